@@ -883,6 +883,176 @@
  */
 #define DS_REMOVE_MID_CMD_ERR_EID 72
 
+/**
+ *  \brief DS Storage Writer Task Terminated Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the DS storage writer child task
+ *  receives an error while waiting for packets from the DS main task.
+ *  The value displayed is the return code from the semaphore take.
+ *  After this event, destination file writes are performed directly
+ *  by the DS main task.
+ */
+#define DS_WRITER_TASK_ERR_EID 73
+
+/**
+ *  \brief DS Flush Destination File Command Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  This event signals the successful execution of a command to flush
+ *  the write buffer for the selected Destination File.
+ *
+ *  This command will succeed if the file table index is valid,
+ *  regardless of whether there was an open file or buffered data.
+ */
+#define DS_FLUSH_FILE_CMD_EID 74
+
+/**
+ *  \brief DS Flush Destination File Command Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event signals the failed execution of a command to flush
+ *  the write buffer for the selected Destination File.
+ *
+ *  The command will fail if the command packet length is invalid
+ *  or if the file table index is invalid.
+ */
+#define DS_FLUSH_FILE_CMD_ERR_EID 75
+
+/**
+ *  \brief DS File Finalizer Task Terminated Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the DS file finalizer child task
+ *  receives an error while waiting for closed files.  The value
+ *  displayed is the return code from the semaphore take.  After this
+ *  event, closed files are finalized directly by the task that closes
+ *  them.
+ */
+#define DS_FINALIZE_TASK_ERR_EID 76
+
+/**
+ *  \brief DS Unfinished Files Recovered Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued at startup when closed destination
+ *  files were still waiting to be finalized at a processor reset.  The
+ *  value displayed is the number of files.  Each file is opened again
+ *  by name so that its header can be updated, then moved and reported.
+ */
+#define DS_FINALIZE_RECOVER_EID 77
+
+/**
+ *  \brief DS Destination File Preallocation Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when storage cannot be reserved for
+ *  a new destination file, or when a preallocated file cannot be
+ *  trimmed to its written length after it is closed.  The value
+ *  displayed is the return code from the file system call.  Packets
+ *  are still written to a file that could not be preallocated.
+ */
+#define DS_FILE_PREALLOC_ERR_EID 78
+
+/**
+ *  \brief DS Destination File Sync Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the data written to a destination
+ *  file cannot be committed to storage as selected by the Destination
+ *  File Table sync policy.  The value displayed is the return code from
+ *  the file system call.  The file remains open and the destination
+ *  remains enabled.
+ */
+#define DS_FILE_SYNC_ERR_EID 79
+
+/**
+ *  \brief DS Destination File Direct I/O Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a destination file that selects
+ *  direct I/O cannot be opened for direct I/O.  The value displayed is
+ *  the return code from the file system call.  Packets are still
+ *  written to the file through the page cache.
+ */
+#define DS_FILE_DIRECT_ERR_EID 80
+
+/**
+ *  \brief DS Get Duplicate Packet Info Command Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  This event signals the successful execution of a command to get
+ *  the duplicate packet info diagnostic packet.
+ */
+#define DS_GET_DEDUP_INFO_CMD_EID 81
+
+/**
+ *  \brief DS Get Duplicate Packet Info Command Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event signals the failed execution of a command to get the
+ *  duplicate packet info diagnostic packet.  The cause of the failure
+ *  is an invalid command packet length.
+ */
+#define DS_GET_DEDUP_INFO_CMD_ERR_EID 82
+
+/**
+ *  \brief DS Unused Pre-opened File Removed Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued at startup when a pre-opened next
+ *  destination file was still waiting to be used at a processor reset.
+ *  The file holds only a header, so it is removed and its name (and
+ *  sequence count) is used again when the next file is created.
+ */
+#define DS_FINALIZE_SPARE_EID 83
+
+/**
+ *  \brief DS Storage Writer Command Dropped Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a command that changes destination
+ *  files cannot be handed to the storage writer child task because the
+ *  writer ring is full.  The command is not run and should be sent again.
+ */
+#define DS_WRITER_CMD_DROP_ERR_EID 84
+
 /**@}*/
 
 #endif
@@ -41,8 +41,24 @@
 #define DS_BY_TIME 2 /**< \brief Action is based on packet timestamp */
 
 #define DS_BY_COUNT     1  /**< \brief Action is based on packet sequence count */
+#define DS_BY_CONTENT   3  /**< \brief Action is based on packet contents (filter type only) */
+#define DS_BY_PKT_RATE  4  /**< \brief Action is based on packets per second (filter type only) */
+#define DS_BY_BYTE_RATE 5  /**< \brief Action is based on bytes per second (filter type only) */
+#define DS_BY_PREDICATE 6  /**< \brief Action is based on packet payload predicates (filter type only) */
 #define DS_EMPTY_STRING "" /**< \brief Empty string buffer entries in DS tables */
 
+#define DS_PREDICATE_EQUAL     1 /**< \brief Predicate matches when the masked packet byte equals Value */
+#define DS_PREDICATE_NOT_EQUAL 2 /**< \brief Predicate matches when the masked packet byte differs from Value */
+
+#define DS_SYNC_NONE     0 /**< \brief Never sync destination file (OS decides when data reaches storage) */
+#define DS_SYNC_ON_CLOSE 1 /**< \brief Sync destination file when it is closed */
+#define DS_SYNC_BY_BYTES 2 /**< \brief Sync destination file every SyncInterval bytes (and when closed) */
+#define DS_SYNC_BY_TIME  3 /**< \brief Sync destination file every SyncInterval seconds (and when closed) */
+
+#define DS_CODEC_NONE    0 /**< \brief Destination file data is not compressed */
+#define DS_CODEC_LZ_FAST 1 /**< \brief LZ block compression, fastest match search */
+#define DS_CODEC_LZ_HIGH 2 /**< \brief LZ block compression, deeper match search for a better ratio */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* DS application table structures                                 */
@@ -53,19 +69,53 @@
 typedef struct
 {
     uint8 FileTableIndex; /**< \brief Index into Destination File Table */
-    uint8 FilterType;     /**< \brief Filter type (packet count or time) */
-
+    uint8 FilterType;     /**< \brief Filter type (packet count, time, content, rate or predicate) */
+
+    /*
+    ** A #DS_BY_CONTENT filter drops packets whose payload repeats the
+    **   last stored payload, but stores at least one packet in every
+    **   Algorithm_X packets (keep-alive).  Algorithm_N only marks the
+    **   filter as used.
+    **
+    ** A #DS_BY_PKT_RATE or #DS_BY_BYTE_RATE filter passes packets while
+    **   a token bucket holds enough packets (or bytes).  The bucket
+    **   refills at Algorithm_N per second up to a burst of Algorithm_X.
+    **   Algorithm_N cannot exceed Algorithm_X, so the rate is at most one
+    **   burst per second.  For #DS_BY_PKT_RATE, Algorithm_O is not used.
+    **   For #DS_BY_BYTE_RATE, N and X count units of 2^Algorithm_O bytes
+    **   (Algorithm_O up to 16, so up to 4 GiB per second), and the burst
+    **   cannot be less than the entry MinLength - a packet larger than
+    **   the burst never passes.
+    **
+    ** A #DS_BY_PREDICATE filter passes packets that match every predicate
+    **   of the packet entry.  Algorithm_N only marks the filter as used.
+    */
     uint16 Algorithm_N; /**< \brief Algorithm value N (pass this many) */
     uint16 Algorithm_X; /**< \brief Algorithm value X (out of this many) */
     uint16 Algorithm_O; /**< \brief Algorithm value O (at this offset) */
 } DS_FilterParms_t;
 
+/** \brief DS Packet Filter Predicate (all zero's = unused) */
+typedef struct
+{
+    uint16 Offset;  /**< \brief Packet byte offset (from the first byte of the packet header) */
+    uint8  Compare; /**< \brief #DS_PREDICATE_EQUAL or #DS_PREDICATE_NOT_EQUAL */
+    uint8  Mask;    /**< \brief Bits of the packet byte to compare */
+    uint8  Value;   /**< \brief Value compared with the masked packet byte */
+    uint8  Spare;   /**< \brief Structure padding */
+} DS_FilterPredicate_t;
+
 /** \brief DS Filter Table Packet Entry */
 typedef struct
 {
     CFE_SB_MsgId_t MessageID; /**< \brief Packet MessageID (may be cmd or tlm) */
 
     DS_FilterParms_t Filter[DS_FILTERS_PER_PACKET]; /**< \brief One entry for each packet destination */
+
+    uint16 MinLength; /**< \brief Shortest packet (bytes), must exceed every Offset and fit every byte rate burst */
+    uint16 Spare;     /**< \brief Structure padding */
+
+    DS_FilterPredicate_t Predicate[DS_PREDICATES_PER_PACKET]; /**< \brief All must match for #DS_BY_PREDICATE */
 } DS_PacketEntry_t;
 
 /** \brief DS Filter Table */
@@ -98,6 +148,25 @@ typedef struct
     uint32 MaxFileAge;  /**< \brief Max file age (seconds) */
 
     uint32 SequenceCount; /**< \brief Sequence count portion of filename */
+    uint32 BufferSize;    /**< \brief Write buffer size (bytes), zero = unbuffered */
+
+    uint16 Preallocate;  /**< \brief Reserve MaxFileSize bytes when the file is created */
+    uint16 SyncPolicy;   /**< \brief Sync policy: #DS_SYNC_NONE, #DS_SYNC_ON_CLOSE, #DS_SYNC_BY_BYTES
+                              or #DS_SYNC_BY_TIME */
+    uint32 SyncInterval; /**< \brief Bytes (#DS_SYNC_BY_BYTES) or seconds (#DS_SYNC_BY_TIME) between syncs */
+
+    uint16 DirectIO;     /**< \brief Write whole blocks around the page cache (requires a write buffer) */
+    uint16 IndexSeconds; /**< \brief Packet seconds between file index samples, zero = no time samples */
+    uint32 IndexBytes;   /**< \brief File bytes between file index samples, zero = no size samples */
+
+    uint16 Codec;         /**< \brief Block compression: #DS_CODEC_NONE, #DS_CODEC_LZ_FAST or #DS_CODEC_LZ_HIGH */
+    uint16 DeltaKeyframe; /**< \brief Packets per message ID between full records when packets are stored
+                                as XOR delta records, zero = store packets as-is */
+
+    uint16 SuperframeSize; /**< \brief Size of the fixed-size records small packets are packed into (bytes),
+                                zero = store packets individually */
+    uint16 SuperframeAge;  /**< \brief Seconds before a partial superframe is written, zero = only when full
+                                or on close */
 } DS_DestFileEntry_t;
 
 /** \brief DS Destination File Table */
@@ -92,7 +92,7 @@ typedef struct
     CFE_SB_MsgId_t MessageID; /**< \brief Message ID of existing entry in Packet Filter Table
                                    \details DS defines Message ID zero to be unused */
     uint16 FilterParmsIndex;  /**< \brief Index into Filter Parms Array */
-    uint16 FilterType;        /**< \brief Filter type (packet count or time) */
+    uint16 FilterType;        /**< \brief Filter type (packet count, time, content, rate or predicate) */
 } DS_FilterTypeCmd_t;
 
 /**
@@ -237,6 +237,19 @@ typedef struct
     uint16 Padding;        /**< \brief Structure Padding on 32-bit boundaries */
 } DS_CloseFileCmd_t;
 
+/**
+ *  \brief Flush Destination File Write Buffer
+ *
+ *  For command details see #DS_FLUSH_FILE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CmdHeader; /**< \brief cFE Software Bus command message header */
+
+    uint16 FileTableIndex; /**< \brief Index into Destination File Table */
+    uint16 Padding;        /**< \brief Structure Padding on 32-bit boundaries */
+} DS_FlushFileCmd_t;
+
 /**
  *  \brief Close All Destination Files
  *
@@ -257,6 +270,16 @@ typedef struct
     CFE_MSG_CommandHeader_t CmdHeader; /**< \brief cFE Software Bus command message header */
 } DS_GetFileInfoCmd_t;
 
+/**
+ *  \brief Get Duplicate Packet Info Command
+ *
+ *  For command details see #DS_GET_DEDUP_INFO_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CmdHeader; /**< \brief cFE Software Bus command message header */
+} DS_GetDedupInfoCmd_t;
+
 /**
  *  \brief Add Message ID To Packet Filter Table
  *
@@ -318,6 +341,30 @@ typedef struct
                                                 */
     uint32 FilteredPktCounter;                 /**< \brief Count of packets discarded (failed filter test) */
     uint32 PassedPktCounter;                   /**< \brief Count of packets that passed filter test */
+    uint32 RateLimitedPktCounter;              /**< \brief Count of packets dropped by a rate limit filter */
+    uint16 LastBatchSize;                      /**< \brief Number of packets read in the most recent pipe batch */
+    uint16 MaxBatchSize;                       /**< \brief Largest number of packets read in a single pipe batch */
+    uint32 BatchCounter;                       /**< \brief Count of pipe batches processed */
+    uint32 BatchPktCounter;                    /**< \brief Count of packets read via pipe batches */
+    uint32 WriterRingBytes;                    /**< \brief Current storage writer ring occupancy (bytes) */
+    uint32 WriterRingPeakBytes;                /**< \brief Storage writer ring high-water mark (bytes) */
+    uint32 WriterDropCounter;                  /**< \brief Count of packets discarded (writer ring full) */
+    uint32 FlushCounter;                       /**< \brief Count of write buffer flushes */
+    uint32 FlushByteCounter;                   /**< \brief Count of bytes written by write buffer flushes */
+    uint32 DirectFlushCounter;                 /**< \brief Count of write buffer flushes written with direct I/O */
+    uint32 RotationCounter;                    /**< \brief Count of new destination files started for a packet */
+    uint32 PreopenHitCounter;                  /**< \brief Count of new destination files that were pre-opened */
+    uint32 LastRotationTime;                   /**< \brief Time to start the most recent new file (microseconds) */
+    uint32 MaxRotationTime;                    /**< \brief Longest time to start a new file (microseconds) */
+    uint16 FinalizeQueueCount;                 /**< \brief Closed files waiting to be finalized */
+    uint16 FinalizeQueuePeak;                  /**< \brief Finalizer queue high-water mark (files) */
+    uint32 FinalizeCounter;                    /**< \brief Count of closed files finalized */
+    uint32 LastFinalizeTime;                   /**< \brief Time from close to finalize of the last file (ms) */
+    uint32 MaxFinalizeTime;                    /**< \brief Longest time from close to finalize (ms) */
+    uint32 SyncCounter;                        /**< \brief Count of destination file syncs */
+    uint32 SyncErrCounter;                     /**< \brief Count of destination file sync errors */
+    uint32 LastSyncTime;                       /**< \brief Time taken by the most recent sync (microseconds) */
+    uint32 MaxSyncTime;                        /**< \brief Longest time taken by a sync (microseconds) */
     char   FilterTblFilename[OS_MAX_PATH_LEN]; /**< \brief Name of filter table file */
 } DS_HkPacket_t;
 
@@ -332,6 +379,12 @@ typedef struct
     uint32 SequenceCount;                    /**< \brief Sequence count portion of filename */
     uint16 EnableState;                      /**< \brief Current file enable/disable state */
     uint16 OpenState;                        /**< \brief Current file open/close state */
+    uint32 BufferedBytes;                    /**< \brief Bytes held in write buffer (not yet in file) */
+    uint32 CodecInBytes;                     /**< \brief Packet bytes written in compressed blocks */
+    uint32 CodecOutBytes;                    /**< \brief File bytes written for compressed blocks */
+    uint32 CodecTime;                        /**< \brief Time spent compressing (microseconds) */
+    uint32 DeltaInBytes;                     /**< \brief Packet bytes written as delta records */
+    uint32 DeltaOutBytes;                    /**< \brief Delta record bytes written (saved = in - out) */
     char   FileName[DS_TOTAL_FNAME_BUFSIZE]; /**< \brief Current filename (path+base+seq+ext) */
 } DS_FileInfo_t;
 
@@ -345,6 +398,25 @@ typedef struct
     DS_FileInfo_t FileInfo[DS_DEST_FILE_CNT]; /**< \brief Current state of destination files */
 } DS_FileInfoPkt_t;
 
+/**
+ * \brief Duplicate packet info for one packet filter table entry
+ */
+typedef struct
+{
+    CFE_SB_MsgId_t MessageID;      /**< \brief Packet filter table entry message ID */
+    uint32         DuplicateCount; /**< \brief Repeated payloads dropped by content filters */
+} DS_DedupInfo_t;
+
+/**
+ * \brief Application duplicate packet info packet
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TlmHeader; /**< \brief cFE Software Bus telemetry message header */
+
+    DS_DedupInfo_t DedupInfo[DS_PACKETS_IN_FILTER_TABLE]; /**< \brief Duplicates per packet filter table entry */
+} DS_DedupInfoPkt_t;
+
 /**
  * \brief Single application file info packet
  */
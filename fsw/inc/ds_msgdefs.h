@@ -610,6 +610,67 @@
  */
 #define DS_REMOVE_MID_CC 18
 
+/**
+ * \brief Flush Destination File Write Buffer
+ *
+ *  \par Description
+ *       This command will write any data held in the write buffer
+ *       for the indicated Destination File to the open file.  The
+ *       file remains open.
+ *
+ *  \par Command Structure
+ *       #DS_FlushFileCmd_t
+ *
+ *  \par Command Verification
+ *       Evidence of success may be found in the following telemetry:
+ *       - #DS_HkPacket_t.CmdAcceptedCounter will increment
+ *       - #DS_HkPacket_t.FlushCounter will increment (if data was buffered)
+ *       - The #DS_FLUSH_FILE_CMD_EID debug event message will be sent
+ *
+ *  \par Error Conditions
+ *       This command can fail for the following reasons:
+ *       - Invalid command packet length
+ *       - Invalid destination file table index
+ *       - Destination file table is not currently loaded
+ *
+ *       Evidence of failure may be found in the following telemetry:
+ *       - #DS_HkPacket_t.CmdRejectedCounter will increment
+ *       - The #DS_FLUSH_FILE_CMD_ERR_EID error event message will be sent
+ *
+ *  \par Criticality
+ *       None
+ */
+#define DS_FLUSH_FILE_CC 19
+
+/**
+ * \brief Get Duplicate Packet Info Packet
+ *
+ *  \par Description
+ *       This command will send the DS Duplicate Packet Info Packet,
+ *       which holds the number of packets each Packet Filter Table
+ *       entry dropped as repeats of the last stored payload.
+ *
+ *  \par Command Structure
+ *       #DS_GetDedupInfoCmd_t
+ *
+ *  \par Command Verification
+ *       Evidence of success may be found in the following telemetry:
+ *       - #DS_HkPacket_t.CmdAcceptedCounter will increment
+ *       - The #DS_DedupInfoPkt_t packet will be sent
+ *
+ *  \par Error Conditions
+ *       This command can fail for the following reasons:
+ *       - Invalid command packet length
+ *
+ *       Evidence of failure may be found in the following telemetry:
+ *       - #DS_HkPacket_t.CmdRejectedCounter will increment
+ *       - The #DS_GET_DEDUP_INFO_CMD_ERR_EID error event message will be sent
+ *
+ *  \par Criticality
+ *       None
+ */
+#define DS_GET_DEDUP_INFO_CC 20
+
 /**\}*/
 
 #endif
\ No newline at end of file
@@ -189,6 +189,21 @@
  */
 #define DS_FILTERS_PER_PACKET 4
 
+/**
+ *  \brief Packet Filter Table -- predicates per packet
+ *
+ *  \par Description:
+ *       This parameter defines the number of payload predicates
+ *       (offset, mask, compare) held by each Packet Filter Table
+ *       entry for use by #DS_BY_PREDICATE filters.  Every predicate
+ *       is evaluated for every packet such a filter examines.
+ *
+ *  \par Limits:
+ *       The number of predicates per packet must be greater than zero
+ *       and not greater than 16.
+ */
+#define DS_PREDICATES_PER_PACKET 4
+
 /**
  *  \brief Common Table File -- descriptor text buffer size
  *
@@ -358,9 +373,10 @@
  *       Set this parameter equal to the number of seconds between
  *       housekeeping request commands.  This number is mission
  *       specific and must match the frequency used by the source
- *       of the command - often the scheduler task.  The value is
- *       used by the DS application to measure file age and also
- *       as a factor in the calculation of file growth rates.
+ *       of the command - often the scheduler task.  File ages and
+ *       growth rates are computed from measured elapsed time; this
+ *       value is only used for the growth rate calculation when no
+ *       elapsed time can be measured.
  *
  *  \par Limits
  *       This parameter must be greater than zero.
@@ -427,6 +443,51 @@
  */
 #define DS_FILE_HEADER_TYPE 1
 
+/**
+ *  \brief File Header Message ID List Size
+ *
+ *  \par Description:
+ *       Number of distinct message IDs listed in the DS file header
+ *       of each Data Storage File.  Files holding more message IDs
+ *       than this are marked as overflowed, and readers must then
+ *       scan the file to find the others.
+ *
+ *  \par Limits:
+ *       The DS app limits this value to be not less than 1 and not
+ *       greater than 256.
+ */
+#define DS_FILE_HEADER_MID_CNT 16
+
+/**
+ *  \brief File Header Message ID Bloom Filter Size
+ *
+ *  \par Description:
+ *       Number of bits in the message ID Bloom filter held in the DS
+ *       file header of each Data Storage File.  Every message ID
+ *       stored in the file sets #DS_FILE_BLOOM_HASH_CNT bits, so a
+ *       message ID with any of its bits clear is not in the file.
+ *       Unlike the message ID list, the filter covers every message
+ *       ID in the file (at the cost of occasional false matches).
+ *
+ *  \par Limits:
+ *       The DS app limits this value to be a multiple of 32, not less
+ *       than 32 and not greater than 4096.
+ */
+#define DS_FILE_BLOOM_BITS 256
+
+/**
+ *  \brief File Header Message ID Bloom Filter Hash Count
+ *
+ *  \par Description:
+ *       Number of filter bits set for each message ID in the file
+ *       header Bloom filter (see #DS_FILE_BLOOM_BITS).
+ *
+ *  \par Limits:
+ *       The DS app limits this value to be not less than 1 and not
+ *       greater than 8.
+ */
+#define DS_FILE_BLOOM_HASH_CNT 3
+
 /**
  *  \brief Move Files to Downlink Directory After Close Selection
  *
@@ -462,6 +523,442 @@
  */
 #define DS_PER_PACKET_PIPE_LIMIT 45
 
+/**
+ *  \brief Application Pipe Batch Limit
+ *
+ *  \par Description:
+ *       This parameter defines the maximum number of packets that
+ *       will be processed per wakeup of the DS main loop.  After a
+ *       packet is received via the blocking pipe read, DS will poll
+ *       the input pipe for additional packets until the pipe is empty
+ *       or this many packets have been processed.  A value of 1
+ *       processes one packet per blocking read.
+ *
+ *  \par Limits:
+ *       The value must be greater than zero and cannot exceed the
+ *       definition of #DS_APP_PIPE_DEPTH.
+ */
+#define DS_APP_PIPE_BATCH_LIMIT 16
+
+/**
+ *  \brief Storage Writer Child Task Name
+ *
+ *  \par Description:
+ *       This parameter defines the name of the DS child task that
+ *       performs all destination file I/O.
+ *
+ *  \par Limits:
+ *       The string length (including string terminator) cannot
+ *       exceed #OS_MAX_API_NAME.  (limit is not verified)
+ */
+#define DS_WRITER_TASK_NAME "DS_WRITER"
+
+/**
+ *  \brief Storage Writer Child Task Stack Size
+ *
+ *  \par Description:
+ *       This parameter defines the stack size (in bytes) of the DS
+ *       storage writer child task.
+ *
+ *  \par Limits:
+ *       The value must be greater than zero.
+ */
+#define DS_WRITER_TASK_STACK_SIZE 16384
+
+/**
+ *  \brief Storage Writer Child Task Priority
+ *
+ *  \par Description:
+ *       This parameter defines the priority of the DS storage writer
+ *       child task.  The child task should normally run at a lower
+ *       priority (larger number) than the DS main task so that pipe
+ *       draining is never held off by file system writes.
+ *
+ *  \par Limits:
+ *       The value must be between 1 and 255.
+ */
+#define DS_WRITER_TASK_PRIORITY 200
+
+/**
+ *  \brief Storage Writer Ring Size
+ *
+ *  \par Description:
+ *       This parameter defines the size (in bytes) of the ring buffer
+ *       used to pass packets that have passed the filter test,
+ *       destination file commands and maintenance from the DS main
+ *       task to the storage writer child task.  Each packet in the
+ *       ring occupies a small record header plus the packet itself,
+ *       rounded up to the Software Bus buffer alignment.  Records that
+ *       do not fit are discarded and counted.
+ *
+ *  \par Limits:
+ *       The value must be a multiple of 4 and large enough to hold
+ *       at least #DS_APP_PIPE_DEPTH typical packets.
+ */
+#define DS_WRITER_RING_SIZE 65536
+
+/**
+ *  \brief Storage Writer Drain Timeout
+ *
+ *  \par Description:
+ *       This parameter defines how long (in milliseconds) DS waits at
+ *       exit for the storage writer child task to run the records
+ *       already in the ring.  If the ring is not empty by then, files
+ *       are left for the storage writer and the CDS is not updated.
+ *
+ *  \par Limits:
+ *       The value must be greater than zero.
+ */
+#define DS_WRITER_DRAIN_TIMEOUT 5000
+
+/**
+ *  \brief File Finalizer Child Task Name
+ *
+ *  \par Description:
+ *       This parameter defines the name of the DS child task that
+ *       updates the header of, closes, moves and reports each
+ *       destination file after it has been closed.
+ *
+ *  \par Limits:
+ *       The string length (including string terminator) cannot
+ *       exceed #OS_MAX_API_NAME.  (limit is not verified)
+ */
+#define DS_FINALIZE_TASK_NAME "DS_FINAL"
+
+/**
+ *  \brief File Finalizer Child Task Stack Size
+ *
+ *  \par Description:
+ *       This parameter defines the stack size (in bytes) of the DS
+ *       file finalizer child task.
+ *
+ *  \par Limits:
+ *       The value must be greater than zero.
+ */
+#define DS_FINALIZE_TASK_STACK_SIZE 16384
+
+/**
+ *  \brief File Finalizer Child Task Priority
+ *
+ *  \par Description:
+ *       This parameter defines the priority of the DS file finalizer
+ *       child task.  The child task should normally run at a lower
+ *       priority (larger number) than the storage writer child task
+ *       so that moving finished files never delays packet storage.
+ *
+ *  \par Limits:
+ *       The value must be between 1 and 255.
+ */
+#define DS_FINALIZE_TASK_PRIORITY 210
+
+/**
+ *  \brief File Finalizer Queue Depth
+ *
+ *  \par Description:
+ *       This parameter defines how many closed destination files may
+ *       wait for the file finalizer child task.  The queue is kept in
+ *       the Critical Data Store so that files waiting at a processor
+ *       reset are still finalized; each queue entry uses its own CDS
+ *       area.  When the queue is full, a closed file is kept by its
+ *       destination (one file per destination) until there is room,
+ *       and a further close of that destination waits for the
+ *       finalizer, so the depth should cover the files closed while
+ *       the slowest file is being finalized.
+ *
+ *  \par Limits:
+ *       The value must be at least twice #DS_DEST_FILE_CNT, so that two
+ *       close all commands (or a close all and a round of file size or
+ *       age limits) can be queued back to back.
+ */
+#define DS_FINALIZE_QUEUE_DEPTH 40
+
+/**
+ *  \brief Destination File Write Buffer -- maximum size
+ *
+ *  \par Description:
+ *       This parameter defines the largest write buffer (in bytes)
+ *       that a Destination File Table entry may request.  Packets
+ *       for a buffered destination are collected in RAM and written
+ *       to the file in a single call when the buffer fills, when the
+ *       file is closed, or by command.  One buffer of this size is
+ *       reserved for every destination file.
+ *
+ *  \par Limits:
+ *       The value must be greater than zero and a multiple of 4.
+ *       Table entries may request any size up to this limit, or
+ *       zero to write each packet directly to the file.
+ */
+#define DS_WRITE_BUFFER_MAX_SIZE 4096
+
+/**
+ *  \brief Destination File Pre-open Threshold
+ *
+ *  \par Description:
+ *       This parameter defines how full (as a percentage of the
+ *       maximum file size or maximum file age) an open destination
+ *       file must be before the next file is created in advance by
+ *       the maintenance scheduler.  Switching to a pre-opened file
+ *       only requires the file handle to be exchanged, so the packet
+ *       that starts the new file is not delayed by the file create
+ *       and file header writes.  Time based filenames of pre-opened
+ *       files carry the time the file was created in advance.  The
+ *       name of each pre-opened file is kept in the Critical Data
+ *       Store (one area per destination) until the file is used, so
+ *       a file left unused by a processor reset is removed at startup.
+ *
+ *  \par Limits:
+ *       The value must be between 0 and 100.  Zero disables
+ *       pre-opening of destination files.
+ */
+#define DS_FILE_PREOPEN_PERCENT 75
+
+/**
+ *  \brief Destination File Preallocation Selection
+ *
+ *  \par Description:
+ *       Set this parameter to enable the code that reserves storage
+ *       for destination files.  When a Destination File Table entry
+ *       selects preallocation, the full maximum file size is reserved
+ *       when the file is created, so the file system does not have
+ *       to extend the file (and fragment the volume) as packets are
+ *       written.  Storage is reserved beyond the end of file, so the
+ *       file length still only counts the bytes written (a file left
+ *       open by a reset holds no padding).  Unused storage is released
+ *       when the file is closed.  Storage is reserved through the Linux
+ *       fallocate() call (FALLOC_FL_KEEP_SIZE) and released through the
+ *       POSIX truncate() call on the host path of the file.  On hosts
+ *       without FALLOC_FL_KEEP_SIZE the setting has no effect and
+ *       preallocation is rejected by table validation.
+ *
+ *  \par Limits
+ *       This parameter must be set to one of the following:
+ *       true  = preallocation available if the host has FALLOC_FL_KEEP_SIZE (Linux)
+ *       false = preallocation rejected by table validation
+ */
+#define DS_FILE_PREALLOCATE false
+
+/**
+ *  \brief Destination File Sync Selection
+ *
+ *  \par Description:
+ *       Set this parameter to enable the code that commits destination
+ *       file data to storage as selected by the Destination File Table
+ *       sync policy.  A file may be synced when it is closed, after a
+ *       number of bytes or after a number of seconds.  Without a sync
+ *       policy, data reaches storage whenever the operating system
+ *       decides to write it.  Files are synced through the POSIX
+ *       fsync() call on the host path of the file.
+ *
+ *  \par Limits
+ *       This parameter must be set to one of the following:
+ *       true  = sync policies available (POSIX file system required)
+ *       false = any policy except DS_SYNC_NONE rejected by table validation
+ */
+#define DS_FILE_SYNC false
+
+/**
+ *  \brief Destination File Direct I/O Selection
+ *
+ *  \par Description:
+ *       Set this parameter to enable the code that writes destination
+ *       files around the operating system page cache.  DS never reads
+ *       destination files back, so for a high rate destination the
+ *       page cache only adds a copy of the data and memory pressure.
+ *       When a Destination File Table entry selects direct I/O, the
+ *       write buffer is written to the file in whole aligned blocks
+ *       (the last block is padded, and the file is trimmed to the
+ *       bytes actually written when it is closed).  Files are written
+ *       through the POSIX O_DIRECT flag on the host path of the file.
+ *       O_DIRECT is a Linux extension - on hosts without it the
+ *       setting has no effect and direct I/O is rejected by table
+ *       validation, as if this parameter were false.
+ *
+ *  \par Limits
+ *       This parameter must be set to one of the following:
+ *       true  = direct I/O available if the host has O_DIRECT (Linux)
+ *       false = direct I/O rejected by table validation
+ */
+#define DS_FILE_DIRECT_IO false
+
+/**
+ *  \brief Destination File Direct I/O Block Size
+ *
+ *  \par Description:
+ *       This parameter defines the alignment (in bytes) of the file
+ *       offsets, lengths and memory addresses used for direct I/O.
+ *       It must be at least the logical block size of the storage
+ *       device (the file system block size is safest).  Write buffer
+ *       sizes for direct I/O destinations must be a multiple of it.
+ *
+ *  \par Limits:
+ *       The value must be a power of two, at least 512.  If direct
+ *       I/O is available, #DS_WRITE_BUFFER_MAX_SIZE must be a multiple
+ *       of this value.
+ */
+#define DS_DIRECT_IO_BLOCK_SIZE 4096
+
+/**
+ *  \brief Destination File Positional Header Update Selection
+ *
+ *  \par Description:
+ *       Set this parameter to update the header of a closed destination
+ *       file with a single positional write through the POSIX pwrite()
+ *       call on the host path of the file.  Otherwise the header is
+ *       updated through a new OSAL file handle (open, seek, write and
+ *       close), which works with any OSAL file system.
+ *
+ *  \par Limits
+ *       This parameter must be set to one of the following:
+ *       true  = positional header update (POSIX file system required)
+ *       false = header update through OSAL only
+ */
+#define DS_FILE_POSITIONAL_WRITE false
+
+/**
+ *  \brief Destination File Index Size
+ *
+ *  \par Description:
+ *       This parameter defines the maximum number of (packet time,
+ *       file offset) samples in the index written at the end of a
+ *       destination file, which bounds the index size.  Samples are
+ *       taken at the spacing selected in the Destination File Table
+ *       entry; when the index fills up, every other sample is dropped
+ *       and the spacing is doubled.  The index is only written with
+ *       cFE file headers (see #DS_FILE_HEADER_TYPE), which hold its
+ *       file offset.
+ *
+ *  \par Limits:
+ *       The DS app limits this value to be not less than 2 and not
+ *       greater than 1024.
+ */
+#define DS_FILE_INDEX_MAX_CNT 64
+
+/**
+ *  \brief Destination File Compression Selection
+ *
+ *  \par Description:
+ *       Set this parameter to enable the block compression codecs that
+ *       a Destination File Table entry may select.  Each write buffer
+ *       flush is compressed into a self-contained block with its own
+ *       frame (sync word, lengths and CRC), so a damaged block only
+ *       loses the packets it holds.  Blocks that do not get smaller
+ *       are stored uncompressed.
+ *
+ *  \par Limits
+ *       This parameter must be set to one of the following:
+ *       true  = compression available
+ *       false = compression rejected by table validation
+ */
+#define DS_FILE_COMPRESSION true
+
+/**
+ *  \brief Delta Record Message ID Count
+ *
+ *  \par Description:
+ *       This parameter defines how many message IDs each destination
+ *       remembers the last stored packet of, for destinations that
+ *       store packets as XOR delta records (see the Destination File
+ *       Table DeltaKeyframe field).  When more message IDs are written
+ *       to a file, the oldest remembered one is replaced and its next
+ *       packet is stored in full.
+ *
+ *  \par Limits:
+ *       The DS app limits this value to be not less than 1 and not
+ *       greater than 32.
+ */
+#define DS_DELTA_MID_CNT 4
+
+/**
+ *  \brief Delta Record Packet Size
+ *
+ *  \par Description:
+ *       This parameter defines the largest packet (in bytes) that may
+ *       be stored as a delta record.  Larger packets are always stored
+ *       in full.  Memory used is #DS_DEST_FILE_CNT times
+ *       #DS_DELTA_MID_CNT times this value.
+ *
+ *  \par Limits:
+ *       The DS app limits this value to be not less than 16 and not
+ *       greater than 65535.
+ */
+#define DS_DELTA_MAX_PKT_SIZE 512
+
+/**
+ *  \brief Superframe Maximum Size
+ *
+ *  \par Description:
+ *       This parameter defines the largest superframe (in bytes) a
+ *       destination may pack small packets into (see the Destination
+ *       File Table SuperframeSize field).  Set it to the downlink
+ *       segment size.  Memory used is #DS_DEST_FILE_CNT times this
+ *       value.
+ *
+ *  \par Limits:
+ *       The DS app limits this value to be not less than 64 and not
+ *       greater than 65535.
+ */
+#define DS_SUPERFRAME_MAX_SIZE 2048
+
+/**
+ *  \brief Table Update Check Period
+ *
+ *  \par Description:
+ *       This parameter defines the interval (in milliseconds) between
+ *       checks for pending Destination File Table and Packet Filter
+ *       Table updates.  The DS main loop will not block for longer
+ *       than this while waiting for packets.
+ *
+ *  \par Limits:
+ *       The value must be greater than zero.
+ */
+#define DS_SCHED_TABLE_PERIOD 1000
+
+/**
+ *  \brief Write Buffer Flush Period
+ *
+ *  \par Description:
+ *       This parameter defines the interval (in milliseconds) between
+ *       flushes of destination file write buffers that have not been
+ *       filled.  It limits how long packets may be held in RAM for a
+ *       destination with a low data rate.
+ *
+ *  \par Limits:
+ *       The value must be greater than zero.
+ */
+#define DS_SCHED_FLUSH_PERIOD 5000
+
+/**
+ *  \brief Critical Data Store Commit Period
+ *
+ *  \par Description:
+ *       This parameter defines the interval (in milliseconds) between
+ *       commits of changed destination sequence counts to the Critical
+ *       Data Store.  Counts advanced by new files are held until the
+ *       next commit, close all command or application exit (a reserve
+ *       of counts is kept ahead, see #DS_CDS_SEQ_RESERVE).  Changes
+ *       made by command or by table update are committed at once.
+ *
+ *  \par Limits:
+ *       The value must be greater than zero.
+ */
+#define DS_SCHED_CDS_PERIOD 5000
+
+/**
+ *  \brief Critical Data Store Sequence Count Reservation
+ *
+ *  \par Description:
+ *       This parameter defines how many filename sequence counts are
+ *       reserved in the Critical Data Store each time a new count file
+ *       forces a commit.  Files created within the reservation do not
+ *       write to the CDS.  A sequence count is never reused after a
+ *       processor reset, but up to this many counts may be skipped.
+ *       Zero commits the exact sequence count for every new file.
+ *
+ *  \par Limits:
+ *       The value must be less than #DS_MAX_SEQUENCE_COUNT.
+ */
+#define DS_CDS_SEQ_RESERVE 16
+
 /**\}*/
 
 #endif
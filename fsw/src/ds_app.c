@@ -38,6 +38,8 @@
 #include "ds_cmds.h"
 #include "ds_file.h"
 #include "ds_table.h"
+#include "ds_writer.h"
+#include "ds_finalize.h"
 #include "ds_events.h"
 #include "ds_msgdefs.h"
 #include "ds_version.h"
@@ -63,6 +65,7 @@ void DS_AppMain(void)
     CFE_SB_Buffer_t *BufPtr    = NULL;
     int32            Result    = CFE_SUCCESS;
     uint32           RunStatus = CFE_ES_RunStatus_APP_RUN;
+    int32            i         = 0;
 
     /*
     ** Performance Log (start time counter)...
@@ -98,7 +101,7 @@ void DS_AppMain(void)
         /*
         ** Wait for next Software Bus message...
         */
-        Result = CFE_SB_ReceiveBuffer(&BufPtr, DS_AppData.InputPipe, DS_SB_TIMEOUT);
+        Result = CFE_SB_ReceiveBuffer(&BufPtr, DS_AppData.InputPipe, DS_AppSchedTimeout());
 
         /*
         ** Performance Log (start time counter)...
@@ -110,20 +113,16 @@ void DS_AppMain(void)
         */
         if (Result == CFE_SUCCESS)
         {
-            DS_AppProcessMsg(BufPtr);
+            DS_AppProcessBatch(BufPtr);
+            DS_AppSchedRun();
         }
-        else if (Result == CFE_SB_TIME_OUT)
+        else if ((Result == CFE_SB_TIME_OUT) || (Result == CFE_SB_NO_MESSAGE))
         {
             /*
-             * Process data storage file age limits and check for
-             * table updates.  This is usually done during the
-             * housekeeping cycle, but if housekeeping requests are
-             * coming at a rate slower than 1Hz, we perform the operations
-             * here.
-             */
-            DS_FileTestAge(DS_SECS_PER_TIMEOUT);
-            DS_TableManageDestFile();
-            DS_TableManageFilter();
+            ** Woke for a maintenance deadline (the receive is a poll
+            **   when a deadline has already passed)...
+            */
+            DS_AppSchedRun();
         }
         else
         {
@@ -140,6 +139,48 @@ void DS_AppMain(void)
         */
     }
 
+    /*
+    ** No more messages are read - let the storage writer finish the
+    **   records already in the ring before files are touched here...
+    */
+    if (DS_WriterDrain())
+    {
+        DS_WriterLock();
+
+        /*
+        ** Close open destination files - writes out data held in write
+        **   buffers and partly filled superframes...
+        */
+        for (i = 0; i < DS_DEST_FILE_CNT; i++)
+        {
+            if (OS_ObjectIdDefined(DS_AppData.FileStatus[i].FileHandle))
+            {
+                DS_FileCloseDest(i);
+            }
+
+            DS_FileCloseSpare(i);
+        }
+
+        /*
+        ** Closed files still waiting for room go to the finalizer last...
+        */
+        for (i = 0; i < DS_DEST_FILE_CNT; i++)
+        {
+            DS_FileRetryFinalize(i, true);
+        }
+
+        /*
+        ** Commit pending Critical Data Store (CDS) changes before exit...
+        */
+        DS_TableCommitCDS();
+
+        DS_WriterUnlock();
+    }
+    else
+    {
+        CFE_ES_WriteToSysLog("DS storage writer ring not empty at exit, CDS not updated\n");
+    }
+
     /*
     ** Check for "fatal" process error...
     */
@@ -191,7 +232,8 @@ int32 DS_AppInitialize(void)
     */
     for (i = 0; i < DS_DEST_FILE_CNT; i++)
     {
-        DS_AppData.FileStatus[i].FileHandle = OS_OBJECT_ID_UNDEFINED;
+        DS_AppData.FileStatus[i].FileHandle  = OS_OBJECT_ID_UNDEFINED;
+        DS_AppData.FileStatus[i].SpareHandle = OS_OBJECT_ID_UNDEFINED;
     }
 
     /*
@@ -262,6 +304,30 @@ int32 DS_AppInitialize(void)
         Result = DS_TableCreateCDS();
     }
 
+    /*
+    ** Start the storage writer child task...
+    */
+    if (Result == CFE_SUCCESS)
+    {
+        Result = DS_WriterInit();
+    }
+
+    /*
+    ** Start the file finalizer child task...
+    */
+    if (Result == CFE_SUCCESS)
+    {
+        Result = DS_FinalizeInit();
+    }
+
+    /*
+    ** Start the maintenance deadline clock...
+    */
+    if (Result == CFE_SUCCESS)
+    {
+        DS_AppSchedInit();
+    }
+
     /*
     ** Generate application startup event message...
     */
@@ -275,6 +341,57 @@ int32 DS_AppInitialize(void)
     return Result;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Process a batch of Software Bus messages                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_AppProcessBatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    CFE_SB_Buffer_t *PollBufPtr = NULL;
+    uint16           BatchSize  = 0;
+    int32            Result     = CFE_SUCCESS;
+
+    /*
+    ** Process the packet from the blocking read...
+    */
+    DS_AppProcessMsg(BufPtr);
+    BatchSize++;
+
+    /*
+    ** Drain whatever else is already waiting in the pipe, up to the batch limit...
+    */
+    while (BatchSize < DS_APP_PIPE_BATCH_LIMIT)
+    {
+        Result = CFE_SB_ReceiveBuffer(&PollBufPtr, DS_AppData.InputPipe, CFE_SB_POLL);
+
+        if (Result != CFE_SUCCESS)
+        {
+            /*
+            ** Pipe is empty (or has failed) - any pipe error will be
+            ** reported by the next blocking read in the main loop...
+            */
+            break;
+        }
+
+        DS_AppProcessMsg(PollBufPtr);
+        BatchSize++;
+    }
+
+    /*
+    ** Update pipe batch statistics once per batch...
+    */
+    DS_AppData.LastBatchSize = BatchSize;
+    DS_AppData.BatchCounter++;
+    DS_AppData.BatchPktCounter += BatchSize;
+
+    if (BatchSize > DS_AppData.MaxBatchSize)
+    {
+        DS_AppData.MaxBatchSize = BatchSize;
+    }
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Process Software Bus messages                                   */
@@ -343,6 +460,7 @@ void DS_AppProcessMsg(const CFE_SB_Buffer_t *BufPtr)
 void DS_AppProcessCmd(const CFE_SB_Buffer_t *BufPtr)
 {
     CFE_MSG_FcnCode_t CommandCode = 0;
+    DS_WriterRecord_t Record;
 
     CFE_MSG_GetFcnCode(&BufPtr->Msg, &CommandCode);
 
@@ -390,6 +508,80 @@ void DS_AppProcessCmd(const CFE_SB_Buffer_t *BufPtr)
             DS_CmdSetFilterParms(BufPtr);
             break;
 
+        /*
+        ** Destination file commands are run by the storage writer...
+        */
+        case DS_SET_DEST_TYPE_CC:
+        case DS_SET_DEST_STATE_CC:
+        case DS_SET_DEST_PATH_CC:
+        case DS_SET_DEST_BASE_CC:
+        case DS_SET_DEST_EXT_CC:
+        case DS_SET_DEST_SIZE_CC:
+        case DS_SET_DEST_AGE_CC:
+        case DS_SET_DEST_COUNT_CC:
+        case DS_CLOSE_FILE_CC:
+        case DS_GET_FILE_INFO_CC:
+        case DS_CLOSE_ALL_CC:
+        case DS_FLUSH_FILE_CC:
+            memset(&Record, 0, sizeof(Record));
+            Record.Type = DS_WRITER_COMMAND;
+
+            if (DS_WriterSubmit(&Record, BufPtr) == false)
+            {
+                CFE_EVS_SendEvent(DS_WRITER_CMD_DROP_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Command dropped, storage writer ring full: CC = %d", CommandCode);
+
+                DS_AppData.CmdRejectedCounter++;
+            }
+            break;
+
+        /*
+        ** Add message ID to filter table...
+        */
+        case DS_ADD_MID_CC:
+            DS_CmdAddMID(BufPtr);
+            break;
+
+        /*
+        ** Remove message ID from filter table...
+        */
+        case DS_REMOVE_MID_CC:
+            DS_CmdRemoveMID(BufPtr);
+            break;
+
+        /*
+        ** Get duplicate packet info telemetry packet...
+        */
+        case DS_GET_DEDUP_INFO_CC:
+            DS_CmdGetDedupInfo(BufPtr);
+            break;
+
+        /*
+        ** DS application command with unknown command code...
+        */
+        default:
+            CFE_EVS_SendEvent(DS_CMD_CODE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Invalid command code: MID = 0x%08X, CC = %d", DS_CMD_MID, CommandCode);
+
+            DS_AppData.CmdRejectedCounter++;
+            break;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Process destination file commands (writer lock held)            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_AppProcessFileCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    CFE_MSG_FcnCode_t CommandCode = 0;
+
+    CFE_MSG_GetFcnCode(&BufPtr->Msg, &CommandCode);
+
+    switch (CommandCode)
+    {
         /*
         ** Set destination file filename type (time vs count)...
         */
@@ -461,34 +653,27 @@ void DS_AppProcessCmd(const CFE_SB_Buffer_t *BufPtr)
             break;
 
         /*
-        ** Add message ID to filter table...
-        */
-        case DS_ADD_MID_CC:
-            DS_CmdAddMID(BufPtr);
-            break;
-
-        /*
-        ** Remove message ID from filter table...
+        ** Close all destination files (next packet will re-open)...
         */
-        case DS_REMOVE_MID_CC:
-            DS_CmdRemoveMID(BufPtr);
+        case DS_CLOSE_ALL_CC:
+            DS_CmdCloseAll(BufPtr);
             break;
 
         /*
-        ** Close all destination files (next packet will re-open)...
+        ** Flush destination file write buffer...
         */
-        case DS_CLOSE_ALL_CC:
-            DS_CmdCloseAll(BufPtr);
+        case DS_FLUSH_FILE_CC:
+            DS_CmdFlushFile(BufPtr);
             break;
 
         /*
-        ** DS application command with unknown command code...
+        ** Only destination file commands are handed to the storage writer...
         */
         default:
             CFE_EVS_SendEvent(DS_CMD_CODE_ERR_EID, CFE_EVS_EventType_ERROR,
                               "Invalid command code: MID = 0x%08X, CC = %d", DS_CMD_MID, CommandCode);
 
-            DS_AppData.CmdRejectedCounter++;
+            DS_AppData.FileCmdRejectedCounter++;
             break;
     }
 }
@@ -501,11 +686,13 @@ void DS_AppProcessCmd(const CFE_SB_Buffer_t *BufPtr)
 
 void DS_AppProcessHK(void)
 {
-    DS_HkPacket_t  HkPacket;
-    int32          i                                              = 0;
-    int32          Status                                         = 0;
-    char           FilterTblName[CFE_MISSION_TBL_MAX_NAME_LENGTH] = {0};
-    CFE_TBL_Info_t FilterTblInfo;
+    DS_HkPacket_t     HkPacket;
+    int32             Status                                         = 0;
+    uint32            Now                                            = 0;
+    char              FilterTblName[CFE_MISSION_TBL_MAX_NAME_LENGTH] = {0};
+    CFE_TBL_Info_t    FilterTblInfo;
+    DS_WriterRecord_t Record;
+    DS_WriterHk_t     WriterHk;
 
     memset(&HkPacket, 0, sizeof(HkPacket));
 
@@ -515,21 +702,19 @@ void DS_AppProcessHK(void)
     CFE_MSG_Init(&HkPacket.TlmHeader.Msg, CFE_SB_ValueToMsgId(DS_HK_TLM_MID), sizeof(DS_HkPacket_t));
 
     /*
-    ** Process data storage file age limits...
+    ** Counters updated by the storage writer are read from the snapshot
+    **   it publishes after each command and maintenance record...
     */
-    DS_FileTestAge(DS_SECS_PER_HK_CYCLE);
+    OS_MutSemTake(DS_AppData.WriterHkMutexId);
+    WriterHk = DS_AppData.WriterHk;
+    OS_MutSemGive(DS_AppData.WriterHkMutexId);
 
     /*
-    ** Take this opportunity to check for table updates...
+    ** Copy application command counters to housekeeping telemetry packet
+    **   (destination file commands are counted by the storage writer)...
     */
-    DS_TableManageDestFile();
-    DS_TableManageFilter();
-
-    /*
-    ** Copy application command counters to housekeeping telemetry packet...
-    */
-    HkPacket.CmdAcceptedCounter = DS_AppData.CmdAcceptedCounter;
-    HkPacket.CmdRejectedCounter = DS_AppData.CmdRejectedCounter;
+    HkPacket.CmdAcceptedCounter = DS_AppData.CmdAcceptedCounter + WriterHk.FileCmdAcceptedCounter;
+    HkPacket.CmdRejectedCounter = DS_AppData.CmdRejectedCounter + WriterHk.FileCmdRejectedCounter;
 
     /*
     ** Copy packet storage counters to housekeeping telemetry packet...
@@ -539,19 +724,80 @@ void DS_AppProcessHK(void)
     HkPacket.FilteredPktCounter = DS_AppData.FilteredPktCounter;
     HkPacket.PassedPktCounter   = DS_AppData.PassedPktCounter;
 
+    HkPacket.RateLimitedPktCounter = DS_AppData.RateLimitedPktCounter;
+
+    /*
+    ** Copy pipe batch statistics to housekeeping telemetry packet...
+    */
+    HkPacket.LastBatchSize   = DS_AppData.LastBatchSize;
+    HkPacket.MaxBatchSize    = DS_AppData.MaxBatchSize;
+    HkPacket.BatchCounter    = DS_AppData.BatchCounter;
+    HkPacket.BatchPktCounter = DS_AppData.BatchPktCounter;
+
+    /*
+    ** Copy storage writer ring statistics to housekeeping telemetry packet
+    **   (peak and drops are only updated by the producer, this task)...
+    */
+    HkPacket.WriterRingBytes     = DS_WriterRingBytesUsed();
+    HkPacket.WriterRingPeakBytes = DS_AppData.WriterRing.PeakBlocks * DS_WRITER_BLOCK_SIZE;
+    HkPacket.WriterDropCounter   = DS_AppData.WriterRing.DropCounter;
+
+    /*
+    ** Copy write buffer flush statistics to housekeeping telemetry packet...
+    */
+    HkPacket.FlushCounter       = WriterHk.FlushCounter;
+    HkPacket.FlushByteCounter   = WriterHk.FlushByteCounter;
+    HkPacket.DirectFlushCounter = WriterHk.DirectFlushCounter;
+
+    /*
+    ** Copy file rotation statistics to housekeeping telemetry packet...
+    */
+    HkPacket.RotationCounter   = WriterHk.RotationCounter;
+    HkPacket.PreopenHitCounter = WriterHk.PreopenHitCounter;
+    HkPacket.LastRotationTime  = WriterHk.LastRotationTime;
+    HkPacket.MaxRotationTime   = WriterHk.MaxRotationTime;
+
+    /*
+    ** Finalizer statistics are updated by the file finalizer task...
+    */
+    OS_MutSemTake(DS_AppData.FinalizeMutexId);
+
+    /*
+    ** Copy file finalizer statistics to housekeeping telemetry packet...
+    */
+    HkPacket.FinalizeQueueCount = DS_AppData.FinalizeQueue.Count;
+    HkPacket.FinalizeQueuePeak  = DS_AppData.FinalizePeakCount;
+    HkPacket.FinalizeCounter    = DS_AppData.FinalizeCounter;
+    HkPacket.LastFinalizeTime   = DS_AppData.LastFinalizeTime;
+    HkPacket.MaxFinalizeTime    = DS_AppData.MaxFinalizeTime;
+
     /*
-    ** Copy file I/O counters to housekeeping telemetry packet...
+    ** Copy file sync statistics to housekeeping telemetry packet...
+    */
+    HkPacket.SyncCounter    = DS_AppData.SyncCounter;
+    HkPacket.SyncErrCounter = DS_AppData.SyncErrCounter;
+    HkPacket.LastSyncTime   = DS_AppData.LastSyncTime;
+    HkPacket.MaxSyncTime    = DS_AppData.MaxSyncTime;
+
+    /*
+    ** Copy file header update counters to housekeeping telemetry packet...
     */
-    HkPacket.FileWriteCounter     = DS_AppData.FileWriteCounter;
-    HkPacket.FileWriteErrCounter  = DS_AppData.FileWriteErrCounter;
     HkPacket.FileUpdateCounter    = DS_AppData.FileUpdateCounter;
     HkPacket.FileUpdateErrCounter = DS_AppData.FileUpdateErrCounter;
 
+    OS_MutSemGive(DS_AppData.FinalizeMutexId);
+
+    /*
+    ** Copy file write counters to housekeeping telemetry packet...
+    */
+    HkPacket.FileWriteCounter    = WriterHk.FileWriteCounter;
+    HkPacket.FileWriteErrCounter = WriterHk.FileWriteErrCounter;
+
     /*
     ** Copy configuration table counters to housekeeping telemetry packet...
     */
-    HkPacket.DestTblLoadCounter   = DS_AppData.DestTblLoadCounter;
-    HkPacket.DestTblErrCounter    = DS_AppData.DestTblErrCounter;
+    HkPacket.DestTblLoadCounter   = WriterHk.DestTblLoadCounter;
+    HkPacket.DestTblErrCounter    = WriterHk.DestTblErrCounter;
     HkPacket.FilterTblLoadCounter = DS_AppData.FilterTblLoadCounter;
     HkPacket.FilterTblErrCounter  = DS_AppData.FilterTblErrCounter;
 
@@ -561,13 +807,19 @@ void DS_AppProcessHK(void)
     HkPacket.AppEnableState = DS_AppData.AppEnableState;
 
     /*
-    ** Compute file growth rate from number of bytes since last HK request...
+    ** Have the storage writer compute file growth rates from the number
+    **   of bytes since the last HK request...
     */
-    for (i = 0; i < DS_DEST_FILE_CNT; i++)
-    {
-        DS_AppData.FileStatus[i].FileRate   = DS_AppData.FileStatus[i].FileGrowth / DS_SECS_PER_HK_CYCLE;
-        DS_AppData.FileStatus[i].FileGrowth = 0;
-    }
+    Now = DS_AppSchedClock();
+
+    memset(&Record, 0, sizeof(Record));
+    Record.Type          = DS_WRITER_WORK;
+    Record.Work          = DS_WRITER_WORK_RATE;
+    Record.RateMillisecs = Now - DS_AppData.Sched.HkTime;
+
+    DS_AppData.Sched.HkTime = Now;
+
+    DS_WriterSubmit(&Record, NULL);
 
     /* Get the filter table info, put the file name in the hk pkt. */
     Status = snprintf(FilterTblName, CFE_MISSION_TBL_MAX_NAME_LENGTH, "DS.%s", DS_FILTER_TBL_NAME);
@@ -607,6 +859,267 @@ void DS_AppProcessHK(void)
     CFE_SB_TransmitMsg(&HkPacket.TlmHeader.Msg, true);
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Maintenance scheduler clock                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_AppSchedClock(void)
+{
+    CFE_TIME_SysTime_t MissionTime = CFE_TIME_GetMET();
+
+    return (MissionTime.Seconds * 1000) + (CFE_TIME_Sub2MicroSecs(MissionTime.Subseconds) / 1000);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Initialize maintenance deadlines                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_AppSchedInit(void)
+{
+    uint32 Now = DS_AppSchedClock();
+
+    DS_AppData.Sched.AgeTime       = Now;
+    DS_AppData.Sched.AgeDeadline   = Now;
+    DS_AppData.Sched.TableDeadline = Now;
+    DS_AppData.Sched.FlushDeadline = Now + DS_SCHED_FLUSH_PERIOD;
+    DS_AppData.Sched.CDSDeadline   = Now + DS_SCHED_CDS_PERIOD;
+    DS_AppData.Sched.HkTime        = Now;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Time until the next maintenance deadline                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_AppSchedTimeout(void)
+{
+    uint32 Now     = DS_AppSchedClock();
+    int32  Timeout = DS_SB_TIMEOUT;
+
+    if ((int32)(DS_AppData.Sched.AgeDeadline - Now) < Timeout)
+    {
+        Timeout = (int32)(DS_AppData.Sched.AgeDeadline - Now);
+    }
+
+    if ((int32)(DS_AppData.Sched.TableDeadline - Now) < Timeout)
+    {
+        Timeout = (int32)(DS_AppData.Sched.TableDeadline - Now);
+    }
+
+    if ((int32)(DS_AppData.Sched.FlushDeadline - Now) < Timeout)
+    {
+        Timeout = (int32)(DS_AppData.Sched.FlushDeadline - Now);
+    }
+
+    if ((int32)(DS_AppData.Sched.CDSDeadline - Now) < Timeout)
+    {
+        Timeout = (int32)(DS_AppData.Sched.CDSDeadline - Now);
+    }
+
+    if (Timeout <= 0)
+    {
+        /*
+        ** A deadline has passed - check the pipe without waiting...
+        */
+        Timeout = CFE_SB_POLL;
+    }
+
+    return Timeout;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Run maintenance that is due                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_AppSchedRun(void)
+{
+    uint32            Now      = DS_AppSchedClock();
+    bool              AgeDue   = ((int32)(DS_AppData.Sched.AgeDeadline - Now) <= 0);
+    bool              TableDue = ((int32)(DS_AppData.Sched.TableDeadline - Now) <= 0);
+    bool              FlushDue = ((int32)(DS_AppData.Sched.FlushDeadline - Now) <= 0);
+    bool              CDSDue   = ((int32)(DS_AppData.Sched.CDSDeadline - Now) <= 0);
+    bool              Queued   = false;
+    DS_WriterRecord_t Record;
+
+    /*
+    ** Most packet batches find no deadline due...
+    */
+    if (AgeDue || TableDue || FlushDue || CDSDue)
+    {
+        memset(&Record, 0, sizeof(Record));
+        Record.Type = DS_WRITER_WORK;
+
+        if (AgeDue)
+        {
+            /*
+            ** Charge open files with the whole seconds that have elapsed,
+            **   carrying the fraction of a second to the next charge...
+            */
+            Record.Work |= DS_WRITER_WORK_AGE;
+            Record.AgeSeconds = (Now - DS_AppData.Sched.AgeTime) / 1000;
+        }
+
+        if (TableDue)
+        {
+            Record.Work |= DS_WRITER_WORK_DEST_TBL;
+        }
+
+        if (FlushDue)
+        {
+            Record.Work |= DS_WRITER_WORK_FLUSH;
+        }
+
+        if (CDSDue)
+        {
+            Record.Work |= DS_WRITER_WORK_CDS;
+        }
+
+        /*
+        ** Destination files belong to the storage writer - a full ring
+        **   skips this maintenance until the next deadline...
+        */
+        Queued = DS_WriterSubmit(&Record, NULL);
+
+        if (AgeDue && Queued)
+        {
+            DS_AppData.Sched.AgeTime += Record.AgeSeconds * 1000;
+            DS_AppData.Sched.AgeDeadline = DS_AppData.Sched.AgeTime + DS_SCHED_AGE_PERIOD;
+        }
+        else if (AgeDue)
+        {
+            /*
+            ** Time not charged is carried to the next charge...
+            */
+            DS_AppData.Sched.AgeDeadline = Now + DS_SCHED_AGE_PERIOD;
+        }
+
+        if (TableDue)
+        {
+            DS_AppData.Sched.TableDeadline = Now + DS_SCHED_TABLE_PERIOD;
+
+            /*
+            ** Check for packet filter table updates (used by this task)...
+            */
+            DS_TableManageFilter();
+        }
+
+        if (FlushDue)
+        {
+            DS_AppData.Sched.FlushDeadline = Now + DS_SCHED_FLUSH_PERIOD;
+        }
+
+        if (CDSDue)
+        {
+            DS_AppData.Sched.CDSDeadline = Now + DS_SCHED_CDS_PERIOD;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Run maintenance (writer lock held)                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_AppProcessWork(const DS_WriterRecord_t *Record)
+{
+    int32 i = 0;
+
+    if (Record->Work & DS_WRITER_WORK_AGE)
+    {
+        DS_FileTestAge(Record->AgeSeconds);
+    }
+
+    if (Record->Work & DS_WRITER_WORK_DEST_TBL)
+    {
+        /*
+        ** Check for destination file table updates...
+        */
+        DS_TableManageDestFile();
+    }
+
+    if (Record->Work & DS_WRITER_WORK_FLUSH)
+    {
+        /*
+        ** Write out data that has been held in write buffers...
+        */
+        for (i = 0; i < DS_DEST_FILE_CNT; i++)
+        {
+            if (OS_ObjectIdDefined(DS_AppData.FileStatus[i].FileHandle))
+            {
+                DS_FileFlushBuffer(i);
+            }
+        }
+    }
+
+    if (Record->Work & DS_WRITER_WORK_APP_STATE)
+    {
+        /*
+        ** Update the Critical Data Store (CDS) now - a commanded state
+        **   must survive a processor reset...
+        */
+        DS_TableMarkCDS(DS_CDS_APP_STATE);
+        DS_TableCommitCDS();
+    }
+
+    if (Record->Work & DS_WRITER_WORK_CDS)
+    {
+        /*
+        ** Commit sequence count and state changes to the CDS...
+        */
+        DS_TableCommitCDS();
+    }
+
+    if (Record->Work & (DS_WRITER_WORK_AGE | DS_WRITER_WORK_FLUSH))
+    {
+        /*
+        ** Hand over closed files that found the finalizer queue full...
+        */
+        for (i = 0; i < DS_DEST_FILE_CNT; i++)
+        {
+            DS_FileRetryFinalize(i, false);
+        }
+
+        /*
+        ** Open the next file ahead of time for files that are nearly too old
+        **   (the size threshold is tested after each write)...
+        */
+        DS_FileTestPreopen();
+    }
+
+    if (Record->Work & DS_WRITER_WORK_RATE)
+    {
+        /*
+        ** Compute file growth rate from number of bytes since last HK request...
+        */
+        for (i = 0; i < DS_DEST_FILE_CNT; i++)
+        {
+            if (Record->RateMillisecs > 0)
+            {
+                DS_AppData.FileStatus[i].FileRate =
+                    (uint32)(((uint64)DS_AppData.FileStatus[i].FileGrowth * 1000) / Record->RateMillisecs);
+            }
+            else
+            {
+                DS_AppData.FileStatus[i].FileRate = DS_AppData.FileStatus[i].FileGrowth / DS_SECS_PER_HK_CYCLE;
+            }
+            DS_AppData.FileStatus[i].FileGrowth = 0;
+        }
+    }
+
+    if (Record->Work & DS_WRITER_WORK_RESET)
+    {
+        DS_CmdResetFileCounters();
+    }
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Packet storage pre-processor                                    */
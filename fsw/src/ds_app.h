@@ -32,6 +32,14 @@
 
 #include "ds_table.h"
 
+#include "ds_writer.h"
+
+#include "ds_finalize.h"
+
+#include "ds_file.h"
+
+#include "ds_codec.h"
+
 #include "ds_extern_typedefs.h"
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -44,11 +52,37 @@
  * \brief Wakeup for DS
  *
  * \par Description
- *      Wakes up DS every 1 second for routine maintenance whether a
- *      message was received or not.
+ *      Longest time (in milliseconds) DS will wait for a message.  DS
+ *      usually wakes sooner, when the next maintenance deadline is due.
+ */
+#define DS_SB_TIMEOUT 1000
+
+/**
+ * \brief File age resolution
+ *
+ * \par Description
+ *      File ages are kept in whole seconds, so open files are charged
+ *      with elapsed time once per second of the scheduler clock.
+ */
+#define DS_SCHED_AGE_PERIOD 1000
+
+/**
+ * \brief Maintenance deadlines
+ *
+ * \par Description
+ *      All times are in milliseconds of the scheduler clock, see
+ *      #DS_AppSchedClock.  Deadlines are compared using wrap-safe
+ *      unsigned subtraction.
  */
-#define DS_SB_TIMEOUT       1000
-#define DS_SECS_PER_TIMEOUT (DS_SB_TIMEOUT / 1000)
+typedef struct
+{
+    uint32 AgeTime;       /**< \brief Clock time when file ages were last charged */
+    uint32 AgeDeadline;   /**< \brief Clock time of the next file age charge */
+    uint32 TableDeadline; /**< \brief Clock time of the next table update check */
+    uint32 FlushDeadline; /**< \brief Clock time of the next write buffer flush */
+    uint32 CDSDeadline;   /**< \brief Clock time of the next CDS commit */
+    uint32 HkTime;        /**< \brief Clock time of the previous housekeeping request */
+} DS_AppSched_t;
 
 /**
  * \brief Current state of destination files
@@ -63,7 +97,38 @@ typedef struct
     uint32    FileCount;                        /**< \brief Current file sequence count */
     uint16    FileState;                        /**< \brief Current file enable/disable state */
     uint16    Unused;                           /**< \brief Unused - structure padding */
+    uint32    BufferedBytes;                    /**< \brief Bytes held in write buffer (not yet in file) */
+    uint32    SyncBytes;                        /**< \brief Bytes written since the last sync */
+    uint32    SyncAge;                          /**< \brief Seconds that written bytes have waited for a sync */
+    bool      Direct;                           /**< \brief Current file is written with direct I/O */
+    int32     DirectFd;                         /**< \brief Direct I/O file descriptor */
+    uint32    DirectOffset;                     /**< \brief File offset of the first byte in the write buffer */
+    uint32    DirectTail;                       /**< \brief Bytes at the start of the write buffer already written */
     char      FileName[DS_TOTAL_FNAME_BUFSIZE]; /**< \brief Current filename (path+base+seq+ext) */
+    osal_id_t SpareHandle;                      /**< \brief Pre-opened next file handle */
+    uint32    SpareSize;                        /**< \brief Pre-opened next file size in bytes (header) */
+    char      SpareName[DS_TOTAL_FNAME_BUFSIZE]; /**< \brief Pre-opened next filename */
+    bool      Preallocated;                      /**< \brief Current file storage was reserved */
+    bool      SparePreallocated;                 /**< \brief Pre-opened next file storage was reserved */
+    DS_FileSummary_t Summary;                    /**< \brief Current file content summary */
+    uint32           IndexCount;                 /**< \brief Number of current file index samples */
+    uint32           IndexShift;                 /**< \brief Index spacing doublings (index filled up) */
+    DS_FileIndexEntry_t Index[DS_FILE_INDEX_MAX_CNT]; /**< \brief Current file index samples */
+    uint16              Codec;         /**< \brief Current file block compression codec */
+    uint32              CodecInBytes;  /**< \brief Current file packet bytes written in compressed blocks */
+    uint32              CodecOutBytes; /**< \brief Current file bytes written for compressed blocks (with frames) */
+    uint32              CodecTime;     /**< \brief Current file time spent compressing (microseconds) */
+    uint16              DeltaKeyframe; /**< \brief Current file packets between keyframes, zero = no delta records */
+    uint16              DeltaNext;     /**< \brief Next message ID slot to replace */
+    uint32              DeltaInBytes;  /**< \brief Current file packet bytes written as delta records */
+    uint32              DeltaOutBytes; /**< \brief Current file delta record bytes written (with headers) */
+    DS_DeltaSlot_t      Delta[DS_DELTA_MID_CNT]; /**< \brief Last stored packet of each recent message ID */
+    uint16              SuperframeSize;  /**< \brief Current file superframe size, zero = no superframes */
+    uint16              SuperframeCount; /**< \brief Packets in the current superframe */
+    uint32              SuperframeUsed;  /**< \brief Packet bytes in the current superframe */
+    uint32              SuperframeAge;   /**< \brief Seconds since the first packet in the current superframe */
+    bool                FinalizePending; /**< \brief Closed file is waiting for room in the finalizer queue */
+    DS_FinalizeEntry_t  FinalizeEntry;   /**< \brief Closed file waiting for room in the finalizer queue */
 } DS_AppFileStatus_t;
 
 /**
@@ -73,7 +138,9 @@ typedef struct
 {
     CFE_SB_PipeId_t InputPipe; /**< \brief Pipe Id for DS command pipe */
 
-    CFE_ES_CDSHandle_t DataStoreHandle; /**< \brief Critical Data Store (CDS) handle */
+    CFE_ES_CDSHandle_t DataStoreHandle;                /**< \brief Critical Data Store (CDS) handle */
+    uint32             DataStoreImage[DS_CDS_ENTRIES]; /**< \brief Values held in the CDS at the last write */
+    bool               DataStoreDirty[DS_CDS_ENTRIES]; /**< \brief CDS entry changed since the last write */
 
     CFE_TBL_Handle_t FilterTblHandle;   /**< \brief Packet filter table handle */
     CFE_TBL_Handle_t DestFileTblHandle; /**< \brief Destination file table handle */
@@ -81,14 +148,16 @@ typedef struct
     DS_FilterTable_t *  FilterTblPtr;   /**< \brief Packet filter table data pointer */
     DS_DestFileTable_t *DestFileTblPtr; /**< \brief Destination file table data pointer */
 
-    uint8 CmdAcceptedCounter;   /**< \brief Count of valid commands received */
-    uint8 CmdRejectedCounter;   /**< \brief Count of invalid commands received */
-    uint8 DestTblLoadCounter;   /**< \brief Count of destination file table loads */
-    uint8 DestTblErrCounter;    /**< \brief Count of failed attempts to get table data pointer */
-    uint8 FilterTblLoadCounter; /**< \brief Count of packet filter table loads */
-    uint8 FilterTblErrCounter;  /**< \brief Count of failed attempts to get table data pointer */
-    uint8 AppEnableState;       /**< \brief Application enable/disable state */
-    uint8 Spare8;               /**< \brief Structure alignment padding */
+    uint8 CmdAcceptedCounter;     /**< \brief Count of valid commands received */
+    uint8 CmdRejectedCounter;     /**< \brief Count of invalid commands received */
+    uint8 FileCmdAcceptedCounter; /**< \brief Count of valid commands run by the storage writer */
+    uint8 FileCmdRejectedCounter; /**< \brief Count of invalid commands run by the storage writer */
+    uint8 DestTblLoadCounter;     /**< \brief Count of destination file table loads */
+    uint8 DestTblErrCounter;      /**< \brief Count of failed attempts to get table data pointer */
+    uint8 FilterTblLoadCounter;   /**< \brief Count of packet filter table loads */
+    uint8 FilterTblErrCounter;    /**< \brief Count of failed attempts to get table data pointer */
+    uint8 AppEnableState;         /**< \brief Application enable/disable state */
+    uint8 Spare8[3];              /**< \brief Structure alignment padding */
 
     uint16 FileWriteCounter;     /**< \brief Count of good destination file writes */
     uint16 FileWriteErrCounter;  /**< \brief Count of bad destination file writes */
@@ -100,15 +169,87 @@ typedef struct
     uint32 FilteredPktCounter; /**< \brief Count of packets discarded (failed filter test) */
     uint32 PassedPktCounter;   /**< \brief Count of packets that passed filter test */
 
+    uint32 RateLimitedPktCounter; /**< \brief Count of packets dropped by a rate limit filter */
+
+    uint16 LastBatchSize;   /**< \brief Number of packets read in the most recent pipe batch */
+    uint16 MaxBatchSize;    /**< \brief Largest number of packets read in a single pipe batch */
+    uint32 BatchCounter;    /**< \brief Count of pipe batches processed */
+    uint32 BatchPktCounter; /**< \brief Count of packets read via pipe batches */
+
+    uint32 FlushCounter;       /**< \brief Count of write buffer flushes */
+    uint32 FlushByteCounter;   /**< \brief Count of bytes written by write buffer flushes */
+    uint32 DirectFlushCounter; /**< \brief Count of write buffer flushes written with direct I/O */
+
+    uint32 RotationCounter;   /**< \brief Count of new destination files started for a packet */
+    uint32 PreopenHitCounter; /**< \brief Count of new destination files that were pre-opened */
+    uint32 LastRotationTime;  /**< \brief Time to start the most recent new file (microseconds) */
+    uint32 MaxRotationTime;   /**< \brief Longest time to start a new file (microseconds) */
+
+    uint32 FinalizeCounter;   /**< \brief Count of closed files finalized */
+    uint32 FinalizePeakCount; /**< \brief Finalizer queue high-water mark (files) */
+    uint32 LastFinalizeTime;  /**< \brief Time from close to finalize of the last file (milliseconds) */
+    uint32 MaxFinalizeTime;   /**< \brief Longest time from close to finalize (milliseconds) */
+
+    uint32 SyncCounter;    /**< \brief Count of destination file syncs */
+    uint32 SyncErrCounter; /**< \brief Count of destination file sync errors */
+    uint32 LastSyncTime;   /**< \brief Time taken by the most recent sync (microseconds) */
+    uint32 MaxSyncTime;    /**< \brief Longest time taken by a sync (microseconds) */
+
     DS_AppFileStatus_t FileStatus[DS_DEST_FILE_CNT]; /**< \brief Current state of destination files */
 
-    DS_HashLink_t  HashLinks[DS_PACKETS_IN_FILTER_TABLE]; /**< \brief Hash table linked list elements */
-    DS_HashLink_t *HashTable[DS_HASH_TABLE_ENTRIES];      /**< \brief Each hash table entry is a linked list */
+    DS_AppSched_t Sched; /**< \brief Maintenance deadlines */
+
+    DS_HashSlot_t HashTable[DS_HASH_TABLE_ENTRIES]; /**< \brief Open addressed MID index into filter table */
+
+    int32 FreeEntryHead;                             /**< \brief First unused filter table entry (or #DS_INDEX_NONE) */
+    int32 FreeEntryNext[DS_PACKETS_IN_FILTER_TABLE]; /**< \brief Next unused filter table entry in free list */
+
+    DS_RoutePlan_t RoutePlan[DS_PACKETS_IN_FILTER_TABLE]; /**< \brief Active filters for each filter table entry */
+    uint32         DuplicatePktCounter[DS_PACKETS_IN_FILTER_TABLE]; /**< \brief Repeats dropped, per entry */
+
+    CFE_ES_TaskId_t WriterTaskId;     /**< \brief Storage writer child task ID */
+    osal_id_t       WriterSemId;      /**< \brief Storage writer ring semaphore ID */
+    osal_id_t       WriterMutexId;    /**< \brief Destination file access mutex ID (held by the writer per record) */
+    osal_id_t       WriterHkMutexId;  /**< \brief Storage writer housekeeping snapshot mutex ID */
+    bool            WriterTaskActive; /**< \brief Storage writer child task is running */
+    DS_WriterHk_t   WriterHk;         /**< \brief Storage writer counters published for housekeeping */
+    DS_WriterRing_t WriterRing;       /**< \brief Packets waiting for the storage writer child task */
+
+    CFE_ES_TaskId_t    FinalizeTaskId;     /**< \brief File finalizer child task ID */
+    osal_id_t          FinalizeSemId;      /**< \brief File finalizer queue semaphore ID */
+    osal_id_t          FinalizeMutexId;    /**< \brief File finalizer queue mutex ID */
+    bool               FinalizeTaskActive; /**< \brief File finalizer child task is running */
+    CFE_ES_CDSHandle_t FinalizeCDSHandle;  /**< \brief File finalizer queue head and count CDS handle */
+    DS_FinalizeQueue_t FinalizeQueue;      /**< \brief Closed files waiting for the file finalizer child task */
+
+    CFE_ES_CDSHandle_t FinalizeEntryCDSHandle[DS_FINALIZE_QUEUE_DEPTH]; /**< \brief File finalizer queue entry CDS handles */
+    CFE_ES_CDSHandle_t SpareCDSHandle[DS_DEST_FILE_CNT]; /**< \brief Pre-opened next filename CDS handles */
+
+    DS_CodecWork_t CodecWork; /**< \brief Block compression workspace (used with the destination file lock held) */
+
+    uint8 DeltaRecord[sizeof(DS_DeltaRecord_t) +
+                      DS_DELTA_MAX_PKT_SIZE]; /**< \brief Delta record workspace (used with the destination file lock held) */
+
+    uint8 Superframe[DS_DEST_FILE_CNT][DS_SUPERFRAME_MAX_SIZE]; /**< \brief Superframe being filled, per destination */
+
+    uint8 WriteBufferPool[(DS_DEST_FILE_CNT * DS_WRITE_BUFFER_MAX_SIZE) +
+                          DS_DIRECT_IO_BLOCK_SIZE]; /**< \brief Write buffer storage, see #DS_WRITE_BUFFER */
 } DS_AppData_t;
 
 /** \brief DS global data structure reference */
 extern DS_AppData_t DS_AppData;
 
+/**
+ * \brief Destination file write buffer
+ *
+ * Write buffers start on a #DS_DIRECT_IO_BLOCK_SIZE boundary within the
+ * write buffer storage, so any buffer may be written with direct I/O.
+ */
+#define DS_WRITE_BUFFER(FileIndex)                                                                         \
+    (((uint8 *)(((cpuaddr)DS_AppData.WriteBufferPool + (DS_DIRECT_IO_BLOCK_SIZE - 1)) &                    \
+                ~((cpuaddr)(DS_DIRECT_IO_BLOCK_SIZE - 1)))) +                                              \
+     ((FileIndex)*DS_WRITE_BUFFER_MAX_SIZE))
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Prototypes for functions defined in ds_app.c                    */
@@ -120,6 +261,8 @@ extern DS_AppData_t DS_AppData;
  *
  *  \par Description
  *       DS application entry point and main process loop.
+ *       At exit, closes open destination files (writing out buffered
+ *       data) once the storage writer ring is empty.
  *
  *  \par Assumptions, External Events, and Notes:
  *       None
@@ -147,6 +290,22 @@ void DS_AppMain(void);
  */
 int32 DS_AppInitialize(void);
 
+/**
+ *  \brief Software Bus pipe batch handler
+ *
+ *  \par Description
+ *       Process the packet returned by the blocking pipe read, then
+ *       poll the input pipe for additional packets until the pipe is
+ *       empty or #DS_APP_PIPE_BATCH_LIMIT packets have been processed.
+ *       The pipe batch statistics are updated once per batch.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] BufPtr Software Bus message pointer (first packet in batch)
+ */
+void DS_AppProcessBatch(const CFE_SB_Buffer_t *BufPtr);
+
 /**
  *  \brief Software Bus message handler
  *
@@ -169,6 +328,8 @@ void DS_AppProcessMsg(const CFE_SB_Buffer_t *BufPtr);
  *
  *  \par Description
  *       Call command code specific DS command handler function
+ *       Submit commands that affect destination files to the storage
+ *       writer (#DS_AppProcessFileCmd)
  *       Generate command error event for unknown command codes
  *
  *  \par Assumptions, External Events, and Notes:
@@ -178,20 +339,119 @@ void DS_AppProcessMsg(const CFE_SB_Buffer_t *BufPtr);
  */
 void DS_AppProcessCmd(const CFE_SB_Buffer_t *BufPtr);
 
+/**
+ *  \brief Destination file command handler
+ *
+ *  \par Description
+ *       Call command code specific DS command handler function for
+ *       commands that change destination files or the destination
+ *       file table
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by the storage writer for a #DS_WRITER_COMMAND record
+ *       with the writer lock held
+ *
+ *  \param[in] BufPtr Software Bus message pointer
+ */
+void DS_AppProcessFileCmd(const CFE_SB_Buffer_t *BufPtr);
+
 /**
  *  \brief Application housekeeping request command handler
  *
  *  \par Description
- *       Check with cFE Table Services for table updates
+ *       Have the storage writer compute file growth rates from the
+ *       measured time since the previous request
  *       Generate application housekeeping telemetry packet
  *
  *  \par Assumptions, External Events, and Notes:
- *       (none)
+ *       Counters updated by the storage writer are reported as of its
+ *       last command or maintenance record (see #DS_WriterPublishHk)
  *
  *  \sa #DS_HkPacket_t
  */
 void DS_AppProcessHK(void);
 
+/**
+ *  \brief Maintenance scheduler clock
+ *
+ *  \par Description
+ *       Returns the cFE Mission Elapsed Time in milliseconds.  MET
+ *       advances with the local clock and, unlike spacecraft time,
+ *       is not changed by STCF or leap second updates.  The value
+ *       wraps after about 49 days; callers compare clock values by
+ *       unsigned subtraction.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \return Current scheduler clock time (milliseconds)
+ */
+uint32 DS_AppSchedClock(void);
+
+/**
+ *  \brief Initialize maintenance deadlines
+ *
+ *  \par Description
+ *       Starts the file age clock at the current time and makes the
+ *       file age and table update checks due immediately.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ */
+void DS_AppSchedInit(void);
+
+/**
+ *  \brief Time until the next maintenance deadline
+ *
+ *  \par Description
+ *       Returns the number of milliseconds until the earliest of the
+ *       file age, table update, write buffer flush and CDS commit
+ *       deadlines, for use as the Software Bus receive timeout.  The
+ *       result is never more than #DS_SB_TIMEOUT, and is #CFE_SB_POLL
+ *       when a deadline has already passed.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \return Software Bus receive timeout (milliseconds)
+ */
+int32 DS_AppSchedTimeout(void);
+
+/**
+ *  \brief Run maintenance that is due
+ *
+ *  \par Description
+ *       Called after every Software Bus receive, whether or not a
+ *       message arrived.  Checks for filter table updates and submits
+ *       one #DS_WRITER_WORK record for the file age, destination table,
+ *       write buffer flush and CDS commit deadlines that have passed
+ *       (see #DS_AppProcessWork).
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The file age clock only advances when the work record is
+ *       accepted, so seconds are not lost while the ring is full.
+ */
+void DS_AppSchedRun(void);
+
+/**
+ *  \brief Run storage writer maintenance
+ *
+ *  \par Description
+ *       Does the work selected in a #DS_WRITER_WORK record: charges
+ *       open files with elapsed seconds (closing files that reach
+ *       their age limit), checks for destination table updates,
+ *       flushes write buffers, marks and commits CDS changes, computes
+ *       file growth rates and resets writer counters.  On the age and
+ *       flush deadlines, also pre-opens the next file for destinations
+ *       that are close to their size or age limit.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by the storage writer with the writer lock held
+ *
+ *  \param[in] Record Storage writer work record
+ */
+void DS_AppProcessWork(const DS_WriterRecord_t *Record);
+
 /**
  *  \brief Application packet storage pre-processor
  *
@@ -84,8 +84,9 @@ void DS_CmdNoop(const CFE_SB_Buffer_t *BufPtr)
 
 void DS_CmdReset(const CFE_SB_Buffer_t *BufPtr)
 {
-    size_t ActualLength   = 0;
-    size_t ExpectedLength = sizeof(DS_ResetCmd_t);
+    size_t            ActualLength   = 0;
+    size_t            ExpectedLength = sizeof(DS_ResetCmd_t);
+    DS_WriterRecord_t Record;
 
     CFE_MSG_GetSize(&BufPtr->Msg, &ActualLength);
 
@@ -115,27 +116,114 @@ void DS_CmdReset(const CFE_SB_Buffer_t *BufPtr)
         DS_AppData.IgnoredPktCounter  = 0;
         DS_AppData.FilteredPktCounter = 0;
         DS_AppData.PassedPktCounter   = 0;
+        memset(DS_AppData.DuplicatePktCounter, 0, sizeof(DS_AppData.DuplicatePktCounter));
+
+        DS_AppData.RateLimitedPktCounter = 0;
 
         /*
-        ** Reset file I/O counters...
+        ** Reset pipe batch statistics...
         */
-        DS_AppData.FileWriteCounter     = 0;
-        DS_AppData.FileWriteErrCounter  = 0;
-        DS_AppData.FileUpdateCounter    = 0;
-        DS_AppData.FileUpdateErrCounter = 0;
+        DS_AppData.LastBatchSize   = 0;
+        DS_AppData.MaxBatchSize    = 0;
+        DS_AppData.BatchCounter    = 0;
+        DS_AppData.BatchPktCounter = 0;
 
         /*
-        ** Reset configuration table counters...
+        ** Reset storage writer ring statistics...
+        */
+        DS_AppData.WriterRing.PeakBlocks  = 0;
+        DS_AppData.WriterRing.DropCounter = 0;
+
+        /*
+        ** Reset packet filter table counters...
         */
-        DS_AppData.DestTblLoadCounter   = 0;
-        DS_AppData.DestTblErrCounter    = 0;
         DS_AppData.FilterTblLoadCounter = 0;
         DS_AppData.FilterTblErrCounter  = 0;
 
+        /*
+        ** Counters kept by the storage writer are reset by the storage writer...
+        */
+        memset(&Record, 0, sizeof(Record));
+        Record.Type = DS_WRITER_WORK;
+        Record.Work = DS_WRITER_WORK_RESET;
+
+        DS_WriterSubmit(&Record, NULL);
+
         CFE_EVS_SendEvent(DS_RESET_CMD_EID, CFE_EVS_EventType_DEBUG, "Reset counters command");
     }
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Reset counters kept by the storage writer (writer lock held)    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_CmdResetFileCounters(void)
+{
+    /*
+    ** Reset destination file command counters...
+    */
+    DS_AppData.FileCmdAcceptedCounter = 0;
+    DS_AppData.FileCmdRejectedCounter = 0;
+
+    /*
+    ** Reset write buffer flush statistics...
+    */
+    DS_AppData.FlushCounter       = 0;
+    DS_AppData.FlushByteCounter   = 0;
+    DS_AppData.DirectFlushCounter = 0;
+
+    /*
+    ** Reset file rotation statistics...
+    */
+    DS_AppData.RotationCounter   = 0;
+    DS_AppData.PreopenHitCounter = 0;
+    DS_AppData.LastRotationTime  = 0;
+    DS_AppData.MaxRotationTime   = 0;
+
+    /*
+    ** Finalizer statistics are updated by the file finalizer task...
+    */
+    OS_MutSemTake(DS_AppData.FinalizeMutexId);
+
+    /*
+    ** Reset file finalizer statistics...
+    */
+    DS_AppData.FinalizeCounter   = 0;
+    DS_AppData.FinalizePeakCount = 0;
+    DS_AppData.LastFinalizeTime  = 0;
+    DS_AppData.MaxFinalizeTime   = 0;
+
+    /*
+    ** Reset file sync statistics...
+    */
+    DS_AppData.SyncCounter    = 0;
+    DS_AppData.SyncErrCounter = 0;
+    DS_AppData.LastSyncTime   = 0;
+    DS_AppData.MaxSyncTime    = 0;
+
+    /*
+    ** Reset file header update counters...
+    */
+    DS_AppData.FileUpdateCounter    = 0;
+    DS_AppData.FileUpdateErrCounter = 0;
+
+    OS_MutSemGive(DS_AppData.FinalizeMutexId);
+
+    /*
+    ** Reset file write counters...
+    */
+    DS_AppData.FileWriteCounter    = 0;
+    DS_AppData.FileWriteErrCounter = 0;
+
+    /*
+    ** Reset destination file table counters...
+    */
+    DS_AppData.DestTblLoadCounter = 0;
+    DS_AppData.DestTblErrCounter  = 0;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Set application ena/dis state                                   */
@@ -147,6 +235,7 @@ void DS_CmdSetAppState(const CFE_SB_Buffer_t *BufPtr)
     DS_AppStateCmd_t *DS_AppStateCmd = (DS_AppStateCmd_t *)BufPtr;
     size_t            ActualLength   = 0;
     size_t            ExpectedLength = sizeof(DS_AppStateCmd_t);
+    DS_WriterRecord_t Record;
 
     CFE_MSG_GetSize(&BufPtr->Msg, &ActualLength);
 
@@ -179,9 +268,13 @@ void DS_CmdSetAppState(const CFE_SB_Buffer_t *BufPtr)
         DS_AppData.AppEnableState = DS_AppStateCmd->EnableState;
 
         /*
-        ** Update the Critical Data Store (CDS)...
+        ** Have the storage writer update the Critical Data Store (CDS)...
         */
-        DS_TableUpdateCDS();
+        memset(&Record, 0, sizeof(Record));
+        Record.Type = DS_WRITER_WORK;
+        Record.Work = DS_WRITER_WORK_APP_STATE;
+
+        DS_WriterSubmit(&Record, NULL);
 
         DS_AppData.CmdAcceptedCounter++;
 
@@ -288,6 +381,11 @@ void DS_CmdSetFilterFile(const CFE_SB_Buffer_t *BufPtr)
 
             pFilterParms->FileTableIndex = DS_FilterFileCmd->FileTableIndex;
 
+            /*
+            ** Update the packet routing plan for this filter table entry...
+            */
+            DS_TableCompileRoute(FilterTableIndex);
+
             /*
             ** Notify cFE that we have modified the table data...
             */
@@ -353,7 +451,7 @@ void DS_CmdSetFilterType(const CFE_SB_Buffer_t *BufPtr)
                           "Invalid FILTER TYPE command arg: filter parameters index = %d",
                           DS_FilterTypeCmd->FilterParmsIndex);
     }
-    else if (DS_TableVerifyType(DS_FilterTypeCmd->FilterType) == false)
+    else if (DS_TableVerifyFilterType(DS_FilterTypeCmd->FilterType) == false)
     {
         /*
         ** Invalid packet filter filename type...
@@ -401,6 +499,11 @@ void DS_CmdSetFilterType(const CFE_SB_Buffer_t *BufPtr)
 
             pFilterParms->FilterType = DS_FilterTypeCmd->FilterType;
 
+            /*
+            ** Update the packet routing plan for this filter table entry...
+            */
+            DS_TableCompileRoute(FilterTableIndex);
+
             /*
             ** Notify cFE that we have modified the table data...
             */
@@ -466,18 +569,6 @@ void DS_CmdSetFilterParms(const CFE_SB_Buffer_t *BufPtr)
                           "Invalid FILTER PARMS command arg: filter parameters index = %d",
                           DS_FilterParmsCmd->FilterParmsIndex);
     }
-    else if (DS_TableVerifyParms(DS_FilterParmsCmd->Algorithm_N, DS_FilterParmsCmd->Algorithm_X,
-                                 DS_FilterParmsCmd->Algorithm_O) == false)
-    {
-        /*
-        ** Invalid packet filter algorithm parameters...
-        */
-        DS_AppData.CmdRejectedCounter++;
-
-        CFE_EVS_SendEvent(DS_PARMS_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "Invalid FILTER PARMS command arg: N = %d, X = %d, O = %d", DS_FilterParmsCmd->Algorithm_N,
-                          DS_FilterParmsCmd->Algorithm_X, DS_FilterParmsCmd->Algorithm_O);
-    }
     else if (DS_AppData.FilterTblPtr == (DS_FilterTable_t *)NULL)
     {
         /*
@@ -495,6 +586,12 @@ void DS_CmdSetFilterParms(const CFE_SB_Buffer_t *BufPtr)
         */
         FilterTableIndex = DS_TableFindMsgID(DS_FilterParmsCmd->MessageID);
 
+        if (FilterTableIndex != DS_INDEX_NONE)
+        {
+            pPacketEntry = &DS_AppData.FilterTblPtr->Packet[FilterTableIndex];
+            pFilterParms = &pPacketEntry->Filter[DS_FilterParmsCmd->FilterParmsIndex];
+        }
+
         if (FilterTableIndex == DS_INDEX_NONE)
         {
             /*
@@ -506,18 +603,35 @@ void DS_CmdSetFilterParms(const CFE_SB_Buffer_t *BufPtr)
                               "Invalid FILTER PARMS command: Message ID 0x%08lX is not in filter table",
                               (unsigned long)CFE_SB_MsgIdToValue(DS_FilterParmsCmd->MessageID));
         }
+        else if ((DS_TableVerifyParms(pFilterParms->FilterType, DS_FilterParmsCmd->Algorithm_N,
+                                      DS_FilterParmsCmd->Algorithm_X, DS_FilterParmsCmd->Algorithm_O) == false) ||
+                 (DS_TableVerifyBurst(pFilterParms->FilterType, DS_FilterParmsCmd->Algorithm_X,
+                                      DS_FilterParmsCmd->Algorithm_O, pPacketEntry->MinLength) == false))
+        {
+            /*
+            ** Invalid packet filter algorithm parameters (limits depend on the filter type)...
+            */
+            DS_AppData.CmdRejectedCounter++;
+
+            CFE_EVS_SendEvent(DS_PARMS_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Invalid FILTER PARMS command arg: N = %d, X = %d, O = %d",
+                              DS_FilterParmsCmd->Algorithm_N, DS_FilterParmsCmd->Algorithm_X,
+                              DS_FilterParmsCmd->Algorithm_O);
+        }
         else
         {
             /*
             ** Set new packet filter values (algorithm)...
             */
-            pPacketEntry = &DS_AppData.FilterTblPtr->Packet[FilterTableIndex];
-            pFilterParms = &pPacketEntry->Filter[DS_FilterParmsCmd->FilterParmsIndex];
-
             pFilterParms->Algorithm_N = DS_FilterParmsCmd->Algorithm_N;
             pFilterParms->Algorithm_X = DS_FilterParmsCmd->Algorithm_X;
             pFilterParms->Algorithm_O = DS_FilterParmsCmd->Algorithm_O;
 
+            /*
+            ** Update the packet routing plan for this filter table entry...
+            */
+            DS_TableCompileRoute(FilterTableIndex);
+
             /*
             ** Notify cFE that we have modified the table data...
             */
@@ -554,7 +668,7 @@ void DS_CmdSetDestType(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Invalid command packet length...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_NTYPE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST TYPE command length: expected = %d, actual = %d", (int)ExpectedLength,
@@ -565,7 +679,7 @@ void DS_CmdSetDestType(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Invalid destination file table index...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_NTYPE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST TYPE command arg: file table index = %d", DS_DestTypeCmd->FileTableIndex);
@@ -575,7 +689,7 @@ void DS_CmdSetDestType(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Invalid destination filename type...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_NTYPE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST TYPE command arg: filename type = %d", DS_DestTypeCmd->FileNameType);
@@ -585,7 +699,7 @@ void DS_CmdSetDestType(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Must have a valid destination file table loaded...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_NTYPE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST TYPE command: destination file table is not loaded");
@@ -598,12 +712,17 @@ void DS_CmdSetDestType(const CFE_SB_Buffer_t *BufPtr)
         pDest               = &DS_AppData.DestFileTblPtr->File[DS_DestTypeCmd->FileTableIndex];
         pDest->FileNameType = DS_DestTypeCmd->FileNameType;
 
+        /*
+        ** A next file opened ahead of time has the old filename...
+        */
+        DS_FileCloseSpare(DS_DestTypeCmd->FileTableIndex);
+
         /*
         ** Notify cFE that we have modified the table data...
         */
         CFE_TBL_Modified(DS_AppData.DestFileTblHandle);
 
-        DS_AppData.CmdAcceptedCounter++;
+        DS_AppData.FileCmdAcceptedCounter++;
 
         CFE_EVS_SendEvent(DS_NTYPE_CMD_EID, CFE_EVS_EventType_DEBUG,
                           "DEST TYPE command: file table index = %d, filename type = %d",
@@ -630,7 +749,7 @@ void DS_CmdSetDestState(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Invalid command packet length...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_STATE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST STATE command length: expected = %d, actual = %d", (int)ExpectedLength,
@@ -641,7 +760,7 @@ void DS_CmdSetDestState(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Invalid destination file table index...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_STATE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST STATE command arg: file table index = %d", DS_DestStateCmd->FileTableIndex);
@@ -651,7 +770,7 @@ void DS_CmdSetDestState(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Invalid destination file state...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_STATE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST STATE command arg: file state = %d", DS_DestStateCmd->EnableState);
@@ -661,7 +780,7 @@ void DS_CmdSetDestState(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Must have a valid destination file table loaded...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_STATE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST STATE command: destination file table is not loaded");
@@ -679,7 +798,7 @@ void DS_CmdSetDestState(const CFE_SB_Buffer_t *BufPtr)
         */
         CFE_TBL_Modified(DS_AppData.DestFileTblHandle);
 
-        DS_AppData.CmdAcceptedCounter++;
+        DS_AppData.FileCmdAcceptedCounter++;
 
         CFE_EVS_SendEvent(DS_STATE_CMD_EID, CFE_EVS_EventType_DEBUG,
                           "DEST STATE command: file table index = %d, file state = %d", DS_DestStateCmd->FileTableIndex,
@@ -707,7 +826,7 @@ void DS_CmdSetDestPath(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Invalid command packet length...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_PATH_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST PATH command length: expected = %d, actual = %d", (int)ExpectedLength,
@@ -718,7 +837,7 @@ void DS_CmdSetDestPath(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Invalid destination file table index...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_PATH_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST PATH command arg: file table index = %d", (int)DS_DestPathCmd->FileTableIndex);
@@ -728,7 +847,7 @@ void DS_CmdSetDestPath(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Must have a valid destination file table loaded...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_PATH_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST PATH command: destination file table is not loaded");
@@ -741,12 +860,17 @@ void DS_CmdSetDestPath(const CFE_SB_Buffer_t *BufPtr)
         pDest = &DS_AppData.DestFileTblPtr->File[DS_DestPathCmd->FileTableIndex];
         strncpy(pDest->Pathname, DS_DestPathCmd->Pathname, sizeof(pDest->Pathname));
 
+        /*
+        ** A next file opened ahead of time has the old filename...
+        */
+        DS_FileCloseSpare(DS_DestPathCmd->FileTableIndex);
+
         /*
         ** Notify cFE that we have modified the table data...
         */
         CFE_TBL_Modified(DS_AppData.DestFileTblHandle);
 
-        DS_AppData.CmdAcceptedCounter++;
+        DS_AppData.FileCmdAcceptedCounter++;
 
         CFE_EVS_SendEvent(DS_PATH_CMD_EID, CFE_EVS_EventType_DEBUG,
                           "DEST PATH command: file table index = %d, pathname = '%s'",
@@ -774,7 +898,7 @@ void DS_CmdSetDestBase(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Invalid command packet length...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_BASE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST BASE command length: expected = %d, actual = %d", (int)ExpectedLength,
@@ -785,7 +909,7 @@ void DS_CmdSetDestBase(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Invalid destination file table index...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_BASE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST BASE command arg: file table index = %d", (int)DS_DestBaseCmd->FileTableIndex);
@@ -795,7 +919,7 @@ void DS_CmdSetDestBase(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Must have a valid destination file table loaded...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_BASE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST BASE command: destination file table is not loaded");
@@ -808,12 +932,17 @@ void DS_CmdSetDestBase(const CFE_SB_Buffer_t *BufPtr)
         pDest = &DS_AppData.DestFileTblPtr->File[DS_DestBaseCmd->FileTableIndex];
         strncpy(pDest->Basename, DS_DestBaseCmd->Basename, sizeof(pDest->Basename));
 
+        /*
+        ** A next file opened ahead of time has the old filename...
+        */
+        DS_FileCloseSpare(DS_DestBaseCmd->FileTableIndex);
+
         /*
         ** Notify cFE that we have modified the table data...
         */
         CFE_TBL_Modified(DS_AppData.DestFileTblHandle);
 
-        DS_AppData.CmdAcceptedCounter++;
+        DS_AppData.FileCmdAcceptedCounter++;
 
         CFE_EVS_SendEvent(DS_BASE_CMD_EID, CFE_EVS_EventType_DEBUG,
                           "DEST BASE command: file table index = %d, base filename = '%s'",
@@ -841,7 +970,7 @@ void DS_CmdSetDestExt(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Invalid command packet length...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_EXT_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST EXT command length: expected = %d, actual = %d", (int)ExpectedLength,
@@ -852,7 +981,7 @@ void DS_CmdSetDestExt(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Invalid destination file table index...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_EXT_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST EXT command arg: file table index = %d", (int)DS_DestExtCmd->FileTableIndex);
@@ -862,7 +991,7 @@ void DS_CmdSetDestExt(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Must have a valid destination file table loaded...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_EXT_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST EXT command: destination file table is not loaded");
@@ -875,12 +1004,17 @@ void DS_CmdSetDestExt(const CFE_SB_Buffer_t *BufPtr)
         pDest = &DS_AppData.DestFileTblPtr->File[DS_DestExtCmd->FileTableIndex];
         strncpy(pDest->Extension, DS_DestExtCmd->Extension, sizeof(pDest->Extension));
 
+        /*
+        ** A next file opened ahead of time has the old filename...
+        */
+        DS_FileCloseSpare(DS_DestExtCmd->FileTableIndex);
+
         /*
         ** Notify cFE that we have modified the table data...
         */
         CFE_TBL_Modified(DS_AppData.DestFileTblHandle);
 
-        DS_AppData.CmdAcceptedCounter++;
+        DS_AppData.FileCmdAcceptedCounter++;
 
         CFE_EVS_SendEvent(DS_EXT_CMD_EID, CFE_EVS_EventType_DEBUG,
                           "DEST EXT command: file table index = %d, extension = '%s'",
@@ -908,7 +1042,7 @@ void DS_CmdSetDestSize(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Invalid command packet length...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_SIZE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST SIZE command length: expected = %d, actual = %d", (int)ExpectedLength,
@@ -919,7 +1053,7 @@ void DS_CmdSetDestSize(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Invalid destination file table index...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_SIZE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST SIZE command arg: file table index = %d", (int)DS_DestSizeCmd->FileTableIndex);
@@ -929,7 +1063,7 @@ void DS_CmdSetDestSize(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Invalid destination file size limit...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_SIZE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST SIZE command arg: size limit = %d", (int)DS_DestSizeCmd->MaxFileSize);
@@ -939,7 +1073,7 @@ void DS_CmdSetDestSize(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Must have a valid destination file table loaded...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_SIZE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST SIZE command: destination file table is not loaded");
@@ -957,7 +1091,7 @@ void DS_CmdSetDestSize(const CFE_SB_Buffer_t *BufPtr)
         */
         CFE_TBL_Modified(DS_AppData.DestFileTblHandle);
 
-        DS_AppData.CmdAcceptedCounter++;
+        DS_AppData.FileCmdAcceptedCounter++;
 
         CFE_EVS_SendEvent(DS_SIZE_CMD_EID, CFE_EVS_EventType_DEBUG,
                           "DEST SIZE command: file table index = %d, size limit = %d",
@@ -985,7 +1119,7 @@ void DS_CmdSetDestAge(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Invalid command packet length...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_AGE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST AGE command length: expected = %d, actual = %d", (int)ExpectedLength,
@@ -996,7 +1130,7 @@ void DS_CmdSetDestAge(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Invalid destination file table index...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_AGE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST AGE command arg: file table index = %d", (int)DS_DestAgeCmd->FileTableIndex);
@@ -1006,7 +1140,7 @@ void DS_CmdSetDestAge(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Invalid destination file age limit...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_AGE_CMD_ERR_EID, CFE_EVS_EventType_ERROR, "Invalid DEST AGE command arg: age limit = %d",
                           (int)DS_DestAgeCmd->MaxFileAge);
@@ -1016,7 +1150,7 @@ void DS_CmdSetDestAge(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Must have a valid destination file table loaded...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_AGE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST AGE command: destination file table is not loaded");
@@ -1034,7 +1168,7 @@ void DS_CmdSetDestAge(const CFE_SB_Buffer_t *BufPtr)
         */
         CFE_TBL_Modified(DS_AppData.DestFileTblHandle);
 
-        DS_AppData.CmdAcceptedCounter++;
+        DS_AppData.FileCmdAcceptedCounter++;
 
         CFE_EVS_SendEvent(DS_AGE_CMD_EID, CFE_EVS_EventType_DEBUG,
                           "DEST AGE command: file table index = %d, age limit = %d", (int)DS_DestAgeCmd->FileTableIndex,
@@ -1063,7 +1197,7 @@ void DS_CmdSetDestCount(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Invalid command packet length...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_SEQ_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST COUNT command length: expected = %d, actual = %d", (int)ExpectedLength,
@@ -1074,7 +1208,7 @@ void DS_CmdSetDestCount(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Invalid destination file table index...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_SEQ_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST COUNT command arg: file table index = %d",
@@ -1085,7 +1219,7 @@ void DS_CmdSetDestCount(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Invalid destination file sequence count...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_SEQ_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST COUNT command arg: sequence count = %d", (int)DS_DestCountCmd->SequenceCount);
@@ -1095,7 +1229,7 @@ void DS_CmdSetDestCount(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Must have a valid destination file table loaded...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_SEQ_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST COUNT command: destination file table is not loaded");
@@ -1114,17 +1248,24 @@ void DS_CmdSetDestCount(const CFE_SB_Buffer_t *BufPtr)
         DestFile->SequenceCount = DS_DestCountCmd->SequenceCount;
         FileStatus->FileCount   = DS_DestCountCmd->SequenceCount;
 
+        /*
+        ** A next file opened ahead of time has the old filename...
+        */
+        DS_FileCloseSpare(DS_DestCountCmd->FileTableIndex);
+
         /*
         ** Notify cFE that we have modified the table data...
         */
         CFE_TBL_Modified(DS_AppData.DestFileTblHandle);
 
         /*
-        ** Update the Critical Data Store (CDS)...
+        ** Update the Critical Data Store (CDS) now - a commanded count
+        **   must survive a processor reset...
         */
-        DS_TableUpdateCDS();
+        DS_TableMarkCDS(DS_DestCountCmd->FileTableIndex);
+        DS_TableCommitCDS();
 
-        DS_AppData.CmdAcceptedCounter++;
+        DS_AppData.FileCmdAcceptedCounter++;
 
         CFE_EVS_SendEvent(DS_SEQ_CMD_EID, CFE_EVS_EventType_DEBUG,
                           "DEST COUNT command: file table index = %d, sequence count = %d",
@@ -1151,7 +1292,7 @@ void DS_CmdCloseFile(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Invalid command packet length...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_CLOSE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST CLOSE command length: expected = %d, actual = %d", (int)ExpectedLength,
@@ -1162,7 +1303,7 @@ void DS_CmdCloseFile(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Invalid destination file table index...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_CLOSE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST CLOSE command arg: file table index = %d",
@@ -1175,17 +1316,69 @@ void DS_CmdCloseFile(const CFE_SB_Buffer_t *BufPtr)
         */
         if (OS_ObjectIdDefined(DS_AppData.FileStatus[DS_CloseFileCmd->FileTableIndex].FileHandle))
         {
-            DS_FileUpdateHeader(DS_CloseFileCmd->FileTableIndex);
             DS_FileCloseDest(DS_CloseFileCmd->FileTableIndex);
         }
 
-        DS_AppData.CmdAcceptedCounter++;
+        DS_AppData.FileCmdAcceptedCounter++;
 
         CFE_EVS_SendEvent(DS_CLOSE_CMD_EID, CFE_EVS_EventType_DEBUG, "DEST CLOSE command: file table index = %d",
                           (int)DS_CloseFileCmd->FileTableIndex);
     }
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Flush destination file write buffer                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_CmdFlushFile(const CFE_SB_Buffer_t *BufPtr)
+{
+    DS_FlushFileCmd_t *DS_FlushFileCmd = (DS_FlushFileCmd_t *)BufPtr;
+    size_t             ActualLength    = 0;
+    size_t             ExpectedLength  = sizeof(DS_FlushFileCmd_t);
+
+    CFE_MSG_GetSize(&BufPtr->Msg, &ActualLength);
+
+    if (ExpectedLength != ActualLength)
+    {
+        /*
+        ** Invalid command packet length...
+        */
+        DS_AppData.FileCmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_FLUSH_FILE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid DEST FLUSH command length: expected = %d, actual = %d", (int)ExpectedLength,
+                          (int)ActualLength);
+    }
+    else if (DS_TableVerifyFileIndex(DS_FlushFileCmd->FileTableIndex) == false)
+    {
+        /*
+        ** Invalid destination file table index...
+        */
+        DS_AppData.FileCmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_FLUSH_FILE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid DEST FLUSH command arg: file table index = %d",
+                          (int)DS_FlushFileCmd->FileTableIndex);
+    }
+    else
+    {
+        /*
+        ** Write buffered data to destination file (if the file was open)...
+        */
+        if (OS_ObjectIdDefined(DS_AppData.FileStatus[DS_FlushFileCmd->FileTableIndex].FileHandle))
+        {
+            DS_FileFlushBuffer(DS_FlushFileCmd->FileTableIndex);
+        }
+
+        DS_AppData.FileCmdAcceptedCounter++;
+
+        CFE_EVS_SendEvent(DS_FLUSH_FILE_CMD_EID, CFE_EVS_EventType_DEBUG, "DEST FLUSH command: file table index = %d",
+                          (int)DS_FlushFileCmd->FileTableIndex);
+    }
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Close all open destination files                                */
@@ -1205,7 +1398,7 @@ void DS_CmdCloseAll(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Invalid command packet length...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_CLOSE_ALL_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid DEST CLOSE ALL command length: expected = %d, actual = %d", (int)ExpectedLength,
@@ -1220,12 +1413,18 @@ void DS_CmdCloseAll(const CFE_SB_Buffer_t *BufPtr)
         {
             if (OS_ObjectIdDefined(DS_AppData.FileStatus[i].FileHandle))
             {
-                DS_FileUpdateHeader(i);
                 DS_FileCloseDest(i);
             }
+
+            DS_FileCloseSpare(i);
         }
 
-        DS_AppData.CmdAcceptedCounter++;
+        /*
+        ** Commit pending Critical Data Store (CDS) changes...
+        */
+        DS_TableCommitCDS();
+
+        DS_AppData.FileCmdAcceptedCounter++;
 
         CFE_EVS_SendEvent(DS_CLOSE_ALL_CMD_EID, CFE_EVS_EventType_DEBUG, "DEST CLOSE ALL command");
     }
@@ -1251,7 +1450,7 @@ void DS_CmdGetFileInfo(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Invalid command packet length...
         */
-        DS_AppData.CmdRejectedCounter++;
+        DS_AppData.FileCmdRejectedCounter++;
 
         CFE_EVS_SendEvent(DS_GET_FILE_INFO_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid GET FILE INFO command length: expected = %d, actual = %d", (int)ExpectedLength,
@@ -1262,7 +1461,7 @@ void DS_CmdGetFileInfo(const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Create and send a file info packet...
         */
-        DS_AppData.CmdAcceptedCounter++;
+        DS_AppData.FileCmdAcceptedCounter++;
 
         CFE_EVS_SendEvent(DS_GET_FILE_INFO_CMD_EID, CFE_EVS_EventType_DEBUG, "GET FILE INFO command");
 
@@ -1287,6 +1486,24 @@ void DS_CmdGetFileInfo(const CFE_SB_Buffer_t *BufPtr)
             */
             DS_FileInfoPkt.FileInfo[i].FileRate = DS_AppData.FileStatus[i].FileRate;
 
+            /*
+            ** Set amount of data waiting in the write buffer...
+            */
+            DS_FileInfoPkt.FileInfo[i].BufferedBytes = DS_AppData.FileStatus[i].BufferedBytes;
+
+            /*
+            ** Set compression ratio (in/out bytes) and time...
+            */
+            DS_FileInfoPkt.FileInfo[i].CodecInBytes  = DS_AppData.FileStatus[i].CodecInBytes;
+            DS_FileInfoPkt.FileInfo[i].CodecOutBytes = DS_AppData.FileStatus[i].CodecOutBytes;
+            DS_FileInfoPkt.FileInfo[i].CodecTime     = DS_AppData.FileStatus[i].CodecTime;
+
+            /*
+            ** Set bytes saved by delta records (in - out)...
+            */
+            DS_FileInfoPkt.FileInfo[i].DeltaInBytes  = DS_AppData.FileStatus[i].DeltaInBytes;
+            DS_FileInfoPkt.FileInfo[i].DeltaOutBytes = DS_AppData.FileStatus[i].DeltaOutBytes;
+
             /*
             ** Set current filename sequence count...
             */
@@ -1331,6 +1548,66 @@ void DS_CmdGetFileInfo(const CFE_SB_Buffer_t *BufPtr)
     }
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get duplicate packet info packet                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_CmdGetDedupInfo(const CFE_SB_Buffer_t *BufPtr)
+{
+    DS_DedupInfoPkt_t DS_DedupInfoPkt;
+    size_t            ActualLength   = 0;
+    size_t            ExpectedLength = sizeof(DS_GetDedupInfoCmd_t);
+    int32             i              = 0;
+
+    CFE_MSG_GetSize(&BufPtr->Msg, &ActualLength);
+
+    if (ExpectedLength != ActualLength)
+    {
+        /*
+        ** Invalid command packet length...
+        */
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_GET_DEDUP_INFO_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid GET DEDUP INFO command length: expected = %d, actual = %d", (int)ExpectedLength,
+                          (int)ActualLength);
+    }
+    else
+    {
+        /*
+        ** Create and send a duplicate packet info packet...
+        */
+        DS_AppData.CmdAcceptedCounter++;
+
+        CFE_EVS_SendEvent(DS_GET_DEDUP_INFO_CMD_EID, CFE_EVS_EventType_DEBUG, "GET DEDUP INFO command");
+
+        CFE_MSG_Init(&DS_DedupInfoPkt.TlmHeader.Msg, CFE_SB_ValueToMsgId(DS_DEDUP_TLM_MID),
+                     sizeof(DS_DedupInfoPkt_t));
+
+        for (i = 0; i < DS_PACKETS_IN_FILTER_TABLE; i++)
+        {
+            /*
+            ** Counts follow the filter table entry, not the message ID...
+            */
+            if (DS_AppData.FilterTblPtr == (DS_FilterTable_t *)NULL)
+            {
+                DS_DedupInfoPkt.DedupInfo[i].MessageID = CFE_SB_INVALID_MSG_ID;
+            }
+            else
+            {
+                DS_DedupInfoPkt.DedupInfo[i].MessageID = DS_AppData.FilterTblPtr->Packet[i].MessageID;
+            }
+
+            DS_DedupInfoPkt.DedupInfo[i].DuplicateCount = DS_AppData.DuplicatePktCounter[i];
+        }
+
+        CFE_SB_TimeStampMsg(&DS_DedupInfoPkt.TlmHeader.Msg);
+        CFE_SB_TransmitMsg(&DS_DedupInfoPkt.TlmHeader.Msg, true);
+    }
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Add message ID to packet filter table                           */
@@ -1393,7 +1670,7 @@ void DS_CmdAddMID(const CFE_SB_Buffer_t *BufPtr)
                           "Invalid ADD MID command: MID = 0x%08lX is already in filter table at index = %d",
                           (unsigned long)CFE_SB_MsgIdToValue(DS_AddMidCmd->MessageID), (int)FilterTableIndex);
     }
-    else if ((FilterTableIndex = DS_TableFindMsgID(CFE_SB_INVALID_MSG_ID)) == DS_INDEX_NONE)
+    else if ((FilterTableIndex = DS_TableAllocEntry()) == DS_INDEX_NONE)
     {
         /*
         ** Packet filter table has no unused entries...
@@ -1427,6 +1704,13 @@ void DS_CmdAddMID(const CFE_SB_Buffer_t *BufPtr)
             pFilterParms->Algorithm_O = 0;
         }
 
+        pPacketEntry->MinLength = 0;
+        memset(pPacketEntry->Predicate, 0, sizeof(pPacketEntry->Predicate));
+
+        /* Update the packet routing plan as well */
+        DS_TableCompileRoute(FilterTableIndex);
+        DS_AppData.DuplicatePktCounter[FilterTableIndex] = 0;
+
         CFE_SB_SubscribeEx(DS_AddMidCmd->MessageID, DS_AppData.InputPipe, CFE_SB_DEFAULT_QOS, DS_PER_PACKET_PIPE_LIMIT);
         /*
         ** Notify cFE that we have modified the table data...
@@ -1507,8 +1791,8 @@ void DS_CmdRemoveMID(const CFE_SB_Buffer_t *BufPtr)
     }
     else
     {
-        /* Convert MID into hash table index */
-        HashTableIndex = DS_TableHashFunction(DS_RemoveMidCmd->MessageID);
+        /* Remove the message ID from the hash table */
+        HashTableIndex = DS_TableRemoveMsgID(DS_RemoveMidCmd->MessageID);
 
         /*
         ** Reset used packet filter entry for used message ID...
@@ -1517,9 +1801,6 @@ void DS_CmdRemoveMID(const CFE_SB_Buffer_t *BufPtr)
 
         pPacketEntry->MessageID = CFE_SB_INVALID_MSG_ID;
 
-        /* Create new hash table as well */
-        DS_TableCreateHash();
-
         for (i = 0; i < DS_FILTERS_PER_PACKET; i++)
         {
             pFilterParms = &pPacketEntry->Filter[i];
@@ -1532,6 +1813,13 @@ void DS_CmdRemoveMID(const CFE_SB_Buffer_t *BufPtr)
             pFilterParms->Algorithm_O = 0;
         }
 
+        pPacketEntry->MinLength = 0;
+        memset(pPacketEntry->Predicate, 0, sizeof(pPacketEntry->Predicate));
+
+        /* Update the packet routing plan and make the entry available again */
+        DS_TableCompileRoute(FilterTableIndex);
+        DS_TableFreeEntry(FilterTableIndex);
+
         CFE_SB_Unsubscribe(DS_RemoveMidCmd->MessageID, DS_AppData.InputPipe);
 
         /*
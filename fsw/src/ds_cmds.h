@@ -60,6 +60,7 @@ void DS_CmdNoop(const CFE_SB_Buffer_t *BufPtr);
  *       - generate error event if invalid command packet length
  *       Process valid command packets
  *       - set selected housekeeping telemetry counters to zero
+ *       - have the storage writer reset the counters it keeps
  *       - generate success event (event type = debug)
  *
  *  \par Assumptions, External Events, and Notes:
@@ -67,10 +68,25 @@ void DS_CmdNoop(const CFE_SB_Buffer_t *BufPtr);
  *
  *  \param[in] BufPtr Software Bus message pointer
  *
- *  \sa #DS_RESET_CC, #DS_ResetCmd_t
+ *  \sa #DS_RESET_CC, #DS_ResetCmd_t, #DS_CmdResetFileCounters
  */
 void DS_CmdReset(const CFE_SB_Buffer_t *BufPtr);
 
+/**
+ *  \brief Reset storage writer counters
+ *
+ *  \par Description
+ *       Set the destination file command, flush, rotation, finalizer,
+ *       file I/O and destination table counters to zero
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by the storage writer for a #DS_WRITER_WORK_RESET record
+ *       with the writer lock held
+ *
+ *  \sa #DS_CmdReset
+ */
+void DS_CmdResetFileCounters(void);
+
 /**
  *  \brief Set application enable/disable state command handler
  *
@@ -81,6 +97,7 @@ void DS_CmdReset(const CFE_SB_Buffer_t *BufPtr);
  *       - generate error event if invalid enable/disable state
  *       Process valid command packets
  *       - update application enable/disable state
+ *       - have the storage writer update the Critical Data Store (CDS)
  *       - generate success event (event type = debug)
  *
  *  \par Assumptions, External Events, and Notes:
@@ -378,6 +395,28 @@ void DS_CmdSetDestCount(const CFE_SB_Buffer_t *BufPtr);
  */
 void DS_CmdCloseFile(const CFE_SB_Buffer_t *BufPtr);
 
+/**
+ *  \brief Flush data storage file write buffer command handler
+ *
+ *  \par Description
+ *       Write any data held in the write buffer for the selected
+ *       data storage file to the file. The file remains open.
+ *       Reject invalid command packets
+ *       - generate error event if invalid command packet length
+ *       - generate error event if invalid destination file index
+ *       Accept valid command packets
+ *       - flush the selected destination file write buffer
+ *       - generate success event (event type = debug)
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] BufPtr Software Bus message pointer
+ *
+ *  \sa #DS_FLUSH_FILE_CC, #DS_FlushFileCmd_t
+ */
+void DS_CmdFlushFile(const CFE_SB_Buffer_t *BufPtr);
+
 /**
  *  \brief Close all data storage files command handler
  *
@@ -421,6 +460,27 @@ void DS_CmdCloseAll(const CFE_SB_Buffer_t *BufPtr);
  */
 void DS_CmdGetFileInfo(const CFE_SB_Buffer_t *BufPtr);
 
+/**
+ *  \brief Get duplicate packet information telemetry packet command handler
+ *
+ *  \par Description
+ *       Create and send a telemetry packet containing the number of
+ *       repeated payloads dropped for each packet filter table entry.
+ *       Reject invalid command packets
+ *       - generate error event if invalid command packet length
+ *       Accept valid command packets
+ *       - generate duplicate packet info telemetry packet
+ *       - generate success event (event type = debug)
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] BufPtr Software Bus message pointer
+ *
+ *  \sa #DS_GET_DEDUP_INFO_CC, #DS_GetDedupInfoCmd_t, #DS_DedupInfoPkt_t
+ */
+void DS_CmdGetDedupInfo(const CFE_SB_Buffer_t *BufPtr);
+
 /**
  *  \brief Add Message ID to Packet Filter Table
  *
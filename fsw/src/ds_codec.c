@@ -0,0 +1,403 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,917-1, and identified as “CFS Data Storage
+ * (DS) application version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  CFS Data Storage (DS) block compression codecs
+ */
+
+#include "cfe.h"
+
+#include "ds_platform_cfg.h"
+#include "ds_verify.h"
+
+#include "ds_extern_typedefs.h"
+#include "ds_codec.h"
+
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Codec table (indexed by Destination File Table codec selection) */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+const DS_CodecEntry_t DS_CodecTable[DS_CODEC_COUNT] = {
+    /* DS_CODEC_NONE    */ {NULL, NULL},
+    /* DS_CODEC_LZ_FAST */ {DS_CodecCompressFast, DS_CodecDecompressLZ},
+    /* DS_CODEC_LZ_HIGH */ {DS_CodecCompressHigh, DS_CodecDecompressLZ},
+};
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compress a block                                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_CodecCompress(uint16 Codec, const uint8 *Data, uint32 Length, uint8 *Output, uint32 MaxSize,
+                        DS_CodecWork_t *Work)
+{
+    uint32 Result = 0;
+
+    if ((DS_FILE_COMPRESSION == true) && (Codec < DS_CODEC_COUNT) && (DS_CodecTable[Codec].Compress != NULL) &&
+        (Length <= DS_WRITE_BUFFER_MAX_SIZE))
+    {
+        Result = DS_CodecTable[Codec].Compress(Data, Length, Output, MaxSize, Work);
+
+        /*
+        ** Blocks that did not get smaller are stored as-is...
+        */
+        if (Result >= Length)
+        {
+            Result = 0;
+        }
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Decompress a block                                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_CodecDecompress(uint16 Codec, const uint8 *Data, uint32 Length, uint8 *Output, uint32 MaxSize)
+{
+    uint32 Result = 0;
+
+    if ((Codec < DS_CODEC_COUNT) && (DS_CodecTable[Codec].Decompress != NULL))
+    {
+        Result = DS_CodecTable[Codec].Decompress(Data, Length, Output, MaxSize);
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Fast LZ block compressor                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_CodecCompressFast(const uint8 *Data, uint32 Length, uint8 *Output, uint32 MaxSize, DS_CodecWork_t *Work)
+{
+    return DS_CodecCompressLZ(Data, Length, Output, MaxSize, Work, 1);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* High ratio LZ block compressor                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_CodecCompressHigh(const uint8 *Data, uint32 Length, uint8 *Output, uint32 MaxSize, DS_CodecWork_t *Work)
+{
+    return DS_CodecCompressLZ(Data, Length, Output, MaxSize, Work, DS_CODEC_HIGH_DEPTH);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LZ block compressor                                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_CodecCompressLZ(const uint8 *Data, uint32 Length, uint8 *Output, uint32 MaxSize, DS_CodecWork_t *Work,
+                          uint32 Depth)
+{
+    uint32 Position    = 0;
+    uint32 Anchor      = 0;
+    uint32 OutLength   = 0;
+    uint32 Candidate   = 0;
+    uint32 Tries       = 0;
+    uint32 MatchLength = 0;
+    uint32 BestLength  = 0;
+    uint32 BestOffset  = 0;
+    uint32 Hash        = 0;
+    uint32 i           = 0;
+    bool   Full        = false;
+
+    /*
+    ** Matches never reach back into a previous block...
+    */
+    memset(Work->Head, 0xFF, sizeof(Work->Head));
+
+    while ((Full == false) && ((Position + DS_CODEC_MIN_MATCH) <= Length))
+    {
+        /*
+        ** Add this position to the front of its hash chain...
+        */
+        Hash                  = DS_CodecHash(&Data[Position]);
+        Candidate             = Work->Head[Hash];
+        Work->Prev[Position]  = Candidate;
+        Work->Head[Hash]      = Position;
+
+        /*
+        ** Keep the longest match among the most recent candidates...
+        */
+        BestLength = 0;
+        BestOffset = 0;
+
+        for (Tries = 0; (Tries < Depth) && (Candidate != DS_CODEC_NO_POSITION) &&
+                        ((Position - Candidate) <= DS_CODEC_MAX_OFFSET);
+             Tries++)
+        {
+            MatchLength = 0;
+            while (((Position + MatchLength) < Length) && (Data[Candidate + MatchLength] == Data[Position + MatchLength]))
+            {
+                MatchLength++;
+            }
+
+            if (MatchLength > BestLength)
+            {
+                BestLength = MatchLength;
+                BestOffset = Position - Candidate;
+            }
+
+            Candidate = Work->Prev[Candidate];
+        }
+
+        if (BestLength >= DS_CODEC_MIN_MATCH)
+        {
+            OutLength = DS_CodecPutSequence(Output, OutLength, MaxSize, &Data[Anchor], Position - Anchor, BestOffset,
+                                            BestLength);
+            Full      = (OutLength == 0);
+
+            /*
+            ** Deeper searches also index the positions inside the match...
+            */
+            if (Depth > 1)
+            {
+                for (i = Position + 1; (i < (Position + BestLength)) && ((i + DS_CODEC_MIN_MATCH) <= Length); i++)
+                {
+                    Hash             = DS_CodecHash(&Data[i]);
+                    Work->Prev[i]    = Work->Head[Hash];
+                    Work->Head[Hash] = i;
+                }
+            }
+
+            Position += BestLength;
+            Anchor = Position;
+        }
+        else
+        {
+            Position++;
+        }
+    }
+
+    /*
+    ** Remaining bytes are written as literals...
+    */
+    if (Full == false)
+    {
+        OutLength = DS_CodecPutSequence(Output, OutLength, MaxSize, &Data[Anchor], Length - Anchor, 0, 0);
+    }
+
+    return OutLength;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write LZ sequence                                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_CodecPutSequence(uint8 *Output, uint32 Position, uint32 MaxSize, const uint8 *Literals,
+                           uint32 LiteralLength, uint32 MatchOffset, uint32 MatchLength)
+{
+    uint32 MatchCode = 0;
+    uint32 Needed    = 0;
+    uint32 Remaining = 0;
+
+    if (MatchLength != 0)
+    {
+        MatchCode = MatchLength - DS_CODEC_MIN_MATCH;
+        Needed    = 2 + (MatchCode / 255) + 1;
+    }
+
+    /*
+    ** Token, literal lengths and literals (plus offset and match lengths)...
+    */
+    Needed += 1 + (LiteralLength / 255) + 1 + LiteralLength;
+
+    if ((Position > MaxSize) || (Needed > (MaxSize - Position)))
+    {
+        Position = 0;
+    }
+    else
+    {
+        Output[Position++] = (uint8)(((LiteralLength < 15) ? LiteralLength : 15) << 4) |
+                             (uint8)((MatchCode < 15) ? MatchCode : 15);
+
+        if (LiteralLength >= 15)
+        {
+            for (Remaining = LiteralLength - 15; Remaining >= 255; Remaining -= 255)
+            {
+                Output[Position++] = 255;
+            }
+            Output[Position++] = (uint8)Remaining;
+        }
+
+        memcpy(&Output[Position], Literals, LiteralLength);
+        Position += LiteralLength;
+
+        if (MatchLength != 0)
+        {
+            Output[Position++] = (uint8)(MatchOffset & 0xFF);
+            Output[Position++] = (uint8)(MatchOffset >> 8);
+
+            if (MatchCode >= 15)
+            {
+                for (Remaining = MatchCode - 15; Remaining >= 255; Remaining -= 255)
+                {
+                    Output[Position++] = 255;
+                }
+                Output[Position++] = (uint8)Remaining;
+            }
+        }
+    }
+
+    return Position;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LZ match finder hash                                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_CodecHash(const uint8 *Data)
+{
+    uint32 Value;
+
+    memcpy(&Value, Data, sizeof(Value));
+
+    return (Value * 2654435761U) >> (32 - DS_CODEC_HASH_BITS);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Read LZ sequence length                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_CodecGetLength(const uint8 *Data, uint32 Length, uint32 *Position, uint32 Nibble, uint32 *Count)
+{
+    bool  Valid = true;
+    uint8 Byte  = 255;
+
+    *Count = Nibble;
+
+    if (Nibble == 15)
+    {
+        while (Valid && (Byte == 255))
+        {
+            Valid = (*Position < Length);
+            if (Valid)
+            {
+                Byte = Data[*Position];
+                (*Position)++;
+                *Count += Byte;
+            }
+        }
+    }
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LZ block decompressor                                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_CodecDecompressLZ(const uint8 *Data, uint32 Length, uint8 *Output, uint32 MaxSize)
+{
+    uint32 Position  = 0;
+    uint32 OutLength = 0;
+    uint32 Count     = 0;
+    uint32 Offset    = 0;
+    uint8  Token     = 0;
+    bool   Valid     = true;
+    bool   Done      = false;
+
+    while (Valid && (Done == false))
+    {
+        /*
+        ** Literals - the block ends after the literals of the last sequence...
+        */
+        Valid = (Position < Length);
+        if (Valid)
+        {
+            Token = Data[Position++];
+            Valid = DS_CodecGetLength(Data, Length, &Position, Token >> 4, &Count);
+        }
+
+        if (Valid)
+        {
+            Valid = (Count <= (Length - Position)) && (Count <= (MaxSize - OutLength));
+        }
+
+        if (Valid)
+        {
+            memcpy(&Output[OutLength], &Data[Position], Count);
+            Position += Count;
+            OutLength += Count;
+
+            Done = (Position == Length);
+        }
+
+        /*
+        ** Match - copied a byte at a time since it may overlap itself...
+        */
+        if (Valid && (Done == false))
+        {
+            Valid = ((Length - Position) >= 2);
+            if (Valid)
+            {
+                Offset = Data[Position] | ((uint32)Data[Position + 1] << 8);
+                Position += 2;
+                Valid = DS_CodecGetLength(Data, Length, &Position, Token & 0x0F, &Count);
+            }
+
+            if (Valid)
+            {
+                Count += DS_CODEC_MIN_MATCH;
+                Valid = (Offset != 0) && (Offset <= OutLength) && (Count <= (MaxSize - OutLength));
+            }
+
+            if (Valid)
+            {
+                while (Count > 0)
+                {
+                    Output[OutLength] = Output[OutLength - Offset];
+                    OutLength++;
+                    Count--;
+                }
+            }
+        }
+    }
+
+    if (Valid == false)
+    {
+        OutLength = 0;
+    }
+
+    return OutLength;
+}
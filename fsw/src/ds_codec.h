@@ -0,0 +1,315 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,917-1, and identified as “CFS Data Storage
+ * (DS) application version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  CFS Data Storage (DS) block compression codecs header file
+ */
+#ifndef DS_CODEC_H
+#define DS_CODEC_H
+
+#include "cfe.h"
+
+#include "ds_platform_cfg.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* DS block compression structures and definitions                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define DS_CODEC_COUNT 3 /**< \brief Number of codec selections (including #DS_CODEC_NONE) */
+
+#define DS_CODEC_FRAME_SYNC 0x44534342 /**< \brief Block frame sync word ("DSCB") */
+
+#define DS_CODEC_HASH_BITS  12 /**< \brief Match finder hash table size (log2 entries) */
+#define DS_CODEC_MIN_MATCH  4  /**< \brief Shortest match encoded */
+#define DS_CODEC_MAX_OFFSET 65535 /**< \brief Largest match distance encoded */
+#define DS_CODEC_HIGH_DEPTH 32 /**< \brief Match candidates searched by #DS_CODEC_LZ_HIGH */
+#define DS_CODEC_NO_POSITION 0xFFFFFFFF /**< \brief Empty match finder hash table entry */
+
+/**
+ * \brief Largest compressed size of a block of Length bytes
+ *
+ * Incompressible data grows by one length byte per 255 literals plus
+ * the sequence token.
+ */
+#define DS_CODEC_BOUND(Length) ((Length) + ((Length) / 255) + 16)
+
+/**
+ * \brief Compressed block frame
+ *
+ * Every block written to a compressed destination file starts with this
+ * frame (in host byte order, like the DS file header).  Readers find
+ * the next block from Length, and resynchronize on the sync word after
+ * a damaged block.  Codec is #DS_CODEC_NONE for blocks stored as-is.
+ *
+ * LZ blocks are a series of sequences: a token byte (literal count in
+ * the high nibble, match length minus #DS_CODEC_MIN_MATCH in the low
+ * nibble, 15 meaning more length bytes follow, each added until one is
+ * less than 255), the literals, then a 16 bit little endian match offset
+ * and any extra match length bytes.  The last sequence has literals only.
+ */
+typedef struct
+{
+    uint32 Sync;      /**< \brief Block sync word, #DS_CODEC_FRAME_SYNC */
+    uint16 Codec;     /**< \brief Block codec, #DS_CODEC_NONE when stored uncompressed */
+    uint16 Spare;     /**< \brief Structure padding */
+    uint32 RawLength; /**< \brief Packet bytes held in the block */
+    uint32 Length;    /**< \brief Block data bytes following the frame */
+    uint32 Crc;       /**< \brief cFE default CRC of the block data */
+} DS_CodecFrame_t;
+
+/**
+ * \brief Codec workspace
+ *
+ * Shared by all destinations - blocks are compressed one at a time
+ * with the destination file lock held.
+ */
+typedef struct
+{
+    uint32 Head[1 << DS_CODEC_HASH_BITS];  /**< \brief Most recent position for each hash */
+    uint32 Prev[DS_WRITE_BUFFER_MAX_SIZE]; /**< \brief Previous position with the same hash */
+    uint8  Block[sizeof(DS_CodecFrame_t) + DS_CODEC_BOUND(DS_WRITE_BUFFER_MAX_SIZE)]; /**< \brief Framed output */
+} DS_CodecWork_t;
+
+/**
+ * \brief Codec block compressor
+ *
+ * Returns the compressed length, or 0 if the output buffer is too small.
+ */
+typedef uint32 (*DS_CodecCompressFunc_t)(const uint8 *Data, uint32 Length, uint8 *Output, uint32 MaxSize,
+                                         DS_CodecWork_t *Work);
+
+/**
+ * \brief Codec block decompressor
+ *
+ * Returns the decompressed length, or 0 if the block is not valid.
+ */
+typedef uint32 (*DS_CodecDecompressFunc_t)(const uint8 *Data, uint32 Length, uint8 *Output, uint32 MaxSize);
+
+/**
+ * \brief Codec table entry
+ *
+ * Codecs are selected by their index in the codec table, which is the
+ * value of the Destination File Table Codec field.  New codecs only
+ * need an entry in the table (and #DS_CODEC_COUNT raised).
+ */
+typedef struct
+{
+    DS_CodecCompressFunc_t   Compress;   /**< \brief Block compressor */
+    DS_CodecDecompressFunc_t Decompress; /**< \brief Block decompressor */
+} DS_CodecEntry_t;
+
+/** \brief Codec table, indexed by codec selection */
+extern const DS_CodecEntry_t DS_CodecTable[DS_CODEC_COUNT];
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Prototypes for functions defined in ds_codec.c                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Compress a block
+ *
+ *  \par Description
+ *       Compresses Length bytes of Data with the selected codec.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Returns 0 (store the block as-is) for #DS_CODEC_NONE, an unknown
+ *       codec, a block larger than #DS_WRITE_BUFFER_MAX_SIZE, or when
+ *       the result would not be smaller than the input.
+ *
+ *  \param[in]  Codec   Codec selection
+ *  \param[in]  Data    Block data
+ *  \param[in]  Length  Block data length (bytes)
+ *  \param[out] Output  Compressed data
+ *  \param[in]  MaxSize Output buffer size (bytes)
+ *  \param[in]  Work    Codec workspace
+ *
+ *  \return Compressed length (bytes), 0 if not compressed
+ */
+uint32 DS_CodecCompress(uint16 Codec, const uint8 *Data, uint32 Length, uint8 *Output, uint32 MaxSize,
+                        DS_CodecWork_t *Work);
+
+/**
+ *  \brief Decompress a block
+ *
+ *  \par Description
+ *       Decompresses Length bytes of block data written with the
+ *       selected codec.  Used to check blocks on the ground and in
+ *       unit tests; flight software only writes blocks.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Every read and write is bounds checked, so damaged blocks
+ *       return 0 rather than overrunning either buffer.
+ *
+ *  \param[in]  Codec   Codec selection
+ *  \param[in]  Data    Compressed data
+ *  \param[in]  Length  Compressed data length (bytes)
+ *  \param[out] Output  Decompressed data
+ *  \param[in]  MaxSize Output buffer size (bytes)
+ *
+ *  \return Decompressed length (bytes), 0 if the block is not valid
+ */
+uint32 DS_CodecDecompress(uint16 Codec, const uint8 *Data, uint32 Length, uint8 *Output, uint32 MaxSize);
+
+/**
+ *  \brief LZ block compressor
+ *
+ *  \par Description
+ *       Greedy LZ77 compressor shared by the LZ codecs.  Each position
+ *       is hashed on its first #DS_CODEC_MIN_MATCH bytes and up to
+ *       Depth earlier positions with the same hash are compared.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A Depth of 1 only checks the most recent position and skips
+ *       hashing inside matches (#DS_CODEC_LZ_FAST).
+ *
+ *  \param[in]  Data    Block data
+ *  \param[in]  Length  Block data length (bytes)
+ *  \param[out] Output  Compressed data
+ *  \param[in]  MaxSize Output buffer size (bytes)
+ *  \param[in]  Work    Codec workspace
+ *  \param[in]  Depth   Match candidates searched at each position
+ *
+ *  \return Compressed length (bytes), 0 if the output buffer is too small
+ */
+uint32 DS_CodecCompressLZ(const uint8 *Data, uint32 Length, uint8 *Output, uint32 MaxSize, DS_CodecWork_t *Work,
+                          uint32 Depth);
+
+/**
+ *  \brief Fast LZ block compressor
+ *
+ *  \par Description
+ *       #DS_CODEC_LZ_FAST compressor - LZ compression checking one
+ *       match candidate per position.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in]  Data    Block data
+ *  \param[in]  Length  Block data length (bytes)
+ *  \param[out] Output  Compressed data
+ *  \param[in]  MaxSize Output buffer size (bytes)
+ *  \param[in]  Work    Codec workspace
+ *
+ *  \return Compressed length (bytes), 0 if the output buffer is too small
+ */
+uint32 DS_CodecCompressFast(const uint8 *Data, uint32 Length, uint8 *Output, uint32 MaxSize, DS_CodecWork_t *Work);
+
+/**
+ *  \brief High ratio LZ block compressor
+ *
+ *  \par Description
+ *       #DS_CODEC_LZ_HIGH compressor - LZ compression checking up to
+ *       #DS_CODEC_HIGH_DEPTH match candidates per position.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in]  Data    Block data
+ *  \param[in]  Length  Block data length (bytes)
+ *  \param[out] Output  Compressed data
+ *  \param[in]  MaxSize Output buffer size (bytes)
+ *  \param[in]  Work    Codec workspace
+ *
+ *  \return Compressed length (bytes), 0 if the output buffer is too small
+ */
+uint32 DS_CodecCompressHigh(const uint8 *Data, uint32 Length, uint8 *Output, uint32 MaxSize, DS_CodecWork_t *Work);
+
+/**
+ *  \brief Write LZ sequence
+ *
+ *  \par Description
+ *       Appends one sequence (literals followed by an optional match)
+ *       to the compressed data.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       MatchLength of 0 writes the final, literals only, sequence.
+ *
+ *  \param[out] Output        Compressed data
+ *  \param[in]  Position      Compressed data length so far (bytes)
+ *  \param[in]  MaxSize       Output buffer size (bytes)
+ *  \param[in]  Literals      Literal bytes
+ *  \param[in]  LiteralLength Literal byte count
+ *  \param[in]  MatchOffset   Match distance (bytes)
+ *  \param[in]  MatchLength   Match length (bytes), 0 = no match
+ *
+ *  \return New compressed data length (bytes), 0 if the output buffer is too small
+ */
+uint32 DS_CodecPutSequence(uint8 *Output, uint32 Position, uint32 MaxSize, const uint8 *Literals,
+                           uint32 LiteralLength, uint32 MatchOffset, uint32 MatchLength);
+
+/**
+ *  \brief LZ match finder hash
+ *
+ *  \par Description
+ *       Hashes the #DS_CODEC_MIN_MATCH bytes at Data into an index in
+ *       the match finder hash table.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Data need not be aligned.
+ *
+ *  \param[in] Data Block data at the position to hash
+ *
+ *  \return Hash table index
+ */
+uint32 DS_CodecHash(const uint8 *Data);
+
+/**
+ *  \brief Read LZ sequence length
+ *
+ *  \par Description
+ *       Reads a literal or match length: the token nibble, plus the
+ *       length bytes that follow when the nibble is 15.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in]     Data     Compressed data
+ *  \param[in]     Length   Compressed data length (bytes)
+ *  \param[in,out] Position Compressed data read position
+ *  \param[in]     Nibble   Length from the sequence token
+ *  \param[out]    Count    Length read
+ *
+ *  \return Length read without running past the end of the data
+ */
+bool DS_CodecGetLength(const uint8 *Data, uint32 Length, uint32 *Position, uint32 Nibble, uint32 *Count);
+
+/**
+ *  \brief LZ block decompressor
+ *
+ *  \par Description
+ *       Decodes a block written by #DS_CodecCompressLZ.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in]  Data    Compressed data
+ *  \param[in]  Length  Compressed data length (bytes)
+ *  \param[out] Output  Decompressed data
+ *  \param[in]  MaxSize Output buffer size (bytes)
+ *
+ *  \return Decompressed length (bytes), 0 if the block is not valid
+ */
+uint32 DS_CodecDecompressLZ(const uint8 *Data, uint32 Length, uint8 *Output, uint32 MaxSize);
+
+#endif
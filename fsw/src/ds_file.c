@@ -35,6 +35,10 @@
 #include "ds_app.h"
 #include "ds_file.h"
 #include "ds_table.h"
+#include "ds_writer.h"
+#include "ds_finalize.h"
+#include "ds_fsext.h"
+#include "ds_codec.h"
 #include "ds_events.h"
 
 #include <stdio.h>
@@ -42,6 +46,9 @@
 #define DS_PKT_SEQUENCE_BASED_FILTER_TYPE 1
 #define DS_PKT_TIME_BASED_FILTER_TYPE     2
 
+#define DS_FNV_OFFSET_BASIS 0xCBF29CE484222325ULL /* 64 bit FNV-1a hash */
+#define DS_FNV_PRIME        0x00000100000001B3ULL
+
 #define DS_16_MSB_SUBSECS_SHIFT 16
 #define DS_11_LSB_SECONDS_MASK  0x07FF
 #define DS_11_LSB_SECONDS_SHIFT 4
@@ -61,14 +68,10 @@ bool DS_IsPacketFiltered(CFE_MSG_Message_t *MessagePtr, uint16 FilterType, uint1
     ** Algorithm_X = out of every group of this many packets
     ** Algorithm_O = starting at this offset within the group
     */
-    bool                    PacketIsFiltered = false;
-    CFE_TIME_SysTime_t      PacketTime;
-    uint16                  PacketValue;
-    uint16                  Seconds;
-    uint16                  Subsecs;
-    CFE_MSG_SequenceCount_t SeqCnt = 0;
+    bool             PacketIsFiltered = false;
+    DS_RouteFilter_t RouteFilter;
 
-    memset(&PacketTime, 0, sizeof(PacketTime));
+    memset(&RouteFilter, 0, sizeof(RouteFilter));
 
     /*
     ** Verify input values (all errors = packet is filtered)...
@@ -110,71 +113,298 @@ bool DS_IsPacketFiltered(CFE_MSG_Message_t *MessagePtr, uint16 FilterType, uint1
     }
     else
     {
-        if (FilterType == DS_PKT_SEQUENCE_BASED_FILTER_TYPE)
+        /*
+        ** Apply the filter algorithm (common for both filter types)...
+        */
+        RouteFilter.FilterType  = FilterType;
+        RouteFilter.Algorithm_N = Algorithm_N;
+        RouteFilter.Algorithm_X = Algorithm_X;
+        RouteFilter.Algorithm_O = Algorithm_O;
+        RouteFilter.Reciprocal  = DS_ROUTE_RECIPROCAL(Algorithm_X);
+
+        PacketIsFiltered = DS_IsRouteFiltered(&RouteFilter, DS_FilterPacketValue(MessagePtr, FilterType));
+    }
+
+    return PacketIsFiltered;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Create packet filter value from Software Bus packet             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint16 DS_FilterPacketValue(CFE_MSG_Message_t *MessagePtr, uint16 FilterType)
+{
+    CFE_TIME_SysTime_t      PacketTime;
+    uint16                  PacketValue;
+    uint16                  Seconds;
+    uint16                  Subsecs;
+    CFE_MSG_SequenceCount_t SeqCnt = 0;
+
+    memset(&PacketTime, 0, sizeof(PacketTime));
+
+    if (FilterType == DS_PKT_SEQUENCE_BASED_FILTER_TYPE)
+    {
+        /*
+        ** Create packet filter value from packet sequence count...
+        */
+        CFE_MSG_GetSequenceCount(MessagePtr, &SeqCnt);
+        PacketValue = (uint16)SeqCnt;
+    }
+    else
+    {
+        /*
+        ** Create packet filter value from packet timestamp...
+        */
+        CFE_MSG_GetMsgTime(MessagePtr, &PacketTime);
+
+        /*
+        ** Get the least significant 11 bits of timestamp seconds...
+        */
+        Seconds = (uint16)PacketTime.Seconds;
+        Seconds = Seconds & DS_11_LSB_SECONDS_MASK;
+
+        /*
+        ** Get the most significant 4 bits of timestamp subsecs...
+        */
+        Subsecs = (uint16)(PacketTime.Subseconds >> DS_16_MSB_SUBSECS_SHIFT);
+        Subsecs = Subsecs & DS_4_MSB_SUBSECS_MASK;
+
+        /*
+        ** Shift seconds and subsecs to allow merge...
+        */
+        Seconds = Seconds << DS_11_LSB_SECONDS_SHIFT;
+        Subsecs = Subsecs >> DS_4_MSB_SUBSECS_SHIFT;
+
+        /*
+        ** Merge seconds and subsecs to create packet filter value...
+        */
+        PacketValue = Seconds | Subsecs;
+    }
+
+    return PacketValue;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Apply pre-validated routing plan filter to packet filter value  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool DS_IsRouteFiltered(const DS_RouteFilter_t *RouteFilter, uint16 PacketValue)
+{
+    bool   PacketIsFiltered = false;
+    uint32 Fraction         = 0;
+    uint32 GroupPosition    = 0;
+
+    if (PacketValue < RouteFilter->Algorithm_O)
+    {
+        /*
+        ** Value is less than offset of passed range...
+        */
+        PacketIsFiltered = true;
+    }
+    else
+    {
+        /*
+        ** Compute (PacketValue - Algorithm_O) % Algorithm_X without a divide. The
+        ** low 32 bits of value * reciprocal are the fractional part of the quotient,
+        ** and scaling that fraction by the group size recovers the exact remainder
+        ** for any 16 bit value and group size...
+        */
+        Fraction      = RouteFilter->Reciprocal * (uint32)(PacketValue - RouteFilter->Algorithm_O);
+        GroupPosition = (uint32)(((uint64)Fraction * RouteFilter->Algorithm_X) >> 32);
+
+        if (GroupPosition < RouteFilter->Algorithm_N)
         {
             /*
-            ** Create packet filter value from packet sequence count...
+            ** This packet was passed by the filter algorithm...
             */
-            CFE_MSG_GetSequenceCount(MessagePtr, &SeqCnt);
-            PacketValue = (uint16)SeqCnt;
+            PacketIsFiltered = false;
         }
         else
         {
             /*
-            ** Create packet filter value from packet timestamp...
-            */
-            CFE_MSG_GetMsgTime(MessagePtr, &PacketTime);
-
-            /*
-            ** Get the least significant 11 bits of timestamp seconds...
+            ** This packet was filtered by the filter algorithm...
             */
-            Seconds = (uint16)PacketTime.Seconds;
-            Seconds = Seconds & DS_11_LSB_SECONDS_MASK;
+            PacketIsFiltered = true;
+        }
+    }
 
-            /*
-            ** Get the most significant 4 bits of timestamp subsecs...
-            */
-            Subsecs = (uint16)(PacketTime.Subseconds >> DS_16_MSB_SUBSECS_SHIFT);
-            Subsecs = Subsecs & DS_4_MSB_SUBSECS_MASK;
+    return PacketIsFiltered;
+}
 
-            /*
-            ** Shift seconds and subsecs to allow merge...
-            */
-            Seconds = Seconds << DS_11_LSB_SECONDS_SHIFT;
-            Subsecs = Subsecs >> DS_4_MSB_SUBSECS_SHIFT;
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Apply routing plan payload predicates to Software Bus packet    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool DS_IsPredicateFiltered(const DS_RoutePlan_t *RoutePlan, const CFE_SB_Buffer_t *BufPtr, size_t PacketLength)
+{
+    const uint8 *              Packet    = (const uint8 *)BufPtr;
+    const DS_RoutePredicate_t *Predicate = RoutePlan->Predicate;
+    bool                       Mismatch  = true;
+    uint16                     i         = 0;
 
-            /*
-            ** Merge seconds and subsecs to create packet filter value...
-            */
-            PacketValue = Seconds | Subsecs;
-        }
+    /*
+    ** Offsets were checked against MinLength - shorter packets never match...
+    */
+    if (PacketLength >= RoutePlan->MinLength)
+    {
+        Mismatch = false;
 
         /*
-        ** Apply the filter algorithm (common for both filter types)...
+        ** Every predicate is evaluated - no early exit, no per-predicate branch...
         */
-        if (PacketValue < Algorithm_O)
+        for (i = 0; i < RoutePlan->PredicateCount; i++)
         {
-            /*
-            ** Value is less than offset of passed range...
-            */
-            PacketIsFiltered = true;
+            Mismatch |= (((Packet[Predicate[i].Offset] & Predicate[i].Mask) == Predicate[i].Value) !=
+                         Predicate[i].Expect);
         }
-        else if (((PacketValue - Algorithm_O) % Algorithm_X) < Algorithm_N)
+    }
+
+    return Mismatch;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Create packet content fingerprint from Software Bus packet      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint64 DS_FilterPacketFingerprint(const CFE_SB_Buffer_t *BufPtr)
+{
+    const uint8 *  Packet       = (const uint8 *)BufPtr;
+    uint64         Fingerprint  = DS_FNV_OFFSET_BASIS;
+    size_t         PacketLength = 0;
+    size_t         HeaderLength = sizeof(CFE_MSG_CommandHeader_t);
+    size_t         i            = 0;
+    CFE_MSG_Type_t PacketType   = CFE_MSG_Type_Invalid;
+
+    CFE_MSG_GetSize(&BufPtr->Msg, &PacketLength);
+    CFE_MSG_GetType(&BufPtr->Msg, &PacketType);
+
+    /*
+    ** Skip the header - timestamp, sequence count and checksum change
+    **   when the payload does not...
+    */
+    if (PacketType == CFE_MSG_Type_Tlm)
+    {
+        HeaderLength = sizeof(CFE_MSG_TelemetryHeader_t);
+    }
+
+    for (i = 0; i < sizeof(PacketLength); i++)
+    {
+        Fingerprint = (Fingerprint ^ (uint8)(PacketLength >> (8 * i))) * DS_FNV_PRIME;
+    }
+
+    for (i = HeaderLength; i < PacketLength; i++)
+    {
+        Fingerprint = (Fingerprint ^ Packet[i]) * DS_FNV_PRIME;
+    }
+
+    return Fingerprint;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Apply routing plan content filter to packet fingerprint         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool DS_IsContentFiltered(DS_RouteFilter_t *RouteFilter, uint64 Fingerprint)
+{
+    bool PacketIsFiltered = false;
+
+    if (RouteFilter->Primed && (RouteFilter->Fingerprint == Fingerprint) &&
+        ((RouteFilter->Repeats + 1) < RouteFilter->Algorithm_X))
+    {
+        /*
+        ** Same payload as the last stored packet...
+        */
+        RouteFilter->Repeats++;
+        PacketIsFiltered = true;
+    }
+    else
+    {
+        /*
+        ** New payload or keep-alive is due - this one is stored...
+        */
+        RouteFilter->Primed      = true;
+        RouteFilter->Fingerprint = Fingerprint;
+        RouteFilter->Repeats     = 0;
+    }
+
+    return PacketIsFiltered;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Apply routing plan rate filter (token bucket) to packet         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool DS_IsRateFiltered(DS_RouteFilter_t *RouteFilter, CFE_TIME_SysTime_t PacketTime, size_t PacketLength)
+{
+    bool   PacketIsFiltered = false;
+    uint16 Scale            = 0;
+    uint64 Capacity         = 0;
+    uint64 Tokens           = RouteFilter->Tokens;
+    uint64 Cost             = (uint64)1 << DS_RATE_TOKEN_SHIFT;
+    uint64 Now              = ((uint64)PacketTime.Seconds << 32) | PacketTime.Subseconds;
+    uint64 Then             = ((uint64)RouteFilter->RefillTime.Seconds << 32) | RouteFilter->RefillTime.Subseconds;
+
+    if (RouteFilter->FilterType == DS_BY_BYTE_RATE)
+    {
+        /*
+        ** Byte rate and burst are in units of 2^Algorithm_O bytes...
+        */
+        Scale = RouteFilter->Algorithm_O;
+        Cost  = (uint64)PacketLength << DS_RATE_TOKEN_SHIFT;
+    }
+
+    Capacity = ((uint64)RouteFilter->Algorithm_X << Scale) << DS_RATE_TOKEN_SHIFT;
+
+    if (!RouteFilter->Primed)
+    {
+        /*
+        ** First packet - bucket starts full...
+        */
+        Tokens              = Capacity;
+        RouteFilter->Primed = true;
+    }
+    else if (Now > Then)
+    {
+        if ((PacketTime.Seconds - RouteFilter->RefillTime.Seconds) >= RouteFilter->Algorithm_X)
         {
             /*
-            ** This packet was passed by the filter algorithm...
+            ** Refill rate is at least one per second - long gaps fill the bucket...
             */
-            PacketIsFiltered = false;
+            Tokens = Capacity;
         }
         else
         {
             /*
-            ** This packet was filtered by the filter algorithm...
+            ** Gap is under 2^16 seconds (2^48 subsecond ticks), so the product
+            **   fits, and so does the refill scaled by up to 2^16...
             */
-            PacketIsFiltered = true;
+            Tokens += (((Now - Then) * RouteFilter->Algorithm_N) >> (32 - DS_RATE_TOKEN_SHIFT)) << Scale;
+            if (Tokens > Capacity)
+            {
+                Tokens = Capacity;
+            }
         }
     }
 
+    RouteFilter->RefillTime = PacketTime;
+
+    if (Tokens >= Cost)
+    {
+        Tokens -= Cost;
+    }
+    else
+    {
+        PacketIsFiltered = true;
+    }
+
+    RouteFilter->Tokens = Tokens;
+
     return PacketIsFiltered;
 }
 
@@ -186,13 +416,22 @@ bool DS_IsPacketFiltered(CFE_MSG_Message_t *MessagePtr, uint16 FilterType, uint1
 
 void DS_FileStorePacket(CFE_SB_MsgId_t MessageID, const CFE_SB_Buffer_t *BufPtr)
 {
-    DS_PacketEntry_t *PacketEntry  = NULL;
-    DS_FilterParms_t *FilterParms  = NULL;
-    bool              PassedFilter = false;
-    bool              FilterResult = false;
-    int32             FilterIndex  = 0;
-    int32             FileIndex    = 0;
-    int32             i            = 0;
+    DS_RoutePlan_t *   RoutePlan    = NULL;
+    DS_RouteFilter_t * RouteFilter  = NULL;
+    bool               FilterResult = false;
+    int32              FilterIndex  = 0;
+    int32              i            = 0;
+    uint16             DestCount    = 0;
+    uint16             ValueMask    = 0;
+    bool               Duplicate    = false;
+    bool               RateLimited  = false;
+    bool               Mismatch     = false;
+    uint64             Fingerprint  = 0;
+    size_t             PacketLength = 0;
+    CFE_TIME_SysTime_t PacketTime   = {0};
+    uint16             DestIndex[DS_FILTERS_PER_PACKET];
+    uint16             PacketValue[DS_BY_CONTENT + 1];
+    DS_WriterRecord_t  Record;
 
     /*
     ** Convert packet MessageID to packet filter table index...
@@ -208,51 +447,121 @@ void DS_FileStorePacket(CFE_SB_MsgId_t MessageID, const CFE_SB_Buffer_t *BufPtr)
     }
     else
     {
-        PacketEntry  = &DS_AppData.FilterTblPtr->Packet[FilterIndex];
-        PassedFilter = false;
-
         /*
-        ** Each packet has multiple filters for multiple files...
+        ** Routing plan holds only active filters with valid parameters...
         */
-        for (i = 0; i < DS_FILTERS_PER_PACKET; i++)
+        RoutePlan = &DS_AppData.RoutePlan[FilterIndex];
+
+        for (i = 0; i < RoutePlan->FilterCount; i++)
         {
-            FilterParms = &PacketEntry->Filter[i];
+            RouteFilter = &RoutePlan->Filter[i];
 
             /*
-            ** Ignore unused and invalid filters...
+            ** Ignore disabled destination files...
             */
-            if ((FilterParms->Algorithm_N != DS_UNUSED) && (FilterParms->FileTableIndex < DS_DEST_FILE_CNT))
+            if (DS_AppData.FileStatus[RouteFilter->FileIndex].FileState == DS_ENABLED)
             {
-                FileIndex = FilterParms->FileTableIndex;
                 /*
-                ** Ignore disabled destination files...
+                ** Create each kind of packet filter value at most once per packet...
                 */
-                if (DS_AppData.FileStatus[FileIndex].FileState == DS_ENABLED)
+                if ((ValueMask & (1 << RouteFilter->FilterType)) == 0)
                 {
-                    /*
-                    ** Apply filter algorithm to the packet...
-                    */
-                    FilterResult = DS_IsPacketFiltered((CFE_MSG_Message_t *)BufPtr, FilterParms->FilterType,
-                                                       FilterParms->Algorithm_N, FilterParms->Algorithm_X,
-                                                       FilterParms->Algorithm_O);
-                    if (FilterResult == false)
+                    if (RouteFilter->FilterType == DS_BY_CONTENT)
+                    {
+                        Fingerprint = DS_FilterPacketFingerprint(BufPtr);
+                    }
+                    else if ((RouteFilter->FilterType == DS_BY_PKT_RATE) ||
+                             (RouteFilter->FilterType == DS_BY_BYTE_RATE))
+                    {
+                        /*
+                        ** Both rate filter types share the packet time and length - mission
+                        **   elapsed time is not moved by spacecraft time corrections...
+                        */
+                        PacketTime = CFE_TIME_GetMET();
+                        CFE_MSG_GetSize(&BufPtr->Msg, &PacketLength);
+                        ValueMask |= (1 << DS_BY_PKT_RATE) | (1 << DS_BY_BYTE_RATE);
+                    }
+                    else if (RouteFilter->FilterType == DS_BY_PREDICATE)
                     {
                         /*
-                        ** Write unfiltered packets to destination file...
+                        ** All predicate filters share the packet entry predicates...
                         */
-                        DS_FileSetupWrite(FileIndex, BufPtr);
-                        PassedFilter = true;
+                        CFE_MSG_GetSize(&BufPtr->Msg, &PacketLength);
+                        Mismatch = DS_IsPredicateFiltered(RoutePlan, BufPtr, PacketLength);
+                    }
+                    else
+                    {
+                        PacketValue[RouteFilter->FilterType] =
+                            DS_FilterPacketValue((CFE_MSG_Message_t *)BufPtr, RouteFilter->FilterType);
                     }
+                    ValueMask |= (1 << RouteFilter->FilterType);
+                }
+
+                /*
+                ** Apply filter algorithm to the packet...
+                */
+                if (RouteFilter->FilterType == DS_BY_CONTENT)
+                {
+                    FilterResult = DS_IsContentFiltered(RouteFilter, Fingerprint);
+                    Duplicate    = (Duplicate || FilterResult);
+                }
+                else if ((RouteFilter->FilterType == DS_BY_PKT_RATE) || (RouteFilter->FilterType == DS_BY_BYTE_RATE))
+                {
+                    FilterResult = DS_IsRateFiltered(RouteFilter, PacketTime, PacketLength);
+                    RateLimited  = (RateLimited || FilterResult);
+                }
+                else if (RouteFilter->FilterType == DS_BY_PREDICATE)
+                {
+                    FilterResult = Mismatch;
+                }
+                else
+                {
+                    FilterResult = DS_IsRouteFiltered(RouteFilter, PacketValue[RouteFilter->FilterType]);
+                }
+
+                if (FilterResult == false)
+                {
+                    /*
+                    ** Unfiltered packets will be written to this destination file...
+                    */
+                    DestIndex[DestCount] = RouteFilter->FileIndex;
+                    DestCount++;
                 }
             }
         }
 
+        /*
+        ** Count packets a content filter found to repeat a stored payload...
+        */
+        if (Duplicate)
+        {
+            DS_AppData.DuplicatePktCounter[FilterIndex]++;
+        }
+
+        /*
+        ** Count packets a rate filter dropped for at least one destination...
+        */
+        if (RateLimited)
+        {
+            DS_AppData.RateLimitedPktCounter++;
+        }
+
         /*
         ** Count packet as passed if any filters passed...
         */
-        if (PassedFilter)
+        if (DestCount > 0)
         {
             DS_AppData.PassedPktCounter++;
+
+            /*
+            ** Hand the packet and its destination files to the storage writer...
+            */
+            memset(&Record, 0, sizeof(Record));
+            Record.Type      = DS_WRITER_PACKET;
+            Record.DestCount = DestCount;
+            memcpy(Record.DestIndex, DestIndex, DestCount * sizeof(DestIndex[0]));
+
+            DS_WriterSubmit(&Record, BufPtr);
         }
         else
         {
@@ -273,17 +582,33 @@ void DS_FileSetupWrite(int32 FileIndex, const CFE_SB_Buffer_t *BufPtr)
     DS_AppFileStatus_t *FileStatus   = &DS_AppData.FileStatus[FileIndex];
     bool                OpenNewFile  = false;
     size_t              PacketLength = 0;
+    size_t              WriteLength  = 0;
+    CFE_TIME_SysTime_t  StartTime;
 
     /*
     ** Create local pointers for array indexed data...
     */
     CFE_MSG_GetSize(&BufPtr->Msg, &PacketLength);
 
+    /*
+    ** Records can grow the file by more than the packet length...
+    */
+    WriteLength = PacketLength;
+    if (FileStatus->SuperframeSize != 0)
+    {
+        WriteLength = DS_FileSuperframeGrowth(FileIndex, PacketLength);
+    }
+    else if (FileStatus->DeltaKeyframe != 0)
+    {
+        WriteLength += sizeof(DS_DeltaRecord_t);
+    }
+
     if (!OS_ObjectIdDefined(FileStatus->FileHandle))
     {
         /*
         ** 1st packet since destination enabled or file closed...
         */
+        StartTime   = CFE_TIME_GetMET();
         OpenNewFile = true;
     }
     else
@@ -291,21 +616,26 @@ void DS_FileSetupWrite(int32 FileIndex, const CFE_SB_Buffer_t *BufPtr)
         /*
         ** Test size of existing destination file...
         */
-        if ((FileStatus->FileSize + PacketLength) > DestFile->MaxFileSize)
+        if ((FileStatus->FileSize + WriteLength) > DestFile->MaxFileSize)
         {
             /*
             ** This packet would cause file to exceed max size limit...
             */
-            DS_FileUpdateHeader(FileIndex);
+            StartTime = CFE_TIME_GetMET();
             DS_FileCloseDest(FileIndex);
-            OpenNewFile = true;
+
+            /*
+            ** Destination is disabled if the write buffer could not be flushed...
+            */
+            OpenNewFile = (FileStatus->FileState == DS_ENABLED);
         }
         else
         {
             /*
             ** File size is OK - write packet data to file...
             */
-            DS_FileWriteData(FileIndex, BufPtr, PacketLength);
+            DS_FileWritePacket(FileIndex, BufPtr, PacketLength);
+            DS_FileSummaryUpdate(FileIndex, BufPtr, PacketLength);
         }
     }
 
@@ -319,12 +649,15 @@ void DS_FileSetupWrite(int32 FileIndex, const CFE_SB_Buffer_t *BufPtr)
 
         if (OS_ObjectIdDefined(FileStatus->FileHandle))
         {
+            DS_FileRotationDone(StartTime);
+
             /*
             ** By writing the first packet without first performing a size
             **   limit test, we avoid issues resulting from having the max
             **   file size set less than the size of one packet...
             */
-            DS_FileWriteData(FileIndex, BufPtr, PacketLength);
+            DS_FileWritePacket(FileIndex, BufPtr, PacketLength);
+            DS_FileSummaryUpdate(FileIndex, BufPtr, PacketLength);
         }
     }
 
@@ -332,6 +665,12 @@ void DS_FileSetupWrite(int32 FileIndex, const CFE_SB_Buffer_t *BufPtr)
     ** If the write did not occur due to I/O error (create or write)
     **   then current state = file closed and destination disabled...
     */
+
+    /*
+    ** Open the next file as soon as this write takes the file past the
+    **   pre-open threshold, rather than waiting for the next age tick...
+    */
+    DS_FileTestPreopenDest(FileIndex);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -343,46 +682,233 @@ void DS_FileSetupWrite(int32 FileIndex, const CFE_SB_Buffer_t *BufPtr)
 void DS_FileWriteData(int32 FileIndex, const void *FileData, uint32 DataLength)
 {
     DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+    uint32              BufferSize = DS_AppData.DestFileTblPtr->File[FileIndex].BufferSize;
     int32               Result     = CFE_SUCCESS;
 
-    /*
-    ** Let cFE manage the file I/O...
-    */
-    Result = OS_write(FileStatus->FileHandle, FileData, DataLength);
-    if (Result == DataLength)
+    if (FileStatus->Direct)
     {
         /*
-        ** Success - update file size and data rate counters...
+        ** Direct I/O - every packet goes through the write buffer...
         */
-        DS_AppData.FileWriteCounter++;
-
-        FileStatus->FileSize += DataLength;
-        FileStatus->FileGrowth += DataLength;
+        DS_FileWriteDirect(FileIndex, FileData, DataLength);
     }
     else
     {
         /*
-        ** Error - send event, close file and disable destination...
+        ** Make room in the write buffer (if any) for this packet...
         */
-        DS_FileWriteError(FileIndex, DataLength, Result);
-    }
-}
-
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-/*                                                                 */
-/* Write header to destination file                                */
-/*                                                                 */
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-
-void DS_FileWriteHeader(int32 FileIndex)
-{
-#if (DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE)
+        if ((FileStatus->BufferedBytes + DataLength) > BufferSize)
+        {
+            Result = DS_FileFlushBuffer(FileIndex);
+        }
 
-    DS_DestFileEntry_t *DestFile   = &DS_AppData.DestFileTblPtr->File[FileIndex];
+        if (Result != CFE_SUCCESS)
+        {
+            /*
+            ** Flush failed - file has been closed and destination disabled...
+            */
+        }
+        else if ((BufferSize != 0) && (DataLength <= BufferSize))
+        {
+            /*
+            ** Append packet to write buffer - update file size and data rate counters...
+            */
+            memcpy(&DS_WRITE_BUFFER(FileIndex)[FileStatus->BufferedBytes], FileData, DataLength);
+            FileStatus->BufferedBytes += DataLength;
+
+            DS_AppData.FileWriteCounter++;
+
+            FileStatus->FileSize += DataLength;
+            FileStatus->FileGrowth += DataLength;
+            FileStatus->SyncBytes += DataLength;
+
+            /*
+            ** Write buffer to file as soon as it is full...
+            */
+            if (FileStatus->BufferedBytes == BufferSize)
+            {
+                DS_FileFlushBuffer(FileIndex);
+            }
+        }
+        else if (FileStatus->Codec != DS_CODEC_NONE)
+        {
+            /*
+            ** Packet does not fit the write buffer - frame it as its own block...
+            */
+            Result = DS_FileWriteBlock(FileIndex, FileData, DataLength);
+            if (Result > 0)
+            {
+                DS_AppData.FileWriteCounter++;
+
+                FileStatus->FileSize += Result;
+                FileStatus->FileGrowth += DataLength;
+                FileStatus->SyncBytes += Result;
+            }
+            else
+            {
+                DS_FileWriteError(FileIndex, DataLength, Result);
+            }
+        }
+        else
+        {
+            /*
+            ** Let cFE manage the file I/O...
+            */
+            Result = OS_write(FileStatus->FileHandle, FileData, DataLength);
+            if (Result == DataLength)
+            {
+                /*
+                ** Success - update file size and data rate counters...
+                */
+                DS_AppData.FileWriteCounter++;
+
+                FileStatus->FileSize += DataLength;
+                FileStatus->FileGrowth += DataLength;
+                FileStatus->SyncBytes += DataLength;
+            }
+            else
+            {
+                /*
+                ** Error - send event, close file and disable destination...
+                */
+                DS_FileWriteError(FileIndex, DataLength, Result);
+            }
+        }
+    }
+
+    /*
+    ** Apply the destination sync policy (unless the write closed the file)...
+    */
+    if (OS_ObjectIdDefined(FileStatus->FileHandle))
+    {
+        DS_FileTestSync(FileIndex);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write data to direct I/O destination file                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileWriteDirect(int32 FileIndex, const void *FileData, uint32 DataLength)
+{
+    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+    uint32              BufferSize = DS_AppData.DestFileTblPtr->File[FileIndex].BufferSize;
+    uint8 *             Buffer     = DS_WRITE_BUFFER(FileIndex);
+    const uint8 *       Data       = FileData;
+    uint32              Remaining  = DataLength;
+    uint32              Capacity   = 0;
+    uint32              Length     = 0;
+    int32               Result     = CFE_SUCCESS;
+
+    /*
+    ** Table may have been updated since the file was opened - always
+    **   stage whole blocks...
+    */
+    BufferSize &= ~(uint32)(DS_DIRECT_IO_BLOCK_SIZE - 1);
+    if (BufferSize == 0)
+    {
+        BufferSize = DS_DIRECT_IO_BLOCK_SIZE;
+    }
+
+    while ((Remaining > 0) && (Result == CFE_SUCCESS))
+    {
+        /*
+        ** Buffer always ends on a block boundary (the first buffer after
+        **   the file header is short, so later buffers are aligned)...
+        */
+        Capacity = BufferSize - (FileStatus->DirectOffset % DS_DIRECT_IO_BLOCK_SIZE);
+
+        if (FileStatus->BufferedBytes >= Capacity)
+        {
+            Result = DS_FileFlushBuffer(FileIndex);
+        }
+        else
+        {
+            /*
+            ** Packets larger than the buffer are split across flushes...
+            */
+            Length = Capacity - FileStatus->BufferedBytes;
+            if (Length > Remaining)
+            {
+                Length = Remaining;
+            }
+
+            memcpy(&Buffer[FileStatus->BufferedBytes], Data, Length);
+            FileStatus->BufferedBytes += Length;
+
+            Data += Length;
+            Remaining -= Length;
+
+            if (FileStatus->BufferedBytes == Capacity)
+            {
+                Result = DS_FileFlushBuffer(FileIndex);
+            }
+        }
+    }
+
+    if (Result == CFE_SUCCESS)
+    {
+        /*
+        ** Success - update file size and data rate counters...
+        */
+        DS_AppData.FileWriteCounter++;
+
+        FileStatus->FileSize += DataLength;
+        FileStatus->FileGrowth += DataLength;
+        FileStatus->SyncBytes += DataLength;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write header to destination file                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileWriteHeader(int32 FileIndex)
+{
     DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+    uint32              DataLength = 0;
+    int32               Result     = CFE_SUCCESS;
+
+    Result = DS_FileWriteHeaderData(FileIndex, FileStatus->FileHandle, FileStatus->FileName, &DataLength);
+
+    if (Result == CFE_SUCCESS)
+    {
+        /*
+        ** Success - update file size and data rate counters...
+        */
+        FileStatus->FileSize += DataLength;
+        FileStatus->FileGrowth += DataLength;
+    }
+    else
+    {
+        /*
+        ** Error - send event, close file and disable destination...
+        */
+        DS_FileWriteError(FileIndex, DataLength, Result);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write header to an open file                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FileWriteHeaderData(int32 FileIndex, osal_id_t FileHandle, const char *FileName, uint32 *DataLength)
+{
+    int32 Result = CFE_SUCCESS;
+
+    *DataLength = 0;
+
+#if (DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE)
+
+    DS_DestFileEntry_t *DestFile = &DS_AppData.DestFileTblPtr->File[FileIndex];
     CFE_FS_Header_t     CFE_FS_Header;
     DS_FileHeader_t     DS_FileHeader;
-    int32               Result = CFE_SUCCESS;
 
     /*
     ** Initialize selected parts of the cFE file header...
@@ -392,57 +918,45 @@ void DS_FileWriteHeader(int32 FileIndex)
     /*
     ** Let cFE finish the init and write the primary header...
     */
-    Result = CFE_FS_WriteHeader(FileStatus->FileHandle, &CFE_FS_Header);
+    Result = CFE_FS_WriteHeader(FileHandle, &CFE_FS_Header);
 
     if (Result == sizeof(CFE_FS_Header_t))
     {
-        /*
-        ** Success - update file size and data rate counters...
-        */
         DS_AppData.FileWriteCounter++;
 
-        FileStatus->FileSize += sizeof(CFE_FS_Header_t);
-        FileStatus->FileGrowth += sizeof(CFE_FS_Header_t);
-
         /*
         ** Initialize the DS file header...
         */
         memset(&DS_FileHeader, 0, sizeof(DS_FileHeader));
+        DS_FileHeader.Version        = DS_FILE_HEADER_VERSION;
         DS_FileHeader.FileTableIndex = FileIndex;
         DS_FileHeader.FileNameType   = DestFile->FileNameType;
-        strncpy(DS_FileHeader.FileName, FileStatus->FileName, sizeof(DS_FileHeader.FileName));
+        strncpy(DS_FileHeader.FileName, FileName, sizeof(DS_FileHeader.FileName));
 
         /*
         ** Manually write the secondary header...
         */
-        Result = OS_write(FileStatus->FileHandle, &DS_FileHeader, sizeof(DS_FileHeader_t));
+        Result = OS_write(FileHandle, &DS_FileHeader, sizeof(DS_FileHeader_t));
 
         if (Result == sizeof(DS_FileHeader_t))
         {
-            /*
-            ** Success - update file size and data rate counters...
-            */
             DS_AppData.FileWriteCounter++;
 
-            FileStatus->FileSize += sizeof(DS_FileHeader_t);
-            FileStatus->FileGrowth += sizeof(DS_FileHeader_t);
+            *DataLength = sizeof(CFE_FS_Header_t) + sizeof(DS_FileHeader_t);
+            Result      = CFE_SUCCESS;
         }
         else
         {
-            /*
-            ** Error - send event, close file and disable destination...
-            */
-            DS_FileWriteError(FileIndex, sizeof(DS_FileHeader_t), Result);
+            *DataLength = sizeof(DS_FileHeader_t);
         }
     }
     else
     {
-        /*
-        ** Error - send event, close file and disable destination...
-        */
-        DS_FileWriteError(FileIndex, sizeof(CFE_FS_Header_t), Result);
+        *DataLength = sizeof(CFE_FS_Header_t);
     }
 #endif
+
+    return Result;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -479,121 +993,440 @@ void DS_FileCreateDest(uint32 FileIndex)
     DS_AppFileStatus_t *FileStatus      = &DS_AppData.FileStatus[FileIndex];
     int32               Result          = CFE_SUCCESS;
     osal_id_t           LocalFileHandle = OS_OBJECT_ID_UNDEFINED;
+    bool                NewFile         = false;
 
-    /*
-    ** Create filename from "path + base + sequence count + extension"...
-    */
-    DS_FileCreateName(FileIndex);
-
-    if (FileStatus->FileName[0] != 0)
+    if (OS_ObjectIdDefined(FileStatus->SpareHandle))
     {
         /*
-        ** Success - create a new destination file...
+        ** Next file was created ahead of time - just switch to it...
         */
-        Result = OS_OpenCreate(&LocalFileHandle, FileStatus->FileName, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE,
-                               OS_READ_WRITE);
+        DS_AppData.PreopenHitCounter++;
+        NewFile = true;
 
-        if (Result != OS_SUCCESS)
-        {
-            /*
-            ** Error - send event, disable destination and reset filename...
-            */
-            DS_AppData.FileWriteErrCounter++;
+        FileStatus->FileHandle   = FileStatus->SpareHandle;
+        FileStatus->FileSize     = FileStatus->SpareSize;
+        FileStatus->Preallocated = FileStatus->SparePreallocated;
+        strncpy(FileStatus->FileName, FileStatus->SpareName, sizeof(FileStatus->FileName));
 
-            CFE_EVS_SendEvent(DS_CREATE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "FILE CREATE error: result = %d, dest = %d, name = '%s'", (int)Result, (int)FileIndex,
-                              FileStatus->FileName);
+        FileStatus->SpareHandle       = OS_OBJECT_ID_UNDEFINED;
+        FileStatus->SpareSize         = 0;
+        FileStatus->SparePreallocated = false;
+        memset(FileStatus->SpareName, 0, sizeof(FileStatus->SpareName));
 
-            memset(FileStatus->FileName, 0, sizeof(FileStatus->FileName));
+        DS_FinalizeUpdateSpareCDS(FileIndex, FileStatus->SpareName);
+    }
+    else
+    {
+        /*
+        ** Create filename from "path + base + sequence count + extension"...
+        */
+        DS_FileCreateName(FileIndex, FileStatus->FileName);
 
-            /*
-            ** Something needs to get fixed before we try again...
-            */
-            FileStatus->FileState = DS_DISABLED;
-        }
-        else
+        if (FileStatus->FileName[0] != 0)
         {
             /*
-            ** Success - store the file handle...
+            ** Success - create a new destination file...
             */
-            DS_AppData.FileWriteCounter++;
+            Result = OS_OpenCreate(&LocalFileHandle, FileStatus->FileName, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE,
+                                   OS_READ_WRITE);
+
+            if (Result != OS_SUCCESS)
+            {
+                /*
+                ** Error - send event, disable destination and reset filename...
+                */
+                DS_AppData.FileWriteErrCounter++;
 
-            FileStatus->FileHandle = LocalFileHandle;
+                CFE_EVS_SendEvent(DS_CREATE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "FILE CREATE error: result = %d, dest = %d, name = '%s'", (int)Result, (int)FileIndex,
+                                  FileStatus->FileName);
 
-            /*
-            ** Initialize and write config specific file header...
-            */
-            DS_FileWriteHeader(FileIndex);
+                memset(FileStatus->FileName, 0, sizeof(FileStatus->FileName));
 
-            /*
-            ** Update sequence count if have one and write successful...
-            */
-            if (OS_ObjectIdDefined(FileStatus->FileHandle) && (DestFile->FileNameType == DS_BY_COUNT))
+                /*
+                ** Something needs to get fixed before we try again...
+                */
+                FileStatus->FileState = DS_DISABLED;
+            }
+            else
             {
-                FileStatus->FileCount++;
-                if (FileStatus->FileCount > DS_MAX_SEQUENCE_COUNT)
-                {
-                    FileStatus->FileCount = DestFile->SequenceCount;
-                }
+                /*
+                ** Success - store the file handle...
+                */
+                DS_AppData.FileWriteCounter++;
+
+                FileStatus->FileHandle = LocalFileHandle;
+                NewFile                = true;
+
+                /*
+                ** Reserve storage before any data is written...
+                */
+                FileStatus->Preallocated = DS_FilePreallocate(FileIndex, FileStatus->FileName);
 
                 /*
-                ** Update Critical Data Store (CDS)...
+                ** Initialize and write config specific file header...
                 */
-                DS_TableUpdateCDS();
+                DS_FileWriteHeader(FileIndex);
             }
         }
     }
+
+    /*
+    ** Update sequence count if have one and write successful...
+    */
+    if (NewFile && OS_ObjectIdDefined(FileStatus->FileHandle) && (DestFile->FileNameType == DS_BY_COUNT))
+    {
+        FileStatus->FileCount++;
+        if (FileStatus->FileCount > DS_MAX_SEQUENCE_COUNT)
+        {
+            FileStatus->FileCount = DestFile->SequenceCount;
+        }
+
+        /*
+        ** Update Critical Data Store (CDS) if the count is no
+        **   longer covered by the committed reservation...
+        */
+        DS_TableReserveCDS(FileIndex);
+    }
+
+    if (NewFile && OS_ObjectIdDefined(FileStatus->FileHandle))
+    {
+        /*
+        ** Codec and record mode are fixed for the life of the file, so
+        **   a table update never mixes formats...
+        */
+        FileStatus->Codec          = DestFile->Codec;
+        FileStatus->DeltaKeyframe  = DestFile->DeltaKeyframe;
+        FileStatus->SuperframeSize = DestFile->SuperframeSize;
+
+        DS_FileOpenDirect(FileIndex);
+    }
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Create destination filename                                     */
+/* Open direct I/O access to a new destination file                */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void DS_FileCreateName(uint32 FileIndex)
+void DS_FileOpenDirect(uint32 FileIndex)
 {
-    DS_DestFileEntry_t *DestFile    = &DS_AppData.DestFileTblPtr->File[FileIndex];
-    DS_AppFileStatus_t *FileStatus  = &DS_AppData.FileStatus[FileIndex];
-    int32               TotalLength = 0;
-
-    char Workname[2 * DS_TOTAL_FNAME_BUFSIZE];
-    char Sequence[DS_TOTAL_FNAME_BUFSIZE];
+    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+    int32               Result     = OS_SUCCESS;
 
-    /* Copy in path */
-    CFE_SB_MessageStringGet(Workname, DestFile->Pathname, NULL, sizeof(Workname), sizeof(DestFile->Pathname));
-    TotalLength = strlen(Workname);
+    /*
+    ** Packet data starts after the file header...
+    */
+    FileStatus->Direct       = false;
+    FileStatus->DirectFd     = -1;
+    FileStatus->DirectOffset = FileStatus->FileSize;
+    FileStatus->DirectTail   = 0;
 
-    if (TotalLength > 0)
+    if (DS_AppData.DestFileTblPtr->File[FileIndex].DirectIO == DS_ENABLED)
     {
-        /* Add separator if needed */
-        if (Workname[TotalLength - 1] != DS_PATH_SEPARATOR)
+        Result = DS_FsExtOpenDirect(FileStatus->FileName, &FileStatus->DirectFd);
+
+        if (Result == OS_SUCCESS)
         {
-            /* There's always space since Workname is twice the size of Pathname */
-            Workname[TotalLength++] = DS_PATH_SEPARATOR;
+            FileStatus->Direct = true;
         }
+        else
+        {
+            /*
+            ** Error - send event but keep writing through the page cache...
+            */
+            CFE_EVS_SendEvent(DS_FILE_DIRECT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "FILE DIRECT I/O error: result = %d, dest = %d, name = '%s'", (int)Result,
+                              (int)FileIndex, FileStatus->FileName);
+        }
+    }
+}
 
-        /* Add base name */
-        CFE_SB_MessageStringGet(&Workname[TotalLength], DestFile->Basename, NULL, sizeof(Workname) - TotalLength,
-                                sizeof(DestFile->Basename));
-        TotalLength = strlen(Workname);
-
-        /* Create the sequence portion of the filename */
-        DS_FileCreateSequence(Sequence, DestFile->FileNameType, FileStatus->FileCount);
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Reserve storage for a new destination file                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool DS_FilePreallocate(uint32 FileIndex, const char *FileName)
+{
+    DS_DestFileEntry_t *DestFile     = &DS_AppData.DestFileTblPtr->File[FileIndex];
+    int32               Result       = OS_SUCCESS;
+    bool                Preallocated = false;
 
-        /* Sequence is always null terminated so can use strncat */
-        strncat(&Workname[TotalLength], Sequence, sizeof(Workname) - TotalLength - 1);
-        TotalLength = strlen(Workname);
+    if (DestFile->Preallocate == DS_ENABLED)
+    {
+        /*
+        ** Files never grow past the max size - reserve all of it now...
+        */
+        Result = DS_FsExtAllocate(FileName, DestFile->MaxFileSize);
 
-        /* Only add extension if not empty */
-        if (DestFile->Extension[0] != '\0')
+        if (Result == OS_SUCCESS)
         {
-            /* Add a "." character (if needed) before appending the extension */
-            if (DestFile->Extension[0] != '.')
-            {
-                strncat(Workname, ".", sizeof(Workname) - strlen(Workname) - 1);
-                TotalLength++;
-            }
-
+            Preallocated = true;
+        }
+        else
+        {
+            /*
+            ** Error - send event, the file grows as it is written...
+            */
+            CFE_EVS_SendEvent(DS_FILE_PREALLOC_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "FILE PREALLOCATE error: result = %d, size = %d, dest = %d, name = '%s'", (int)Result,
+                              (int)DestFile->MaxFileSize, (int)FileIndex, FileName);
+        }
+    }
+
+    return Preallocated;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Open the next destination file ahead of time                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void DS_FileOpenSpare(uint32 FileIndex)
+{
+    DS_AppFileStatus_t *FileStatus      = &DS_AppData.FileStatus[FileIndex];
+    int32               Result          = CFE_SUCCESS;
+    uint32              DataLength      = 0;
+    osal_id_t           LocalFileHandle = OS_OBJECT_ID_UNDEFINED;
+    bool                NameSaved       = false;
+
+    /*
+    ** Next file gets the filename (and sequence count) that would be
+    **   used if the current file were closed now...
+    */
+    DS_FileCreateName(FileIndex, FileStatus->SpareName);
+
+    /*
+    ** Time based names repeat within the same second - never truncate
+    **   the file that is still open...
+    */
+    if ((FileStatus->SpareName[0] != 0) && (strcmp(FileStatus->SpareName, FileStatus->FileName) != 0))
+    {
+        /*
+        ** Name is saved before the file exists, so an unused file can be
+        **   removed after a processor reset...
+        */
+        DS_FinalizeUpdateSpareCDS(FileIndex, FileStatus->SpareName);
+        NameSaved = true;
+
+        Result = OS_OpenCreate(&LocalFileHandle, FileStatus->SpareName, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE,
+                               OS_READ_WRITE);
+
+        if (Result != OS_SUCCESS)
+        {
+            /*
+            ** Error - send event, the file will be created again when needed...
+            */
+            DS_AppData.FileWriteErrCounter++;
+
+            CFE_EVS_SendEvent(DS_CREATE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "FILE CREATE error: result = %d, dest = %d, name = '%s'", (int)Result, (int)FileIndex,
+                              FileStatus->SpareName);
+        }
+        else
+        {
+            DS_AppData.FileWriteCounter++;
+
+            FileStatus->SparePreallocated = DS_FilePreallocate(FileIndex, FileStatus->SpareName);
+
+            Result = DS_FileWriteHeaderData(FileIndex, LocalFileHandle, FileStatus->SpareName, &DataLength);
+
+            if (Result == CFE_SUCCESS)
+            {
+                /*
+                ** Success - header bytes count towards the current data rate...
+                */
+                FileStatus->SpareHandle = LocalFileHandle;
+                FileStatus->SpareSize   = DataLength;
+                FileStatus->FileGrowth += DataLength;
+            }
+            else
+            {
+                /*
+                ** Error - send event and discard the partial file...
+                */
+                DS_AppData.FileWriteErrCounter++;
+
+                CFE_EVS_SendEvent(DS_WRITE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "FILE WRITE error: result = %d, length = %d, dest = %d, name = '%s'", (int)Result,
+                                  (int)DataLength, (int)FileIndex, FileStatus->SpareName);
+
+                OS_close(LocalFileHandle);
+                OS_remove(FileStatus->SpareName);
+
+                FileStatus->SparePreallocated = false;
+            }
+        }
+    }
+
+    if (!OS_ObjectIdDefined(FileStatus->SpareHandle))
+    {
+        memset(FileStatus->SpareName, 0, sizeof(FileStatus->SpareName));
+
+        if (NameSaved)
+        {
+            DS_FinalizeUpdateSpareCDS(FileIndex, FileStatus->SpareName);
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Discard the pre-opened next destination file                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void DS_FileCloseSpare(uint32 FileIndex)
+{
+    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+
+    if (OS_ObjectIdDefined(FileStatus->SpareHandle))
+    {
+        /*
+        ** File holds only a header and its sequence count was never
+        **   used - remove it so the name can be created again later...
+        */
+        OS_close(FileStatus->SpareHandle);
+        OS_remove(FileStatus->SpareName);
+
+        FileStatus->SpareHandle       = OS_OBJECT_ID_UNDEFINED;
+        FileStatus->SpareSize         = 0;
+        FileStatus->SparePreallocated = false;
+        memset(FileStatus->SpareName, 0, sizeof(FileStatus->SpareName));
+
+        DS_FinalizeUpdateSpareCDS(FileIndex, FileStatus->SpareName);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Pre-open processor                                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void DS_FileTestPreopen(void)
+{
+    uint32 FileIndex = 0;
+
+    if ((DS_FILE_PREOPEN_PERCENT > 0) && (DS_AppData.DestFileTblPtr != (DS_DestFileTable_t *)NULL))
+    {
+        for (FileIndex = 0; FileIndex < DS_DEST_FILE_CNT; FileIndex++)
+        {
+            DS_FileTestPreopenDest(FileIndex);
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Pre-open test for one destination                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void DS_FileTestPreopenDest(uint32 FileIndex)
+{
+    DS_DestFileEntry_t *DestFile   = &DS_AppData.DestFileTblPtr->File[FileIndex];
+    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+
+    /*
+    ** Only open files that are still receiving packets need a next file...
+    */
+    if ((DS_FILE_PREOPEN_PERCENT > 0) && OS_ObjectIdDefined(FileStatus->FileHandle) &&
+        !OS_ObjectIdDefined(FileStatus->SpareHandle) && (FileStatus->FileState == DS_ENABLED))
+    {
+        if ((((uint64)FileStatus->FileSize * 100) >= ((uint64)DestFile->MaxFileSize * DS_FILE_PREOPEN_PERCENT)) ||
+            (((uint64)FileStatus->FileAge * 100) >= ((uint64)DestFile->MaxFileAge * DS_FILE_PREOPEN_PERCENT)))
+        {
+            DS_FileOpenSpare(FileIndex);
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Measure elapsed time in microseconds                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 DS_FileElapsedTime(CFE_TIME_SysTime_t StartTime)
+{
+    CFE_TIME_SysTime_t Elapsed     = CFE_TIME_Subtract(CFE_TIME_GetMET(), StartTime);
+    uint32             ElapsedTime = 0xFFFFFFFF;
+
+    /*
+    ** Saturate rather than wrap (a stall of over an hour)...
+    */
+    if (Elapsed.Seconds < (0xFFFFFFFF / 1000000))
+    {
+        ElapsedTime = (Elapsed.Seconds * 1000000) + CFE_TIME_Sub2MicroSecs(Elapsed.Subseconds);
+    }
+
+    return ElapsedTime;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Record new file start latency                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void DS_FileRotationDone(CFE_TIME_SysTime_t StartTime)
+{
+    uint32 RotationTime = DS_FileElapsedTime(StartTime);
+
+    DS_AppData.RotationCounter++;
+    DS_AppData.LastRotationTime = RotationTime;
+
+    if (RotationTime > DS_AppData.MaxRotationTime)
+    {
+        DS_AppData.MaxRotationTime = RotationTime;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Create destination filename                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void DS_FileCreateName(uint32 FileIndex, char *FileName)
+{
+    DS_DestFileEntry_t *DestFile    = &DS_AppData.DestFileTblPtr->File[FileIndex];
+    DS_AppFileStatus_t *FileStatus  = &DS_AppData.FileStatus[FileIndex];
+    int32               TotalLength = 0;
+
+    char Workname[2 * DS_TOTAL_FNAME_BUFSIZE];
+    char Sequence[DS_TOTAL_FNAME_BUFSIZE];
+
+    /* Copy in path */
+    CFE_SB_MessageStringGet(Workname, DestFile->Pathname, NULL, sizeof(Workname), sizeof(DestFile->Pathname));
+    TotalLength = strlen(Workname);
+
+    if (TotalLength > 0)
+    {
+        /* Add separator if needed */
+        if (Workname[TotalLength - 1] != DS_PATH_SEPARATOR)
+        {
+            /* There's always space since Workname is twice the size of Pathname */
+            Workname[TotalLength++] = DS_PATH_SEPARATOR;
+        }
+
+        /* Add base name */
+        CFE_SB_MessageStringGet(&Workname[TotalLength], DestFile->Basename, NULL, sizeof(Workname) - TotalLength,
+                                sizeof(DestFile->Basename));
+        TotalLength = strlen(Workname);
+
+        /* Create the sequence portion of the filename */
+        DS_FileCreateSequence(Sequence, DestFile->FileNameType, FileStatus->FileCount);
+
+        /* Sequence is always null terminated so can use strncat */
+        strncat(&Workname[TotalLength], Sequence, sizeof(Workname) - TotalLength - 1);
+        TotalLength = strlen(Workname);
+
+        /* Only add extension if not empty */
+        if (DestFile->Extension[0] != '\0')
+        {
+            /* Add a "." character (if needed) before appending the extension */
+            if (DestFile->Extension[0] != '.')
+            {
+                strncat(Workname, ".", sizeof(Workname) - strlen(Workname) - 1);
+                TotalLength++;
+            }
+
             /* Append the extension portion to the path/base+sequence portion */
             CFE_SB_MessageStringGet(&Workname[TotalLength], DestFile->Extension, NULL, sizeof(Workname) - TotalLength,
                                     sizeof(DestFile->Extension));
@@ -603,7 +1436,7 @@ void DS_FileCreateName(uint32 FileIndex)
         if (strlen(Workname) < DS_TOTAL_FNAME_BUFSIZE)
         {
             /* Success - copy workname to filename buffer */
-            strcpy(FileStatus->FileName, Workname);
+            strcpy(FileName, Workname);
         }
         else
         {
@@ -759,155 +1592,913 @@ void DS_FileCreateSequence(char *Buffer, uint32 Type, uint32 Count)
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void DS_FileUpdateHeader(int32 FileIndex)
+void DS_FileUpdateHeader(const DS_FinalizeEntry_t *Entry)
 {
 #if (DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE)
     /*
     ** Update CFE specific header fields...
     */
-    DS_AppFileStatus_t *FileStatus  = &DS_AppData.FileStatus[FileIndex];
-    CFE_TIME_SysTime_t  CurrentTime = CFE_TIME_GetTime();
-    int32               Result      = CFE_SUCCESS;
+    DS_FileHeader_t DS_FileHeader;
+    osal_id_t       FileHandle = OS_OBJECT_ID_UNDEFINED;
+    int32           Result     = CFE_SUCCESS;
+
+    memset(&DS_FileHeader, 0, sizeof(DS_FileHeader));
+
+    /* update file close time */
+    DS_FileHeader.CloseSeconds = Entry->CloseTime.Seconds;
+    DS_FileHeader.CloseSubsecs = Entry->CloseTime.Subseconds;
+
+    /* rebuild the fields written when the file was created */
+    DS_FileHeader.FileTableIndex = Entry->FileTableIndex;
+    DS_FileHeader.FileNameType   = Entry->FileNameType;
+    DS_FileHeader.Version        = DS_FILE_HEADER_VERSION;
+    strncpy(DS_FileHeader.FileName, Entry->FileName, sizeof(DS_FileHeader.FileName));
+
+    /* update file content summary */
+    DS_FileHeader.PacketCount  = Entry->Summary.PacketCount;
+    DS_FileHeader.FirstSeconds = Entry->Summary.FirstTime.Seconds;
+    DS_FileHeader.FirstSubsecs = Entry->Summary.FirstTime.Subseconds;
+    DS_FileHeader.LastSeconds  = Entry->Summary.LastTime.Seconds;
+    DS_FileHeader.LastSubsecs  = Entry->Summary.LastTime.Subseconds;
+    DS_FileHeader.DataBytes    = Entry->Summary.DataBytes;
+    DS_FileHeader.IndexOffset  = Entry->Summary.IndexOffset;
+    DS_FileHeader.MidCount     = Entry->Summary.MidCount;
+    DS_FileHeader.MidOverflow  = Entry->Summary.MidOverflow;
+    memcpy(DS_FileHeader.MidList, Entry->Summary.MidList, sizeof(DS_FileHeader.MidList));
+    memcpy(DS_FileHeader.MidBloom, Entry->Summary.MidBloom, sizeof(DS_FileHeader.MidBloom));
 
-    Result = OS_lseek(FileStatus->FileHandle, sizeof(CFE_FS_Header_t), OS_SEEK_SET);
+    /*
+    ** The whole DS header is rebuilt, so the close time and the content
+    **   summary go out in a single write with no seek...
+    */
+    Result = DS_FsExtWriteAt(Entry->FileName, sizeof(CFE_FS_Header_t), &DS_FileHeader, sizeof(DS_FileHeader_t));
 
-    if (Result == sizeof(CFE_FS_Header_t))
+    if (Result == OS_ERR_NOT_IMPLEMENTED)
     {
-        /* update file close time */
-        Result = OS_write(FileStatus->FileHandle, &CurrentTime, sizeof(CFE_TIME_SysTime_t));
+        /*
+        ** Positional writes are not configured - seek and write through
+        **   an OSAL handle instead (the file has already been closed)...
+        */
+        Result = OS_OpenCreate(&FileHandle, Entry->FileName, OS_FILE_FLAG_NONE, OS_WRITE_ONLY);
 
-        if (Result == sizeof(CFE_TIME_SysTime_t))
-        {
-            DS_AppData.FileUpdateCounter++;
-        }
-        else
+        if (Result == OS_SUCCESS)
         {
-            DS_AppData.FileUpdateErrCounter++;
+            if ((OS_lseek(FileHandle, sizeof(CFE_FS_Header_t), OS_SEEK_SET) == sizeof(CFE_FS_Header_t)) &&
+                (OS_write(FileHandle, &DS_FileHeader, sizeof(DS_FileHeader_t)) == sizeof(DS_FileHeader_t)))
+            {
+                Result = OS_SUCCESS;
+            }
+            else
+            {
+                Result = OS_ERROR;
+            }
+
+            OS_close(FileHandle);
         }
     }
+
+    /*
+    ** Headers are updated by the file finalizer task...
+    */
+    OS_MutSemTake(DS_AppData.FinalizeMutexId);
+
+    if (Result == OS_SUCCESS)
+    {
+        DS_AppData.FileUpdateCounter++;
+    }
     else
     {
         DS_AppData.FileUpdateErrCounter++;
     }
+
+    OS_MutSemGive(DS_AppData.FinalizeMutexId);
 #endif
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Close destination file                                          */
+/* Add packet to destination file content summary                  */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void DS_FileCloseDest(int32 FileIndex)
+
+void DS_FileSummaryUpdate(int32 FileIndex, const CFE_SB_Buffer_t *BufPtr, uint32 PacketLength)
 {
-    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+    DS_FileSummary_t * Summary = &DS_AppData.FileStatus[FileIndex].Summary;
+    CFE_SB_MsgId_t     MessageID;
+    CFE_TIME_SysTime_t PacketTime;
+    uint32             MessageValue = 0;
+    uint32             Bit          = 0;
+    uint32             i            = 0;
 
-#if (DS_MOVE_FILES == true)
     /*
-    ** Move file from working directory to downlink directory...
+    ** Nothing to count if the write failed (file has been closed)...
     */
-    int32 OS_result;
-    int32 PathLength;
-    char *FileName;
-    char  PathName[DS_TOTAL_FNAME_BUFSIZE];
+    if (OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle))
+    {
+        memset(&PacketTime, 0, sizeof(PacketTime));
+        CFE_MSG_GetMsgTime(&BufPtr->Msg, &PacketTime);
 
-    /*
-    ** First, close the file...
-    */
-    OS_close(FileStatus->FileHandle);
+        if (Summary->PacketCount == 0)
+        {
+            Summary->FirstTime = PacketTime;
+        }
+
+        Summary->LastTime = PacketTime;
+        Summary->PacketCount++;
 
-    /*
-    ** Move file only if table has a downlink directory name...
-    */
-    if (DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] != '\0')
-    {
         /*
-        ** Make sure directory name does not end with slash character...
+        ** Packet was the last data appended to the file...
         */
-        CFE_SB_MessageStringGet(PathName, DS_AppData.DestFileTblPtr->File[FileIndex].Movename, NULL, sizeof(PathName),
-                                sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
-        PathLength = strlen(PathName);
-        if (PathName[PathLength - 1] == '/')
-        {
-            PathName[PathLength - 1] = '\0';
-            PathLength--;
-        }
+        DS_FileIndexUpdate(FileIndex, PacketTime, DS_AppData.FileStatus[FileIndex].FileSize - PacketLength);
 
         /*
-        ** Get a pointer to slash character before the filename...
+        ** Add new message IDs to the list until it is full...
         */
-        FileName = strrchr(FileStatus->FileName, '/');
+        CFE_MSG_GetMsgId(&BufPtr->Msg, &MessageID);
+        MessageValue = CFE_SB_MsgIdToValue(MessageID);
+
+        while ((i < Summary->MidCount) && (Summary->MidList[i] != MessageValue))
+        {
+            i++;
+        }
 
-        if (FileName != NULL)
+        if (i < Summary->MidCount)
         {
             /*
-            ** Verify that directory name plus filename is not too large...
+            ** Message ID is already listed (and in the Bloom filter)...
             */
-            if ((PathLength + strlen(FileName)) < DS_TOTAL_FNAME_BUFSIZE)
+        }
+        else
+        {
+            if (Summary->MidCount < DS_FILE_HEADER_MID_CNT)
             {
-                /*
-                ** Append the filename (with slash) to the directory name...
-                */
-                strcat(PathName, FileName);
-
-                /*
-                ** Use OS function to move/rename the file...
-                */
-                OS_result = OS_mv(FileStatus->FileName, PathName);
-
-                if (OS_result != OS_SUCCESS)
-                {
-                    /*
-                    ** Error - send event but leave destination enabled...
-                    */
-                    CFE_EVS_SendEvent(DS_MOVE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "FILE MOVE error: src = '%s', tgt = '%s', result = %d", FileStatus->FileName,
-                                      PathName, OS_result);
-                }
+                Summary->MidList[Summary->MidCount] = MessageValue;
+                Summary->MidCount++;
             }
             else
             {
-                /*
-                ** Error - send event but leave destination enabled...
-                */
-                CFE_EVS_SendEvent(DS_MOVE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "FILE MOVE error: dir name = '%s', filename = '%s'", PathName, FileName);
+                Summary->MidOverflow = true;
             }
-        }
-        else
-        {
+
             /*
-            ** Error - send event but leave destination enabled...
+            ** Bloom filter covers message IDs the list has no room for...
             */
-            CFE_EVS_SendEvent(DS_MOVE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "FILE MOVE error: dir name = '%s', filename = 'NULL'", PathName);
+            for (i = 0; i < DS_FILE_BLOOM_HASH_CNT; i++)
+            {
+                Bit = DS_FileBloomBit(MessageValue, i);
+                Summary->MidBloom[Bit / 32] |= (uint32)1 << (Bit % 32);
+            }
         }
-
-        /* Update the path name for reporting */
-        strncpy(FileStatus->FileName, PathName, sizeof(PathName));
     }
-#else
-    /*
-    ** Close the file...
-    */
-    OS_close(FileStatus->FileHandle);
-#endif
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Message ID Bloom filter bit                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_FileBloomBit(uint32 MessageValue, uint32 HashIndex)
+{
+    /*
+    ** Double hashing - two multiplicative hashes make every hash function...
+    */
+    uint32 Hash1 = MessageValue * 0x9E3779B1;
+    uint32 Hash2 = (MessageValue * 0x85EBCA77) | 1;
+
+    return (Hash1 + (HashIndex * Hash2)) % DS_FILE_BLOOM_BITS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Add packet to destination file index                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileIndexUpdate(int32 FileIndex, CFE_TIME_SysTime_t PacketTime, uint32 Offset)
+{
+    DS_DestFileEntry_t * DestFile   = &DS_AppData.DestFileTblPtr->File[FileIndex];
+    DS_AppFileStatus_t * FileStatus = &DS_AppData.FileStatus[FileIndex];
+    DS_FileIndexEntry_t *LastEntry  = NULL;
+    bool                 AddEntry   = false;
+    uint32               i          = 0;
+
+    if (FileStatus->IndexCount == 0)
+    {
+        /*
+        ** First packet is always sampled (if the index is selected)...
+        */
+        AddEntry = ((DestFile->IndexBytes != 0) || (DestFile->IndexSeconds != 0));
+    }
+    else
+    {
+        /*
+        ** Spacing is doubled each time the index fills up...
+        */
+        LastEntry = &FileStatus->Index[FileStatus->IndexCount - 1];
+
+        if ((DestFile->IndexBytes != 0) &&
+            (((Offset - LastEntry->Offset) >> FileStatus->IndexShift) >= DestFile->IndexBytes))
+        {
+            AddEntry = true;
+        }
+
+        if ((DestFile->IndexSeconds != 0) &&
+            (((PacketTime.Seconds - LastEntry->Seconds) >> FileStatus->IndexShift) >= DestFile->IndexSeconds))
+        {
+            AddEntry = true;
+        }
+    }
+
+    if (AddEntry)
+    {
+        if (FileStatus->IndexCount == DS_FILE_INDEX_MAX_CNT)
+        {
+            /*
+            ** Index is full - keep every other sample...
+            */
+            for (i = 0; (i * 2) < DS_FILE_INDEX_MAX_CNT; i++)
+            {
+                FileStatus->Index[i] = FileStatus->Index[i * 2];
+            }
+
+            FileStatus->IndexCount = i;
+            FileStatus->IndexShift++;
+        }
+
+        FileStatus->Index[FileStatus->IndexCount].Seconds = PacketTime.Seconds;
+        FileStatus->Index[FileStatus->IndexCount].Subsecs = PacketTime.Subseconds;
+        FileStatus->Index[FileStatus->IndexCount].Offset  = Offset;
+        FileStatus->IndexCount++;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write destination file index                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileWriteIndex(int32 FileIndex)
+{
+    DS_AppFileStatus_t * FileStatus = &DS_AppData.FileStatus[FileIndex];
+    DS_FileIndexHeader_t IndexHeader;
+    uint32               IndexOffset = FileStatus->FileSize;
+
+    if (FileStatus->IndexCount > 0)
+    {
+        IndexHeader.EntryCount = FileStatus->IndexCount;
+        IndexHeader.EntrySize  = sizeof(DS_FileIndexEntry_t);
+
+        /*
+        ** Empty the index first - a write error closes the file...
+        */
+        FileStatus->IndexCount = 0;
+        FileStatus->IndexShift = 0;
+
+        DS_FileWriteData(FileIndex, &IndexHeader, sizeof(IndexHeader));
+
+        if (OS_ObjectIdDefined(FileStatus->FileHandle))
+        {
+            DS_FileWriteData(FileIndex, FileStatus->Index, IndexHeader.EntryCount * sizeof(DS_FileIndexEntry_t));
+        }
+
+        if (OS_ObjectIdDefined(FileStatus->FileHandle))
+        {
+            FileStatus->Summary.IndexOffset = IndexOffset;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Flush destination file write buffer                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FileFlushBuffer(int32 FileIndex)
+{
+    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+    uint32              Length     = FileStatus->BufferedBytes;
+    int32               Result     = CFE_SUCCESS;
+
+    if (FileStatus->Direct && ((FileStatus->DirectOffset % DS_DIRECT_IO_BLOCK_SIZE) == 0))
+    {
+        /*
+        ** Buffer starts on a block boundary - bypass the page cache...
+        */
+        Result = DS_FileFlushDirect(FileIndex);
+    }
+    else if ((Length > 0) && (FileStatus->Codec != DS_CODEC_NONE))
+    {
+        /*
+        ** Empty the buffer before the write - an error will close the file...
+        */
+        FileStatus->BufferedBytes = 0;
+
+        Result = DS_FileWriteBlock(FileIndex, DS_WRITE_BUFFER(FileIndex), Length);
+        if (Result > 0)
+        {
+            /*
+            ** Success - update flush counters and replace the buffered
+            **   packet bytes in the file size with the block size...
+            */
+            DS_AppData.FlushCounter++;
+            DS_AppData.FlushByteCounter += Result;
+
+            FileStatus->FileSize = (FileStatus->FileSize - Length) + Result;
+
+            Result = CFE_SUCCESS;
+        }
+        else
+        {
+            /*
+            ** Error - send event, close file and disable destination...
+            */
+            DS_FileWriteError(FileIndex, Length, Result);
+
+            Result = OS_ERROR;
+        }
+    }
+    else if (Length > 0)
+    {
+        /*
+        ** Empty the buffer before the write - an error will close the file...
+        */
+        FileStatus->BufferedBytes = 0;
+
+        Result = OS_write(FileStatus->FileHandle, DS_WRITE_BUFFER(FileIndex), Length);
+        if (Result == (int32)Length)
+        {
+            /*
+            ** Success - update flush counters (and the direct I/O
+            **   position, which is aligned after the first full buffer)...
+            */
+            DS_AppData.FlushCounter++;
+            DS_AppData.FlushByteCounter += Length;
+
+            FileStatus->DirectOffset += Length;
+
+            Result = CFE_SUCCESS;
+        }
+        else
+        {
+            /*
+            ** Error - send event, close file and disable destination...
+            */
+            DS_FileWriteError(FileIndex, Length, Result);
+
+            Result = OS_ERROR;
+        }
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write compressed block                                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FileWriteBlock(int32 FileIndex, const void *Data, uint32 Length)
+{
+    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+    DS_CodecWork_t *    Work       = &DS_AppData.CodecWork;
+    uint8 *             Payload    = &Work->Block[sizeof(DS_CodecFrame_t)];
+    CFE_TIME_SysTime_t  StartTime  = CFE_TIME_GetMET();
+    DS_CodecFrame_t     Frame;
+    uint32              BlockSize;
+    int32               Result;
+
+    memset(&Frame, 0, sizeof(Frame));
+    Frame.Sync      = DS_CODEC_FRAME_SYNC;
+    Frame.RawLength = Length;
+    Frame.Length    = DS_CodecCompress(FileStatus->Codec, Data, Length, Payload,
+                                       sizeof(Work->Block) - sizeof(DS_CodecFrame_t), Work);
+
+    if (Frame.Length != 0)
+    {
+        /*
+        ** Compressed - frame and block data go out in one write...
+        */
+        Frame.Codec = FileStatus->Codec;
+        Frame.Crc   = CFE_ES_CalculateCRC(Payload, Frame.Length, 0, CFE_MISSION_ES_DEFAULT_CRC);
+        memcpy(Work->Block, &Frame, sizeof(Frame));
+
+        BlockSize = sizeof(Frame) + Frame.Length;
+        FileStatus->CodecTime += DS_FileElapsedTime(StartTime);
+
+        Result = OS_write(FileStatus->FileHandle, Work->Block, BlockSize);
+    }
+    else
+    {
+        /*
+        ** Stored - frame is written ahead of the packet data...
+        */
+        Frame.Codec  = DS_CODEC_NONE;
+        Frame.Length = Length;
+        Frame.Crc    = CFE_ES_CalculateCRC(Data, Length, 0, CFE_MISSION_ES_DEFAULT_CRC);
+
+        BlockSize = sizeof(Frame) + Length;
+        FileStatus->CodecTime += DS_FileElapsedTime(StartTime);
+
+        Result = OS_write(FileStatus->FileHandle, &Frame, sizeof(Frame));
+        if (Result == (int32)sizeof(Frame))
+        {
+            Result = OS_write(FileStatus->FileHandle, Data, Length);
+            if (Result == (int32)Length)
+            {
+                Result = BlockSize;
+            }
+        }
+    }
+
+    if (Result == (int32)BlockSize)
+    {
+        FileStatus->CodecInBytes += Length;
+        FileStatus->CodecOutBytes += BlockSize;
+    }
+    else if (Result >= 0)
+    {
+        /*
+        ** Short write - the block is not usable...
+        */
+        Result = OS_ERROR;
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Flush write buffer with direct I/O                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FileFlushDirect(int32 FileIndex)
+{
+    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+    uint8 *             Buffer     = DS_WRITE_BUFFER(FileIndex);
+    uint32              Length     = FileStatus->BufferedBytes;
+    uint32              Tail       = FileStatus->DirectTail;
+    uint32              Whole      = Length & ~(uint32)(DS_DIRECT_IO_BLOCK_SIZE - 1);
+    uint32              Padded     = (Length + (DS_DIRECT_IO_BLOCK_SIZE - 1)) & ~(uint32)(DS_DIRECT_IO_BLOCK_SIZE - 1);
+    int32               Result     = CFE_SUCCESS;
+
+    /*
+    ** Nothing to do unless data was added after the last flush...
+    */
+    if (Length > Tail)
+    {
+        /*
+        ** Empty the buffer before the write - an error will close the file...
+        */
+        FileStatus->BufferedBytes = 0;
+        FileStatus->DirectTail    = 0;
+
+        /*
+        ** Pad the partial last block (trimmed when the file is closed)...
+        */
+        memset(&Buffer[Length], 0, Padded - Length);
+
+        Result = DS_FsExtWriteDirect(FileStatus->DirectFd, Buffer, Padded, FileStatus->DirectOffset);
+        if (Result == (int32)Padded)
+        {
+            /*
+            ** Success - update flush counters...
+            */
+            DS_AppData.FlushCounter++;
+            DS_AppData.FlushByteCounter += Length - Tail;
+            DS_AppData.DirectFlushCounter++;
+
+            /*
+            ** Keep the partial last block - it is written again with
+            **   the data that completes it...
+            */
+            FileStatus->DirectOffset += Whole;
+            FileStatus->BufferedBytes = Length - Whole;
+            FileStatus->DirectTail    = Length - Whole;
+
+            memmove(Buffer, &Buffer[Whole], Length - Whole);
+
+            Result = CFE_SUCCESS;
+        }
+        else
+        {
+            /*
+            ** Error - send event, close file and disable destination...
+            */
+            DS_FileWriteError(FileIndex, Padded, Result);
+
+            Result = OS_ERROR;
+        }
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Apply destination file sync policy                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileTestSync(int32 FileIndex)
+{
+    DS_DestFileEntry_t *DestFile   = &DS_AppData.DestFileTblPtr->File[FileIndex];
+    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+    bool                SyncDue    = false;
+
+    if (DestFile->SyncPolicy == DS_SYNC_BY_BYTES)
+    {
+        SyncDue = (FileStatus->SyncBytes >= DestFile->SyncInterval);
+    }
+    else if (DestFile->SyncPolicy == DS_SYNC_BY_TIME)
+    {
+        SyncDue = ((FileStatus->SyncBytes > 0) && (FileStatus->SyncAge >= DestFile->SyncInterval));
+    }
+
+    /*
+    ** Buffered data must reach the file before it can be synced (the
+    **   file is closed and the destination disabled if it does not)...
+    */
+    if (SyncDue && (DS_FileFlushBuffer(FileIndex) == CFE_SUCCESS))
+    {
+        /*
+        ** Errors are reported but the file remains open - start
+        **   another interval rather than retry for every packet...
+        */
+        DS_FileSync(FileStatus->FileName);
+
+        FileStatus->SyncBytes = 0;
+        FileStatus->SyncAge   = 0;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Commit destination file data to storage                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FileSync(const char *FileName)
+{
+    CFE_TIME_SysTime_t StartTime = CFE_TIME_GetMET();
+    uint32             SyncTime  = 0;
+    int32              Result    = OS_SUCCESS;
+
+    Result   = DS_FsExtSync(FileName);
+    SyncTime = DS_FileElapsedTime(StartTime);
+
+    /*
+    ** Files are synced by both the storage writer and the file finalizer...
+    */
+    OS_MutSemTake(DS_AppData.FinalizeMutexId);
+
+    if (Result == OS_SUCCESS)
+    {
+        DS_AppData.SyncCounter++;
+        DS_AppData.LastSyncTime = SyncTime;
+
+        if (SyncTime > DS_AppData.MaxSyncTime)
+        {
+            DS_AppData.MaxSyncTime = SyncTime;
+        }
+    }
+    else
+    {
+        DS_AppData.SyncErrCounter++;
+    }
+
+    OS_MutSemGive(DS_AppData.FinalizeMutexId);
+
+    if (Result != OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(DS_FILE_SYNC_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "FILE SYNC error: result = %d, name = '%s'", (int)Result, FileName);
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Close destination file                                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void DS_FileCloseDest(int32 FileIndex)
+{
+    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+    DS_FinalizeEntry_t  Entry;
+
+    /*
+    ** Write the partial superframe (a write error closes the file)...
+    */
+    DS_FileSuperframeFlush(FileIndex);
+
+#if (DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE)
+    /*
+    ** Append the file index (a write error closes the file)...
+    */
+    DS_FileWriteIndex(FileIndex);
+#endif
+
+    /*
+    ** Buffered data must reach the file before it is handed off (the
+    **   file is closed and the destination disabled if it does not)...
+    */
+    if (!OS_ObjectIdDefined(FileStatus->FileHandle))
+    {
+        /*
+        ** File was closed by an index write error...
+        */
+    }
+    else if (DS_FileFlushBuffer(FileIndex) == CFE_SUCCESS)
+    {
+        memset(&Entry, 0, sizeof(Entry));
+
+        Entry.FileHandle = FileStatus->FileHandle;
+        Entry.CloseTime  = CFE_TIME_GetTime();
+        Entry.QueueTime  = DS_AppSchedClock();
+        Entry.Truncate   = (FileStatus->Preallocated || FileStatus->Direct);
+        Entry.Sync       = (DS_AppData.DestFileTblPtr->File[FileIndex].SyncPolicy != DS_SYNC_NONE);
+        Entry.Summary    = FileStatus->Summary;
+
+        Entry.FileTableIndex = FileIndex;
+        Entry.FileNameType   = DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType;
+        strncpy(Entry.FileName, FileStatus->FileName, sizeof(Entry.FileName));
+
+#if (DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE)
+        /*
+        ** Count the packet data as stored (after any delta, superframe or
+        **   codec encoding) - everything between the headers and the index...
+        */
+        if (Entry.Summary.IndexOffset != 0)
+        {
+            Entry.Summary.DataBytes = Entry.Summary.IndexOffset - (sizeof(CFE_FS_Header_t) + sizeof(DS_FileHeader_t));
+        }
+        else
+        {
+            Entry.Summary.DataBytes = FileStatus->FileSize - (sizeof(CFE_FS_Header_t) + sizeof(DS_FileHeader_t));
+        }
+#endif
+
+#if (DS_MOVE_FILES == true)
+        /*
+        ** Move file from working directory to downlink directory...
+        */
+        int32 PathLength;
+        char *FileName;
+        char  PathName[DS_TOTAL_FNAME_BUFSIZE];
+
+        /*
+        ** Move file only if table has a downlink directory name...
+        */
+        if (DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] != '\0')
+        {
+            /*
+            ** Make sure directory name does not end with slash character...
+            */
+            CFE_SB_MessageStringGet(PathName, DS_AppData.DestFileTblPtr->File[FileIndex].Movename, NULL,
+                                    sizeof(PathName), sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
+            PathLength = strlen(PathName);
+            if (PathName[PathLength - 1] == '/')
+            {
+                PathName[PathLength - 1] = '\0';
+                PathLength--;
+            }
+
+            /*
+            ** Get a pointer to slash character before the filename...
+            */
+            FileName = strrchr(FileStatus->FileName, '/');
+
+            if (FileName != NULL)
+            {
+                /*
+                ** Verify that directory name plus filename is not too large...
+                */
+                if ((PathLength + strlen(FileName)) < DS_TOTAL_FNAME_BUFSIZE)
+                {
+                    /*
+                    ** Append the filename (with slash) to the directory name...
+                    */
+                    strcat(PathName, FileName);
+
+                    /*
+                    ** File is moved/renamed by the file finalizer...
+                    */
+                    strncpy(Entry.MoveName, PathName, sizeof(Entry.MoveName));
+                }
+                else
+                {
+                    /*
+                    ** Error - send event but leave destination enabled...
+                    */
+                    CFE_EVS_SendEvent(DS_MOVE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "FILE MOVE error: dir name = '%s', filename = '%s'", PathName, FileName);
+                }
+            }
+            else
+            {
+                /*
+                ** Error - send event but leave destination enabled...
+                */
+                CFE_EVS_SendEvent(DS_MOVE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "FILE MOVE error: dir name = '%s', filename = 'NULL'", PathName);
+            }
+
+            /* Update the path name for reporting */
+            strncpy(FileStatus->FileName, PathName, sizeof(PathName));
+        }
+#endif
+
+        /*
+        ** File information telemetry is sent by the file finalizer...
+        */
+        Entry.FileInfo.FileAge       = FileStatus->FileAge;
+        Entry.FileInfo.FileSize      = FileStatus->FileSize;
+        Entry.FileInfo.FileRate      = FileStatus->FileRate;
+        Entry.FileInfo.SequenceCount = FileStatus->FileCount;
+        Entry.FileInfo.EnableState   = FileStatus->FileState;
+        Entry.FileInfo.OpenState     = DS_CLOSED;
+        Entry.FileInfo.CodecInBytes  = FileStatus->CodecInBytes;
+        Entry.FileInfo.CodecOutBytes = FileStatus->CodecOutBytes;
+        Entry.FileInfo.CodecTime     = FileStatus->CodecTime;
+        Entry.FileInfo.DeltaInBytes  = FileStatus->DeltaInBytes;
+        Entry.FileInfo.DeltaOutBytes = FileStatus->DeltaOutBytes;
+        strncpy(Entry.FileInfo.FileName, FileStatus->FileName, sizeof(Entry.FileInfo.FileName));
+
+        /*
+        ** Reset status for this destination file...
+        */
+        FileStatus->FileHandle    = OS_OBJECT_ID_UNDEFINED;
+        FileStatus->FileAge       = 0;
+        FileStatus->FileSize      = 0;
+        FileStatus->BufferedBytes = 0;
+        FileStatus->SyncBytes     = 0;
+        FileStatus->SyncAge       = 0;
+        FileStatus->Preallocated  = false;
+
+        memset(&FileStatus->Summary, 0, sizeof(FileStatus->Summary));
+        FileStatus->IndexCount = 0;
+        FileStatus->IndexShift = 0;
+
+        FileStatus->Codec         = DS_CODEC_NONE;
+        FileStatus->CodecInBytes  = 0;
+        FileStatus->CodecOutBytes = 0;
+        FileStatus->CodecTime     = 0;
+
+        /*
+        ** Next file starts every message ID with a keyframe...
+        */
+        FileStatus->DeltaKeyframe = 0;
+        FileStatus->DeltaNext     = 0;
+        FileStatus->DeltaInBytes  = 0;
+        FileStatus->DeltaOutBytes = 0;
+        memset(FileStatus->Delta, 0, sizeof(FileStatus->Delta));
+
+        FileStatus->SuperframeSize  = 0;
+        FileStatus->SuperframeCount = 0;
+        FileStatus->SuperframeUsed  = 0;
+        FileStatus->SuperframeAge   = 0;
+
+        if (FileStatus->Direct)
+        {
+            /*
+            ** Last block was written (padded) by the flush above...
+            */
+            DS_FsExtCloseDirect(FileStatus->DirectFd);
+
+            FileStatus->Direct     = false;
+            FileStatus->DirectFd   = -1;
+            FileStatus->DirectTail = 0;
+        }
+
+        /*
+        ** Remove previous filename from status data...
+        */
+        memset(FileStatus->FileName, 0, sizeof(FileStatus->FileName));
+
+        /*
+        ** Update header, close, move and report the file in the background
+        **   (behind any earlier file of this destination still waiting for
+        **   room in the queue)...
+        */
+        DS_FileRetryFinalize(FileIndex, true);
+
+        if (!DS_FinalizeEnqueue(&Entry))
+        {
+            FileStatus->FinalizeEntry   = Entry;
+            FileStatus->FinalizePending = true;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Hand a waiting closed file to the finalizer                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void DS_FileRetryFinalize(int32 FileIndex, bool Wait)
+{
+    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+
+    while (FileStatus->FinalizePending)
+    {
+        if (DS_FinalizeEnqueue(&FileStatus->FinalizeEntry))
+        {
+            memset(&FileStatus->FinalizeEntry, 0, sizeof(FileStatus->FinalizeEntry));
+            FileStatus->FinalizePending = false;
+        }
+        else if (Wait)
+        {
+            /*
+            ** Queue is still full - wait for the finalizer to catch up...
+            */
+            OS_TaskDelay(DS_WRITER_DRAIN_POLL);
+        }
+        else
+        {
+            /*
+            ** Queue is still full - try again on the next maintenance pass...
+            */
+            break;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Finalize closed destination file                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void DS_FileFinalize(DS_FinalizeEntry_t *Entry)
+{
+    int32 OS_result = OS_SUCCESS;
+
+    /*
+    ** Files recovered after a processor reset have no handle to close...
+    */
+    if (OS_ObjectIdDefined(Entry->FileHandle))
+    {
+        OS_close(Entry->FileHandle);
+        Entry->FileHandle = OS_OBJECT_ID_UNDEFINED;
+    }
+
+    /*
+    ** Header is patched by name, so no handle is needed...
+    */
+    DS_FileUpdateHeader(Entry);
+
+    if (Entry->Truncate)
+    {
+        /*
+        ** Release storage reserved beyond the data actually written...
+        */
+        OS_result = DS_FsExtTruncate(Entry->FileName, Entry->FileInfo.FileSize);
+
+        if (OS_result != OS_SUCCESS)
+        {
+            CFE_EVS_SendEvent(DS_FILE_PREALLOC_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "FILE TRUNCATE error: result = %d, size = %d, name = '%s'", (int)OS_result,
+                              (int)Entry->FileInfo.FileSize, Entry->FileName);
+        }
+    }
+
+    if (Entry->Sync)
+    {
+        /*
+        ** Commit the completed file (and its final length) to storage...
+        */
+        DS_FileSync(Entry->FileName);
+    }
+
+#if (DS_MOVE_FILES == true)
+    if (Entry->MoveName[0] != '\0')
+    {
+        /*
+        ** Use OS function to move/rename the file...
+        */
+        OS_result = OS_mv(Entry->FileName, Entry->MoveName);
+
+        if (OS_result != OS_SUCCESS)
+        {
+            /*
+            ** Error - send event but leave destination enabled...
+            */
+            CFE_EVS_SendEvent(DS_MOVE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "FILE MOVE error: src = '%s', tgt = '%s', result = %d", Entry->FileName,
+                              Entry->MoveName, (int)OS_result);
+        }
+    }
+#endif
 
     /*
     ** Transmit file information telemetry...
     */
-    DS_FileTransmit(FileStatus);
-
-    /*
-    ** Reset status for this destination file...
-    */
-    FileStatus->FileHandle = OS_OBJECT_ID_UNDEFINED;
-    FileStatus->FileAge    = 0;
-    FileStatus->FileSize   = 0;
-
-    /*
-    ** Remove previous filename from status data...
-    */
-    memset(FileStatus->FileName, 0, sizeof(FileStatus->FileName));
+    DS_FileTransmit(&Entry->FileInfo);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -920,7 +2511,7 @@ void DS_FileTestAge(uint32 ElapsedSeconds)
     uint32 FileIndex = 0;
 
     /*
-    ** Called from HK request command handler (elapsed = platform config)
+    ** Called from maintenance scheduler (elapsed = measured whole seconds)
     */
     if (DS_AppData.DestFileTblPtr != (DS_DestFileTable_t *)NULL)
     {
@@ -941,9 +2532,39 @@ void DS_FileTestAge(uint32 ElapsedSeconds)
                     /*
                     ** Close files that exceed maximum file age...
                     */
-                    DS_FileUpdateHeader(FileIndex);
                     DS_FileCloseDest(FileIndex);
                 }
+                else
+                {
+                    /*
+                    ** Write partial superframes that have waited long enough...
+                    */
+                    if (DS_AppData.FileStatus[FileIndex].SuperframeCount > 0)
+                    {
+                        DS_AppData.FileStatus[FileIndex].SuperframeAge += ElapsedSeconds;
+
+                        if ((DS_AppData.DestFileTblPtr->File[FileIndex].SuperframeAge != 0) &&
+                            (DS_AppData.FileStatus[FileIndex].SuperframeAge >=
+                             DS_AppData.DestFileTblPtr->File[FileIndex].SuperframeAge))
+                        {
+                            DS_FileSuperframeFlush(FileIndex);
+                        }
+                    }
+
+                    /*
+                    ** Sync files whose data has waited long enough (unless
+                    **   the superframe write closed the file)...
+                    */
+                    if (DS_AppData.FileStatus[FileIndex].SyncBytes > 0)
+                    {
+                        DS_AppData.FileStatus[FileIndex].SyncAge += ElapsedSeconds;
+                    }
+
+                    if (OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle))
+                    {
+                        DS_FileTestSync(FileIndex);
+                    }
+                }
             }
         }
     }
@@ -955,7 +2576,7 @@ void DS_FileTestAge(uint32 ElapsedSeconds)
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void DS_FileTransmit(DS_AppFileStatus_t *FileStatus)
+void DS_FileTransmit(const DS_FileInfo_t *FileInfo)
 {
     DS_FileCompletePktBuf_t *PktBuf;
 
@@ -972,35 +2593,439 @@ void DS_FileTransmit(DS_AppFileStatus_t *FileStatus)
         CFE_MSG_Init(&PktBuf->Pkt.TlmHeader.Msg, CFE_SB_ValueToMsgId(DS_COMP_TLM_MID), sizeof(*PktBuf));
 
         /*
-        ** Set file age and size...
+        ** Set file age, size, growth rate, sequence count, enable and
+        **   closed state and filename (captured when file was closed)...
+        */
+        PktBuf->Pkt.FileInfo = *FileInfo;
+
+        /*
+        ** Timestamp and send file info telemetry...
+        */
+        CFE_SB_TimeStampMsg(&PktBuf->Pkt.TlmHeader.Msg);
+        CFE_SB_TransmitBuffer(&PktBuf->SBBuf, true);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write packet to destination file                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileWritePacket(int32 FileIndex, const CFE_SB_Buffer_t *BufPtr, uint32 PacketLength)
+{
+    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+    uint8 *             Data       = &DS_AppData.DeltaRecord[sizeof(DS_DeltaRecord_t)];
+    DS_DeltaSlot_t *    Slot;
+    DS_DeltaRecord_t    Record;
+    CFE_SB_MsgId_t      MessageID = CFE_SB_INVALID_MSG_ID;
+
+    if (FileStatus->SuperframeSize != 0)
+    {
+        /*
+        ** Packets are packed into fixed-size superframes...
+        */
+        DS_FileSuperframeAdd(FileIndex, BufPtr, PacketLength);
+    }
+    else if (FileStatus->DeltaKeyframe == 0)
+    {
+        /*
+        ** Packets are stored as-is...
+        */
+        DS_FileWriteData(FileIndex, BufPtr, PacketLength);
+    }
+    else
+    {
+        CFE_MSG_GetMsgId(&BufPtr->Msg, &MessageID);
+
+        memset(&Record, 0, sizeof(Record));
+        Record.MessageID = CFE_SB_MsgIdToValue(MessageID);
+        Record.Type      = DS_DELTA_KEYFRAME;
+        Record.Length    = PacketLength;
+
+        Slot = DS_FileDeltaSlot(FileIndex, Record.MessageID);
+
+        if (PacketLength > DS_DELTA_MAX_PKT_SIZE)
+        {
+            /*
+            ** Too large to keep - the next packet must be a keyframe too...
+            */
+            Slot->Length = 0;
+            Slot->Count  = 0;
+        }
+        else
+        {
+            if ((Slot->Length == PacketLength) && (Slot->Count < FileStatus->DeltaKeyframe))
+            {
+                Record.Length = DS_FileDeltaEncode(Slot->Packet, (const uint8 *)BufPtr, PacketLength, Data,
+                                                   DS_DELTA_MAX_PKT_SIZE);
+            }
+
+            if ((Record.Length != 0) && (Record.Length < PacketLength))
+            {
+                Record.Type  = DS_DELTA_XOR;
+                Record.Count = Slot->Count;
+                Slot->Count++;
+            }
+            else
+            {
+                Record.Length = PacketLength;
+                Slot->Count   = 1;
+            }
+
+            /*
+            ** Next packet of this message ID is encoded against this one...
+            */
+            memcpy(Slot->Packet, BufPtr, PacketLength);
+            Slot->Length = PacketLength;
+        }
+
+        if (Record.Type == DS_DELTA_XOR)
+        {
+            /*
+            ** Header and delta go out together from the workspace...
+            */
+            memcpy(DS_AppData.DeltaRecord, &Record, sizeof(Record));
+            DS_FileWriteData(FileIndex, DS_AppData.DeltaRecord, sizeof(Record) + Record.Length);
+        }
+        else
+        {
+            DS_FileWriteData(FileIndex, &Record, sizeof(Record));
+
+            if (OS_ObjectIdDefined(FileStatus->FileHandle))
+            {
+                DS_FileWriteData(FileIndex, BufPtr, PacketLength);
+            }
+        }
+
+        /*
+        ** A write error closes the file and clears the counts...
         */
-        PktBuf->Pkt.FileInfo.FileAge  = FileStatus->FileAge;
-        PktBuf->Pkt.FileInfo.FileSize = FileStatus->FileSize;
+        if (OS_ObjectIdDefined(FileStatus->FileHandle))
+        {
+            FileStatus->DeltaInBytes += PacketLength;
+            FileStatus->DeltaOutBytes += sizeof(Record) + Record.Length;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get delta record message ID slot                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+DS_DeltaSlot_t *DS_FileDeltaSlot(int32 FileIndex, uint32 MessageID)
+{
+    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+    DS_DeltaSlot_t *    Slot       = NULL;
+    DS_DeltaSlot_t *    Unused     = NULL;
+    int32               i;
+
+    for (i = 0; (i < DS_DELTA_MID_CNT) && (Slot == NULL); i++)
+    {
+        if (FileStatus->Delta[i].Length == 0)
+        {
+            if (Unused == NULL)
+            {
+                Unused = &FileStatus->Delta[i];
+            }
+        }
+        else if (FileStatus->Delta[i].MessageID == MessageID)
+        {
+            Slot = &FileStatus->Delta[i];
+        }
+    }
+
+    if (Slot == NULL)
+    {
+        if (Unused != NULL)
+        {
+            Slot = Unused;
+        }
+        else
+        {
+            /*
+            ** All slots in use - replace the one assigned longest ago...
+            */
+            Slot                  = &FileStatus->Delta[FileStatus->DeltaNext];
+            FileStatus->DeltaNext = (FileStatus->DeltaNext + 1) % DS_DELTA_MID_CNT;
+        }
+
+        Slot->MessageID = MessageID;
+        Slot->Length    = 0;
+        Slot->Count     = 0;
+    }
+
+    return Slot;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Encode XOR delta                                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_FileDeltaEncode(const uint8 *Previous, const uint8 *Packet, uint32 Length, uint8 *Output, uint32 MaxSize)
+{
+    uint32 InPos  = 0;
+    uint32 OutPos = 0;
+    uint32 Skip;
+    uint32 Count;
+
+    while ((InPos < Length) && (OutPos < Length))
+    {
         /*
-        ** Set file growth rate (computed when process last HK request)...
+        ** Unchanged bytes, then changed bytes (255 of each at most)...
         */
-        PktBuf->Pkt.FileInfo.FileRate = FileStatus->FileRate;
+        Skip = 0;
+        while ((InPos + Skip < Length) && (Skip < 255) && (Previous[InPos + Skip] == Packet[InPos + Skip]))
+        {
+            Skip++;
+        }
+        InPos += Skip;
+
+        Count = 0;
+        while ((InPos + Count < Length) && (Count < 255) && (Previous[InPos + Count] != Packet[InPos + Count]))
+        {
+            Count++;
+        }
+
+        if ((InPos == Length) && (Count == 0) && (OutPos != 0))
+        {
+            /*
+            ** Trailing unchanged bytes are implied by the packet length...
+            */
+            break;
+        }
+
+        if ((OutPos + 2 + Count) > MaxSize)
+        {
+            OutPos = Length;
+        }
+        else
+        {
+            Output[OutPos++] = (uint8)Skip;
+            Output[OutPos++] = (uint8)Count;
+
+            while (Count > 0)
+            {
+                Output[OutPos++] = Previous[InPos] ^ Packet[InPos];
+                InPos++;
+                Count--;
+            }
+        }
+    }
+
+    /*
+    ** Delta must save space to be worth storing...
+    */
+    if (OutPos >= Length)
+    {
+        OutPos = 0;
+    }
+
+    return OutPos;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Decode XOR delta                                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_FileDeltaDecode(const uint8 *Previous, uint32 Length, const uint8 *Data, uint32 DataLength, uint8 *Packet)
+{
+    uint32 InPos  = 0;
+    uint32 OutPos = 0;
+    uint32 Skip;
+    uint32 Count;
+    bool   Valid = true;
+
+    while ((InPos < DataLength) && Valid)
+    {
+        if ((InPos + 2) > DataLength)
+        {
+            Valid = false;
+        }
+        else
+        {
+            Skip  = Data[InPos];
+            Count = Data[InPos + 1];
+            InPos += 2;
+
+            if (((OutPos + Skip + Count) > Length) || ((InPos + Count) > DataLength))
+            {
+                Valid = false;
+            }
+            else
+            {
+                memcpy(&Packet[OutPos], &Previous[OutPos], Skip);
+                OutPos += Skip;
+
+                while (Count > 0)
+                {
+                    Packet[OutPos] = Previous[OutPos] ^ Data[InPos];
+                    OutPos++;
+                    InPos++;
+                    Count--;
+                }
+            }
+        }
+    }
+
+    if (Valid)
+    {
         /*
-        ** Set current filename sequence count...
+        ** Trailing bytes are unchanged...
         */
-        PktBuf->Pkt.FileInfo.SequenceCount = FileStatus->FileCount;
+        memcpy(&Packet[OutPos], &Previous[OutPos], Length - OutPos);
+    }
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Add packet to superframe                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileSuperframeAdd(int32 FileIndex, const CFE_SB_Buffer_t *BufPtr, uint32 PacketLength)
+{
+    DS_AppFileStatus_t *  FileStatus = &DS_AppData.FileStatus[FileIndex];
+    uint8 *               Superframe = DS_AppData.Superframe[FileIndex];
+    uint32                Size       = FileStatus->SuperframeSize;
+    uint32                Room       = Size - sizeof(DS_SuperframeHeader_t);
+    uint32                Need       = sizeof(uint16) + PacketLength;
+    uint16                Prefix     = (uint16)PacketLength;
+    DS_SuperframeHeader_t Header;
+
+    /*
+    ** Packet does not fit - write the superframe first...
+    */
+    if ((FileStatus->SuperframeUsed + Need) > Room)
+    {
+        DS_FileSuperframeFlush(FileIndex);
+    }
+
+    if (!OS_ObjectIdDefined(FileStatus->FileHandle))
+    {
         /*
-        ** Set file enable/disable state...
+        ** Superframe write failed - file has been closed and destination disabled...
         */
-        PktBuf->Pkt.FileInfo.EnableState = FileStatus->FileState;
+    }
+    else if (Need > Room)
+    {
         /*
-        ** Set file closed state...
+        ** Too large for any superframe - a record of its own, padded
+        **   to the next superframe boundary...
         */
-        PktBuf->Pkt.FileInfo.OpenState = DS_CLOSED;
+        memset(&Header, 0, sizeof(Header));
+        Header.Sync        = DS_SUPERFRAME_SYNC;
+        Header.PacketCount = 1;
+        Header.Length      = ((sizeof(Header) + Need + Size - 1) / Size) * Size;
+        Header.Used        = Need;
+
+        memcpy(Superframe, &Header, sizeof(Header));
+        memcpy(&Superframe[sizeof(Header)], &Prefix, sizeof(Prefix));
+        DS_FileWriteData(FileIndex, Superframe, sizeof(Header) + sizeof(Prefix));
+
+        if (OS_ObjectIdDefined(FileStatus->FileHandle))
+        {
+            DS_FileWriteData(FileIndex, BufPtr, PacketLength);
+        }
+
+        if (OS_ObjectIdDefined(FileStatus->FileHandle) && (Header.Length > (sizeof(Header) + Need)))
+        {
+            memset(Superframe, 0, Size);
+            DS_FileWriteData(FileIndex, Superframe, Header.Length - sizeof(Header) - Need);
+        }
+    }
+    else
+    {
+        if (FileStatus->SuperframeCount == 0)
+        {
+            FileStatus->SuperframeAge = 0;
+        }
+
+        memcpy(&Superframe[sizeof(Header) + FileStatus->SuperframeUsed], &Prefix, sizeof(Prefix));
+        memcpy(&Superframe[sizeof(Header) + FileStatus->SuperframeUsed + sizeof(Prefix)], BufPtr, PacketLength);
+
+        FileStatus->SuperframeUsed += Need;
+        FileStatus->SuperframeCount++;
+
         /*
-        ** Set current open filename...
+        ** Write the superframe as soon as no other packet can fit...
         */
-        strncpy(PktBuf->Pkt.FileInfo.FileName, FileStatus->FileName, sizeof(PktBuf->Pkt.FileInfo.FileName));
+        if ((Room - FileStatus->SuperframeUsed) <= sizeof(Prefix))
+        {
+            DS_FileSuperframeFlush(FileIndex);
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write partial superframe                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileSuperframeFlush(int32 FileIndex)
+{
+    DS_AppFileStatus_t *  FileStatus = &DS_AppData.FileStatus[FileIndex];
+    uint8 *               Superframe = DS_AppData.Superframe[FileIndex];
+    uint32                Size       = FileStatus->SuperframeSize;
+    DS_SuperframeHeader_t Header;
+
+    if (FileStatus->SuperframeCount > 0)
+    {
+        memset(&Header, 0, sizeof(Header));
+        Header.Sync        = DS_SUPERFRAME_SYNC;
+        Header.PacketCount = FileStatus->SuperframeCount;
+        Header.Length      = Size;
+        Header.Used        = FileStatus->SuperframeUsed;
+
+        memcpy(Superframe, &Header, sizeof(Header));
+        memset(&Superframe[sizeof(Header) + Header.Used], 0, Size - sizeof(Header) - Header.Used);
 
         /*
-        ** Timestamp and send file info telemetry...
+        ** Empty the superframe first - a write error closes the file...
         */
-        CFE_SB_TimeStampMsg(&PktBuf->Pkt.TlmHeader.Msg);
-        CFE_SB_TransmitBuffer(&PktBuf->SBBuf, true);
+        FileStatus->SuperframeCount = 0;
+        FileStatus->SuperframeUsed  = 0;
+        FileStatus->SuperframeAge   = 0;
+
+        DS_FileWriteData(FileIndex, Superframe, Size);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get file growth for superframe packet                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_FileSuperframeGrowth(int32 FileIndex, uint32 PacketLength)
+{
+    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+    uint32              Size       = FileStatus->SuperframeSize;
+    uint32              Room       = Size - sizeof(DS_SuperframeHeader_t);
+    uint32              Need       = sizeof(uint16) + PacketLength;
+    uint32              Growth     = Size;
+
+    if (Need > Room)
+    {
+        Growth = ((sizeof(DS_SuperframeHeader_t) + Need + Size - 1) / Size) * Size;
+    }
+
+    /*
+    ** Current superframe is written first if the packet does not fit...
+    */
+    if ((FileStatus->SuperframeCount > 0) && ((FileStatus->SuperframeUsed + Need) > Room))
+    {
+        Growth += Size;
     }
+
+    return Growth;
 }
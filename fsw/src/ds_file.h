@@ -28,6 +28,8 @@
 
 #include "ds_platform_cfg.h"
 
+#include "ds_finalize.h"
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* DS file header definitions                                      */
@@ -35,8 +37,19 @@
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 #if (DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE)
+/**
+ * \brief DS file header layout version
+ */
+#define DS_FILE_HEADER_VERSION 2
+
 /**
  * \brief DS File Header (follows cFE file header at start of file)
+ *
+ * The version 1 fields keep their version 1 offsets, so existing
+ * readers are not affected; version 2 fields are appended after them.
+ * The content summary lets readers select files by time or message ID
+ * without reading the packets.  Summary fields are zero until the file
+ * has been closed and finalized.
  */
 typedef struct
 {
@@ -47,9 +60,108 @@ typedef struct
     uint16 FileNameType;   /**< \brief Filename type - count vs time */
 
     char FileName[DS_TOTAL_FNAME_BUFSIZE]; /**< \brief On-board filename */
+
+    /* Version 2 fields */
+
+    uint32 Version; /**< \brief Header layout version (#DS_FILE_HEADER_VERSION) */
+
+    uint32 PacketCount;  /**< \brief Number of packets in the file */
+    uint32 FirstSeconds; /**< \brief Time of the first packet */
+    uint32 FirstSubsecs;
+    uint32 LastSeconds; /**< \brief Time of the last packet */
+    uint32 LastSubsecs;
+    uint32 DataBytes;   /**< \brief Stored bytes of packet data (after any delta, superframe
+                             or codec encoding) between the file header and the index */
+    uint32 IndexOffset; /**< \brief File offset of the trailing index (0 = none) */
+
+    uint16 MidCount;                        /**< \brief Number of message IDs in MidList */
+    uint16 MidOverflow;                     /**< \brief File holds message IDs not in MidList */
+    uint32 MidList[DS_FILE_HEADER_MID_CNT]; /**< \brief Message IDs in the file */
+
+    uint32 MidBloom[DS_FILE_BLOOM_BITS / 32]; /**< \brief Bloom filter of every message ID in the file
+                                                   (see #DS_FileBloomBit) */
 } DS_FileHeader_t;
 #endif
 
+/**
+ * \brief DS file index sample
+ *
+ * The file index is written at the end of the file, at the offset
+ * given by the DS file header.  It is a #DS_FileIndexHeader_t followed
+ * by samples in file order.
+ */
+typedef struct
+{
+    uint32 Seconds; /**< \brief Packet time */
+    uint32 Subsecs;
+    uint32 Offset; /**< \brief File offset of the packet */
+} DS_FileIndexEntry_t;
+
+/**
+ * \brief DS file index header
+ */
+typedef struct
+{
+    uint32 EntryCount; /**< \brief Number of samples that follow */
+    uint32 EntrySize;  /**< \brief Size of each sample in bytes */
+} DS_FileIndexHeader_t;
+
+#define DS_DELTA_KEYFRAME 0 /**< \brief Delta record holds the whole packet */
+#define DS_DELTA_XOR      1 /**< \brief Delta record holds the packet XOR the previous packet */
+
+/**
+ * \brief DS delta record header
+ *
+ * Destinations with a non-zero DeltaKeyframe store each packet as a
+ * record (in host byte order).  A #DS_DELTA_KEYFRAME record is followed
+ * by the packet.  A #DS_DELTA_XOR record applies to the previous packet
+ * of the same message ID, which has the same length, and is followed
+ * by (skip, count) byte pairs: skip bytes are unchanged, then count
+ * bytes follow that are XORed with the previous packet.  Bytes after
+ * the last pair are unchanged.  Every file starts each message ID with
+ * a keyframe.
+ */
+typedef struct
+{
+    uint32 MessageID; /**< \brief Packet message ID value */
+    uint16 Type;      /**< \brief #DS_DELTA_KEYFRAME or #DS_DELTA_XOR */
+    uint16 Count;     /**< \brief Records since the keyframe (0 = keyframe) */
+    uint32 Length;    /**< \brief Record data bytes following the header */
+} DS_DeltaRecord_t;
+
+/**
+ * \brief Last stored packet of a message ID
+ */
+typedef struct
+{
+    uint32 MessageID;                     /**< \brief Packet message ID value */
+    uint32 Length;                        /**< \brief Packet length, zero = unused */
+    uint32 Count;                         /**< \brief Packets stored since (and including) the keyframe */
+    uint8  Packet[DS_DELTA_MAX_PKT_SIZE]; /**< \brief Packet contents */
+} DS_DeltaSlot_t;
+
+#define DS_SUPERFRAME_SYNC     0x44535346 /**< \brief Superframe header sync word ("DSSF") */
+#define DS_SUPERFRAME_MIN_SIZE 64         /**< \brief Smallest superframe size a table may select */
+
+/**
+ * \brief DS superframe header
+ *
+ * Destinations with a non-zero SuperframeSize pack consecutive packets
+ * into records of exactly SuperframeSize bytes (in host byte order).
+ * The header is followed by Used bytes of packets, each preceded by its
+ * uint16 length, and zero padding.  A packet too large for an empty
+ * superframe gets a record of its own, rounded up to a multiple of
+ * SuperframeSize, so records always end on a superframe boundary.
+ */
+typedef struct
+{
+    uint32 Sync;        /**< \brief #DS_SUPERFRAME_SYNC */
+    uint16 PacketCount; /**< \brief Packets in the superframe */
+    uint16 Spare;       /**< \brief Structure padding */
+    uint32 Length;      /**< \brief Record bytes, including this header and the padding */
+    uint32 Used;        /**< \brief Length-prefixed packet bytes following the header */
+} DS_SuperframeHeader_t;
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Prototypes for functions defined in ds_file.c                   */
@@ -111,7 +223,9 @@ void DS_FileSetupWrite(int32 FileIndex, const CFE_SB_Buffer_t *BufPtr);
  *  \par Description
  *       This function writes data to an existing data storage
  *       destination file and updates the associated data rate
- *       counters. If necessary, the function will invoke a
+ *       counters. If the destination has a write buffer, data is
+ *       appended to the buffer and the buffer is written to the
+ *       file when full. If necessary, the function will invoke a
  *       file write error handler.
  *
  *  \par Assumptions, External Events, and Notes:
@@ -125,6 +239,27 @@ void DS_FileSetupWrite(int32 FileIndex, const CFE_SB_Buffer_t *BufPtr);
  */
 void DS_FileWriteData(int32 FileIndex, const void *FileData, uint32 DataLength);
 
+/**
+ *  \brief Write data (packet) to direct I/O file
+ *
+ *  \par Description
+ *       Appends data to the write buffer of a destination file that
+ *       is written with direct I/O, flushing the buffer each time it
+ *       reaches a block boundary.  Packets larger than the buffer are
+ *       split across flushes.  The first buffer after the file header
+ *       is short, so that every later flush starts on a block boundary.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Destination file is open for direct I/O.
+ *
+ *  \param[in] FileIndex  Destination file index
+ *  \param[in] FileData   Pointer to packet data
+ *  \param[in] DataLength Length of packet data
+ *
+ *  \sa #DS_FileWriteData, #DS_FileFlushDirect
+ */
+void DS_FileWriteDirect(int32 FileIndex, const void *FileData, uint32 DataLength);
+
 /**
  *  \brief Write data storage file header
  *
@@ -145,6 +280,30 @@ void DS_FileWriteData(int32 FileIndex, const void *FileData, uint32 DataLength);
  */
 void DS_FileWriteHeader(int32 FileIndex);
 
+/**
+ *  \brief Write data storage file header to an open file
+ *
+ *  \par Description
+ *       Writes the configured file header (if any) for a destination
+ *       to the selected file.  Used for the current destination file
+ *       and for a next file that is opened ahead of time.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The caller handles write errors.
+ *
+ *  \param[in]  FileIndex  Destination file index
+ *  \param[in]  FileHandle Open file handle
+ *  \param[in]  FileName   Filename stored in the DS file header
+ *  \param[out] DataLength Header size in bytes (or size of the failed write)
+ *
+ *  \return Execution status
+ *  \retval #CFE_SUCCESS Header was written
+ *  \retval Other        Result of the failed file write
+ *
+ *  \sa #DS_FileWriteHeader
+ */
+int32 DS_FileWriteHeaderData(int32 FileIndex, osal_id_t FileHandle, const char *FileName, uint32 *DataLength);
+
 /**
  *  \brief File write error handler
  *
@@ -176,15 +335,159 @@ void DS_FileWriteError(uint32 FileIndex, uint32 DataLength, int32 WriteResult);
  *       this destination to pass the filter test - or the previous
  *       file may have been closed by command or file size/age test.
  *       Note that destination files are not created until there is
- *       a packet ready to be written.
+ *       a packet ready to be written.  If the next file was opened
+ *       ahead of time it becomes the destination file.
  *
  *  \par Assumptions, External Events, and Notes:
  *       (none)
  *
  *  \param[in] FileIndex Destination file index
+ *
+ *  \sa #DS_FileOpenSpare
  */
 void DS_FileCreateDest(uint32 FileIndex);
 
+/**
+ *  \brief Open direct I/O access to a new destination file
+ *
+ *  \par Description
+ *       Resets the direct I/O state for a newly started destination
+ *       file.  If the Destination File Table entry selects direct I/O,
+ *       a direct I/O descriptor is opened for the file.  Errors are
+ *       reported and the file is then written through the page cache.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       File header has been written.
+ *
+ *  \param[in] FileIndex Destination file index
+ *
+ *  \sa #DS_FsExtOpenDirect, #DS_FileCloseDest
+ */
+void DS_FileOpenDirect(uint32 FileIndex);
+
+/**
+ *  \brief Reserve storage for a new destination file
+ *
+ *  \par Description
+ *       If the Destination File Table entry selects preallocation,
+ *       reserves storage for the maximum file size.  Errors are
+ *       reported but the file is still used.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] FileIndex Destination file index
+ *  \param[in] FileName  Name of the newly created file
+ *
+ *  \return Storage was reserved (unused storage is released at close)
+ *
+ *  \sa #DS_FsExtAllocate, #DS_FileFinalize
+ */
+bool DS_FilePreallocate(uint32 FileIndex, const char *FileName);
+
+/**
+ *  \brief Open the next destination file ahead of time
+ *
+ *  \par Description
+ *       Creates the file that would be created if the current file
+ *       for this destination were closed now, and writes its file
+ *       header.  The file is held until #DS_FileCreateDest needs a
+ *       new file.  Errors are reported but do not close the current
+ *       file or disable the destination.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] FileIndex Destination file index
+ *
+ *  \sa #DS_FileCloseSpare, #DS_FileTestPreopen
+ */
+void DS_FileOpenSpare(uint32 FileIndex);
+
+/**
+ *  \brief Discard the pre-opened next destination file
+ *
+ *  \par Description
+ *       Closes and removes the next file opened ahead of time (if
+ *       any).  Called when destination settings that are part of the
+ *       filename change, and by the close all command.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] FileIndex Destination file index
+ *
+ *  \sa #DS_FileOpenSpare
+ */
+void DS_FileCloseSpare(uint32 FileIndex);
+
+/**
+ *  \brief Pre-open processor
+ *
+ *  \par Description
+ *       Called by the maintenance scheduler.  Opens the next file for
+ *       each enabled destination whose open file has reached
+ *       #DS_FILE_PREOPEN_PERCENT of its maximum size or age.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The size threshold is also tested after every write, so this
+ *       mostly catches files that reach the age threshold.
+ *
+ *  \sa #DS_FileTestPreopenDest
+ */
+void DS_FileTestPreopen(void);
+
+/**
+ *  \brief Pre-open test for one destination
+ *
+ *  \par Description
+ *       Opens the next file for the destination if it is enabled, has
+ *       no next file yet and its open file has reached
+ *       #DS_FILE_PREOPEN_PERCENT of its maximum size or age.  Called
+ *       by the writer after each packet write and by the maintenance
+ *       scheduler.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The destination file table pointer is valid.
+ *
+ *  \param[in] FileIndex Destination file index
+ *
+ *  \sa #DS_FileOpenSpare, #DS_FileTestPreopen
+ */
+void DS_FileTestPreopenDest(uint32 FileIndex);
+
+/**
+ *  \brief Record new file start latency
+ *
+ *  \par Description
+ *       Updates the file rotation statistics with the time taken
+ *       to start a new file for a packet, measured from when the new
+ *       file was found to be needed (including closing the previous
+ *       file) to when the packet can be written.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] StartTime Mission elapsed time when the new file was needed
+ */
+void DS_FileRotationDone(CFE_TIME_SysTime_t StartTime);
+
+/**
+ *  \brief Measure elapsed time in microseconds
+ *
+ *  \par Description
+ *       Returns the mission elapsed time since the start time, in
+ *       microseconds.  Saturates at 0xFFFFFFFF rather than wrapping.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] StartTime Mission elapsed time at the start of the interval
+ *
+ *  \return Elapsed time (microseconds)
+ */
+uint32 DS_FileElapsedTime(CFE_TIME_SysTime_t StartTime);
+
 /**
  *  \brief Construct the next filename for a destination file
  *
@@ -199,11 +502,12 @@ void DS_FileCreateDest(uint32 FileIndex);
  *  \par Assumptions, External Events, and Notes:
  *       (none)
  *
- *  \param[in] FileIndex Destination file index
+ *  \param[in]  FileIndex Destination file index
+ *  \param[out] FileName  Filename buffer (#DS_TOTAL_FNAME_BUFSIZE bytes)
  *
  *  \sa #DS_DestFileEntry_t
  */
-void DS_FileCreateName(uint32 FileIndex);
+void DS_FileCreateName(uint32 FileIndex, char *FileName);
 
 /**
  *  \brief Construct the sequence portion of a filename
@@ -232,21 +536,350 @@ void DS_FileCreateSequence(char *Buffer, uint32 Type, uint32 Count);
  *  \brief Update destination file header (prior to closing)
  *
  *  \par Description
- *       This function is called just before closing a data storage
- *       destination file. The purpose of the function is to update
- *       portions of the file header that cannot be known in advance,
- *       such as the file size or the file close time.  During the
- *       update process, seek and write errors are counted but
- *       otherwise ignored as the file is about to be closed.
+ *       This function is called by the file finalizer for each closed
+ *       data storage destination file. The purpose of the function is
+ *       to update portions of the file header that cannot be known in
+ *       advance, such as the file close time and the content summary.  The
+ *       whole DS header is rebuilt from the entry, so the close time and the
+ *       summary are written together with a single positional write when
+ *       #DS_FILE_POSITIONAL_WRITE is set, or else through a new OSAL
+ *       file handle.  Errors are counted but otherwise ignored.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Any buffered data has already been written to the file.
+ *
+ *  \param[in] Entry Closed destination file
+ *
+ *  \sa #DS_FileWriteHeader, #DS_FileFinalize
+ */
+void DS_FileUpdateHeader(const DS_FinalizeEntry_t *Entry);
+
+/**
+ *  \brief Add packet to destination file content summary
+ *
+ *  \par Description
+ *       Counts a packet written to the destination file and records
+ *       its time and message ID for the DS file header.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Packets are only counted if the file is still open after the
+ *       write (a write error closes the file).
+ *
+ *  \param[in] FileIndex    Destination file table index
+ *  \param[in] BufPtr       Packet written to the file
+ *  \param[in] PacketLength Packet length in bytes
+ *
+ *  \sa #DS_FileUpdateHeader
+ */
+void DS_FileSummaryUpdate(int32 FileIndex, const CFE_SB_Buffer_t *BufPtr, uint32 PacketLength);
+
+/**
+ *  \brief Add packet to destination file index
+ *
+ *  \par Description
+ *       Records a (packet time, file offset) sample if the packet is
+ *       at least the table selected number of bytes or seconds past
+ *       the previous sample.  When the index is full, every other
+ *       sample is dropped and the spacing is doubled.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] FileIndex  Destination file table index
+ *  \param[in] PacketTime Packet time
+ *  \param[in] Offset     File offset of the packet
+ *
+ *  \sa #DS_FileWriteIndex
+ */
+void DS_FileIndexUpdate(int32 FileIndex, CFE_TIME_SysTime_t PacketTime, uint32 Offset);
+
+/**
+ *  \brief Message ID Bloom filter bit
+ *
+ *  \par Description
+ *       Returns the Bloom filter bit number selected by one of the
+ *       #DS_FILE_BLOOM_HASH_CNT hash functions for a message ID.  Bit
+ *       N is bit (N % 32) of word (N / 32) of the filter.  Hash i of
+ *       message ID V is (H1 + (i * H2)) % #DS_FILE_BLOOM_BITS, where
+ *       H1 = V * 0x9E3779B1 and H2 = (V * 0x85EBCA77) | 1 (32 bit
+ *       unsigned arithmetic).  Tools that search DS files must use the
+ *       same hash functions.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] MessageValue Message ID value
+ *  \param[in] HashIndex    Hash function number (0 to #DS_FILE_BLOOM_HASH_CNT - 1)
+ *
+ *  \return Filter bit number
+ */
+uint32 DS_FileBloomBit(uint32 MessageValue, uint32 HashIndex);
+
+/**
+ *  \brief Write destination file index
+ *
+ *  \par Description
+ *       Appends the index samples (if any) to the destination file and
+ *       records the index file offset for the DS file header.  The
+ *       index is then emptied.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called as the file is closed.  A write error closes the file
+ *       and disables the destination (the file has no index).
+ *
+ *  \param[in] FileIndex Destination file table index
+ *
+ *  \sa #DS_FileIndexUpdate, #DS_FileCloseDest
+ */
+void DS_FileWriteIndex(int32 FileIndex);
+
+/**
+ *  \brief Flush destination file write buffer
+ *
+ *  \par Description
+ *       This function writes any data held in the write buffer for
+ *       the selected destination file to the file in a single call.
+ *       It is called when the buffer is full, before the file header
+ *       is updated prior to closing the file, and by command. A write
+ *       error will result in the execution of the common file write
+ *       error handler, which closes the file.
  *
  *  \par Assumptions, External Events, and Notes:
  *       (none)
  *
  *  \param[in] FileIndex Destination file index
  *
- *  \sa #DS_FileWriteHeader
+ *  \return Execution status
+ *  \retval #CFE_SUCCESS Buffer was empty or was written to the file
+ *  \retval Other        Result of the failed file write
+ *
+ *  \sa #DS_FileWriteData, #DS_DestFileEntry_t
+ */
+int32 DS_FileFlushBuffer(int32 FileIndex);
+
+/**
+ *  \brief Write compressed block
+ *
+ *  \par Description
+ *       Compresses the data with the codec selected when the current
+ *       destination file was created, and writes it to the file as one
+ *       framed block (see #DS_CodecFrame_t).  Data that does not get
+ *       smaller is written uncompressed behind the frame.  Updates the
+ *       file compression statistics.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The caller handles write errors (and all other counters).
+ *
+ *  \param[in] FileIndex Destination file index
+ *  \param[in] Data      Packet data
+ *  \param[in] Length    Packet data length (bytes)
+ *
+ *  \return Bytes written to the file (frame included), or the result of
+ *          the failed file write (#OS_ERROR for a short write)
+ *
+ *  \sa #DS_FileFlushBuffer, #DS_CodecCompress
+ */
+int32 DS_FileWriteBlock(int32 FileIndex, const void *Data, uint32 Length);
+
+/**
+ *  \brief Write packet to destination file
+ *
+ *  \par Description
+ *       Writes the packet as-is, or as a delta record when the current
+ *       file stores delta records (see #DS_DeltaRecord_t).  A full
+ *       keyframe record is written for the first packet of a message
+ *       ID, every DeltaKeyframe packets, when the length changes, or
+ *       when the delta would not be smaller than the packet.  Updates
+ *       the delta record byte counts.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A write error closes the file (see #DS_FileWriteData).
+ *
+ *  \param[in] FileIndex    Destination file index
+ *  \param[in] BufPtr       Software Bus message pointer
+ *  \param[in] PacketLength Packet length (bytes)
+ *
+ *  \sa #DS_FileSetupWrite
+ */
+void DS_FileWritePacket(int32 FileIndex, const CFE_SB_Buffer_t *BufPtr, uint32 PacketLength);
+
+/**
+ *  \brief Get delta record message ID slot
+ *
+ *  \par Description
+ *       Returns the slot holding the last packet stored for the message
+ *       ID.  A message ID without a slot gets an unused slot, or else
+ *       replaces the slot assigned longest ago (and starts with a
+ *       keyframe).
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] FileIndex Destination file index
+ *  \param[in] MessageID Packet message ID value
+ *
+ *  \return Message ID slot
+ */
+DS_DeltaSlot_t *DS_FileDeltaSlot(int32 FileIndex, uint32 MessageID);
+
+/**
+ *  \brief Encode XOR delta
+ *
+ *  \par Description
+ *       Writes the (skip, count) pairs that turn Previous into Packet.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in]  Previous Previous packet of the same message ID
+ *  \param[in]  Packet   Packet to encode
+ *  \param[in]  Length   Packet length (bytes), same for both packets
+ *  \param[out] Output   Delta record data
+ *  \param[in]  MaxSize  Output buffer size (bytes)
+ *
+ *  \return Delta record data length, 0 if it would not be smaller than the packet
+ */
+uint32 DS_FileDeltaEncode(const uint8 *Previous, const uint8 *Packet, uint32 Length, uint8 *Output, uint32 MaxSize);
+
+/**
+ *  \brief Decode XOR delta
+ *
+ *  \par Description
+ *       Rebuilds a packet from the previous packet of the same message
+ *       ID and the delta record data.  Used in unit tests and as the
+ *       reference for ground tools.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Damaged data is detected rather than overrunning the packet.
+ *
+ *  \param[in]  Previous   Previous packet of the same message ID
+ *  \param[in]  Length     Packet length (bytes), same for both packets
+ *  \param[in]  Data       Delta record data
+ *  \param[in]  DataLength Delta record data length (bytes)
+ *  \param[out] Packet     Rebuilt packet (Length bytes)
+ *
+ *  \return Data was a complete delta for a packet of Length bytes
+ */
+bool DS_FileDeltaDecode(const uint8 *Previous, uint32 Length, const uint8 *Data, uint32 DataLength, uint8 *Packet);
+
+/**
+ *  \brief Add packet to superframe
+ *
+ *  \par Description
+ *       Appends the length-prefixed packet to the destination
+ *       superframe (see #DS_SuperframeHeader_t).  The superframe is
+ *       written first if the packet does not fit, and as soon as it is
+ *       full.  A packet too large for an empty superframe is written
+ *       as a record of its own.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A write error closes the file (see #DS_FileWriteData).
+ *
+ *  \param[in] FileIndex    Destination file index
+ *  \param[in] BufPtr       Software Bus message pointer
+ *  \param[in] PacketLength Packet length (bytes)
+ *
+ *  \sa #DS_FileWritePacket, #DS_FileSuperframeFlush
+ */
+void DS_FileSuperframeAdd(int32 FileIndex, const CFE_SB_Buffer_t *BufPtr, uint32 PacketLength);
+
+/**
+ *  \brief Write partial superframe
+ *
+ *  \par Description
+ *       Pads the destination superframe to its full size and writes it
+ *       to the file, if it holds any packets.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called when the superframe is full, has waited SuperframeAge
+ *       seconds, or the file is closed.
+ *
+ *  \param[in] FileIndex Destination file index
+ *
+ *  \sa #DS_FileSuperframeAdd, #DS_FileTestAge, #DS_FileCloseDest
+ */
+void DS_FileSuperframeFlush(int32 FileIndex);
+
+/**
+ *  \brief Get file growth for superframe packet
+ *
+ *  \par Description
+ *       Returns the bytes the file grows by once the packet and the
+ *       superframe(s) it is added to have been written, so the file
+ *       size limit can be tested before the packet is added.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] FileIndex    Destination file index
+ *  \param[in] PacketLength Packet length (bytes)
+ *
+ *  \return File growth (bytes)
+ *
+ *  \sa #DS_FileSetupWrite
+ */
+uint32 DS_FileSuperframeGrowth(int32 FileIndex, uint32 PacketLength);
+
+/**
+ *  \brief Flush write buffer with direct I/O
+ *
+ *  \par Description
+ *       Writes the write buffer to the file in whole blocks, padding
+ *       the partial last block.  The partial block stays in the buffer
+ *       and is written again when more data is flushed, so only new
+ *       data causes a write.  A write error will result in the
+ *       execution of the common file write error handler.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Write buffer starts on a block boundary of the file.
+ *
+ *  \param[in] FileIndex Destination file index
+ *
+ *  \return Execution status
+ *  \retval #CFE_SUCCESS Buffer had no new data or was written to the file
+ *  \retval #OS_ERROR    File write failed
+ *
+ *  \sa #DS_FileFlushBuffer, #DS_FsExtWriteDirect
+ */
+int32 DS_FileFlushDirect(int32 FileIndex);
+
+/**
+ *  \brief Apply destination file sync policy
+ *
+ *  \par Description
+ *       Syncs the open destination file when its Destination File Table
+ *       sync policy is due: #DS_SYNC_BY_BYTES after the sync interval
+ *       in bytes has been written, #DS_SYNC_BY_TIME when written data
+ *       has waited the sync interval in seconds.  Buffered data is
+ *       written to the file first.  Other policies do nothing here.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Destination file must be open.
+ *
+ *  \param[in] FileIndex Destination file index
+ *
+ *  \sa #DS_FileSync, #DS_DestFileEntry_t
+ */
+void DS_FileTestSync(int32 FileIndex);
+
+/**
+ *  \brief Commit destination file data to storage
+ *
+ *  \par Description
+ *       Syncs the named file and updates the sync statistics.  Errors
+ *       are reported and counted but are otherwise ignored.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by the storage writer and the file finalizer.
+ *
+ *  \param[in] FileName Destination filename
+ *
+ *  \return Execution status, see \ref OSReturnCodes
+ *  \retval #OS_SUCCESS \copybrief OS_SUCCESS
+ *
+ *  \sa #DS_FsExtSync
  */
-void DS_FileUpdateHeader(int32 FileIndex);
+int32 DS_FileSync(const char *FileName);
 
 /**
  *  \brief Close selected destination file
@@ -255,28 +888,79 @@ void DS_FileUpdateHeader(int32 FileIndex);
  *       This function may be called from the DS Close File command
  *       handler, from the file age processor, from the file size
  *       processor and from the file write error handler.
- *       The function closes the selected destination file and updates
- *       the file status data to indicate that the file handle is not
- *       in use and that the file age, size and name fields are reset.
+ *       The function writes any buffered data to the selected
+ *       destination file, builds the downlink filename and hands the
+ *       file to the file finalizer.  The file status data is updated
+ *       to indicate that the file handle is not in use and that the
+ *       file age, size and name fields are reset.  If the buffered
+ *       data cannot be written, the file is closed by the write error
+ *       handler instead.
  *
  *  \par Assumptions, External Events, and Notes:
- *       (none)
+ *       If the finalizer queue is full, the closed file is kept in the
+ *       file status data until #DS_FileRetryFinalize hands it over.  A
+ *       destination keeps at most one such file, so a second close
+ *       waits for room in the queue.
  *
  *  \param[in] FileIndex Destination file index
+ *
+ *  \sa #DS_FinalizeEnqueue
  */
 void DS_FileCloseDest(int32 FileIndex);
 
+/**
+ *  \brief Hand a waiting closed file to the finalizer
+ *
+ *  \par Description
+ *       Queues the closed file kept by the selected destination while
+ *       the finalizer queue was full.  Files are handed over in the
+ *       order they were closed, and are never finalized ahead of the
+ *       files already in the queue.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called with the storage writer lock held.  Does nothing if the
+ *       destination has no waiting file.
+ *
+ *  \param[in] FileIndex Destination file index
+ *  \param[in] Wait      Wait for room in the queue (else try once)
+ *
+ *  \sa #DS_FileCloseDest
+ */
+void DS_FileRetryFinalize(int32 FileIndex, bool Wait);
+
+/**
+ *  \brief Finalize closed destination file
+ *
+ *  \par Description
+ *       This function is called by the file finalizer for each closed
+ *       destination file.  The file close time is written to the file
+ *       header, the file is closed, trimmed and synced (if selected)
+ *       and (if configured) moved to the downlink directory, and the file information telemetry packet
+ *       is sent.  A file restored after a processor reset is first
+ *       opened again by name.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Does not access destination file status or the Destination
+ *       File Table.
+ *
+ *  \param[in,out] Entry Closed destination file
+ *
+ *  \sa #DS_FileCloseDest, #DS_FileTransmit
+ */
+void DS_FileFinalize(DS_FinalizeEntry_t *Entry);
+
 /**
  *  \brief File age processor
  *
  *  \par Description
- *       This function is called upon receipt of the DS 1Hz command
- *       (if defined) or upon receipt of the DS housekeeping request
- *       command (if the 1Hz cmd is not defined).
+ *       This function is called by the maintenance scheduler with
+ *       the whole seconds of scheduler clock time that have elapsed
+ *       since the previous call.
  *       The function increments the elapsed file age for all open
  *       data storage files by the amount specified.
  *       Files that exceed the age limit set in the destination file
- *       definition table will be closed.
+ *       definition table will be closed.  Files that remain open are
+ *       synced if their sync policy is due.
  *       If this destination remains enabled, another file will be
  *       opened when the next packet is written to this destination.
  *
@@ -291,17 +975,17 @@ void DS_FileTestAge(uint32 ElapsedSeconds);
  *  \brief Transmit file information telemetry handler
  *
  *  \par Description
- *       Create and send a telemetry packet containing the current
- *       status for a closed destination file.
+ *       Create and send a telemetry packet containing the status
+ *       of a destination file at the time it was closed.
  *
  *  \par Assumptions, External Events, and Notes:
  *       (none)
  *
- *  \param[in] FileStatus Current state of destination file
+ *  \param[in] FileInfo State of destination file when closed
  *
  *  \sa #DS_FileCompletePktBuf_t
  */
-void DS_FileTransmit(DS_AppFileStatus_t *FileStatus);
+void DS_FileTransmit(const DS_FileInfo_t *FileInfo);
 
 /**
  * \brief Determine whether Software Bus message packet is filtered
@@ -326,4 +1010,136 @@ void DS_FileTransmit(DS_AppFileStatus_t *FileStatus);
 bool DS_IsPacketFiltered(CFE_MSG_Message_t *MessagePtr, uint16 FilterType, uint16 Algorithm_N, uint16 Algorithm_X,
                          uint16 Algorithm_O);
 
+/**
+ * \brief Create packet filter value from Software Bus message packet
+ *
+ *  \par Description
+ *       This routine extracts the value used by the DS filter algorithm
+ *       from either the packet sequence count or the packet timestamp.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Any filter type other than sequence count selects timestamp.
+ *
+ *  \param[in] MessagePtr Pointer to a Software Bus message packet
+ *  \param[in] FilterType Packet sequence count (1) or timestamp (2)
+ *
+ *  \return Packet filter value
+ */
+uint16 DS_FilterPacketValue(CFE_MSG_Message_t *MessagePtr, uint16 FilterType);
+
+/**
+ * \brief Determine whether packet filter value is filtered by routing plan filter
+ *
+ *  \par Description
+ *       This routine applies the DS filter algorithm to a packet filter
+ *       value using the parameters from a packet routing plan filter.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Routing plan filter parameters have already been validated.
+ *
+ *  \param[in] RouteFilter Pointer to a packet routing plan filter
+ *  \param[in] PacketValue Packet filter value
+ *
+ *  \return Boolean packet filtered response
+ *  \retval true  The packet should be filtered (not used)
+ *  \retval false The packet should not be filtered (used)
+ *
+ *  \sa #DS_RouteFilter_t, #DS_FilterPacketValue
+ */
+bool DS_IsRouteFiltered(const DS_RouteFilter_t *RouteFilter, uint16 PacketValue);
+
+/**
+ * \brief Create packet content fingerprint from Software Bus message packet
+ *
+ *  \par Description
+ *       This routine computes a 64 bit FNV-1a hash of the packet length
+ *       and the bytes that follow the packet header, so packets that
+ *       differ only in timestamp, sequence count or checksum have the
+ *       same fingerprint.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] BufPtr Software Bus message pointer
+ *
+ *  \return Packet content fingerprint
+ */
+uint64 DS_FilterPacketFingerprint(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ * \brief Determine whether packet is filtered by routing plan content filter
+ *
+ *  \par Description
+ *       This routine drops packets whose fingerprint matches the last
+ *       packet the filter passed, except that one packet in every
+ *       Algorithm_X is passed as a keep-alive.  The filter remembers
+ *       the fingerprint of each packet it passes.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Routing plan filter parameters have already been validated.
+ *
+ *  \param[in] RouteFilter Pointer to a #DS_BY_CONTENT routing plan filter
+ *  \param[in] Fingerprint Packet content fingerprint
+ *
+ *  \return Boolean packet filtered response
+ *  \retval true  The packet should be filtered (not used)
+ *  \retval false The packet should not be filtered (used)
+ *
+ *  \sa #DS_RouteFilter_t, #DS_FilterPacketFingerprint
+ */
+bool DS_IsContentFiltered(DS_RouteFilter_t *RouteFilter, uint64 Fingerprint);
+
+/**
+ * \brief Determine whether packet is filtered by routing plan rate filter
+ *
+ *  \par Description
+ *       This routine applies a token bucket to the packet.  The bucket
+ *       refills at Algorithm_N packets (or units of 2^Algorithm_O bytes)
+ *       per second, holds at most Algorithm_X, and starts full.  A packet passes and is taken
+ *       from the bucket when enough tokens are left.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Routing plan filter parameters have already been validated.
+ *       Time moving backwards refills nothing.  The caller passes
+ *       mission elapsed time so that time corrections neither refill
+ *       nor stall the bucket.
+ *
+ *  \param[in] RouteFilter  Pointer to a #DS_BY_PKT_RATE or #DS_BY_BYTE_RATE routing plan filter
+ *  \param[in] PacketTime   Mission elapsed time the packet is being stored
+ *  \param[in] PacketLength Packet length (bytes)
+ *
+ *  \return Boolean packet filtered response
+ *  \retval true  The packet should be filtered (not used)
+ *  \retval false The packet should not be filtered (used)
+ *
+ *  \sa #DS_RouteFilter_t, #DS_RATE_TOKEN_SHIFT
+ */
+bool DS_IsRateFiltered(DS_RouteFilter_t *RouteFilter, CFE_TIME_SysTime_t PacketTime, size_t PacketLength);
+
+/**
+ * \brief Determine whether packet is filtered by routing plan predicates
+ *
+ *  \par Description
+ *       This routine evaluates the predicates compiled into the routing
+ *       plan for the packet.  The packet matches when it is at least
+ *       MinLength bytes long and every predicate matches.  Each
+ *       predicate is evaluated without an early exit so the loop holds
+ *       no data-dependent branches.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Predicate offsets were checked against MinLength when the
+ *       routing plan was compiled.
+ *
+ *  \param[in] RoutePlan    Pointer to the routing plan for the packet
+ *  \param[in] BufPtr       Software Bus message pointer
+ *  \param[in] PacketLength Packet length (bytes)
+ *
+ *  \return Boolean packet filtered response
+ *  \retval true  The packet should be filtered (not used)
+ *  \retval false The packet should not be filtered (used)
+ *
+ *  \sa #DS_RoutePlan_t, #DS_FilterPredicate_t
+ */
+bool DS_IsPredicateFiltered(const DS_RoutePlan_t *RoutePlan, const CFE_SB_Buffer_t *BufPtr, size_t PacketLength);
+
 #endif
@@ -0,0 +1,528 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,917-1, and identified as “CFS Data Storage
+ * (DS) application version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  CFS Data Storage (DS) file finalizer child task functions
+ */
+
+#include "cfe.h"
+
+#include "ds_platform_cfg.h"
+#include "ds_verify.h"
+
+#include "ds_appdefs.h"
+
+#include "ds_app.h"
+#include "ds_file.h"
+#include "ds_finalize.h"
+#include "ds_events.h"
+
+#include <stdio.h>
+
+#define DS_FINALIZE_CDS_NAME       "DS_FINAL_CDS"
+#define DS_FINALIZE_ENTRY_CDS_NAME "DS_FINAL_%u"
+#define DS_FINALIZE_SPARE_CDS_NAME "DS_SPARE_%u"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* File finalizer initialization                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FinalizeInit(void)
+{
+    int32 Result = CFE_SUCCESS;
+
+    DS_AppData.FinalizeTaskActive = false;
+
+    /*
+    ** Get back any files that were waiting at a processor reset...
+    */
+    DS_FinalizeCreateCDS();
+
+    /*
+    ** Remove pre-opened files that were never used before a processor reset...
+    */
+    DS_FinalizeCreateSpareCDS();
+
+    /*
+    ** Create semaphore used to signal files added to the queue (one
+    **   count for each file already waiting)...
+    */
+    Result = OS_CountSemCreate(&DS_AppData.FinalizeSemId, DS_FINALIZE_SEM_NAME, DS_AppData.FinalizeQueue.Count, 0);
+
+    if (Result != OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(DS_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Unable to create finalizer semaphore, err = 0x%08X", (unsigned int)Result);
+    }
+
+    /*
+    ** Create mutex used to serialize queue access...
+    */
+    if (Result == OS_SUCCESS)
+    {
+        Result = OS_MutSemCreate(&DS_AppData.FinalizeMutexId, DS_FINALIZE_MUTEX_NAME, 0);
+
+        if (Result != OS_SUCCESS)
+        {
+            CFE_EVS_SendEvent(DS_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Unable to create finalizer mutex, err = 0x%08X", (unsigned int)Result);
+        }
+    }
+
+    /*
+    ** Create file finalizer child task...
+    */
+    if (Result == OS_SUCCESS)
+    {
+        Result = CFE_ES_CreateChildTask(&DS_AppData.FinalizeTaskId, DS_FINALIZE_TASK_NAME, DS_FinalizeTask,
+                                        CFE_ES_TASK_STACK_ALLOCATE, DS_FINALIZE_TASK_STACK_SIZE,
+                                        DS_FINALIZE_TASK_PRIORITY, 0);
+
+        if (Result != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(DS_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Unable to create finalizer child task, err = 0x%08X", (unsigned int)Result);
+        }
+        else
+        {
+            DS_AppData.FinalizeTaskActive = true;
+        }
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* File finalizer child task entry point                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FinalizeTask(void)
+{
+    int32 Result = OS_SUCCESS;
+
+    while (Result == OS_SUCCESS)
+    {
+        /*
+        ** One semaphore count is given for each file added to the queue...
+        */
+        Result = OS_CountSemTake(DS_AppData.FinalizeSemId);
+
+        if (Result == OS_SUCCESS)
+        {
+            DS_FinalizeProcessNext();
+        }
+    }
+
+    /*
+    ** Revert to finalizing files from the task that closes them...
+    */
+    OS_MutSemTake(DS_AppData.FinalizeMutexId);
+    DS_AppData.FinalizeTaskActive = false;
+    OS_MutSemGive(DS_AppData.FinalizeMutexId);
+
+    CFE_EVS_SendEvent(DS_FINALIZE_TASK_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "File finalizer task terminating, err = 0x%08X", (unsigned int)Result);
+
+    CFE_ES_ExitChildTask();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Queue a closed destination file                                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_FinalizeEnqueue(const DS_FinalizeEntry_t *Entry)
+{
+    DS_FinalizeQueue_t *Queue      = &DS_AppData.FinalizeQueue;
+    DS_FinalizeEntry_t  LocalEntry;
+    bool                Queued     = false;
+    bool                Inline     = false;
+    bool                Stranded   = false;
+    int32               EntryIndex = 0;
+
+    OS_MutSemTake(DS_AppData.FinalizeMutexId);
+
+    if (!DS_AppData.FinalizeTaskActive)
+    {
+        Inline = true;
+    }
+    else if (Queue->Count < DS_FINALIZE_QUEUE_DEPTH)
+    {
+        EntryIndex = (Queue->Head + Queue->Count) % DS_FINALIZE_QUEUE_DEPTH;
+
+        Queue->Entry[EntryIndex] = *Entry;
+        Queue->Count++;
+
+        if (Queue->Count > DS_AppData.FinalizePeakCount)
+        {
+            DS_AppData.FinalizePeakCount = Queue->Count;
+        }
+
+        DS_FinalizeUpdateCDS(EntryIndex);
+        Queued = true;
+    }
+
+    OS_MutSemGive(DS_AppData.FinalizeMutexId);
+
+    if (Queued)
+    {
+        OS_CountSemGive(DS_AppData.FinalizeSemId);
+    }
+    else if (Inline)
+    {
+        /*
+        ** Finish files stranded by a stopped finalizer task first - with
+        **   the task gone, this is the only consumer of the queue...
+        */
+        do
+        {
+            OS_MutSemTake(DS_AppData.FinalizeMutexId);
+            Stranded = (Queue->Count > 0);
+            OS_MutSemGive(DS_AppData.FinalizeMutexId);
+
+            if (Stranded)
+            {
+                DS_FinalizeProcessNext();
+            }
+        } while (Stranded);
+
+        /*
+        ** Finalizer task is not running - finish the file now...
+        */
+        LocalEntry = *Entry;
+        DS_FileFinalize(&LocalEntry);
+
+        OS_MutSemTake(DS_AppData.FinalizeMutexId);
+        DS_FinalizeDone(LocalEntry.QueueTime);
+        OS_MutSemGive(DS_AppData.FinalizeMutexId);
+    }
+
+    /*
+    ** A full queue is left to the caller, which keeps the file until
+    **   the finalizer has caught up...
+    */
+    return (Queued || Inline);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Finalize the oldest queued file                                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FinalizeProcessNext(void)
+{
+    DS_FinalizeQueue_t *Queue   = &DS_AppData.FinalizeQueue;
+    DS_FinalizeEntry_t  Entry;
+    bool                Pending = false;
+
+    /*
+    ** Oldest entry stays in the queue (and the CDS) until the file is
+    **   finalized - producers only add entries behind it...
+    */
+    OS_MutSemTake(DS_AppData.FinalizeMutexId);
+
+    if (Queue->Count > 0)
+    {
+        Entry   = Queue->Entry[Queue->Head];
+        Pending = true;
+    }
+
+    OS_MutSemGive(DS_AppData.FinalizeMutexId);
+
+    if (Pending)
+    {
+        DS_FileFinalize(&Entry);
+
+        /*
+        ** File is complete - now it can be dropped from the CDS...
+        */
+        OS_MutSemTake(DS_AppData.FinalizeMutexId);
+
+        Queue->Head = (Queue->Head + 1) % DS_FINALIZE_QUEUE_DEPTH;
+        Queue->Count--;
+
+        DS_FinalizeUpdateCDS(DS_INDEX_NONE);
+        DS_FinalizeDone(Entry.QueueTime);
+
+        OS_MutSemGive(DS_AppData.FinalizeMutexId);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Create or restore the file finalizer queue CDS areas            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FinalizeCreateCDS(void)
+{
+    DS_FinalizeQueue_t *  Queue      = &DS_AppData.FinalizeQueue;
+    DS_FinalizeCDSState_t State      = {0};
+    int32                 Result     = CFE_SUCCESS;
+    bool                  Restore    = false;
+    uint32                EntryIndex = 0;
+    uint32                i          = 0;
+    char                  EntryName[CFE_MISSION_ES_CDS_MAX_NAME_LENGTH];
+
+    memset(Queue, 0, sizeof(*Queue));
+
+    /*
+    ** Request for CDS areas from cFE Executive Services - one for the
+    **   queue head and count, then one for each queue entry...
+    */
+    Result = CFE_ES_RegisterCDS(&DS_AppData.FinalizeCDSHandle, sizeof(State), DS_FINALIZE_CDS_NAME);
+
+    if (Result == CFE_ES_CDS_ALREADY_EXISTS)
+    {
+        Restore = true;
+        Result  = CFE_SUCCESS;
+    }
+
+    for (i = 0; (i < DS_FINALIZE_QUEUE_DEPTH) && (Result == CFE_SUCCESS); i++)
+    {
+        snprintf(EntryName, sizeof(EntryName), DS_FINALIZE_ENTRY_CDS_NAME, (unsigned int)i);
+
+        Result = CFE_ES_RegisterCDS(&DS_AppData.FinalizeEntryCDSHandle[i], sizeof(DS_FinalizeEntry_t), EntryName);
+
+        if (Result == CFE_ES_CDS_ALREADY_EXISTS)
+        {
+            Result = CFE_SUCCESS;
+        }
+    }
+
+    if ((Result == CFE_SUCCESS) && !Restore)
+    {
+        /*
+        ** New CDS area - write the empty queue (entries are written as files are queued)...
+        */
+        Result = CFE_ES_CopyToCDS(DS_AppData.FinalizeCDSHandle, &State);
+    }
+    else if (Result == CFE_SUCCESS)
+    {
+        /*
+        ** Pre-existing CDS area - read from Critical Data Store...
+        */
+        Result = CFE_ES_RestoreFromCDS(&State, DS_AppData.FinalizeCDSHandle);
+
+        if ((Result == CFE_SUCCESS) &&
+            ((State.Head >= DS_FINALIZE_QUEUE_DEPTH) || (State.Count > DS_FINALIZE_QUEUE_DEPTH)))
+        {
+            Result = CFE_ES_CDS_BLOCK_CRC_ERR;
+        }
+
+        /*
+        ** Only entries inside the saved queue hold files - file handles did
+        **   not survive, so files are finished by name...
+        */
+        for (i = 0; (i < State.Count) && (Result == CFE_SUCCESS); i++)
+        {
+            EntryIndex = (State.Head + i) % DS_FINALIZE_QUEUE_DEPTH;
+
+            Result = CFE_ES_RestoreFromCDS(&Queue->Entry[EntryIndex], DS_AppData.FinalizeEntryCDSHandle[EntryIndex]);
+
+            Queue->Entry[EntryIndex].FileHandle = OS_OBJECT_ID_UNDEFINED;
+            Queue->Entry[EntryIndex].QueueTime  = DS_AppSchedClock();
+        }
+
+        if ((Result == CFE_SUCCESS) && (State.Count > 0))
+        {
+            Queue->Head  = State.Head;
+            Queue->Count = State.Count;
+
+            CFE_EVS_SendEvent(DS_FINALIZE_RECOVER_EID, CFE_EVS_EventType_INFORMATION,
+                              "Recovered %d unfinished destination files", (int)Queue->Count);
+        }
+    }
+
+    if (Result != CFE_SUCCESS)
+    {
+        /*
+        ** CDS is broken - prevent further errors...
+        */
+        DS_AppData.FinalizeCDSHandle = CFE_ES_CDS_BAD_HANDLE;
+
+        memset(Queue, 0, sizeof(*Queue));
+
+        CFE_EVS_SendEvent(DS_INIT_CDS_ERR_EID, CFE_EVS_EventType_ERROR, "Critical Data Store access error = 0x%08X",
+                          (unsigned int)Result);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Save file finalizer queue changes to the CDS                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FinalizeUpdateCDS(int32 EntryIndex)
+{
+    DS_FinalizeCDSState_t State  = {0};
+    int32                 Result = CFE_SUCCESS;
+
+    /*
+    ** Handle is non-zero when CDS is active...
+    */
+    if (!CFE_RESOURCEID_TEST_EQUAL(DS_AppData.FinalizeCDSHandle, CFE_ES_CDS_BAD_HANDLE))
+    {
+        /*
+        ** A new entry is saved before the count that includes it...
+        */
+        if (EntryIndex != DS_INDEX_NONE)
+        {
+            Result = CFE_ES_CopyToCDS(DS_AppData.FinalizeEntryCDSHandle[EntryIndex],
+                                      &DS_AppData.FinalizeQueue.Entry[EntryIndex]);
+        }
+
+        if (Result == CFE_SUCCESS)
+        {
+            State.Head  = DS_AppData.FinalizeQueue.Head;
+            State.Count = DS_AppData.FinalizeQueue.Count;
+
+            Result = CFE_ES_CopyToCDS(DS_AppData.FinalizeCDSHandle, &State);
+        }
+
+        if (Result != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(DS_INIT_CDS_ERR_EID, CFE_EVS_EventType_ERROR, "Critical Data Store access error = 0x%08X",
+                              (unsigned int)Result);
+            /*
+            ** CDS is broken - prevent further errors...
+            */
+            DS_AppData.FinalizeCDSHandle = CFE_ES_CDS_BAD_HANDLE;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Create or restore the pre-opened filename CDS areas             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FinalizeCreateSpareCDS(void)
+{
+    int32  Result    = CFE_SUCCESS;
+    uint32 FileIndex = 0;
+    char   AreaName[CFE_MISSION_ES_CDS_MAX_NAME_LENGTH];
+    char   SpareName[DS_TOTAL_FNAME_BUFSIZE];
+
+    for (FileIndex = 0; (DS_FILE_PREOPEN_PERCENT > 0) && (FileIndex < DS_DEST_FILE_CNT); FileIndex++)
+    {
+        memset(SpareName, 0, sizeof(SpareName));
+
+        snprintf(AreaName, sizeof(AreaName), DS_FINALIZE_SPARE_CDS_NAME, (unsigned int)FileIndex);
+
+        Result = CFE_ES_RegisterCDS(&DS_AppData.SpareCDSHandle[FileIndex], sizeof(SpareName), AreaName);
+
+        if (Result == CFE_ES_CDS_ALREADY_EXISTS)
+        {
+            /*
+            ** Pre-existing CDS area - a saved name is a file that holds
+            **   only a header and was never used...
+            */
+            Result = CFE_ES_RestoreFromCDS(SpareName, DS_AppData.SpareCDSHandle[FileIndex]);
+
+            if ((Result == CFE_SUCCESS) && (SpareName[0] != 0))
+            {
+                SpareName[sizeof(SpareName) - 1] = 0;
+
+                OS_remove(SpareName);
+
+                CFE_EVS_SendEvent(DS_FINALIZE_SPARE_EID, CFE_EVS_EventType_INFORMATION,
+                                  "Removed unused pre-opened file: dest = %d, name = '%s'", (int)FileIndex, SpareName);
+
+                memset(SpareName, 0, sizeof(SpareName));
+            }
+        }
+
+        if (Result == CFE_SUCCESS)
+        {
+            /*
+            ** No next file is open yet...
+            */
+            Result = CFE_ES_CopyToCDS(DS_AppData.SpareCDSHandle[FileIndex], SpareName);
+        }
+
+        if (Result != CFE_SUCCESS)
+        {
+            /*
+            ** CDS is broken - prevent further errors...
+            */
+            DS_AppData.SpareCDSHandle[FileIndex] = CFE_ES_CDS_BAD_HANDLE;
+
+            CFE_EVS_SendEvent(DS_INIT_CDS_ERR_EID, CFE_EVS_EventType_ERROR, "Critical Data Store access error = 0x%08X",
+                              (unsigned int)Result);
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Save a pre-opened filename to the CDS                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FinalizeUpdateSpareCDS(uint32 FileIndex, const char *SpareName)
+{
+    int32 Result = CFE_SUCCESS;
+
+    /*
+    ** Handle is non-zero when CDS is active...
+    */
+    if (!CFE_RESOURCEID_TEST_EQUAL(DS_AppData.SpareCDSHandle[FileIndex], CFE_ES_CDS_BAD_HANDLE))
+    {
+        Result = CFE_ES_CopyToCDS(DS_AppData.SpareCDSHandle[FileIndex], SpareName);
+
+        if (Result != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(DS_INIT_CDS_ERR_EID, CFE_EVS_EventType_ERROR, "Critical Data Store access error = 0x%08X",
+                              (unsigned int)Result);
+            /*
+            ** CDS is broken - prevent further errors...
+            */
+            DS_AppData.SpareCDSHandle[FileIndex] = CFE_ES_CDS_BAD_HANDLE;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Record file finalize latency                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FinalizeDone(uint32 QueueTime)
+{
+    uint32 FinalizeTime = DS_AppSchedClock() - QueueTime;
+
+    DS_AppData.FinalizeCounter++;
+    DS_AppData.LastFinalizeTime = FinalizeTime;
+
+    if (FinalizeTime > DS_AppData.MaxFinalizeTime)
+    {
+        DS_AppData.MaxFinalizeTime = FinalizeTime;
+    }
+}
@@ -0,0 +1,261 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,917-1, and identified as “CFS Data Storage
+ * (DS) application version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  CFS Data Storage (DS) file finalizer child task header file
+ */
+#ifndef DS_FINALIZE_H
+#define DS_FINALIZE_H
+
+#include "cfe.h"
+
+#include "ds_platform_cfg.h"
+
+#include "ds_msg.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* DS file finalizer queue structures and definitions              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define DS_FINALIZE_SEM_NAME   "DS_FINAL_SEM"
+#define DS_FINALIZE_MUTEX_NAME "DS_FINAL_MUT"
+
+/**
+ * \brief Destination file content summary
+ *
+ * Collected as packets are written and copied to the DS file header
+ * when the file is finalized.
+ */
+typedef struct
+{
+    uint32             PacketCount;                     /**< \brief Number of packets written */
+    CFE_TIME_SysTime_t FirstTime;                       /**< \brief Time of the first packet */
+    CFE_TIME_SysTime_t LastTime;                        /**< \brief Time of the last packet */
+    uint32             DataBytes;                       /**< \brief Stored packet data bytes (set at close) */
+    uint32             IndexOffset;                     /**< \brief File offset of the trailing index (0 = none) */
+    uint16             MidCount;                        /**< \brief Number of message IDs in MidList */
+    uint16             MidOverflow;                     /**< \brief File holds message IDs not in MidList */
+    uint32             MidList[DS_FILE_HEADER_MID_CNT]; /**< \brief Message IDs written */
+    uint32             MidBloom[DS_FILE_BLOOM_BITS / 32]; /**< \brief Bloom filter of all message IDs written */
+} DS_FileSummary_t;
+
+/**
+ * \brief Closed destination file waiting to be finalized
+ *
+ * Everything needed to finish the file is copied out of the destination
+ * file status when the file is closed, so the finalizer never touches
+ * destination state or the Destination File Table.
+ */
+typedef struct
+{
+    osal_id_t          FileHandle;                       /**< \brief Open file handle (undefined after a reset) */
+    CFE_TIME_SysTime_t CloseTime;                        /**< \brief File close time for the file header */
+    uint32             QueueTime;                        /**< \brief Scheduler clock time when the file was queued */
+    char               FileName[DS_TOTAL_FNAME_BUFSIZE]; /**< \brief Working directory filename */
+    char               MoveName[DS_TOTAL_FNAME_BUFSIZE]; /**< \brief Downlink directory filename (empty = no move) */
+    bool               Truncate;                         /**< \brief Trim preallocated file to its written size */
+    bool               Sync;                             /**< \brief Commit file to storage before it is moved */
+    uint16             FileTableIndex;                   /**< \brief Destination file table index for the file header */
+    uint16             FileNameType;                     /**< \brief Filename type for the file header */
+    DS_FileSummary_t   Summary;                          /**< \brief File content summary for the file header */
+    DS_FileInfo_t      FileInfo;                         /**< \brief File completion telemetry */
+} DS_FinalizeEntry_t;
+
+/**
+ * \brief File finalizer queue
+ *
+ * The queue is kept in the Critical Data Store.  An entry is only
+ * removed after the file has been finalized, so files that were waiting
+ * (or being finalized) at a processor reset are finished after restart.
+ * Each entry has its own CDS area, written once when the file is queued;
+ * the head and count are saved separately (see #DS_FinalizeCDSState_t).
+ */
+typedef struct
+{
+    uint32 Head;  /**< \brief Oldest entry (next to be finalized) */
+    uint32 Count; /**< \brief Number of entries waiting */
+
+    DS_FinalizeEntry_t Entry[DS_FINALIZE_QUEUE_DEPTH]; /**< \brief Queue storage */
+} DS_FinalizeQueue_t;
+
+/**
+ * \brief File finalizer queue CDS state
+ *
+ * Removing a finalized file from the queue only writes this small CDS
+ * area.  Queue entries outside of the saved head and count are unused.
+ */
+typedef struct
+{
+    uint32 Head;  /**< \brief Oldest entry (next to be finalized) */
+    uint32 Count; /**< \brief Number of entries waiting */
+} DS_FinalizeCDSState_t;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Prototypes for functions defined in ds_finalize.c               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief File finalizer initialization
+ *
+ *  \par Description
+ *       Restores files left in the queue by a processor reset, then
+ *       creates the queue semaphore, the queue mutex and the file
+ *       finalizer child task.  Restored files are finalized as soon
+ *       as the child task starts.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 DS_FinalizeInit(void);
+
+/**
+ *  \brief File finalizer child task entry point
+ *
+ *  \par Description
+ *       Waits for a closed destination file to be queued, then
+ *       finalizes it.  If the wait fails, the child task exits and
+ *       closed files are finalized by the task that closes them.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ */
+void DS_FinalizeTask(void);
+
+/**
+ *  \brief Queue a closed destination file
+ *
+ *  \par Description
+ *       Adds the file to the queue (and the Critical Data Store) and
+ *       signals the file finalizer child task.  If the child task is not
+ *       running, any files left in the queue and then this file are
+ *       finalized before this function returns.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A full queue is never bypassed - the caller keeps the file and
+ *       tries again later (see #DS_FileRetryFinalize).
+ *
+ *  \param[in] Entry Closed destination file
+ *
+ *  \return File was queued or finalized (false = queue is full)
+ */
+bool DS_FinalizeEnqueue(const DS_FinalizeEntry_t *Entry);
+
+/**
+ *  \brief Finalize the oldest queued file
+ *
+ *  \par Description
+ *       Finalizes the oldest file in the queue, then removes it from
+ *       the queue (and the Critical Data Store).
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must only be called from the file finalizer child task, or
+ *       once the child task has stopped.
+ */
+void DS_FinalizeProcessNext(void);
+
+/**
+ *  \brief Create or restore the file finalizer queue CDS areas
+ *
+ *  \par Description
+ *       Registers the queue head and count and each queue entry with
+ *       the Critical Data Store.  A queue saved before a processor
+ *       reset is restored, with every file marked as having no open
+ *       handle.  CDS errors are reported but are not fatal; the queue
+ *       then only lives in RAM.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ */
+void DS_FinalizeCreateCDS(void);
+
+/**
+ *  \brief Create or restore the pre-opened filename CDS areas
+ *
+ *  \par Description
+ *       Registers one Critical Data Store area for the pre-opened next
+ *       filename of each destination (if pre-open is enabled).  Files
+ *       named in areas saved before a processor reset hold only a
+ *       header and are removed.  CDS errors are reported but are not
+ *       fatal; an unused pre-opened file may then be left behind by a
+ *       processor reset.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \sa #DS_FinalizeUpdateSpareCDS
+ */
+void DS_FinalizeCreateSpareCDS(void);
+
+/**
+ *  \brief Save a pre-opened filename to the CDS
+ *
+ *  \par Description
+ *       Copies the pre-opened next filename for a destination to the
+ *       Critical Data Store, if active.  An empty name means that no
+ *       unused pre-opened file exists.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       SpareName must be a #DS_TOTAL_FNAME_BUFSIZE character buffer.
+ *
+ *  \param[in] FileIndex Destination file table index
+ *  \param[in] SpareName Pre-opened next filename (empty = none)
+ *
+ *  \sa #DS_FileOpenSpare, #DS_FileCloseSpare
+ */
+void DS_FinalizeUpdateSpareCDS(uint32 FileIndex, const char *SpareName);
+
+/**
+ *  \brief Save file finalizer queue changes to the CDS
+ *
+ *  \par Description
+ *       Copies a new queue entry (if any), then the queue head and
+ *       count, to the Critical Data Store, if active.  The entry is
+ *       saved first so that a saved count never covers an entry that
+ *       has not been saved.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Caller must hold the queue mutex.
+ *
+ *  \param[in] EntryIndex Queue entry added, or #DS_INDEX_NONE if an entry was removed
+ */
+void DS_FinalizeUpdateCDS(int32 EntryIndex);
+
+/**
+ *  \brief Record file finalize latency
+ *
+ *  \par Description
+ *       Updates the finalized file counter and the last and longest
+ *       times from close to finalize.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] QueueTime Scheduler clock time when the file was closed
+ */
+void DS_FinalizeDone(uint32 QueueTime);
+
+#endif
@@ -0,0 +1,330 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,917-1, and identified as “CFS Data Storage
+ * (DS) application version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  CFS Data Storage (DS) file system extensions
+ *
+ *  File operations that OSAL does not provide.  These are the only
+ *  functions in DS that call the host operating system directly.
+ */
+
+/*
+** glibc only declares O_DIRECT for GNU sources (must precede all includes).
+**   Other C libraries may not have O_DIRECT at all - see DS_FSEXT_DIRECT_IO...
+*/
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include "cfe.h"
+
+#include "ds_platform_cfg.h"
+#include "ds_verify.h"
+
+#include "ds_fsext.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+/*
+** Preallocation must not change the file length, or a file left open by
+**   a reset (and never trimmed) would end in MaxFileSize of zeros.  It is
+**   only built when the host can reserve storage past the end of file...
+*/
+#if (DS_FILE_PREALLOCATE == true) && defined(FALLOC_FL_KEEP_SIZE)
+#define DS_FSEXT_PREALLOCATE true
+#else
+#define DS_FSEXT_PREALLOCATE false
+#endif
+
+/*
+** Direct I/O is only built when selected and the host has O_DIRECT,
+**   otherwise the direct I/O table setting fails verification...
+*/
+#if (DS_FILE_DIRECT_IO == true) && defined(O_DIRECT)
+#define DS_FSEXT_DIRECT_IO true
+#else
+#define DS_FSEXT_DIRECT_IO false
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Reserve file storage                                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FsExtAllocate(const char *FileName, uint32 Size)
+{
+    int32 Result = OS_ERR_NOT_IMPLEMENTED;
+
+#if (DS_FSEXT_PREALLOCATE == true)
+    char LocalPath[OS_MAX_LOCAL_PATH_LEN];
+    int  FileDesc = -1;
+
+    Result = OS_TranslatePath(FileName, LocalPath);
+
+    if (Result == OS_SUCCESS)
+    {
+        /*
+        ** Storage belongs to the file, so a separate descriptor
+        **   does not disturb the OSAL file position...
+        */
+        FileDesc = open(LocalPath, O_WRONLY);
+
+        if (FileDesc < 0)
+        {
+            Result = OS_ERROR;
+        }
+        else
+        {
+            /*
+            ** Reserved blocks stay past the end of file - the file length
+            **   only grows as data is written...
+            */
+            if (fallocate(FileDesc, FALLOC_FL_KEEP_SIZE, 0, Size) != 0)
+            {
+                Result = OS_ERROR;
+            }
+
+            close(FileDesc);
+        }
+    }
+#endif
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Set file length                                                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FsExtTruncate(const char *FileName, uint32 Size)
+{
+    int32 Result = OS_ERR_NOT_IMPLEMENTED;
+
+#if (DS_FILE_PREALLOCATE == true) || (DS_FILE_DIRECT_IO == true)
+    char LocalPath[OS_MAX_LOCAL_PATH_LEN];
+
+    Result = OS_TranslatePath(FileName, LocalPath);
+
+    if (Result == OS_SUCCESS)
+    {
+        if (truncate(LocalPath, Size) != 0)
+        {
+            Result = OS_ERROR;
+        }
+    }
+#endif
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Commit file data to storage                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FsExtSync(const char *FileName)
+{
+    int32 Result = OS_ERR_NOT_IMPLEMENTED;
+
+#if (DS_FILE_SYNC == true)
+    char LocalPath[OS_MAX_LOCAL_PATH_LEN];
+    int  FileDesc = -1;
+
+    Result = OS_TranslatePath(FileName, LocalPath);
+
+    if (Result == OS_SUCCESS)
+    {
+        /*
+        ** Cached data belongs to the file, so any descriptor
+        **   will commit data written through the OSAL handle...
+        */
+        FileDesc = open(LocalPath, O_WRONLY);
+
+        if (FileDesc < 0)
+        {
+            Result = OS_ERROR;
+        }
+        else
+        {
+            if (fsync(FileDesc) != 0)
+            {
+                Result = OS_ERROR;
+            }
+
+            close(FileDesc);
+        }
+    }
+#endif
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Open file for direct I/O                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FsExtOpenDirect(const char *FileName, int32 *FileDesc)
+{
+    int32 Result = OS_ERR_NOT_IMPLEMENTED;
+
+    *FileDesc = -1;
+
+#if (DS_FSEXT_DIRECT_IO == true)
+    char LocalPath[OS_MAX_LOCAL_PATH_LEN];
+
+    Result = OS_TranslatePath(FileName, LocalPath);
+
+    if (Result == OS_SUCCESS)
+    {
+        /*
+        ** A second descriptor - the OSAL handle still owns the file.
+        **
+        ** Mixing this descriptor with the OSAL handle is coherent because:
+        **   - The OSAL handle is a plain host descriptor with no user
+        **     space buffer, so buffered data is in the page cache as soon
+        **     as the OSAL write returns.
+        **   - Before each O_DIRECT write the kernel writes back and then
+        **     invalidates any cached pages in the written range, so stale
+        **     cached data can neither overwrite nor shadow the new blocks.
+        **   - DS never writes both paths at once (one writer task), and
+        **     buffered writes before the first aligned block never touch
+        **     a direct block.  The later buffered writes into direct
+        **     blocks (index, header at finalize) re-read them from disk...
+        */
+        *FileDesc = open(LocalPath, O_WRONLY | O_DIRECT);
+
+        if (*FileDesc < 0)
+        {
+            Result = OS_ERROR;
+        }
+    }
+#endif
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write aligned blocks with direct I/O                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FsExtWriteDirect(int32 FileDesc, const void *Buffer, uint32 Length, uint32 Offset)
+{
+    int32 Result = OS_ERR_NOT_IMPLEMENTED;
+
+#if (DS_FSEXT_DIRECT_IO == true)
+    /*
+    ** Positional write - the descriptor has no file position to manage...
+    */
+    Result = pwrite(FileDesc, Buffer, Length, Offset);
+
+    if (Result < 0)
+    {
+        Result = OS_ERROR;
+    }
+#endif
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Close direct I/O file                                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FsExtCloseDirect(int32 FileDesc)
+{
+#if (DS_FSEXT_DIRECT_IO == true)
+    close(FileDesc);
+#endif
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Report direct I/O support                                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_FsExtDirectAvailable(void)
+{
+    return DS_FSEXT_DIRECT_IO;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Report preallocation support                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_FsExtAllocateAvailable(void)
+{
+    return DS_FSEXT_PREALLOCATE;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write data at a file offset                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FsExtWriteAt(const char *FileName, uint32 Offset, const void *Data, uint32 Length)
+{
+    int32 Result = OS_ERR_NOT_IMPLEMENTED;
+
+#if (DS_FILE_POSITIONAL_WRITE == true)
+    char LocalPath[OS_MAX_LOCAL_PATH_LEN];
+    int  FileDesc = -1;
+
+    Result = OS_TranslatePath(FileName, LocalPath);
+
+    if (Result == OS_SUCCESS)
+    {
+        /*
+        ** One positional write - no seek is needed to reach the offset...
+        */
+        FileDesc = open(LocalPath, O_WRONLY);
+
+        if (FileDesc < 0)
+        {
+            Result = OS_ERROR;
+        }
+        else
+        {
+            if (pwrite(FileDesc, Data, Length, Offset) != (long)Length)
+            {
+                Result = OS_ERROR;
+            }
+
+            close(FileDesc);
+        }
+    }
+#endif
+
+    return Result;
+}
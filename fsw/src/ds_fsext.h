@@ -0,0 +1,216 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,917-1, and identified as “CFS Data Storage
+ * (DS) application version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  CFS Data Storage (DS) file system extensions header file
+ */
+#ifndef DS_FSEXT_H
+#define DS_FSEXT_H
+
+#include "cfe.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Prototypes for functions defined in ds_fsext.c                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Reserve file storage
+ *
+ *  \par Description
+ *       Reserves storage for the first Size bytes of the named file,
+ *       so later writes within that range do not have to allocate
+ *       blocks.  The file length does not change.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       OSAL has no equivalent call - the OSAL virtual path is
+ *       translated to the host path and Linux fallocate() with
+ *       FALLOC_FL_KEEP_SIZE is used.  Returns #OS_ERR_NOT_IMPLEMENTED
+ *       unless #DS_FsExtAllocateAvailable is true.
+ *
+ *  \param[in] FileName OSAL path of an existing file
+ *  \param[in] Size     Number of bytes to reserve
+ *
+ *  \return Execution status, see \ref OSReturnCodes
+ *  \retval #OS_SUCCESS \copybrief OS_SUCCESS
+ */
+int32 DS_FsExtAllocate(const char *FileName, uint32 Size);
+
+/**
+ *  \brief Set file length
+ *
+ *  \par Description
+ *       Sets the length of the named file to Size bytes, releasing
+ *       any reserved storage beyond that length.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       OSAL has no equivalent call - the OSAL virtual path is
+ *       translated to the host path and POSIX truncate() is used.
+ *       Returns #OS_ERR_NOT_IMPLEMENTED when both #DS_FILE_PREALLOCATE
+ *       and #DS_FILE_DIRECT_IO are false.
+ *
+ *  \param[in] FileName OSAL path of an existing file
+ *  \param[in] Size     New file length in bytes
+ *
+ *  \return Execution status, see \ref OSReturnCodes
+ *  \retval #OS_SUCCESS \copybrief OS_SUCCESS
+ */
+int32 DS_FsExtTruncate(const char *FileName, uint32 Size);
+
+/**
+ *  \brief Commit file data to storage
+ *
+ *  \par Description
+ *       Waits until all data written to the named file (and the file
+ *       length) has reached the storage device.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       OSAL has no equivalent call - the OSAL virtual path is
+ *       translated to the host path and POSIX fsync() is used.
+ *       Returns #OS_ERR_NOT_IMPLEMENTED when #DS_FILE_SYNC is false.
+ *
+ *  \param[in] FileName OSAL path of an existing file
+ *
+ *  \return Execution status, see \ref OSReturnCodes
+ *  \retval #OS_SUCCESS \copybrief OS_SUCCESS
+ */
+int32 DS_FsExtSync(const char *FileName);
+
+/**
+ *  \brief Open file for direct I/O
+ *
+ *  \par Description
+ *       Opens a second, write only descriptor for the named file that
+ *       bypasses the page cache.  Writes through the descriptor must
+ *       use #DS_DIRECT_IO_BLOCK_SIZE aligned offsets, lengths and
+ *       buffer addresses.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       OSAL has no equivalent call - the OSAL virtual path is
+ *       translated to the host path and POSIX open() with O_DIRECT
+ *       is used.  Returns #OS_ERR_NOT_IMPLEMENTED unless
+ *       #DS_FsExtDirectAvailable is true.
+ *
+ *  \param[in]  FileName OSAL path of an existing file
+ *  \param[out] FileDesc Host file descriptor (-1 on error)
+ *
+ *  \return Execution status, see \ref OSReturnCodes
+ *  \retval #OS_SUCCESS \copybrief OS_SUCCESS
+ */
+int32 DS_FsExtOpenDirect(const char *FileName, int32 *FileDesc);
+
+/**
+ *  \brief Write aligned blocks with direct I/O
+ *
+ *  \par Description
+ *       Writes Length bytes from Buffer at file offset Offset, without
+ *       changing any file position.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Buffer, Length and Offset are #DS_DIRECT_IO_BLOCK_SIZE aligned.
+ *       Returns #OS_ERR_NOT_IMPLEMENTED unless #DS_FsExtDirectAvailable
+ *       is true.
+ *
+ *  \param[in] FileDesc Descriptor from #DS_FsExtOpenDirect
+ *  \param[in] Buffer   Data to write
+ *  \param[in] Length   Number of bytes to write
+ *  \param[in] Offset   File offset of the first byte
+ *
+ *  \return Number of bytes written, or error status (see \ref OSReturnCodes)
+ */
+int32 DS_FsExtWriteDirect(int32 FileDesc, const void *Buffer, uint32 Length, uint32 Offset);
+
+/**
+ *  \brief Close direct I/O file
+ *
+ *  \par Description
+ *       Closes a descriptor from #DS_FsExtOpenDirect.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] FileDesc Descriptor from #DS_FsExtOpenDirect
+ */
+void DS_FsExtCloseDirect(int32 FileDesc);
+
+/**
+ *  \brief Report direct I/O support
+ *
+ *  \par Description
+ *       Reports whether #DS_FsExtOpenDirect can open files for direct
+ *       I/O on this platform.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       True only when #DS_FILE_DIRECT_IO is set and the host C library
+ *       declares O_DIRECT (Linux).  Destination file table entries that
+ *       select direct I/O fail verification otherwise.
+ *
+ *  \return Direct I/O support
+ *  \retval true  Direct I/O is available
+ *  \retval false Direct I/O is not available
+ */
+bool DS_FsExtDirectAvailable(void);
+
+/**
+ *  \brief Report preallocation support
+ *
+ *  \par Description
+ *       Reports whether #DS_FsExtAllocate can reserve file storage on
+ *       this platform.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       True only when #DS_FILE_PREALLOCATE is set and the host C
+ *       library declares FALLOC_FL_KEEP_SIZE (Linux).  Destination file
+ *       table entries that select preallocation fail verification
+ *       otherwise.
+ *
+ *  \return Preallocation support
+ *  \retval true  Preallocation is available
+ *  \retval false Preallocation is not available
+ */
+bool DS_FsExtAllocateAvailable(void);
+
+/**
+ *  \brief Write data at a file offset
+ *
+ *  \par Description
+ *       Writes Length bytes from Data to the named file, starting at
+ *       file offset Offset.  Used to patch data already in the file
+ *       with a single open, write and close.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       OSAL has no equivalent call - the OSAL virtual path is
+ *       translated to the host path and POSIX pwrite() is used.
+ *       Returns #OS_ERR_NOT_IMPLEMENTED unless #DS_FILE_POSITIONAL_WRITE
+ *       is set, in which case the caller must fall back to OSAL.
+ *
+ *  \param[in] FileName OSAL path of an existing file
+ *  \param[in] Offset   File offset of the first byte
+ *  \param[in] Data     Data to write
+ *  \param[in] Length   Number of bytes to write
+ *
+ *  \return Execution status, see \ref OSReturnCodes
+ *  \retval #OS_SUCCESS \copybrief OS_SUCCESS
+ *  \retval #OS_ERR_NOT_IMPLEMENTED \copybrief OS_ERR_NOT_IMPLEMENTED
+ */
+int32 DS_FsExtWriteAt(const char *FileName, uint32 Offset, const void *Data, uint32 Length);
+
+#endif
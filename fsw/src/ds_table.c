@@ -35,6 +35,8 @@
 #include "ds_table.h"
 #include "ds_msg.h"
 #include "ds_events.h"
+#include "ds_file.h"
+#include "ds_fsext.h"
 
 #define DS_CDS_NAME "DS_CDS"
 
@@ -212,12 +214,14 @@ void DS_TableManageDestFile(void)
             {
                 DS_AppData.FileStatus[i].FileState = DS_AppData.DestFileTblPtr->File[i].EnableState;
                 DS_AppData.FileStatus[i].FileCount = DS_AppData.DestFileTblPtr->File[i].SequenceCount;
+
+                /*
+                ** Store local values in the Critical Data Store (CDS)...
+                */
+                DS_TableMarkCDS(i);
             }
 
-            /*
-            ** Store local values in the Critical Data Store (CDS)...
-            */
-            DS_TableUpdateCDS();
+            DS_TableCommitCDS();
         }
         else if (Result == CFE_TBL_ERR_NEVER_LOADED)
         {
@@ -260,6 +264,14 @@ void DS_TableManageDestFile(void)
             */
             DS_AppData.DestTblLoadCounter++;
 
+            /*
+            ** Next files opened ahead of time may not match the new table...
+            */
+            for (i = 0; i < DS_DEST_FILE_CNT; i++)
+            {
+                DS_FileCloseSpare(i);
+            }
+
             /*
             ** Allow cFE to update the table data...
             */
@@ -273,12 +285,14 @@ void DS_TableManageDestFile(void)
             {
                 DS_AppData.FileStatus[i].FileState = DS_AppData.DestFileTblPtr->File[i].EnableState;
                 DS_AppData.FileStatus[i].FileCount = DS_AppData.DestFileTblPtr->File[i].SequenceCount;
+
+                /*
+                ** Store local values in the Critical Data Store (CDS)...
+                */
+                DS_TableMarkCDS(i);
             }
 
-            /*
-            ** Store local values in the Critical Data Store (CDS)...
-            */
-            DS_TableUpdateCDS();
+            DS_TableCommitCDS();
         }
     }
 }
@@ -318,7 +332,7 @@ void DS_TableManageFilter(void)
             DS_TableSubscribe();
 
             /*
-            ** Create hash table for messageID's in new filter table...
+            ** Create hash table, free list and routing plan for new filter table...
             */
             DS_TableCreateHash();
         }
@@ -363,24 +377,21 @@ void DS_TableManageFilter(void)
             */
             DS_AppData.FilterTblLoadCounter++;
 
-            /*
-            ** Un-subscribe to the packets in the old filter table...
-            */
-            DS_TableUnsubscribe();
-
             /*
             ** Allow cFE to update the filter table data...
             */
             CFE_TBL_ReleaseAddress(DS_AppData.FilterTblHandle);
             CFE_TBL_Update(DS_AppData.FilterTblHandle);
             CFE_TBL_GetAddress((void *)&DS_AppData.FilterTblPtr, DS_AppData.FilterTblHandle);
+
             /*
-            ** Subscribe to the packets in the new filter table...
+            ** Change subscriptions only for packets added or removed by the
+            ** new filter table (hash table still describes the old table)...
             */
-            DS_TableSubscribe();
+            DS_TableResubscribe();
 
             /*
-            ** Create hash table for messageID's in new filter table...
+            ** Create hash table, free list and routing plan for new filter table...
             */
             DS_TableCreateHash();
         }
@@ -454,6 +465,12 @@ bool DS_TableVerifyDestFileEntry(DS_DestFileEntry_t *DestFileEntry, uint8 TableI
     **  MaxFileSize   = cannot be less than DS_FILE_MIN_SIZE_LIMIT
     **  MaxFileAge    = cannot be less than DS_FILE_MIN_AGE_LIMIT
     **  SequenceCount = may be zero, cannot exceed DS_MAX_SEQUENCE_COUNT
+    **  BufferSize    = may be zero, cannot exceed DS_WRITE_BUFFER_MAX_SIZE
+    **  Preallocate   = DS_DISABLED, or DS_ENABLED if preallocation available
+    **  SyncPolicy    = DS_SYNC_NONE, or any policy if DS_FILE_SYNC
+    **  SyncInterval  = cannot be zero for DS_SYNC_BY_BYTES or DS_SYNC_BY_TIME
+    **  DirectIO      = DS_DISABLED, or DS_ENABLED if direct I/O available (with
+    **                  a write buffer that is a multiple of DS_DIRECT_IO_BLOCK_SIZE)
     */
     if (DS_TableVerifyType(DestFileEntry->FileNameType) == false)
     {
@@ -500,6 +517,91 @@ bool DS_TableVerifyDestFileEntry(DS_DestFileEntry_t *DestFileEntry, uint8 TableI
         }
         Result = false;
     }
+    else if (DS_TableVerifyBufferSize(DestFileEntry->BufferSize) == false)
+    {
+        if (ErrorCount == 0)
+        {
+            CFE_EVS_SendEvent(DS_FIL_TBL_ERR_EID, CFE_EVS_EventType_ERROR, "%s index = %d, buffer size = %d",
+                              CommonErrorText, (int)TableIndex, (int)DestFileEntry->BufferSize);
+        }
+        Result = false;
+    }
+    else if (DS_TableVerifyPreallocate(DestFileEntry->Preallocate) == false)
+    {
+        if (ErrorCount == 0)
+        {
+            CFE_EVS_SendEvent(DS_FIL_TBL_ERR_EID, CFE_EVS_EventType_ERROR, "%s index = %d, preallocate = %d",
+                              CommonErrorText, (int)TableIndex, (int)DestFileEntry->Preallocate);
+        }
+        Result = false;
+    }
+    else if (DS_TableVerifySync(DestFileEntry->SyncPolicy, DestFileEntry->SyncInterval) == false)
+    {
+        if (ErrorCount == 0)
+        {
+            CFE_EVS_SendEvent(DS_FIL_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s index = %d, sync policy = %d, sync interval = %d", CommonErrorText, (int)TableIndex,
+                              (int)DestFileEntry->SyncPolicy, (int)DestFileEntry->SyncInterval);
+        }
+        Result = false;
+    }
+    else if (DS_TableVerifyDirectIO(DestFileEntry->DirectIO, DestFileEntry->BufferSize) == false)
+    {
+        if (ErrorCount == 0)
+        {
+            CFE_EVS_SendEvent(DS_FIL_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s index = %d, direct I/O = %d, buffer size = %d", CommonErrorText, (int)TableIndex,
+                              (int)DestFileEntry->DirectIO, (int)DestFileEntry->BufferSize);
+        }
+        Result = false;
+    }
+    else if (DS_TableVerifyIndex(DestFileEntry->IndexBytes, DestFileEntry->IndexSeconds) == false)
+    {
+        if (ErrorCount == 0)
+        {
+            CFE_EVS_SendEvent(DS_FIL_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s index = %d, index bytes = %d, index seconds = %d", CommonErrorText, (int)TableIndex,
+                              (int)DestFileEntry->IndexBytes, (int)DestFileEntry->IndexSeconds);
+        }
+        Result = false;
+    }
+    else if (DS_TableVerifyCodec(DestFileEntry->Codec, DestFileEntry->BufferSize, DestFileEntry->DirectIO,
+                                 ((DestFileEntry->IndexBytes != 0) || (DestFileEntry->IndexSeconds != 0))) == false)
+    {
+        if (ErrorCount == 0)
+        {
+            CFE_EVS_SendEvent(DS_FIL_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s index = %d, codec = %d, buffer size = %d, direct I/O = %d", CommonErrorText,
+                              (int)TableIndex, (int)DestFileEntry->Codec, (int)DestFileEntry->BufferSize,
+                              (int)DestFileEntry->DirectIO);
+        }
+        Result = false;
+    }
+    else if (DS_TableVerifyDelta(DestFileEntry->DeltaKeyframe,
+                                 ((DestFileEntry->IndexBytes != 0) || (DestFileEntry->IndexSeconds != 0))) == false)
+    {
+        if (ErrorCount == 0)
+        {
+            CFE_EVS_SendEvent(DS_FIL_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s index = %d, delta keyframe = %d, index bytes = %d, index seconds = %d",
+                              CommonErrorText, (int)TableIndex, (int)DestFileEntry->DeltaKeyframe,
+                              (int)DestFileEntry->IndexBytes, (int)DestFileEntry->IndexSeconds);
+        }
+        Result = false;
+    }
+    else if (DS_TableVerifySuperframe(DestFileEntry->SuperframeSize, DestFileEntry->DeltaKeyframe,
+                                      ((DestFileEntry->IndexBytes != 0) || (DestFileEntry->IndexSeconds != 0))) ==
+             false)
+    {
+        if (ErrorCount == 0)
+        {
+            CFE_EVS_SendEvent(DS_FIL_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s index = %d, superframe size = %d, delta keyframe = %d, index bytes = %d",
+                              CommonErrorText, (int)TableIndex, (int)DestFileEntry->SuperframeSize,
+                              (int)DestFileEntry->DeltaKeyframe, (int)DestFileEntry->IndexBytes);
+        }
+        Result = false;
+    }
 
     return Result;
 }
@@ -565,10 +667,13 @@ int32 DS_TableVerifyFilter(const void *TableData)
 
 bool DS_TableVerifyFilterEntry(DS_PacketEntry_t *PacketEntry, int32 TableIndex, int32 ErrorCount)
 {
-    const char *      CommonErrorText = "Filter table verify err:";
-    DS_FilterParms_t *FilterParms;
-    bool              Result = true;
-    int32             i      = 0;
+    const char *          CommonErrorText = "Filter table verify err:";
+    DS_FilterParms_t *    FilterParms;
+    DS_FilterPredicate_t *Predicate;
+    bool                  Result         = true;
+    bool                  UsesPredicates = false;
+    int32                 PredicateCount = 0;
+    int32                 i              = 0;
 
     /*
     ** Each packet filter table entry has multiple filters per packet
@@ -576,13 +681,30 @@ bool DS_TableVerifyFilterEntry(DS_PacketEntry_t *PacketEntry, int32 TableIndex,
     ** Perform the following validation (per filter):
     **
     **   FileTableIndex = must be less than DS_DEST_FILE_CNT
-    **   FilterType = must be DS_BY_COUNT or DS_BY_TIME
+    **   FilterType = must be DS_BY_COUNT, DS_BY_TIME, DS_BY_CONTENT,
+    **                DS_BY_PKT_RATE or DS_BY_BYTE_RATE
     **
     **   Algorithm_N = cannot exceed Algorithm_X, zero means filter ALL
     **   Algorithm_X = unlimited
-    **   Algorithm_O = must be less than Algorithm_X
+    **   Algorithm_O = must be less than Algorithm_X (byte rate filters:
+    **                 byte scale, cannot exceed DS_RATE_BYTE_SCALE_MAX)
+    **
+    **   Rate filters refill at Algorithm_N per second, so the burst
+    **   (Algorithm_X) always holds at least one second of traffic
+    **
+    **   Byte rate burst (Algorithm_X scaled) = cannot be less than
+    **   MinLength, or no packet would ever fit in the bucket
     **
     **   Note: unused filters (all zero's) are valid
+    **
+    ** Each packet filter table entry also has multiple predicates
+    **
+    **   Offset = must be less than MinLength (the entry's shortest packet)
+    **   Compare = must be DS_PREDICATE_EQUAL or DS_PREDICATE_NOT_EQUAL
+    **   Value = cannot have bits outside Mask
+    **
+    **   Note: unused predicates (all zero's) are valid, but a
+    **         DS_BY_PREDICATE filter needs at least one predicate
     */
     for (i = 0; (i < DS_FILTERS_PER_PACKET) && (Result == true); i++)
     {
@@ -604,7 +726,7 @@ bool DS_TableVerifyFilterEntry(DS_PacketEntry_t *PacketEntry, int32 TableIndex,
                 }
                 Result = false;
             }
-            else if (DS_TableVerifyType((uint16)FilterParms->FilterType) == false)
+            else if (DS_TableVerifyFilterType((uint16)FilterParms->FilterType) == false)
             {
                 if (ErrorCount == 0)
                 {
@@ -615,7 +737,7 @@ bool DS_TableVerifyFilterEntry(DS_PacketEntry_t *PacketEntry, int32 TableIndex,
                 }
                 Result = false;
             }
-            else if (DS_TableVerifyParms(FilterParms->Algorithm_N, FilterParms->Algorithm_X,
+            else if (DS_TableVerifyParms(FilterParms->FilterType, FilterParms->Algorithm_N, FilterParms->Algorithm_X,
                                          FilterParms->Algorithm_O) == false)
             {
                 if (ErrorCount == 0)
@@ -628,7 +750,59 @@ bool DS_TableVerifyFilterEntry(DS_PacketEntry_t *PacketEntry, int32 TableIndex,
                 }
                 Result = false;
             }
+            else if (DS_TableVerifyBurst(FilterParms->FilterType, FilterParms->Algorithm_X, FilterParms->Algorithm_O,
+                                         PacketEntry->MinLength) == false)
+            {
+                if (ErrorCount == 0)
+                {
+                    CFE_EVS_SendEvent(DS_FLT_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "%s MID = 0x%08lX, index = %d, filter = %d, byte rate burst = %lu, min length = %d",
+                                      CommonErrorText, (unsigned long)CFE_SB_MsgIdToValue(PacketEntry->MessageID),
+                                      (int)TableIndex, (int)i,
+                                      (unsigned long)((uint32)FilterParms->Algorithm_X << FilterParms->Algorithm_O),
+                                      PacketEntry->MinLength);
+                }
+                Result = false;
+            }
+            else if (FilterParms->FilterType == DS_BY_PREDICATE)
+            {
+                UsesPredicates = true;
+            }
+        }
+    }
+
+    for (i = 0; (i < DS_PREDICATES_PER_PACKET) && (Result == true); i++)
+    {
+        Predicate = &PacketEntry->Predicate[i];
+
+        if (DS_TableVerifyPredicate(Predicate, PacketEntry->MinLength) == false)
+        {
+            if (ErrorCount == 0)
+            {
+                CFE_EVS_SendEvent(DS_FLT_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "%s MID = 0x%08lX, index = %d, predicate = %d, offset = %d, compare = %d, "
+                                  "mask = 0x%02X, value = 0x%02X, min length = %d",
+                                  CommonErrorText, (unsigned long)CFE_SB_MsgIdToValue(PacketEntry->MessageID),
+                                  (int)TableIndex, (int)i, Predicate->Offset, Predicate->Compare, Predicate->Mask,
+                                  Predicate->Value, PacketEntry->MinLength);
+            }
+            Result = false;
+        }
+        else if (Predicate->Compare != DS_UNUSED)
+        {
+            PredicateCount++;
+        }
+    }
+
+    if ((Result == true) && (UsesPredicates == true) && (PredicateCount == 0))
+    {
+        if (ErrorCount == 0)
+        {
+            CFE_EVS_SendEvent(DS_FLT_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s MID = 0x%08lX, index = %d, predicate filter has no predicates", CommonErrorText,
+                              (unsigned long)CFE_SB_MsgIdToValue(PacketEntry->MessageID), (int)TableIndex);
         }
+        Result = false;
     }
 
     return Result;
@@ -676,13 +850,34 @@ bool DS_TableVerifyFileIndex(uint16 FileTableIndex)
     return Result;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify byte rate filter burst                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyBurst(uint16 FilterType, uint16 Algorithm_X, uint16 Algorithm_O, uint16 MinLength)
+{
+    bool Result = true;
+
+    if (FilterType == DS_BY_BYTE_RATE)
+    {
+        /*
+        ** Packets larger than the burst never fit in the bucket...
+        */
+        Result = (((uint32)Algorithm_X << Algorithm_O) >= MinLength);
+    }
+
+    return Result;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Verify algorithm parameters                                     */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-bool DS_TableVerifyParms(uint16 Algorithm_N, uint16 Algorithm_X, uint16 Algorithm_O)
+bool DS_TableVerifyParms(uint16 FilterType, uint16 Algorithm_N, uint16 Algorithm_X, uint16 Algorithm_O)
 {
     bool Result = true;
 
@@ -698,6 +893,13 @@ bool DS_TableVerifyParms(uint16 Algorithm_N, uint16 Algorithm_X, uint16 Algorith
             */
             Result = false;
         }
+        else if (FilterType == DS_BY_BYTE_RATE)
+        {
+            /*
+            ** Byte rates count in units of 2^Algorithm_O bytes...
+            */
+            Result = (Algorithm_O <= DS_RATE_BYTE_SCALE_MAX);
+        }
         else if (Algorithm_O >= Algorithm_X)
         {
             /*
@@ -728,6 +930,60 @@ bool DS_TableVerifyType(uint16 TimeVsCount)
     return Result;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify filter type                                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyFilterType(uint16 FilterType)
+{
+    bool Result = true;
+
+    if ((DS_TableVerifyType(FilterType) == false) && (FilterType != DS_BY_CONTENT) &&
+        (FilterType != DS_BY_PKT_RATE) && (FilterType != DS_BY_BYTE_RATE) && (FilterType != DS_BY_PREDICATE))
+    {
+        Result = false;
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify filter predicate                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyPredicate(const DS_FilterPredicate_t *Predicate, uint16 MinLength)
+{
+    bool Result = true;
+
+    /*
+    ** Unused predicates (all zero's) are valid
+    */
+    if (DS_TableEntryUnused(Predicate, sizeof(DS_FilterPredicate_t)) == false)
+    {
+        if ((Predicate->Compare != DS_PREDICATE_EQUAL) && (Predicate->Compare != DS_PREDICATE_NOT_EQUAL))
+        {
+            Result = false;
+        }
+        else if (Predicate->Offset >= MinLength)
+        {
+            /*
+            ** Evaluator reads the byte at Offset from packets of at least MinLength
+            */
+            Result = false;
+        }
+        else if ((Predicate->Value & ~Predicate->Mask) != 0)
+        {
+            Result = false;
+        }
+    }
+
+    return Result;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Verify file ena/dis state                                       */
@@ -800,6 +1056,185 @@ bool DS_TableVerifyCount(uint32 SequenceCount)
     return Result;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify write buffer size                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyBufferSize(uint32 BufferSize)
+{
+    bool Result = true;
+
+    if (BufferSize > DS_WRITE_BUFFER_MAX_SIZE)
+    {
+        Result = false;
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify preallocation selection                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyPreallocate(uint16 Preallocate)
+{
+    bool Result = true;
+
+    if (Preallocate == DS_ENABLED)
+    {
+        /*
+        ** Only valid if the platform can reserve file storage...
+        */
+        Result = DS_FsExtAllocateAvailable();
+    }
+    else if (Preallocate != DS_DISABLED)
+    {
+        Result = false;
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify sync policy                                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifySync(uint16 SyncPolicy, uint32 SyncInterval)
+{
+    bool Result = true;
+
+    if ((SyncPolicy == DS_SYNC_BY_BYTES) || (SyncPolicy == DS_SYNC_BY_TIME))
+    {
+        /*
+        ** Periodic policies need a period...
+        */
+        Result = ((DS_FILE_SYNC == true) && (SyncInterval != 0));
+    }
+    else if (SyncPolicy == DS_SYNC_ON_CLOSE)
+    {
+        /*
+        ** Only valid if the platform can sync files...
+        */
+        Result = (DS_FILE_SYNC == true);
+    }
+    else if (SyncPolicy != DS_SYNC_NONE)
+    {
+        Result = false;
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify direct I/O selection                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyDirectIO(uint16 DirectIO, uint32 BufferSize)
+{
+    bool Result = true;
+
+    if (DirectIO == DS_ENABLED)
+    {
+        /*
+        ** Only valid if the platform supports direct I/O and the
+        **   write buffer holds whole blocks...
+        */
+        Result = (DS_FsExtDirectAvailable() && (BufferSize != 0) && ((BufferSize % DS_DIRECT_IO_BLOCK_SIZE) == 0));
+    }
+    else if (DirectIO != DS_DISABLED)
+    {
+        Result = false;
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify file index spacing                                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyIndex(uint32 IndexBytes, uint16 IndexSeconds)
+{
+    bool Result = true;
+
+    if ((IndexBytes != 0) || (IndexSeconds != 0))
+    {
+        /*
+        ** Index can only be found through the DS file header...
+        */
+        Result = (DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE);
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify file compression selection                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyCodec(uint16 Codec, uint32 BufferSize, uint16 DirectIO, bool Indexed)
+{
+    bool Result = true;
+
+    if (Codec != DS_CODEC_NONE)
+    {
+        /*
+        ** Blocks are compressed from the write buffer and replace the
+        **   packet bytes the direct I/O and index offsets refer to...
+        */
+        Result = ((DS_FILE_COMPRESSION == true) && (Codec < DS_CODEC_COUNT) && (BufferSize != 0) &&
+                  (DirectIO == DS_DISABLED) && (Indexed == false));
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify delta record selection                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyDelta(uint16 DeltaKeyframe, bool Indexed)
+{
+    return ((DeltaKeyframe == 0) || (Indexed == false));
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify superframe selection                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifySuperframe(uint16 SuperframeSize, uint16 DeltaKeyframe, bool Indexed)
+{
+    bool Result = true;
+
+    if (SuperframeSize != 0)
+    {
+        /*
+        ** Packets are repacked, so index offsets and delta records
+        **   cannot refer to them...
+        */
+        Result = ((SuperframeSize >= DS_SUPERFRAME_MIN_SIZE) && (SuperframeSize <= DS_SUPERFRAME_MAX_SIZE) &&
+                  (DeltaKeyframe == 0) && (Indexed == false));
+    }
+
+    return Result;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Process new filter table                                        */
@@ -864,6 +1299,70 @@ void DS_TableUnsubscribe(void)
     }
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Subscribe/unsubscribe to filter table differences               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_TableResubscribe(void)
+{
+    DS_PacketEntry_t *FilterPackets = NULL;
+    DS_HashSlot_t *   HashSlot      = NULL;
+    CFE_SB_MsgId_t    MessageID;
+    int32             HashIndex;
+    int32             i;
+
+    FilterPackets = DS_AppData.FilterTblPtr->Packet;
+
+    /*
+    ** Check each entry in "new" packet filter table against the "old" hash table...
+    */
+    for (i = 0; i < DS_PACKETS_IN_FILTER_TABLE; i++)
+    {
+        MessageID = FilterPackets[i].MessageID;
+
+        /*
+        ** Already subscribe to DS command packets...
+        */
+        if (CFE_SB_IsValidMsgId(MessageID) && (CFE_SB_MsgIdToValue(MessageID) != DS_CMD_MID) &&
+            (CFE_SB_MsgIdToValue(MessageID) != DS_SEND_HK_MID))
+        {
+            HashIndex = DS_TableFindSlot(MessageID);
+
+            if (HashIndex == DS_INDEX_NONE)
+            {
+                /*
+                ** Packet was not in the old table...
+                */
+                CFE_SB_SubscribeEx(MessageID, DS_AppData.InputPipe, CFE_SB_DEFAULT_QOS, DS_PER_PACKET_PIPE_LIMIT);
+            }
+            else
+            {
+                /*
+                ** Packet is in both tables - subscription is kept...
+                */
+                DS_AppData.HashTable[HashIndex].Retained = true;
+            }
+        }
+    }
+
+    /*
+    ** Check each entry in "old" hash table for packets not in the "new" table...
+    */
+    for (HashIndex = 0; HashIndex < DS_HASH_TABLE_ENTRIES; HashIndex++)
+    {
+        HashSlot = &DS_AppData.HashTable[HashIndex];
+
+        if ((HashSlot->Index != DS_HASH_SLOT_EMPTY) && (HashSlot->Retained == false) &&
+            (CFE_SB_MsgIdToValue(HashSlot->MessageID) != DS_CMD_MID) &&
+            (CFE_SB_MsgIdToValue(HashSlot->MessageID) != DS_SEND_HK_MID))
+        {
+            CFE_SB_Unsubscribe(HashSlot->MessageID, DS_AppData.InputPipe);
+        }
+    }
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Create DS storage area in CDS                                   */
@@ -873,14 +1372,14 @@ void DS_TableUnsubscribe(void)
 int32 DS_TableCreateCDS(void)
 {
     /* Store file sequence counts and task ena/dis state in CDS */
-    uint32 DataStoreBuffer[DS_DEST_FILE_CNT + 1] = {0};
-    int32  Result                                = CFE_SUCCESS;
-    int32  i                                     = 0;
+    uint32 *DataStoreBuffer = DS_AppData.DataStoreImage;
+    int32   Result          = CFE_SUCCESS;
+    int32   i               = 0;
 
     /*
     ** Request for CDS area from cFE Executive Services...
     */
-    Result = CFE_ES_RegisterCDS(&DS_AppData.DataStoreHandle, sizeof(DataStoreBuffer), DS_CDS_NAME);
+    Result = CFE_ES_RegisterCDS(&DS_AppData.DataStoreHandle, sizeof(DS_AppData.DataStoreImage), DS_CDS_NAME);
 
     if (Result == CFE_SUCCESS)
     {
@@ -892,7 +1391,7 @@ int32 DS_TableCreateCDS(void)
             DataStoreBuffer[i] = DS_AppData.FileStatus[i].FileCount;
         }
 
-        DataStoreBuffer[DS_DEST_FILE_CNT] = DS_AppData.AppEnableState;
+        DataStoreBuffer[DS_CDS_APP_STATE] = DS_AppData.AppEnableState;
 
         Result = CFE_ES_CopyToCDS(DS_AppData.DataStoreHandle, DataStoreBuffer);
     }
@@ -912,7 +1411,10 @@ int32 DS_TableCreateCDS(void)
 
 #if (DS_CDS_ENABLE_STATE == 1)
             /* Only restore enable/disable state if configured */
-            DS_AppData.AppEnableState = (uint8)DataStoreBuffer[DS_DEST_FILE_CNT];
+            DS_AppData.AppEnableState = (uint8)DataStoreBuffer[DS_CDS_APP_STATE];
+#else
+            /* Current state is written by the next commit */
+            DS_AppData.DataStoreDirty[DS_CDS_APP_STATE] = true;
 #endif
         }
     }
@@ -944,9 +1446,9 @@ int32 DS_TableCreateCDS(void)
 void DS_TableUpdateCDS(void)
 {
     /* Store file sequence counts and task ena/dis state in CDS */
-    uint32 DataStoreBuffer[DS_DEST_FILE_CNT + 1] = {0};
-    int32  Result                                = CFE_SUCCESS;
-    int32  i                                     = 0;
+    uint32 *DataStoreBuffer = DS_AppData.DataStoreImage;
+    int32   Result          = CFE_SUCCESS;
+    int32   i               = 0;
 
     /*
     ** Handle is non-zero when CDS is active...
@@ -954,18 +1456,22 @@ void DS_TableUpdateCDS(void)
     if (!CFE_RESOURCEID_TEST_EQUAL(DS_AppData.DataStoreHandle, CFE_ES_CDS_BAD_HANDLE))
     {
         /*
-        ** Copy file sequence counts values to the data array...
+        ** Copy changed file sequence counts to the data array (other
+        **   entries keep their committed value or reservation)...
         */
         for (i = 0; i < DS_DEST_FILE_CNT; i++)
         {
-            DataStoreBuffer[i] = DS_AppData.FileStatus[i].FileCount;
+            if (DS_AppData.DataStoreDirty[i])
+            {
+                DataStoreBuffer[i] = DS_AppData.FileStatus[i].FileCount;
+            }
         }
 
         /*
         ** Always save the DS enable/disable state in the CDS...
         **  (DS_CDS_ENABLE_STATE controls restoring the state)
         */
-        DataStoreBuffer[DS_DEST_FILE_CNT] = DS_AppData.AppEnableState;
+        DataStoreBuffer[DS_CDS_APP_STATE] = DS_AppData.AppEnableState;
 
         /*
         ** Update DS portion of Critical Data Store...
@@ -982,6 +1488,74 @@ void DS_TableUpdateCDS(void)
             DS_AppData.DataStoreHandle = CFE_ES_CDS_BAD_HANDLE;
         }
     }
+
+    memset(DS_AppData.DataStoreDirty, 0, sizeof(DS_AppData.DataStoreDirty));
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Mark a CDS entry as changed                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_TableMarkCDS(int32 Index)
+{
+    DS_AppData.DataStoreDirty[Index] = true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Commit changed CDS entries                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_TableCommitCDS(void)
+{
+    int32 i = 0;
+
+    for (i = 0; i < DS_CDS_ENTRIES; i++)
+    {
+        if (DS_AppData.DataStoreDirty[i])
+        {
+            DS_TableUpdateCDS();
+            break;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Keep the CDS ahead of a destination sequence count              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_TableReserveCDS(int32 FileIndex)
+{
+    uint32 FileCount = DS_AppData.FileStatus[FileIndex].FileCount;
+
+    /*
+    ** A restore must not go back to a count that has been used - the
+    **   committed count is safe while it is no more than the reserve
+    **   ahead of the current count (unsigned, so a count that has
+    **   passed the reservation or rolled over forces a write)...
+    */
+    if ((uint32)(DS_AppData.DataStoreImage[FileIndex] - FileCount) > DS_CDS_SEQ_RESERVE)
+    {
+        if (FileCount > (DS_MAX_SEQUENCE_COUNT - DS_CDS_SEQ_RESERVE))
+        {
+            DS_AppData.DataStoreImage[FileIndex] = DS_MAX_SEQUENCE_COUNT;
+        }
+        else
+        {
+            DS_AppData.DataStoreImage[FileIndex] = FileCount + DS_CDS_SEQ_RESERVE;
+        }
+
+        /*
+        ** Write the reservation (and any other pending changes)...
+        */
+        DS_AppData.DataStoreDirty[FileIndex] = false;
+        DS_TableUpdateCDS();
+    }
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -992,24 +1566,14 @@ void DS_TableUpdateCDS(void)
 
 uint32 DS_TableHashFunction(CFE_SB_MsgId_t MessageID)
 {
+    uint32 Hash = (uint32)CFE_SB_MsgIdToValue(MessageID);
+
     /*
     **   The purpose of a hash function is to take the input value
-    ** and convert it to an index into the hash table. Assume that
-    ** the range of input values is much different (larger) than
-    ** the number of entries in the hash table. Then multiple input
-    ** values must resolve to the same output table index. This is ok
-    ** because each entry in the hash table is a linked list of all
-    ** the inputs with the same hash function result.
-    **
-    **   This particular hash function takes advantage of knowledge
-    ** regarding the format of the input values (cFE MessageID). By
-    ** ignoring the bits that define version number, packet type and
-    ** secondary header (high 5 bits of 16) we are left with the bits
-    ** (mask = 0x7FF) that can identify 2048 unique input telemetry
-    ** packets. Also, by using a fixed hash table size of 256 entries
-    ** and using only the lower 8 bits of the bitmask as the result
-    ** of the hash function, no single hash table entry will have more
-    ** than 8 elements in its linked list.
+    ** and convert it to an index into the hash table. Message ID
+    ** encodings may share most of their low order bits (MsgId v2
+    ** packs subsystem and system bits together), so every input bit
+    ** is mixed into the result before it is masked to the table size.
     **
     **   To look up a MessageID in the DS packet filter table, rather
     ** than search the entire filter table, DS does the following:
@@ -1017,13 +1581,19 @@ uint32 DS_TableHashFunction(CFE_SB_MsgId_t MessageID)
     **   - call the hash function
     **     (input = MessageID, output = hash table index)
     **
-    **   - search hash table entry linked list for matching MessageID
-    **     (each linked list contains, at most, 8 linked list elements)
+    **   - probe consecutive hash table slots for matching MessageID
+    **     (stop at the first empty slot - table is at most half full)
     **
-    **   - matching linked list element has index into filter table
+    **   - matching hash table slot has index into filter table
     **     (can now go directly to the correct filter table entry)
     */
-    return ((uint32)(CFE_SB_MsgIdToValue(MessageID) & DS_HASH_TABLE_MASK));
+    Hash ^= Hash >> 16;
+    Hash *= 0x7FEB352D;
+    Hash ^= Hash >> 15;
+    Hash *= 0x846CA68B;
+    Hash ^= Hash >> 16;
+
+    return (Hash & DS_HASH_TABLE_MASK);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -1035,16 +1605,38 @@ uint32 DS_TableHashFunction(CFE_SB_MsgId_t MessageID)
 void DS_TableCreateHash(void)
 {
     int32 FilterIndex = 0;
+    int32 HashIndex   = 0;
 
     /*
     ** Initialize global hash table structures...
     */
-    memset(DS_AppData.HashLinks, 0, sizeof(DS_AppData.HashLinks));
-    memset(DS_AppData.HashTable, 0, sizeof(DS_AppData.HashTable));
+    for (HashIndex = 0; HashIndex < DS_HASH_TABLE_ENTRIES; HashIndex++)
+    {
+        DS_AppData.HashTable[HashIndex].MessageID = CFE_SB_INVALID_MSG_ID;
+        DS_AppData.HashTable[HashIndex].Index     = DS_HASH_SLOT_EMPTY;
+        DS_AppData.HashTable[HashIndex].Retained  = false;
+    }
 
-    for (FilterIndex = 0; FilterIndex < DS_PACKETS_IN_FILTER_TABLE; FilterIndex++)
+    DS_AppData.FreeEntryHead = DS_INDEX_NONE;
+
+    /*
+    ** Entries in use are added to the hash table, unused entries are added
+    ** to the free list (in reverse so the lowest index is allocated first)
+    ** and every entry gets a routing plan, all in a single pass...
+    */
+    for (FilterIndex = DS_PACKETS_IN_FILTER_TABLE - 1; FilterIndex >= 0; FilterIndex--)
     {
-        DS_TableAddMsgID(DS_AppData.FilterTblPtr->Packet[FilterIndex].MessageID, FilterIndex);
+        if (CFE_SB_MsgId_Equal(DS_AppData.FilterTblPtr->Packet[FilterIndex].MessageID, CFE_SB_INVALID_MSG_ID))
+        {
+            DS_TableFreeEntry(FilterIndex);
+        }
+        else
+        {
+            DS_TableAddMsgID(DS_AppData.FilterTblPtr->Packet[FilterIndex].MessageID, FilterIndex);
+        }
+
+        DS_TableCompileRoute(FilterIndex);
+        DS_AppData.DuplicatePktCounter[FilterIndex] = 0;
     }
 }
 
@@ -1056,38 +1648,25 @@ void DS_TableCreateHash(void)
 
 int32 DS_TableAddMsgID(CFE_SB_MsgId_t MessageID, int32 FilterIndex)
 {
-    int32          HashIndex = 0;
-    DS_HashLink_t *NewLink   = NULL;
-    DS_HashLink_t *LinkList  = NULL;
-
-    /* Get unused linked list entry (one link entry per filter table entry) */
-    NewLink = &DS_AppData.HashLinks[FilterIndex];
+    uint32 HashIndex = 0;
+    int32  i         = 0;
 
-    /* Set filter table data values for new linked list entry */
-    NewLink->Index     = FilterIndex;
-    NewLink->MessageID = MessageID;
+    /* Hash table function converts MID into preferred hash table index */
+    HashIndex = DS_TableHashFunction(MessageID);
 
-    /* Hash table function converts MID into hash table index */
-    HashIndex = DS_TableHashFunction(NewLink->MessageID);
-
-    if (DS_AppData.HashTable[HashIndex] == (DS_HashLink_t *)NULL)
-    {
-        /* Set first link in this hash table entry linked list */
-        DS_AppData.HashTable[HashIndex] = NewLink;
-    }
-    else
+    /* Table is never more than half full so an empty slot is always found */
+    for (i = 0; i < DS_HASH_TABLE_ENTRIES; i++)
     {
-        /* Get start of linked list (all MID's with same hash result) */
-        LinkList = DS_AppData.HashTable[HashIndex];
-
-        /* Find last link */
-        while (LinkList->Next != (DS_HashLink_t *)NULL)
+        if (DS_AppData.HashTable[HashIndex].Index == DS_HASH_SLOT_EMPTY)
         {
-            LinkList = LinkList->Next;
+            /* Set filter table data values for new hash table slot */
+            DS_AppData.HashTable[HashIndex].MessageID = MessageID;
+            DS_AppData.HashTable[HashIndex].Index     = FilterIndex;
+            DS_AppData.HashTable[HashIndex].Retained  = false;
+            break;
         }
 
-        /* Add new link */
-        LinkList->Next = NewLink;
+        HashIndex = (HashIndex + 1) & DS_HASH_TABLE_MASK;
     }
 
     return HashIndex;
@@ -1101,37 +1680,224 @@ int32 DS_TableAddMsgID(CFE_SB_MsgId_t MessageID, int32 FilterIndex)
 
 int32 DS_TableFindMsgID(CFE_SB_MsgId_t MessageID)
 {
-    DS_PacketEntry_t *FilterPackets    = NULL;
-    DS_HashLink_t *   HashLink         = NULL;
-    int32             HashTableIndex   = 0;
-    int32             FilterTableIndex = 0;
-
-    /* De-reference filter table packet array */
-    FilterPackets = DS_AppData.FilterTblPtr->Packet;
+    int32 HashTableIndex   = 0;
+    int32 FilterTableIndex = 0;
 
     /* Set search result to "not found" */
     FilterTableIndex = DS_INDEX_NONE;
 
-    /* Hash table function converts MID into hash table index */
-    HashTableIndex = DS_TableHashFunction(MessageID);
+    /* Find the hash table slot holding this MID */
+    HashTableIndex = DS_TableFindSlot(MessageID);
+
+    if (HashTableIndex != DS_INDEX_NONE)
+    {
+        FilterTableIndex = DS_AppData.HashTable[HashTableIndex].Index;
+    }
+
+    return FilterTableIndex;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* DS_TableFindSlot() - get hash table slot index for MID          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_TableFindSlot(CFE_SB_MsgId_t MessageID)
+{
+    DS_HashSlot_t *HashSlot       = NULL;
+    uint32         HashTableIndex = 0;
+    int32          SlotIndex      = 0;
+    int32          i              = 0;
+
+    /* Set search result to "not found" */
+    SlotIndex = DS_INDEX_NONE;
 
-    /* Get start of linked list (all MID's with same hash result) */
-    HashLink = DS_AppData.HashTable[HashTableIndex];
+    /* Hash table function converts MID into preferred hash table index */
+    HashTableIndex = DS_TableHashFunction(MessageID);
 
-    /* NULL when list is empty or end of list */
-    while (HashLink != (DS_HashLink_t *)NULL)
+    for (i = 0; i < DS_HASH_TABLE_ENTRIES; i++)
     {
-        /* Compare this linked list entry for matching MessageID */
-        if (CFE_SB_MsgIdToValue(FilterPackets[HashLink->Index].MessageID) == CFE_SB_MsgIdToValue(MessageID))
+        HashSlot = &DS_AppData.HashTable[HashTableIndex];
+
+        /* Empty slot ends the probe sequence - MID is not in the table */
+        if (HashSlot->Index == DS_HASH_SLOT_EMPTY)
+        {
+            break;
+        }
+
+        /* Compare this hash table slot for matching MessageID */
+        if (CFE_SB_MsgId_Equal(HashSlot->MessageID, MessageID))
         {
             /* Stop the search - we found it */
-            FilterTableIndex = HashLink->Index;
+            SlotIndex = HashTableIndex;
             break;
         }
 
-        /* Max of 8 links per design */
-        HashLink = HashLink->Next;
+        HashTableIndex = (HashTableIndex + 1) & DS_HASH_TABLE_MASK;
+    }
+
+    return SlotIndex;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Remove MID from hash table                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_TableRemoveMsgID(CFE_SB_MsgId_t MessageID)
+{
+    int32  SlotIndex  = 0;
+    uint32 EmptyIndex = 0;
+    uint32 NextIndex  = 0;
+    uint32 HomeIndex  = 0;
+    int32  i          = 0;
+
+    /* Find the hash table slot holding this MID */
+    SlotIndex = DS_TableFindSlot(MessageID);
+
+    if (SlotIndex != DS_INDEX_NONE)
+    {
+        /*
+        ** Shift later members of the probe sequence back into the hole so
+        ** that lookups never need to step over deleted slots...
+        */
+        EmptyIndex = SlotIndex;
+        NextIndex  = SlotIndex;
+
+        for (i = 0; i < DS_HASH_TABLE_ENTRIES; i++)
+        {
+            NextIndex = (NextIndex + 1) & DS_HASH_TABLE_MASK;
+
+            if (DS_AppData.HashTable[NextIndex].Index == DS_HASH_SLOT_EMPTY)
+            {
+                break;
+            }
+
+            /*
+            ** A slot may only move back if its preferred slot is not
+            ** cyclically between the hole and its current position...
+            */
+            HomeIndex = DS_TableHashFunction(DS_AppData.HashTable[NextIndex].MessageID);
+
+            if (((NextIndex - HomeIndex) & DS_HASH_TABLE_MASK) >= ((NextIndex - EmptyIndex) & DS_HASH_TABLE_MASK))
+            {
+                DS_AppData.HashTable[EmptyIndex] = DS_AppData.HashTable[NextIndex];
+                EmptyIndex                       = NextIndex;
+            }
+        }
+
+        DS_AppData.HashTable[EmptyIndex].MessageID = CFE_SB_INVALID_MSG_ID;
+        DS_AppData.HashTable[EmptyIndex].Index     = DS_HASH_SLOT_EMPTY;
+    }
+
+    return SlotIndex;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Allocate unused packet filter table entry                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_TableAllocEntry(void)
+{
+    int32 FilterTableIndex = DS_AppData.FreeEntryHead;
+
+    if (FilterTableIndex != DS_INDEX_NONE)
+    {
+        DS_AppData.FreeEntryHead = DS_AppData.FreeEntryNext[FilterTableIndex];
     }
 
     return FilterTableIndex;
 }
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Return packet filter table entry to free list                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_TableFreeEntry(int32 FilterIndex)
+{
+    DS_AppData.FreeEntryNext[FilterIndex] = DS_AppData.FreeEntryHead;
+    DS_AppData.FreeEntryHead              = FilterIndex;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compile packet routing plan for one filter table entry          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_TableCompileRoute(int32 FilterIndex)
+{
+    DS_PacketEntry_t *    PacketEntry = NULL;
+    DS_FilterParms_t *    FilterParms = NULL;
+    DS_FilterPredicate_t *Predicate   = NULL;
+    DS_RoutePlan_t *      RoutePlan   = NULL;
+    DS_RouteFilter_t *    RouteFilter = NULL;
+    int32                 i           = 0;
+
+    PacketEntry = &DS_AppData.FilterTblPtr->Packet[FilterIndex];
+    RoutePlan   = &DS_AppData.RoutePlan[FilterIndex];
+
+    RoutePlan->FilterCount    = 0;
+    RoutePlan->PredicateCount = 0;
+    RoutePlan->MinLength      = PacketEntry->MinLength;
+
+    for (i = 0; i < DS_PREDICATES_PER_PACKET; i++)
+    {
+        Predicate = &PacketEntry->Predicate[i];
+
+        /*
+        ** Omit unused predicates and predicates that could read past the packet...
+        */
+        if ((Predicate->Compare != DS_UNUSED) && (DS_TableVerifyPredicate(Predicate, PacketEntry->MinLength) == true))
+        {
+            RoutePlan->Predicate[RoutePlan->PredicateCount].Offset = Predicate->Offset;
+            RoutePlan->Predicate[RoutePlan->PredicateCount].Mask   = Predicate->Mask;
+            RoutePlan->Predicate[RoutePlan->PredicateCount].Value  = Predicate->Value;
+            RoutePlan->Predicate[RoutePlan->PredicateCount].Expect = (Predicate->Compare == DS_PREDICATE_EQUAL);
+
+            RoutePlan->PredicateCount++;
+        }
+    }
+
+    for (i = 0; i < DS_FILTERS_PER_PACKET; i++)
+    {
+        FilterParms = &PacketEntry->Filter[i];
+
+        /*
+        ** Omit unused filters and filters that would reject every packet (or
+        **   predicate filters without predicates, which would accept every packet)...
+        */
+        if ((FilterParms->Algorithm_N != DS_UNUSED) &&
+            (DS_TableVerifyFileIndex(FilterParms->FileTableIndex) == true) &&
+            (DS_TableVerifyFilterType(FilterParms->FilterType) == true) &&
+            (DS_TableVerifyParms(FilterParms->FilterType, FilterParms->Algorithm_N, FilterParms->Algorithm_X,
+                                 FilterParms->Algorithm_O) == true) &&
+            ((FilterParms->FilterType != DS_BY_PREDICATE) || (RoutePlan->PredicateCount > 0)))
+        {
+            RouteFilter = &RoutePlan->Filter[RoutePlan->FilterCount];
+
+            RouteFilter->FileIndex   = FilterParms->FileTableIndex;
+            RouteFilter->FilterType  = FilterParms->FilterType;
+            RouteFilter->Algorithm_N = FilterParms->Algorithm_N;
+            RouteFilter->Algorithm_X = FilterParms->Algorithm_X;
+            RouteFilter->Algorithm_O = FilterParms->Algorithm_O;
+            RouteFilter->Reciprocal  = DS_ROUTE_RECIPROCAL(FilterParms->Algorithm_X);
+
+            /*
+            ** Content and rate filters start over with the next packet...
+            */
+            RouteFilter->Repeats     = 0;
+            RouteFilter->Primed      = false;
+            RouteFilter->Fingerprint = 0;
+            RouteFilter->Tokens      = 0;
+
+            RoutePlan->FilterCount++;
+        }
+    }
+}
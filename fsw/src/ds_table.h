@@ -30,23 +30,120 @@
 
 #include "ds_extern_typedefs.h"
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* DS Critical Data Store definitions                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief CDS entry for the DS enable/disable state
+ *
+ *  Entries 0 to #DS_DEST_FILE_CNT - 1 hold destination sequence counts.
+ */
+#define DS_CDS_APP_STATE DS_DEST_FILE_CNT
+
+#define DS_CDS_ENTRIES (DS_DEST_FILE_CNT + 1) /**< \brief Number of 32 bit entries in the DS CDS area */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* DS hash table structures and definitions                        */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-#define DS_HASH_TABLE_ENTRIES 256
-#define DS_HASH_TABLE_MASK    0x00FF
+/*
+** Round a positive constant up to the next power of two...
+*/
+#define DS_HASH_POW2_SMEAR1(n) ((n) | ((n) >> 1))
+#define DS_HASH_POW2_SMEAR2(n) (DS_HASH_POW2_SMEAR1(n) | (DS_HASH_POW2_SMEAR1(n) >> 2))
+#define DS_HASH_POW2_SMEAR4(n) (DS_HASH_POW2_SMEAR2(n) | (DS_HASH_POW2_SMEAR2(n) >> 4))
+#define DS_HASH_POW2_SMEAR8(n) (DS_HASH_POW2_SMEAR4(n) | (DS_HASH_POW2_SMEAR4(n) >> 8))
+#define DS_HASH_POW2(n)        (DS_HASH_POW2_SMEAR8((n)-1) + 1)
 
-/** \brief DS Hash Table Linked List structure */
-typedef struct DS_HashTag
+/*
+** Open addressed MID index holds at most half as many entries as slots...
+*/
+#define DS_HASH_TABLE_ENTRIES DS_HASH_POW2(2 * DS_PACKETS_IN_FILTER_TABLE)
+#define DS_HASH_TABLE_MASK    (DS_HASH_TABLE_ENTRIES - 1)
+
+#define DS_HASH_SLOT_EMPTY 0xFFFF /**< \brief Hash table slot is not in use */
+
+/** \brief DS Hash Table slot structure */
+typedef struct
 {
     CFE_SB_MsgId_t MessageID; /**< \brief DS filter table entry MessageID */
-    uint16         Index;     /**< \brief DS filter table entry index */
+    uint16         Index;     /**< \brief DS filter table entry index (#DS_HASH_SLOT_EMPTY = unused) */
+    bool           Retained;  /**< \brief MID is also in the filter table being loaded */
+} DS_HashSlot_t;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* DS packet routing plan structures                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-    struct DS_HashTag *Next; /**< \brief Next hash table linked list element */
-} DS_HashLink_t;
+/**
+ *  \brief Routing plan filter reciprocal for group size X
+ *
+ *  Fixed point (2^32 / X, rounded up) reciprocal used to compute the 16 bit
+ *  filter remainder by multiplication. The result wraps to zero for X = 1,
+ *  which correctly yields a remainder of zero for every packet.
+ */
+#define DS_ROUTE_RECIPROCAL(X) ((uint32)(0xFFFFFFFFu / (uint32)(X)) + 1)
+
+/**
+ *  \brief Routing plan rate filter token scale
+ *
+ *  Rate filter buckets count tokens in units of 2^-16 packet (or byte), so
+ *  refills shorter than one whole token are not lost between packets.
+ */
+#define DS_RATE_TOKEN_SHIFT 16
+
+/**
+ *  \brief Routing plan byte rate filter scale limit
+ *
+ *  A #DS_BY_BYTE_RATE filter counts Algorithm_N and Algorithm_X in units
+ *  of 2^Algorithm_O bytes.  The largest unit is 64 KiB, which allows rates
+ *  and bursts up to 4 GiB.
+ */
+#define DS_RATE_BYTE_SCALE_MAX 16
+
+/** \brief DS Routing Plan filter (active and pre-validated filters only) */
+typedef struct
+{
+    uint16 FileIndex;   /**< \brief Destination file table index */
+    uint16 FilterType;  /**< \brief Filter type: #DS_BY_COUNT, #DS_BY_TIME, #DS_BY_CONTENT or a rate */
+    uint16 Algorithm_N; /**< \brief Filter algorithm - pass this many */
+    uint16 Algorithm_X; /**< \brief Filter algorithm - out of this many */
+    uint16 Algorithm_O; /**< \brief Filter algorithm - at this offset */
+    uint16 Repeats;     /**< \brief Content filter - repeats dropped since the last stored packet */
+    uint32 Reciprocal;  /**< \brief Algorithm_X reciprocal, see #DS_ROUTE_RECIPROCAL */
+    bool   Primed;      /**< \brief Content or rate filter - state is set by the first packet */
+    uint64 Fingerprint; /**< \brief Content filter - fingerprint of the last stored payload */
+    uint64 Tokens;      /**< \brief Rate filter - bucket contents, see #DS_RATE_TOKEN_SHIFT */
+
+    CFE_TIME_SysTime_t RefillTime; /**< \brief Rate filter - MET the bucket was last refilled */
+} DS_RouteFilter_t;
+
+/** \brief DS Routing Plan predicate (used and pre-validated predicates only) */
+typedef struct
+{
+    uint16 Offset; /**< \brief Packet byte offset, less than the routing plan MinLength */
+    uint8  Mask;   /**< \brief Bits of the packet byte to compare */
+    uint8  Value;  /**< \brief Masked packet byte value to compare with */
+    bool   Expect; /**< \brief Comparison result that matches: true = equal, false = not equal */
+} DS_RoutePredicate_t;
+
+/** \brief DS Routing Plan for one packet filter table entry */
+typedef struct
+{
+    uint16           FilterCount;                   /**< \brief Number of routing plan filters in use */
+    DS_RouteFilter_t Filter[DS_FILTERS_PER_PACKET]; /**< \brief Routing plan filters */
+
+    uint16              MinLength;                           /**< \brief Shortest packet predicates apply to */
+    uint16              PredicateCount;                      /**< \brief Number of predicates in use */
+    DS_RoutePredicate_t Predicate[DS_PREDICATES_PER_PACKET]; /**< \brief Routing plan predicates */
+} DS_RoutePlan_t;
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
@@ -271,7 +368,9 @@ bool DS_TableVerifyFileIndex(uint16 FileTableIndex);
  *       This function verifies that the indicated packet filter
  *       table filter parameters are within bounds.
  *       Algorithm N must be <= Algorithm X
- *       Algorithm O must be <  Algorithm X
+ *       Algorithm O must be <  Algorithm X, except for a
+ *       #DS_BY_BYTE_RATE filter, where Algorithm O is the byte
+ *       scale and must be <= #DS_RATE_BYTE_SCALE_MAX
  *
  *  \par Called From:
  *       - Command handler (set filter parms)
@@ -280,13 +379,40 @@ bool DS_TableVerifyFileIndex(uint16 FileTableIndex);
  *  \par Assumptions, External Events, and Notes:
  *       (none)
  *
+ *  \param[in] FilterType  Filter type the parameters are used with
  *  \param[in] Algorithm_N Filter Algorithm N value
  *  \param[in] Algorithm_X Filter Algorithm X value
  *  \param[in] Algorithm_O Filter Algorithm O value
  *
  *  \sa #DS_TableVerifyType, #DS_TableVerifyState, #DS_DestFileEntry_t
  */
-bool DS_TableVerifyParms(uint16 Algorithm_N, uint16 Algorithm_X, uint16 Algorithm_O);
+bool DS_TableVerifyParms(uint16 FilterType, uint16 Algorithm_N, uint16 Algorithm_X, uint16 Algorithm_O);
+
+/**
+ *  \brief Verify byte rate filter burst
+ *
+ *  \par Description
+ *       This function verifies that a #DS_BY_BYTE_RATE filter burst
+ *       (Algorithm X in units of 2^Algorithm O bytes) holds the
+ *       shortest packet of the packet filter table entry.  A smaller
+ *       burst would filter every packet.  Other filter types always
+ *       pass.
+ *
+ *  \par Called From:
+ *       - Command handler (set filter parms)
+ *       - Packet Filter Table entry validation function
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Algorithm O has been verified by #DS_TableVerifyParms.
+ *
+ *  \param[in] FilterType  Filter type the parameters are used with
+ *  \param[in] Algorithm_X Filter Algorithm X value
+ *  \param[in] Algorithm_O Filter Algorithm O value
+ *  \param[in] MinLength   Packet filter table entry shortest packet (bytes)
+ *
+ *  \sa #DS_TableVerifyParms, #DS_PacketEntry_t
+ */
+bool DS_TableVerifyBurst(uint16 FilterType, uint16 Algorithm_X, uint16 Algorithm_O, uint16 MinLength);
 
 /**
  *  \brief Verify packet filter type or filename type
@@ -313,6 +439,51 @@ bool DS_TableVerifyParms(uint16 Algorithm_N, uint16 Algorithm_X, uint16 Algorith
  */
 bool DS_TableVerifyType(uint16 TimeVsCount);
 
+/**
+ *  \brief Verify packet filter type
+ *
+ *  \par Description
+ *       This function verifies that the indicated packet filter
+ *       table filter type is within bounds.  Must be #DS_BY_COUNT,
+ *       #DS_BY_TIME, #DS_BY_CONTENT, #DS_BY_PKT_RATE or #DS_BY_BYTE_RATE.
+ *
+ *  \par Called From:
+ *       - Command handler (set filter type)
+ *       - Packet Filter Table entry validation function
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] FilterType Filter Type value
+ *
+ *  \sa #DS_TableVerifyType, #DS_TableVerifyParms
+ */
+bool DS_TableVerifyFilterType(uint16 FilterType);
+
+/**
+ *  \brief Verify packet filter predicate
+ *
+ *  \par Description
+ *       This function verifies that the indicated packet filter
+ *       table predicate is unused (all zero's) or valid.  A valid
+ *       predicate has a known compare, an offset less than the
+ *       packet entry minimum length, and no value bits outside
+ *       the mask (which could never be equal).
+ *
+ *  \par Called From:
+ *       - Packet Filter Table entry validation function
+ *       - Routing plan compile function
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] Predicate Pointer to packet filter table predicate
+ *  \param[in] MinLength Packet filter table entry minimum packet length
+ *
+ *  \sa #DS_FilterPredicate_t, #DS_BY_PREDICATE
+ */
+bool DS_TableVerifyPredicate(const DS_FilterPredicate_t *Predicate, uint16 MinLength);
+
 /**
  *  \brief Verify application or destination file enable/disable state
  *
@@ -398,6 +569,184 @@ bool DS_TableVerifyAge(uint32 MaxFileAge);
  */
 bool DS_TableVerifyCount(uint32 SequenceCount);
 
+/**
+ *  \brief Verify destination file write buffer size
+ *
+ *  \par Description
+ *       This function verifies that the indicated destination file
+ *       write buffer size does not exceed the platform defined
+ *       maximum. A buffer size of zero disables write buffering.
+ *
+ *  \par Called From:
+ *       - Destination File Table entry validation function
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] BufferSize Write buffer size (bytes)
+ *
+ *  \sa #DS_TableVerifySize, #DS_DestFileEntry_t
+ */
+bool DS_TableVerifyBufferSize(uint32 BufferSize);
+
+/**
+ *  \brief Verify destination file preallocation selection
+ *
+ *  \par Description
+ *       This function verifies that the indicated preallocation
+ *       selection is DS_DISABLED, or DS_ENABLED on a platform that
+ *       supports preallocation (see #DS_FsExtAllocateAvailable).
+ *
+ *  \par Called From:
+ *       - Destination File Table entry validation function
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] Preallocate Preallocation selection
+ *
+ *  \sa #DS_TableVerifyState, #DS_DestFileEntry_t
+ */
+bool DS_TableVerifyPreallocate(uint16 Preallocate);
+
+/**
+ *  \brief Verify destination file sync policy
+ *
+ *  \par Description
+ *       This function verifies that the indicated sync policy is
+ *       DS_SYNC_NONE, or any other policy on a platform that supports
+ *       syncing files (see #DS_FILE_SYNC).  The periodic policies
+ *       (DS_SYNC_BY_BYTES and DS_SYNC_BY_TIME) require a non-zero
+ *       sync interval.
+ *
+ *  \par Called From:
+ *       - Destination File Table entry validation function
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] SyncPolicy   Sync policy selection
+ *  \param[in] SyncInterval Bytes or seconds between syncs
+ *
+ *  \sa #DS_TableVerifyPreallocate, #DS_DestFileEntry_t
+ */
+bool DS_TableVerifySync(uint16 SyncPolicy, uint32 SyncInterval);
+
+/**
+ *  \brief Verify destination file direct I/O selection
+ *
+ *  \par Description
+ *       This function verifies that the indicated direct I/O selection
+ *       is DS_DISABLED, or DS_ENABLED on a platform that supports direct
+ *       I/O (see #DS_FsExtDirectAvailable).  Direct I/O also requires a write
+ *       buffer that is a multiple of #DS_DIRECT_IO_BLOCK_SIZE.
+ *
+ *  \par Called From:
+ *       - Destination File Table entry validation function
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] DirectIO   Direct I/O selection
+ *  \param[in] BufferSize Write buffer size (bytes)
+ *
+ *  \sa #DS_TableVerifyBufferSize, #DS_DestFileEntry_t
+ */
+bool DS_TableVerifyDirectIO(uint16 DirectIO, uint32 BufferSize);
+
+/**
+ *  \brief Verify destination file index spacing
+ *
+ *  \par Description
+ *       This function verifies that a file index is only selected
+ *       (non-zero byte or time spacing) when DS files have a cFE file
+ *       header, which holds the index file offset.  Any spacing is
+ *       valid, since #DS_FILE_INDEX_MAX_CNT bounds the index size.
+ *
+ *  \par Called From:
+ *       - Destination File Table entry validation function
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] IndexBytes   File bytes between index samples
+ *  \param[in] IndexSeconds Packet seconds between index samples
+ *
+ *  \sa #DS_DestFileEntry_t
+ */
+bool DS_TableVerifyIndex(uint32 IndexBytes, uint16 IndexSeconds);
+
+/**
+ *  \brief Verify destination file compression selection
+ *
+ *  \par Description
+ *       This function verifies that the indicated codec is DS_CODEC_NONE,
+ *       or a known codec on a platform that supports compression (see
+ *       #DS_FILE_COMPRESSION).  Compression works on whole write buffers,
+ *       so it requires a write buffer, and it cannot be combined with
+ *       direct I/O or a file index (both assume packet bytes are stored
+ *       as written).
+ *
+ *  \par Called From:
+ *       - Destination File Table entry validation function
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] Codec      Codec selection
+ *  \param[in] BufferSize Write buffer size (bytes)
+ *  \param[in] DirectIO   Direct I/O selection
+ *  \param[in] Indexed    File index selected (non-zero index spacing)
+ *
+ *  \sa #DS_TableVerifyBufferSize, #DS_DestFileEntry_t
+ */
+bool DS_TableVerifyCodec(uint16 Codec, uint32 BufferSize, uint16 DirectIO, bool Indexed);
+
+/**
+ *  \brief Verify destination file delta record selection
+ *
+ *  \par Description
+ *       This function verifies that packets are only stored as XOR
+ *       delta records (non-zero keyframe interval) when no file index
+ *       is selected.  Index samples point at packets, and a delta
+ *       record cannot be decoded without the records before it.
+ *
+ *  \par Called From:
+ *       - Destination File Table entry validation function
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] DeltaKeyframe Packets per message ID between full records
+ *  \param[in] Indexed       File index selected (non-zero index spacing)
+ *
+ *  \sa #DS_TableVerifyIndex, #DS_DestFileEntry_t
+ */
+bool DS_TableVerifyDelta(uint16 DeltaKeyframe, bool Indexed);
+
+/**
+ *  \brief Verify destination file superframe selection
+ *
+ *  \par Description
+ *       This function verifies that a non-zero superframe size is not
+ *       less than #DS_SUPERFRAME_MIN_SIZE and not greater than
+ *       #DS_SUPERFRAME_MAX_SIZE, and that superframes are not combined
+ *       with delta records or a file index.
+ *
+ *  \par Called From:
+ *       - Destination File Table entry validation function
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] SuperframeSize Superframe size (bytes), zero = none
+ *  \param[in] DeltaKeyframe  Packets per message ID between full records
+ *  \param[in] Indexed        File index selected (non-zero index spacing)
+ *
+ *  \sa #DS_TableVerifyDelta, #DS_DestFileEntry_t
+ */
+bool DS_TableVerifySuperframe(uint16 SuperframeSize, uint16 DeltaKeyframe, bool Indexed);
+
 /**
  *  \brief Subscribe to packet filter table packets
  *
@@ -435,6 +784,28 @@ void DS_TableSubscribe(void);
  */
 void DS_TableUnsubscribe(void);
 
+/**
+ *  \brief Subscribe to packet filter table differences
+ *
+ *  \par Description
+ *       This function compares a newly loaded packet filter table
+ *       against the hash table that still describes the previous
+ *       table. Packets only in the new table are subscribed, packets
+ *       only in the old table are unsubscribed and packets in both
+ *       tables keep their existing subscription, so none of them
+ *       are dropped during the table switch.
+ *
+ *  \par Called From:
+ *       - Filter table manage updates function (after table update)
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must be called before the hash table is rebuilt for the
+ *       new packet filter table.
+ *
+ *  \sa #DS_TableSubscribe, #DS_TableUnsubscribe, #DS_TableCreateHash
+ */
+void DS_TableResubscribe(void);
+
 /**
  *  \brief Create local area within the Critical Data Store (CDS)
  *
@@ -458,36 +829,102 @@ int32 DS_TableCreateCDS(void);
  *  \brief Update CDS with current filename sequence count values
  *
  *  \par Description
- *       This function writes the current filename sequence count
- *       values to the Critical Data Store. The function is called
- *       each time the sequence count values are modified.
+ *       This function writes the DS area of the Critical Data Store.
+ *       Changed entries are written with the current sequence count
+ *       and enable/disable state, other entries keep the value (and
+ *       any sequence count reservation) from the previous commit.
+ *       All entries are marked as unchanged.
+ *
+ *  \par Called From:
+ *       - CDS commit function
+ *       - CDS sequence count reservation function
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \sa #DS_TableMarkCDS, #DS_TableCommitCDS
+ */
+void DS_TableUpdateCDS(void);
+
+/**
+ *  \brief Mark a CDS entry as changed
+ *
+ *  \par Description
+ *       Records that a destination sequence count, or the DS
+ *       enable/disable state, has changed.  The change is written
+ *       to the Critical Data Store by the next commit; callers that
+ *       change a value by command or table update commit at once.
  *
  *  \par Called From:
  *       - Destination table data update handler
+ *       - Command handlers (set app state, set sequence count)
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] Index Destination file table index, or #DS_CDS_APP_STATE
+ *
+ *  \sa #DS_TableCommitCDS
+ */
+void DS_TableMarkCDS(int32 Index);
+
+/**
+ *  \brief Commit changed CDS entries
+ *
+ *  \par Description
+ *       Writes the DS area of the Critical Data Store if any entry
+ *       has been marked as changed since the last write.
+ *
+ *  \par Called From:
+ *       - Maintenance scheduler (every #DS_SCHED_CDS_PERIOD)
+ *       - Command handler (close all)
+ *       - Application exit
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \sa #DS_TableMarkCDS, #DS_TableUpdateCDS
+ */
+void DS_TableCommitCDS(void);
+
+/**
+ *  \brief Keep the CDS ahead of a destination sequence count
+ *
+ *  \par Description
+ *       Called after a new count file is created.  The CDS must
+ *       never hold a sequence count that has already been used, so
+ *       the CDS is written immediately unless the current count is
+ *       within the reservation made by the previous write.  A new
+ *       reservation of #DS_CDS_SEQ_RESERVE counts is made each time
+ *       this forces a write.
+ *
+ *  \par Called From:
  *       - Destination file creation function
- *       - Command handler (set sequence count)
  *
  *  \par Assumptions, External Events, and Notes:
  *       (none)
  *
- *  \sa #DS_DestFileEntry_t
+ *  \param[in] FileIndex Destination file table index
+ *
+ *  \sa #DS_TableUpdateCDS
  */
-void DS_TableUpdateCDS(void);
+void DS_TableReserveCDS(int32 FileIndex);
 
 /**
  *  \brief Hash table function
  *
  *  \par Description
- *       This function converts a cFE MessageID into an index into
- *       the hash table. The indexed hash table entry contains a
- *       linked list where each link identifies a single entry in
- *       the packet filter table. Thus, the scope of searching the
- *       Packet Filter Table for a specific MessageID has been reduced
- *       from searching the total number of entries in the filter
- *       table by a factor equal to the size of the hash table.
+ *       This function converts a cFE MessageID into the preferred
+ *       slot of the open addressed hash table. All bits of the
+ *       MessageID are mixed into the result so that MessageID
+ *       encodings sharing their low order bits still spread evenly
+ *       across the table. A lookup probes consecutive slots from
+ *       the preferred slot until it finds the MessageID or an
+ *       empty slot, which is usually one or two probes because
+ *       the table is never more than half full.
  *
  *  \par Called From:
- *       - Hash table creation function (after load filter table)
+ *       - Add messageID to hash table function
  *       - Find messageID in filter table function
  *
  *  \par Assumptions, External Events, and Notes:
@@ -497,7 +934,7 @@ void DS_TableUpdateCDS(void);
  *
  *  \return Index of hash table entry for input message ID
  *
- *  \sa #DS_HashLink_t, #DS_TableCreateHash, #DS_TableFindMsgID
+ *  \sa #DS_HashSlot_t, #DS_TableCreateHash, #DS_TableFindMsgID
  */
 uint32 DS_TableHashFunction(CFE_SB_MsgId_t MessageID);
 
@@ -506,12 +943,12 @@ uint32 DS_TableHashFunction(CFE_SB_MsgId_t MessageID);
  *
  *  \par Description
  *       This function populates the hash table following a new
- *       load of the packet filter table. Because there may be
- *       more message ID's than hash table entries, the hash table
- *       function may translate multiple message ID's into each
- *       hash table index. Each hash table entry is a linked list
- *       containing a link for each message ID that translates to
- *       the same hash table index.
+ *       load of the packet filter table. Every slot is first
+ *       marked empty and then each packet filter table entry that
+ *       is in use is added. Unused entries are not indexed, they
+ *       are placed on the free list used by the add MID command.
+ *       The packet routing plan for every entry is compiled in the
+ *       same pass.
  *
  *  \par Called From:
  *       - Filter table manage updates function (after table load)
@@ -519,7 +956,7 @@ uint32 DS_TableHashFunction(CFE_SB_MsgId_t MessageID);
  *  \par Assumptions, External Events, and Notes:
  *       (none)
  *
- *  \sa #DS_HashLink_t, #DS_TableHashFunction, #DS_TableFindMsgID
+ *  \sa #DS_HashSlot_t, #DS_TableHashFunction, #DS_TableFindMsgID
  */
 void DS_TableCreateHash(void);
 
@@ -527,7 +964,8 @@ void DS_TableCreateHash(void);
  *  \brief Adds a message ID to the hash table
  *
  *  \par Description
- *       This function populates the hash table with a new message ID
+ *       This function stores a new message ID in the first empty
+ *       slot at or after the preferred slot for that message ID.
  *
  *  \par Called From:
  *       - Creation of Hash Table
@@ -539,12 +977,104 @@ void DS_TableCreateHash(void);
  *  \param[in] MessageID   Message ID
  *  \param[in] FilterIndex Filter table index for message ID
  *
- *  \return Hash table index for message ID
+ *  \return Hash table slot index for message ID
  *
- *  \sa #DS_HashLink_t, #DS_TableHashFunction, #DS_TableFindMsgID
+ *  \sa #DS_HashSlot_t, #DS_TableHashFunction, #DS_TableFindMsgID
  */
 int32 DS_TableAddMsgID(CFE_SB_MsgId_t MessageID, int32 FilterIndex);
 
+/**
+ *  \brief Removes a message ID from the hash table
+ *
+ *  \par Description
+ *       This function removes a message ID from the hash table and
+ *       shifts any later members of the same probe sequence back
+ *       into the vacated slot, so no rebuild of the hash table is
+ *       needed and lookups never step over deleted slots.
+ *
+ *  \par Called From:
+ *       - Command to remove a MID
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] MessageID Message ID
+ *
+ *  \return Hash table slot index that held the message ID
+ *  \retval #DS_INDEX_NONE Message ID was not in the hash table
+ *
+ *  \sa #DS_HashSlot_t, #DS_TableHashFunction, #DS_TableAddMsgID
+ */
+int32 DS_TableRemoveMsgID(CFE_SB_MsgId_t MessageID);
+
+/**
+ *  \brief Allocate unused packet filter table entry
+ *
+ *  \par Description
+ *       This function removes the first entry from the list of
+ *       unused packet filter table entries. The list is built with
+ *       the hash table after each filter table load.
+ *
+ *  \par Called From:
+ *       - Command handler (add messageID to filter table)
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \return Filter table index of unused entry
+ *  \retval #DS_INDEX_NONE Packet filter table is full
+ *
+ *  \sa #DS_TableFreeEntry, #DS_TableCreateHash
+ */
+int32 DS_TableAllocEntry(void);
+
+/**
+ *  \brief Return packet filter table entry to free list
+ *
+ *  \par Description
+ *       This function adds an unused packet filter table entry
+ *       to the list of entries available to the add MID command.
+ *
+ *  \par Called From:
+ *       - Hash table creation function (after load filter table)
+ *       - Command handler (remove messageID from filter table)
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] FilterIndex Filter table index of unused entry
+ *
+ *  \sa #DS_TableAllocEntry, #DS_TableCreateHash
+ */
+void DS_TableFreeEntry(int32 FilterIndex);
+
+/**
+ *  \brief Compile packet routing plan for one filter table entry
+ *
+ *  \par Description
+ *       This function converts the filters for a single packet filter
+ *       table entry into a dense routing plan. Only filters that are
+ *       in use, have a valid destination file index, filter type and
+ *       algorithm parameters are copied to the plan. Filters that fail
+ *       these tests would filter every packet and are simply omitted.
+ *
+ *  \par Called From:
+ *       - Hash table creation function (after load filter table)
+ *       - Command handler (set file index)
+ *       - Command handler (set filter type)
+ *       - Command handler (set filter parms)
+ *       - Command handler (add messageID to filter table)
+ *       - Command handler (remove messageID from filter table)
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] FilterIndex Filter table index
+ *
+ *  \sa #DS_RoutePlan_t, #DS_TableCreateHash
+ */
+void DS_TableCompileRoute(int32 FilterIndex);
+
 /**
  *  \brief Search packet filter table for message ID
  *
@@ -566,8 +1096,32 @@ int32 DS_TableAddMsgID(CFE_SB_MsgId_t MessageID, int32 FilterIndex);
  *
  *  \return Filter table index for message ID
  *
- *  \sa #DS_HashLink_t, #DS_TableHashFunction, #DS_TableCreateHash
+ *  \sa #DS_HashSlot_t, #DS_TableHashFunction, #DS_TableCreateHash
  */
 int32 DS_TableFindMsgID(CFE_SB_MsgId_t MessageID);
 
+/**
+ *  \brief Search hash table for message ID
+ *
+ *  \par Description
+ *       This function searches for the hash table slot that holds
+ *       the input argument message ID.
+ *
+ *  \par Called From:
+ *       - Find messageID in filter table function
+ *       - Remove messageID from hash table function
+ *       - Subscribe to packet filter table differences function
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] MessageID Message ID
+ *
+ *  \return Hash table slot index for message ID
+ *  \retval #DS_INDEX_NONE Message ID is not in the hash table
+ *
+ *  \sa #DS_HashSlot_t, #DS_TableHashFunction, #DS_TableFindMsgID
+ */
+int32 DS_TableFindSlot(CFE_SB_MsgId_t MessageID);
+
 #endif
@@ -84,6 +84,8 @@
 #error DS_PACKETS_IN_FILTER_TABLE must be defined!
 #elif (DS_PACKETS_IN_FILTER_TABLE < 1)
 #error DS_PACKETS_IN_FILTER_TABLE cannot be less than 1!
+#elif (DS_PACKETS_IN_FILTER_TABLE > 32768)
+#error DS_PACKETS_IN_FILTER_TABLE cannot be greater than 32768!
 #endif
 
 #ifndef DS_FILTERS_PER_PACKET
@@ -94,6 +96,14 @@
 #error DS_FILTERS_PER_PACKET cannot be greater than DS_DEST_FILE_CNT!
 #endif
 
+#ifndef DS_PREDICATES_PER_PACKET
+#error DS_PREDICATES_PER_PACKET must be defined!
+#elif (DS_PREDICATES_PER_PACKET < 1)
+#error DS_PREDICATES_PER_PACKET cannot be less than 1!
+#elif (DS_PREDICATES_PER_PACKET > 16)
+#error DS_PREDICATES_PER_PACKET cannot be greater than 16!
+#endif
+
 #ifndef DS_DESCRIPTOR_BUFSIZE
 #error DS_DESCRIPTOR_BUFSIZE must be defined!
 #elif (DS_DESCRIPTOR_BUFSIZE < 1)
@@ -190,6 +200,32 @@
 #error DS_FILE_HEADER_TYPE must be 0 or 1!
 #endif
 
+#ifndef DS_FILE_HEADER_MID_CNT
+#error DS_FILE_HEADER_MID_CNT must be defined!
+#elif (DS_FILE_HEADER_MID_CNT < 1)
+#error DS_FILE_HEADER_MID_CNT cannot be less than 1!
+#elif (DS_FILE_HEADER_MID_CNT > 256)
+#error DS_FILE_HEADER_MID_CNT cannot be greater than 256!
+#endif
+
+#ifndef DS_FILE_BLOOM_BITS
+#error DS_FILE_BLOOM_BITS must be defined!
+#elif (DS_FILE_BLOOM_BITS < 32)
+#error DS_FILE_BLOOM_BITS cannot be less than 32!
+#elif (DS_FILE_BLOOM_BITS > 4096)
+#error DS_FILE_BLOOM_BITS cannot be greater than 4096!
+#elif ((DS_FILE_BLOOM_BITS % 32) != 0)
+#error DS_FILE_BLOOM_BITS must be a multiple of 32!
+#endif
+
+#ifndef DS_FILE_BLOOM_HASH_CNT
+#error DS_FILE_BLOOM_HASH_CNT must be defined!
+#elif (DS_FILE_BLOOM_HASH_CNT < 1)
+#error DS_FILE_BLOOM_HASH_CNT cannot be less than 1!
+#elif (DS_FILE_BLOOM_HASH_CNT > 8)
+#error DS_FILE_BLOOM_HASH_CNT cannot be greater than 8!
+#endif
+
 #ifndef DS_MOVE_FILES
 #error DS_MOVE_FILES must be defined!
 #elif ((DS_MOVE_FILES != true) && (DS_MOVE_FILES != false))
@@ -204,4 +240,182 @@
 #error DS_PER_PACKET_PIPE_LIMIT cannot be greater than DS_APP_PIPE_DEPTH!
 #endif
 
+#ifndef DS_APP_PIPE_BATCH_LIMIT
+#error DS_APP_PIPE_BATCH_LIMIT must be defined!
+#elif (DS_APP_PIPE_BATCH_LIMIT < 1)
+#error DS_APP_PIPE_BATCH_LIMIT cannot be less than 1!
+#elif (DS_APP_PIPE_BATCH_LIMIT > DS_APP_PIPE_DEPTH)
+#error DS_APP_PIPE_BATCH_LIMIT cannot be greater than DS_APP_PIPE_DEPTH!
+#endif
+
+#ifndef DS_WRITER_TASK_NAME
+#error DS_WRITER_TASK_NAME must be defined!
+#endif
+
+#ifndef DS_WRITER_TASK_STACK_SIZE
+#error DS_WRITER_TASK_STACK_SIZE must be defined!
+#elif (DS_WRITER_TASK_STACK_SIZE < 1)
+#error DS_WRITER_TASK_STACK_SIZE cannot be less than 1!
+#endif
+
+#ifndef DS_WRITER_TASK_PRIORITY
+#error DS_WRITER_TASK_PRIORITY must be defined!
+#elif (DS_WRITER_TASK_PRIORITY < 1)
+#error DS_WRITER_TASK_PRIORITY cannot be less than 1!
+#elif (DS_WRITER_TASK_PRIORITY > 255)
+#error DS_WRITER_TASK_PRIORITY cannot be greater than 255!
+#endif
+
+#ifndef DS_WRITER_RING_SIZE
+#error DS_WRITER_RING_SIZE must be defined!
+#elif (DS_WRITER_RING_SIZE < 1)
+#error DS_WRITER_RING_SIZE cannot be less than 1!
+#elif ((DS_WRITER_RING_SIZE % 4) != 0)
+#error DS_WRITER_RING_SIZE must be a multiple of 4!
+#endif
+
+#ifndef DS_WRITER_DRAIN_TIMEOUT
+#error DS_WRITER_DRAIN_TIMEOUT must be defined!
+#elif (DS_WRITER_DRAIN_TIMEOUT < 1)
+#error DS_WRITER_DRAIN_TIMEOUT cannot be less than 1!
+#endif
+
+#ifndef DS_FINALIZE_TASK_NAME
+#error DS_FINALIZE_TASK_NAME must be defined!
+#endif
+
+#ifndef DS_FINALIZE_TASK_STACK_SIZE
+#error DS_FINALIZE_TASK_STACK_SIZE must be defined!
+#elif (DS_FINALIZE_TASK_STACK_SIZE < 1)
+#error DS_FINALIZE_TASK_STACK_SIZE cannot be less than 1!
+#endif
+
+#ifndef DS_FINALIZE_TASK_PRIORITY
+#error DS_FINALIZE_TASK_PRIORITY must be defined!
+#elif (DS_FINALIZE_TASK_PRIORITY < 1)
+#error DS_FINALIZE_TASK_PRIORITY cannot be less than 1!
+#elif (DS_FINALIZE_TASK_PRIORITY > 255)
+#error DS_FINALIZE_TASK_PRIORITY cannot be greater than 255!
+#endif
+
+#ifndef DS_FINALIZE_QUEUE_DEPTH
+#error DS_FINALIZE_QUEUE_DEPTH must be defined!
+#elif (DS_FINALIZE_QUEUE_DEPTH < (2 * DS_DEST_FILE_CNT))
+#error DS_FINALIZE_QUEUE_DEPTH cannot be less than 2 * DS_DEST_FILE_CNT!
+#endif
+
+#ifndef DS_WRITE_BUFFER_MAX_SIZE
+#error DS_WRITE_BUFFER_MAX_SIZE must be defined!
+#elif (DS_WRITE_BUFFER_MAX_SIZE < 1)
+#error DS_WRITE_BUFFER_MAX_SIZE cannot be less than 1!
+#elif ((DS_WRITE_BUFFER_MAX_SIZE % 4) != 0)
+#error DS_WRITE_BUFFER_MAX_SIZE must be a multiple of 4!
+#endif
+
+#ifndef DS_SCHED_TABLE_PERIOD
+#error DS_SCHED_TABLE_PERIOD must be defined!
+#elif (DS_SCHED_TABLE_PERIOD < 1)
+#error DS_SCHED_TABLE_PERIOD cannot be less than 1!
+#endif
+
+#ifndef DS_SCHED_FLUSH_PERIOD
+#error DS_SCHED_FLUSH_PERIOD must be defined!
+#elif (DS_SCHED_FLUSH_PERIOD < 1)
+#error DS_SCHED_FLUSH_PERIOD cannot be less than 1!
+#endif
+
+#ifndef DS_FILE_PREOPEN_PERCENT
+#error DS_FILE_PREOPEN_PERCENT must be defined!
+#elif (DS_FILE_PREOPEN_PERCENT < 0)
+#error DS_FILE_PREOPEN_PERCENT cannot be less than 0!
+#elif (DS_FILE_PREOPEN_PERCENT > 100)
+#error DS_FILE_PREOPEN_PERCENT cannot be greater than 100!
+#endif
+
+#ifndef DS_FILE_PREALLOCATE
+#error DS_FILE_PREALLOCATE must be defined!
+#elif ((DS_FILE_PREALLOCATE != true) && (DS_FILE_PREALLOCATE != false))
+#error DS_FILE_PREALLOCATE must be true or false!
+#endif
+
+#ifndef DS_FILE_SYNC
+#error DS_FILE_SYNC must be defined!
+#elif ((DS_FILE_SYNC != true) && (DS_FILE_SYNC != false))
+#error DS_FILE_SYNC must be true or false!
+#endif
+
+#ifndef DS_FILE_DIRECT_IO
+#error DS_FILE_DIRECT_IO must be defined!
+#elif ((DS_FILE_DIRECT_IO != true) && (DS_FILE_DIRECT_IO != false))
+#error DS_FILE_DIRECT_IO must be true or false!
+#endif
+
+#ifndef DS_FILE_POSITIONAL_WRITE
+#error DS_FILE_POSITIONAL_WRITE must be defined!
+#elif ((DS_FILE_POSITIONAL_WRITE != true) && (DS_FILE_POSITIONAL_WRITE != false))
+#error DS_FILE_POSITIONAL_WRITE must be true or false!
+#endif
+
+#ifndef DS_DIRECT_IO_BLOCK_SIZE
+#error DS_DIRECT_IO_BLOCK_SIZE must be defined!
+#elif (DS_DIRECT_IO_BLOCK_SIZE < 512)
+#error DS_DIRECT_IO_BLOCK_SIZE cannot be less than 512!
+#elif ((DS_DIRECT_IO_BLOCK_SIZE & (DS_DIRECT_IO_BLOCK_SIZE - 1)) != 0)
+#error DS_DIRECT_IO_BLOCK_SIZE must be a power of two!
+#elif ((DS_FILE_DIRECT_IO == true) && ((DS_WRITE_BUFFER_MAX_SIZE % DS_DIRECT_IO_BLOCK_SIZE) != 0))
+#error DS_WRITE_BUFFER_MAX_SIZE must be a multiple of DS_DIRECT_IO_BLOCK_SIZE!
+#endif
+
+#ifndef DS_FILE_INDEX_MAX_CNT
+#error DS_FILE_INDEX_MAX_CNT must be defined!
+#elif (DS_FILE_INDEX_MAX_CNT < 2)
+#error DS_FILE_INDEX_MAX_CNT cannot be less than 2!
+#elif (DS_FILE_INDEX_MAX_CNT > 1024)
+#error DS_FILE_INDEX_MAX_CNT cannot be greater than 1024!
+#endif
+
+#ifndef DS_FILE_COMPRESSION
+#error DS_FILE_COMPRESSION must be defined!
+#elif ((DS_FILE_COMPRESSION != true) && (DS_FILE_COMPRESSION != false))
+#error DS_FILE_COMPRESSION must be true or false!
+#endif
+
+#ifndef DS_DELTA_MID_CNT
+#error DS_DELTA_MID_CNT must be defined!
+#elif (DS_DELTA_MID_CNT < 1)
+#error DS_DELTA_MID_CNT cannot be less than 1!
+#elif (DS_DELTA_MID_CNT > 32)
+#error DS_DELTA_MID_CNT cannot be greater than 32!
+#endif
+
+#ifndef DS_DELTA_MAX_PKT_SIZE
+#error DS_DELTA_MAX_PKT_SIZE must be defined!
+#elif (DS_DELTA_MAX_PKT_SIZE < 16)
+#error DS_DELTA_MAX_PKT_SIZE cannot be less than 16!
+#elif (DS_DELTA_MAX_PKT_SIZE > 65535)
+#error DS_DELTA_MAX_PKT_SIZE cannot be greater than 65535!
+#endif
+
+#ifndef DS_SUPERFRAME_MAX_SIZE
+#error DS_SUPERFRAME_MAX_SIZE must be defined!
+#elif (DS_SUPERFRAME_MAX_SIZE < 64)
+#error DS_SUPERFRAME_MAX_SIZE cannot be less than 64!
+#elif (DS_SUPERFRAME_MAX_SIZE > 65535)
+#error DS_SUPERFRAME_MAX_SIZE cannot be greater than 65535!
+#endif
+
+#ifndef DS_SCHED_CDS_PERIOD
+#error DS_SCHED_CDS_PERIOD must be defined!
+#elif (DS_SCHED_CDS_PERIOD < 1)
+#error DS_SCHED_CDS_PERIOD cannot be less than 1!
+#endif
+
+#ifndef DS_CDS_SEQ_RESERVE
+#error DS_CDS_SEQ_RESERVE must be defined!
+#elif (DS_CDS_SEQ_RESERVE < 0)
+#error DS_CDS_SEQ_RESERVE cannot be less than 0!
+#elif (DS_CDS_SEQ_RESERVE >= DS_MAX_SEQUENCE_COUNT)
+#error DS_CDS_SEQ_RESERVE must be less than DS_MAX_SEQUENCE_COUNT!
+#endif
+
 #endif
@@ -0,0 +1,470 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,917-1, and identified as “CFS Data Storage
+ * (DS) application version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  CFS Data Storage (DS) storage writer child task functions
+ */
+
+#include "cfe.h"
+
+#include "ds_platform_cfg.h"
+#include "ds_verify.h"
+
+#include "ds_appdefs.h"
+
+#include "ds_app.h"
+#include "ds_file.h"
+#include "ds_writer.h"
+#include "ds_events.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Storage writer initialization                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_WriterInit(void)
+{
+    int32 Result = CFE_SUCCESS;
+
+    DS_AppData.WriterTaskActive = false;
+
+    /*
+    ** Create semaphore used to signal packets added to the ring...
+    */
+    Result = OS_CountSemCreate(&DS_AppData.WriterSemId, DS_WRITER_SEM_NAME, 0, 0);
+
+    if (Result != OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(DS_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Unable to create writer semaphore, err = 0x%08X", (unsigned int)Result);
+    }
+
+    /*
+    ** Create mutex used to serialize destination file access...
+    */
+    if (Result == OS_SUCCESS)
+    {
+        Result = OS_MutSemCreate(&DS_AppData.WriterMutexId, DS_WRITER_MUTEX_NAME, 0);
+
+        if (Result != OS_SUCCESS)
+        {
+            CFE_EVS_SendEvent(DS_INIT_ERR_EID, CFE_EVS_EventType_ERROR, "Unable to create writer mutex, err = 0x%08X",
+                              (unsigned int)Result);
+        }
+    }
+
+    /*
+    ** Create mutex used to publish writer counters to housekeeping...
+    */
+    if (Result == OS_SUCCESS)
+    {
+        Result = OS_MutSemCreate(&DS_AppData.WriterHkMutexId, DS_WRITER_HK_MUTEX_NAME, 0);
+
+        if (Result != OS_SUCCESS)
+        {
+            CFE_EVS_SendEvent(DS_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Unable to create writer HK mutex, err = 0x%08X", (unsigned int)Result);
+        }
+        else
+        {
+            DS_WriterPublishHk();
+        }
+    }
+
+    /*
+    ** Create storage writer child task...
+    */
+    if (Result == OS_SUCCESS)
+    {
+        Result = CFE_ES_CreateChildTask(&DS_AppData.WriterTaskId, DS_WRITER_TASK_NAME, DS_WriterTask,
+                                        CFE_ES_TASK_STACK_ALLOCATE, DS_WRITER_TASK_STACK_SIZE,
+                                        DS_WRITER_TASK_PRIORITY, 0);
+
+        if (Result != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(DS_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Unable to create writer child task, err = 0x%08X", (unsigned int)Result);
+        }
+        else
+        {
+            DS_AppData.WriterTaskActive = true;
+        }
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Storage writer child task entry point                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_WriterTask(void)
+{
+    int32 Result = OS_SUCCESS;
+
+    while (Result == OS_SUCCESS)
+    {
+        /*
+        ** One semaphore count is given for each record added to the ring...
+        */
+        Result = OS_CountSemTake(DS_AppData.WriterSemId);
+
+        if (Result == OS_SUCCESS)
+        {
+            DS_WriterLock();
+            DS_WriterProcessNext();
+            DS_WriterUnlock();
+        }
+    }
+
+    /*
+    ** Revert to running records from the DS main task - the main task
+    **   takes the lock before it touches destination files...
+    */
+    DS_WriterLock();
+    DS_AppData.WriterTaskActive = false;
+    DS_WriterUnlock();
+
+    CFE_EVS_SendEvent(DS_WRITER_TASK_ERR_EID, CFE_EVS_EventType_ERROR, "Storage writer task terminating, err = 0x%08X",
+                      (unsigned int)Result);
+
+    CFE_ES_ExitChildTask();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Add a record to the storage writer ring (DS main task only)     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_WriterEnqueue(const DS_WriterRecord_t *Record, const CFE_SB_Buffer_t *BufPtr)
+{
+    DS_WriterRing_t *  Ring         = &DS_AppData.WriterRing;
+    DS_WriterRecord_t *Header       = NULL;
+    CFE_MSG_Size_t     PacketLength = 0;
+    uint32             Head         = Ring->Head;
+    uint32             Tail         = DS_WRITER_LOAD_INDEX(Ring->Tail);
+    uint32             UsedBlocks   = 0;
+    uint32             NeedBlocks   = 0;
+    uint32             SkipBlocks   = 0;
+    bool               Result       = false;
+
+    if (BufPtr != NULL)
+    {
+        CFE_MSG_GetSize(&BufPtr->Msg, &PacketLength);
+    }
+
+    NeedBlocks = DS_WRITER_HDR_BLOCKS + DS_WRITER_BLOCKS(PacketLength);
+    UsedBlocks = (Head >= Tail) ? (Head - Tail) : (DS_WRITER_RING_BLOCKS - Tail + Head);
+
+    /*
+    ** Records are never split - skip the rest of the ring if the record won't fit...
+    */
+    if (NeedBlocks > (DS_WRITER_RING_BLOCKS - Head))
+    {
+        SkipBlocks = DS_WRITER_RING_BLOCKS - Head;
+    }
+
+    if ((UsedBlocks + SkipBlocks + NeedBlocks) >= DS_WRITER_RING_BLOCKS)
+    {
+        /*
+        ** Ring is full (or packet is larger than the ring)...
+        */
+        Ring->DropCounter++;
+    }
+    else
+    {
+        if (SkipBlocks > 0)
+        {
+            /*
+            ** Mark the unused end of the ring (if there is room for a header)...
+            */
+            if (SkipBlocks >= DS_WRITER_HDR_BLOCKS)
+            {
+                Header       = (DS_WriterRecord_t *)&Ring->Block[Head];
+                Header->Type = DS_WRITER_WRAP;
+            }
+
+            Head = 0;
+        }
+
+        Header         = (DS_WriterRecord_t *)&Ring->Block[Head];
+        *Header        = *Record;
+        Header->Length = PacketLength;
+
+        if (BufPtr != NULL)
+        {
+            memcpy(&Ring->Block[Head + DS_WRITER_HDR_BLOCKS], BufPtr, PacketLength);
+        }
+
+        Head += NeedBlocks;
+        if (Head >= DS_WRITER_RING_BLOCKS)
+        {
+            Head = 0;
+        }
+
+        UsedBlocks += SkipBlocks + NeedBlocks;
+        if (UsedBlocks > Ring->PeakBlocks)
+        {
+            Ring->PeakBlocks = UsedBlocks;
+        }
+
+        /*
+        ** Publish the record (release - the contents are visible before
+        **   the new head), then signal the consumer...
+        */
+        DS_WRITER_STORE_INDEX(Ring->Head, Head);
+        OS_CountSemGive(DS_AppData.WriterSemId);
+
+        Result = true;
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Submit a record (DS main task only)                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_WriterSubmit(const DS_WriterRecord_t *Record, const CFE_SB_Buffer_t *BufPtr)
+{
+    DS_WriterRing_t *Ring   = &DS_AppData.WriterRing;
+    bool             Result = true;
+
+    if (DS_AppData.WriterTaskActive)
+    {
+        /*
+        ** Hand the record to the storage writer child task...
+        */
+        Result = DS_WriterEnqueue(Record, BufPtr);
+    }
+    else
+    {
+        /*
+        ** No storage writer - run records left in the ring (in order) and then this one...
+        */
+        DS_WriterLock();
+
+        while (DS_WRITER_LOAD_INDEX(Ring->Tail) != Ring->Head)
+        {
+            DS_WriterProcessNext();
+        }
+
+        DS_WriterProcess(Record, BufPtr);
+
+        DS_WriterUnlock();
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Run a record (writer lock held)                                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_WriterProcess(const DS_WriterRecord_t *Record, const CFE_SB_Buffer_t *BufPtr)
+{
+    uint32 FileIndex = 0;
+    uint32 i         = 0;
+
+    if (Record->Type == DS_WRITER_PACKET)
+    {
+        /*
+        ** Table may have been updated since the packet was filtered...
+        */
+        if (DS_AppData.DestFileTblPtr != (DS_DestFileTable_t *)NULL)
+        {
+            for (i = 0; i < Record->DestCount; i++)
+            {
+                FileIndex = Record->DestIndex[i];
+
+                /*
+                ** Destination may have been disabled since the packet was filtered...
+                */
+                if (DS_AppData.FileStatus[FileIndex].FileState == DS_ENABLED)
+                {
+                    DS_FileSetupWrite(FileIndex, BufPtr);
+                }
+            }
+        }
+    }
+    else if (Record->Type == DS_WRITER_COMMAND)
+    {
+        DS_AppProcessFileCmd(BufPtr);
+        DS_WriterPublishHk();
+    }
+    else if (Record->Type == DS_WRITER_WORK)
+    {
+        DS_AppProcessWork(Record);
+        DS_WriterPublishHk();
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Run the oldest record in the ring (writer lock held)            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_WriterProcessNext(void)
+{
+    DS_WriterRing_t *  Ring   = &DS_AppData.WriterRing;
+    DS_WriterRecord_t *Record = NULL;
+    uint32             Tail   = Ring->Tail;
+
+    if (Tail != DS_WRITER_LOAD_INDEX(Ring->Head))
+    {
+        /*
+        ** Follow the producer back to the start of the ring...
+        */
+        if ((DS_WRITER_RING_BLOCKS - Tail) < DS_WRITER_HDR_BLOCKS)
+        {
+            Tail = 0;
+        }
+        else if (((DS_WriterRecord_t *)&Ring->Block[Tail])->Type == DS_WRITER_WRAP)
+        {
+            Tail = 0;
+        }
+
+        Record = (DS_WriterRecord_t *)&Ring->Block[Tail];
+
+        DS_WriterProcess(Record, (Record->Length != 0) ? &Ring->Block[Tail + DS_WRITER_HDR_BLOCKS] : NULL);
+
+        Tail += DS_WRITER_HDR_BLOCKS + DS_WRITER_BLOCKS(Record->Length);
+        if (Tail >= DS_WRITER_RING_BLOCKS)
+        {
+            Tail = 0;
+        }
+
+        /*
+        ** Release the record to the producer (release - the record has
+        **   been read before its blocks can be reused)...
+        */
+        DS_WRITER_STORE_INDEX(Ring->Tail, Tail);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Empty the storage writer ring (DS main task only)               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_WriterDrain(void)
+{
+    DS_WriterRing_t *Ring   = &DS_AppData.WriterRing;
+    uint32           Waited = 0;
+
+    /*
+    ** Give the storage writer child task time to empty the ring...
+    */
+    while (DS_AppData.WriterTaskActive && (DS_WRITER_LOAD_INDEX(Ring->Tail) != Ring->Head) &&
+           (Waited < DS_WRITER_DRAIN_TIMEOUT))
+    {
+        OS_TaskDelay(DS_WRITER_DRAIN_POLL);
+        Waited += DS_WRITER_DRAIN_POLL;
+    }
+
+    /*
+    ** Records left by a storage writer that has stopped are run here...
+    */
+    if (!DS_AppData.WriterTaskActive)
+    {
+        DS_WriterLock();
+
+        while (DS_WRITER_LOAD_INDEX(Ring->Tail) != Ring->Head)
+        {
+            DS_WriterProcessNext();
+        }
+
+        DS_WriterUnlock();
+    }
+
+    return (DS_WRITER_LOAD_INDEX(Ring->Tail) == Ring->Head);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get current ring occupancy                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_WriterRingBytesUsed(void)
+{
+    uint32 Head       = DS_WRITER_LOAD_INDEX(DS_AppData.WriterRing.Head);
+    uint32 Tail       = DS_WRITER_LOAD_INDEX(DS_AppData.WriterRing.Tail);
+    uint32 UsedBlocks = 0;
+
+    UsedBlocks = (Head >= Tail) ? (Head - Tail) : (DS_WRITER_RING_BLOCKS - Tail + Head);
+
+    return UsedBlocks * DS_WRITER_BLOCK_SIZE;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Publish storage writer housekeeping snapshot                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_WriterPublishHk(void)
+{
+    DS_WriterHk_t *Hk = &DS_AppData.WriterHk;
+
+    OS_MutSemTake(DS_AppData.WriterHkMutexId);
+
+    Hk->FileCmdAcceptedCounter = DS_AppData.FileCmdAcceptedCounter;
+    Hk->FileCmdRejectedCounter = DS_AppData.FileCmdRejectedCounter;
+    Hk->DestTblLoadCounter     = DS_AppData.DestTblLoadCounter;
+    Hk->DestTblErrCounter      = DS_AppData.DestTblErrCounter;
+    Hk->FileWriteCounter       = DS_AppData.FileWriteCounter;
+    Hk->FileWriteErrCounter    = DS_AppData.FileWriteErrCounter;
+    Hk->FlushCounter           = DS_AppData.FlushCounter;
+    Hk->FlushByteCounter       = DS_AppData.FlushByteCounter;
+    Hk->DirectFlushCounter     = DS_AppData.DirectFlushCounter;
+    Hk->RotationCounter        = DS_AppData.RotationCounter;
+    Hk->PreopenHitCounter      = DS_AppData.PreopenHitCounter;
+    Hk->LastRotationTime       = DS_AppData.LastRotationTime;
+    Hk->MaxRotationTime        = DS_AppData.MaxRotationTime;
+
+    OS_MutSemGive(DS_AppData.WriterHkMutexId);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Lock/unlock destination file state                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_WriterLock(void)
+{
+    OS_MutSemTake(DS_AppData.WriterMutexId);
+}
+
+void DS_WriterUnlock(void)
+{
+    OS_MutSemGive(DS_AppData.WriterMutexId);
+}
@@ -0,0 +1,327 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,917-1, and identified as “CFS Data Storage
+ * (DS) application version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  CFS Data Storage (DS) storage writer child task header file
+ */
+#ifndef DS_WRITER_H
+#define DS_WRITER_H
+
+#include "cfe.h"
+
+#include "ds_platform_cfg.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* DS storage writer ring structures and definitions               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define DS_WRITER_SEM_NAME   "DS_WRITER_SEM"
+#define DS_WRITER_MUTEX_NAME "DS_WRITER_MUT"
+#define DS_WRITER_HK_MUTEX_NAME "DS_WRITER_HK"
+
+#define DS_WRITER_DRAIN_POLL 10 /**< \brief Ring drain check interval at exit (milliseconds) */
+
+/**
+ * \name Storage writer ring record types
+ * \{
+ */
+#define DS_WRITER_WRAP    0 /**< \brief Unused region at the end of the ring */
+#define DS_WRITER_PACKET  1 /**< \brief Packet to write to its destination files */
+#define DS_WRITER_COMMAND 2 /**< \brief Command that changes destination files */
+#define DS_WRITER_WORK    3 /**< \brief Scheduled maintenance */
+/**\}*/
+
+/**
+ * \name Storage writer maintenance work
+ * \{
+ */
+#define DS_WRITER_WORK_AGE       0x0001 /**< \brief Charge file ages with AgeSeconds */
+#define DS_WRITER_WORK_DEST_TBL  0x0002 /**< \brief Check for destination file table updates */
+#define DS_WRITER_WORK_FLUSH     0x0004 /**< \brief Flush write buffers */
+#define DS_WRITER_WORK_CDS       0x0008 /**< \brief Commit CDS changes */
+#define DS_WRITER_WORK_APP_STATE 0x0010 /**< \brief Save a new application state in the CDS */
+#define DS_WRITER_WORK_RATE      0x0020 /**< \brief Compute file growth rates over RateMillisecs */
+#define DS_WRITER_WORK_RESET     0x0040 /**< \brief Reset counters owned by the storage writer */
+/**\}*/
+
+/**
+ * \brief Storage writer ring record header
+ *
+ * Each record in the ring is a header followed by a copy of the packet
+ * or command (maintenance records have no data).  A wrap record marks
+ * an unused region at the end of the ring; the consumer continues at
+ * the start of the ring.
+ */
+typedef struct
+{
+    uint32 Length;                           /**< \brief Packet or command length in bytes */
+    uint16 Type;                             /**< \brief Record type, see #DS_WRITER_PACKET */
+    uint16 DestCount;                        /**< \brief Number of destination files (packets) */
+    uint16 DestIndex[DS_FILTERS_PER_PACKET]; /**< \brief Destination file table indices (packets) */
+    uint32 Work;                             /**< \brief Maintenance to run, see #DS_WRITER_WORK_AGE */
+    uint32 AgeSeconds;                       /**< \brief Seconds to charge to open files */
+    uint32 RateMillisecs;                    /**< \brief Time since the previous file growth rate */
+} DS_WriterRecord_t;
+
+/**
+ * \brief Storage writer ring geometry
+ *
+ * The ring is an array of Software Bus buffer sized blocks so that every
+ * packet copy is correctly aligned for access via #CFE_SB_Buffer_t.
+ */
+#define DS_WRITER_BLOCK_SIZE  sizeof(CFE_SB_Buffer_t)
+#define DS_WRITER_RING_BLOCKS (DS_WRITER_RING_SIZE / DS_WRITER_BLOCK_SIZE)
+#define DS_WRITER_BLOCKS(x)   (((x) + DS_WRITER_BLOCK_SIZE - 1) / DS_WRITER_BLOCK_SIZE)
+#define DS_WRITER_HDR_BLOCKS  DS_WRITER_BLOCKS(sizeof(DS_WriterRecord_t))
+
+/**
+ * \brief Ring index access with acquire/release ordering
+ *
+ * A release store of Head makes the record contents visible before the
+ * new Head, and a release store of Tail finishes the consumer's reads of
+ * a record before the producer may reuse its blocks.  The matching
+ * acquire loads are made by the other task before it touches the ring.
+ */
+#define DS_WRITER_LOAD_INDEX(Index)         __atomic_load_n(&(Index), __ATOMIC_ACQUIRE)
+#define DS_WRITER_STORE_INDEX(Index, Value) __atomic_store_n(&(Index), (Value), __ATOMIC_RELEASE)
+
+/**
+ * \brief Storage writer single-producer/single-consumer ring
+ *
+ * Head is only written by the DS main task (producer) and Tail is only
+ * written by the storage writer child task (consumer).  One block is
+ * always left unused so that (Head == Tail) means the ring is empty.
+ * Head and Tail are only accessed with #DS_WRITER_LOAD_INDEX and
+ * #DS_WRITER_STORE_INDEX.
+ */
+typedef struct
+{
+    uint32 Head; /**< \brief Next block to be written by the producer */
+    uint32 Tail; /**< \brief Next block to be read by the consumer */
+
+    uint32 PeakBlocks;  /**< \brief Ring occupancy high-water mark (blocks) */
+    uint32 DropCounter; /**< \brief Count of records discarded because the ring was full */
+
+    CFE_SB_Buffer_t Block[DS_WRITER_RING_BLOCKS]; /**< \brief Ring storage */
+} DS_WriterRing_t;
+
+/**
+ * \brief Storage writer housekeeping snapshot
+ *
+ * Copies of the counters that only the storage writer updates, published
+ * by the writer after each command and maintenance record so the DS main
+ * task can report them without waiting on destination file I/O.
+ */
+typedef struct
+{
+    uint8  FileCmdAcceptedCounter; /**< \brief Count of valid commands run by the storage writer */
+    uint8  FileCmdRejectedCounter; /**< \brief Count of invalid commands run by the storage writer */
+    uint8  DestTblLoadCounter;     /**< \brief Count of destination file table loads */
+    uint8  DestTblErrCounter;      /**< \brief Count of failed attempts to get table data pointer */
+    uint16 FileWriteCounter;       /**< \brief Count of good destination file writes */
+    uint16 FileWriteErrCounter;    /**< \brief Count of bad destination file writes */
+    uint32 FlushCounter;           /**< \brief Count of write buffer flushes */
+    uint32 FlushByteCounter;       /**< \brief Count of bytes written by write buffer flushes */
+    uint32 DirectFlushCounter;     /**< \brief Count of write buffer flushes written with direct I/O */
+    uint32 RotationCounter;        /**< \brief Count of new destination files started for a packet */
+    uint32 PreopenHitCounter;      /**< \brief Count of new destination files that were pre-opened */
+    uint32 LastRotationTime;       /**< \brief Time to start the most recent new file (microseconds) */
+    uint32 MaxRotationTime;        /**< \brief Longest time to start a new file (microseconds) */
+} DS_WriterHk_t;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Prototypes for functions defined in ds_writer.c                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Storage writer initialization
+ *
+ *  \par Description
+ *       Creates the ring semaphore, the file access mutex, the
+ *       housekeeping snapshot mutex and the storage writer child task.  Once the child task has been
+ *       created, packets that pass the filter test, destination file
+ *       commands and maintenance are handed to the child task rather
+ *       than run by the DS main task.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 DS_WriterInit(void);
+
+/**
+ *  \brief Storage writer child task entry point
+ *
+ *  \par Description
+ *       Waits for the DS main task to signal that a record has been
+ *       added to the ring, then runs the record with the writer lock
+ *       held.  If the wait fails, the child task exits and records
+ *       revert to the DS main task.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ */
+void DS_WriterTask(void);
+
+/**
+ *  \brief Hand a record to the storage writer
+ *
+ *  \par Description
+ *       Copies the record header and the message (if any) into the
+ *       ring and signals the storage writer child task.  Records that
+ *       do not fit in the ring are discarded and counted.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must only be called from the DS main task.
+ *
+ *  \param[in] Record Record header (the length is set from the message)
+ *  \param[in] BufPtr Software Bus message pointer, NULL for maintenance
+ *
+ *  \return Record was added to the ring
+ */
+bool DS_WriterEnqueue(const DS_WriterRecord_t *Record, const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Submit a record
+ *
+ *  \par Description
+ *       Hands the record to the storage writer child task, or runs it
+ *       with the writer lock held (after any records left in the ring)
+ *       when the child task is not running.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must only be called from the DS main task.
+ *
+ *  \param[in] Record Record header
+ *  \param[in] BufPtr Software Bus message pointer, NULL for maintenance
+ *
+ *  \return Record was run or added to the ring
+ */
+bool DS_WriterSubmit(const DS_WriterRecord_t *Record, const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Run a record
+ *
+ *  \par Description
+ *       Writes a packet to each of its (still enabled) destination
+ *       files, runs a destination file command or runs maintenance.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must be called with the writer lock held.
+ *
+ *  \param[in] Record Record header
+ *  \param[in] BufPtr Software Bus message pointer, NULL for maintenance
+ */
+void DS_WriterProcess(const DS_WriterRecord_t *Record, const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Run the oldest record in the ring
+ *
+ *  \par Description
+ *       Removes the oldest record from the ring and runs it.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must be called with the writer lock held, from the storage
+ *       writer child task or from the DS main task once the child
+ *       task has stopped.
+ */
+void DS_WriterProcessNext(void);
+
+/**
+ *  \brief Empty the ring
+ *
+ *  \par Description
+ *       Waits up to #DS_WRITER_DRAIN_TIMEOUT for the storage writer
+ *       child task to run the records in the ring.  Records left by a
+ *       child task that has stopped are run by the caller.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must only be called from the DS main task, after the last
+ *       record has been submitted.
+ *
+ *  \return Ring is empty
+ */
+bool DS_WriterDrain(void);
+
+/**
+ *  \brief Get current ring occupancy
+ *
+ *  \par Description
+ *       Returns the number of ring bytes currently in use.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \return Ring occupancy in bytes
+ */
+uint32 DS_WriterRingBytesUsed(void);
+
+/**
+ *  \brief Publish storage writer housekeeping snapshot
+ *
+ *  \par Description
+ *       Copies the counters owned by the storage writer into the
+ *       housekeeping snapshot, under the snapshot mutex.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by whichever task runs ring records (writer lock held),
+ *       or during initialization before the child task is created.
+ *
+ *  \sa #DS_AppProcessHK
+ */
+void DS_WriterPublishHk(void);
+
+/**
+ *  \brief Lock destination file state
+ *
+ *  \par Description
+ *       Takes the mutex held by whichever task runs ring records.
+ *       The storage writer child task holds it for each record; the
+ *       DS main task only takes it once the child task has stopped
+ *       (or the ring has been drained at exit), so the DS main task
+ *       never waits on destination file I/O.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \sa #DS_WriterUnlock
+ */
+void DS_WriterLock(void);
+
+/**
+ *  \brief Unlock destination file state
+ *
+ *  \par Description
+ *       Gives the mutex taken by #DS_WriterLock.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \sa #DS_WriterLock
+ */
+void DS_WriterUnlock(void);
+
+#endif
@@ -69,248 +69,424 @@
 ** Sample Destination File Table Data
 */
 DS_DestFileTable_t DS_DestFileTable = {
-    /* .Descriptor = */ "Sample File Table Data",
-    /* .File       = */
+    /* .Descriptor     = */ "Sample File Table Data",
+    /* .File           = */
     {
         /* File Index 00 -- event packets only */
         {
 #if (DS_MOVE_FILES == true)
-            /* .Movename      = */ DS_EMPTY_STRING,
+            /* .Movename       = */ DS_EMPTY_STRING,
 #endif
-            /* .Pathname      = */ "set_by_cmd_b4_enable",
-            /* .Basename      = */ "events",
-            /* .Extension     = */ ".dat",
+            /* .Pathname       = */ "set_by_cmd_b4_enable",
+            /* .Basename       = */ "events",
+            /* .Extension      = */ ".dat",
 
-            /* .FileNameType  = */ DS_BY_COUNT,
-            /* .EnableState   = */ DS_DISABLED,
-            /* .MaxFileSize   = */ (1024 * 32), /* 32 K-bytes */
-            /* .MaxFileAge    = */ (60 * 45),   /* 45 minutes */
-            /* .SequenceCount = */ 1000,
+            /* .FileNameType   = */ DS_BY_COUNT,
+            /* .EnableState    = */ DS_DISABLED,
+            /* .MaxFileSize    = */ (1024 * 32), /* 32 K-bytes */
+            /* .MaxFileAge     = */ (60 * 45),   /* 45 minutes */
+            /* .SequenceCount  = */ 1000,
+            /* .BufferSize     = */ 0,
+            /* .Preallocate    = */ DS_DISABLED,
+            /* .SyncPolicy     = */ DS_SYNC_NONE,
+            /* .SyncInterval   = */ 0,
+            /* .DirectIO       = */ DS_DISABLED,
+            /* .IndexSeconds   = */ 0,
+            /* .IndexBytes     = */ 0,
+            /* .Codec          = */ DS_CODEC_NONE,
+            /* .DeltaKeyframe  = */ 0,
+            /* .SuperframeSize = */ 0,
+            /* .SuperframeAge  = */ 0,
         },
         /* File Index 01 -- application housekeeping packets */
         {
 #if (DS_MOVE_FILES == true)
-            /* .Movename      = */ DS_EMPTY_STRING,
+            /* .Movename       = */ DS_EMPTY_STRING,
 #endif
-            /* .Pathname      = */ "set_by_cmd_b4_enable",
-            /* .Basename      = */ "app",
-            /* .Extension     = */ ".hk",
+            /* .Pathname       = */ "set_by_cmd_b4_enable",
+            /* .Basename       = */ "app",
+            /* .Extension      = */ ".hk",
 
-            /* .FileNameType  = */ DS_BY_TIME,
-            /* .EnableState   = */ DS_DISABLED,
-            /* .MaxFileSize   = */ (1024 * 1024 * 2), /* 2 M-bytes */
-            /* .MaxFileAge    = */ (60 * 60 * 2),     /* 2 hours */
-            /* .SequenceCount = */ DS_UNUSED,
+            /* .FileNameType   = */ DS_BY_TIME,
+            /* .EnableState    = */ DS_DISABLED,
+            /* .MaxFileSize    = */ (1024 * 1024 * 2), /* 2 M-bytes */
+            /* .MaxFileAge     = */ (60 * 60 * 2),     /* 2 hours */
+            /* .SequenceCount  = */ DS_UNUSED,
+            /* .BufferSize     = */ 0,
+            /* .Preallocate    = */ DS_DISABLED,
+            /* .SyncPolicy     = */ DS_SYNC_NONE,
+            /* .SyncInterval   = */ 0,
+            /* .DirectIO       = */ DS_DISABLED,
+            /* .IndexSeconds   = */ 0,
+            /* .IndexBytes     = */ 0,
+            /* .Codec          = */ DS_CODEC_NONE,
+            /* .DeltaKeyframe  = */ 0,
+            /* .SuperframeSize = */ 0,
+            /* .SuperframeAge  = */ 0,
         },
         /* File Index 02 -- application telemetry packets */
         {
 #if (DS_MOVE_FILES == true)
-            /* .Movename      = */ DS_EMPTY_STRING,
+            /* .Movename       = */ DS_EMPTY_STRING,
 #endif
-            /* .Pathname      = */ "set_by_cmd_b4_enable",
-            /* .Basename      = */ "app",
-            /* .Extension     = */ ".tlm",
+            /* .Pathname       = */ "set_by_cmd_b4_enable",
+            /* .Basename       = */ "app",
+            /* .Extension      = */ ".tlm",
 
-            /* .FileNameType  = */ DS_BY_COUNT,
-            /* .EnableState   = */ DS_DISABLED,
-            /* .MaxFileSize   = */ (1024 * 1024 * 1024 * 1), /* 1 G-byte */
-            /* .MaxFileAge    = */ (60 * 60 * 2),            /* 2 hours */
-            /* .SequenceCount = */ 2000,
+            /* .FileNameType   = */ DS_BY_COUNT,
+            /* .EnableState    = */ DS_DISABLED,
+            /* .MaxFileSize    = */ (1024 * 1024 * 1024 * 1), /* 1 G-byte */
+            /* .MaxFileAge     = */ (60 * 60 * 2),            /* 2 hours */
+            /* .SequenceCount  = */ 2000,
+            /* .BufferSize     = */ 0,
+            /* .Preallocate    = */ DS_DISABLED,
+            /* .SyncPolicy     = */ DS_SYNC_NONE,
+            /* .SyncInterval   = */ 0,
+            /* .DirectIO       = */ DS_DISABLED,
+            /* .IndexSeconds   = */ 0,
+            /* .IndexBytes     = */ 0,
+            /* .Codec          = */ DS_CODEC_NONE,
+            /* .DeltaKeyframe  = */ 0,
+            /* .SuperframeSize = */ 0,
+            /* .SuperframeAge  = */ 0,
         },
         /* File Index 03 -- hardware telemetry packets */
         {
 #if (DS_MOVE_FILES == true)
-            /* .Movename      = */ DS_EMPTY_STRING,
+            /* .Movename       = */ DS_EMPTY_STRING,
 #endif
-            /* .Pathname      = */ "set_by_cmd_b4_enable",
-            /* .Basename      = */ "hw",
-            /* .Extension     = */ "tlm",
+            /* .Pathname       = */ "set_by_cmd_b4_enable",
+            /* .Basename       = */ "hw",
+            /* .Extension      = */ "tlm",
 
-            /* .FileNameType  = */ DS_BY_COUNT,
-            /* .EnableState   = */ DS_DISABLED,
-            /* .MaxFileSize   = */ (1024 * 1024 * 2), /* 2 M-bytes */
-            /* .MaxFileAge    = */ (60 * 60 * 2),     /* 2 hours */
-            /* .SequenceCount = */ 3000,
+            /* .FileNameType   = */ DS_BY_COUNT,
+            /* .EnableState    = */ DS_DISABLED,
+            /* .MaxFileSize    = */ (1024 * 1024 * 2), /* 2 M-bytes */
+            /* .MaxFileAge     = */ (60 * 60 * 2),     /* 2 hours */
+            /* .SequenceCount  = */ 3000,
+            /* .BufferSize     = */ 0,
+            /* .Preallocate    = */ DS_DISABLED,
+            /* .SyncPolicy     = */ DS_SYNC_NONE,
+            /* .SyncInterval   = */ 0,
+            /* .DirectIO       = */ DS_DISABLED,
+            /* .IndexSeconds   = */ 0,
+            /* .IndexBytes     = */ 0,
+            /* .Codec          = */ DS_CODEC_NONE,
+            /* .DeltaKeyframe  = */ 0,
+            /* .SuperframeSize = */ 0,
+            /* .SuperframeAge  = */ 0,
         },
         /* File Index 04 -- cFE housekeeping packets */
         {
 #if (DS_MOVE_FILES == true)
-            /* .Movename      = */ DS_EMPTY_STRING,
+            /* .Movename       = */ DS_EMPTY_STRING,
 #endif
-            /* .Pathname      = */ "set_by_cmd_b4_enable",
-            /* .Basename      = */ "cfe",
-            /* .Extension     = */ "hk",
+            /* .Pathname       = */ "set_by_cmd_b4_enable",
+            /* .Basename       = */ "cfe",
+            /* .Extension      = */ "hk",
 
-            /* .FileNameType  = */ DS_BY_COUNT,
-            /* .EnableState   = */ DS_DISABLED,
-            /* .MaxFileSize   = */ (1024 * 1024 * 2), /* 2 M-bytes */
-            /* .MaxFileAge    = */ (60 * 60 * 2),     /* 2 hours */
-            /* .SequenceCount = */ 4000,
+            /* .FileNameType   = */ DS_BY_COUNT,
+            /* .EnableState    = */ DS_DISABLED,
+            /* .MaxFileSize    = */ (1024 * 1024 * 2), /* 2 M-bytes */
+            /* .MaxFileAge     = */ (60 * 60 * 2),     /* 2 hours */
+            /* .SequenceCount  = */ 4000,
+            /* .BufferSize     = */ 0,
+            /* .Preallocate    = */ DS_DISABLED,
+            /* .SyncPolicy     = */ DS_SYNC_NONE,
+            /* .SyncInterval   = */ 0,
+            /* .DirectIO       = */ DS_DISABLED,
+            /* .IndexSeconds   = */ 0,
+            /* .IndexBytes     = */ 0,
+            /* .Codec          = */ DS_CODEC_NONE,
+            /* .DeltaKeyframe  = */ 0,
+            /* .SuperframeSize = */ 0,
+            /* .SuperframeAge  = */ 0,
         },
         /* File Index 05 -- cFE telemetry packets */
         {
 #if (DS_MOVE_FILES == true)
-            /* .Movename      = */ DS_EMPTY_STRING,
+            /* .Movename       = */ DS_EMPTY_STRING,
 #endif
-            /* .Pathname      = */ "set_by_cmd_b4_enable",
-            /* .Basename      = */ "cfe",
-            /* .Extension     = */ "tlm",
+            /* .Pathname       = */ "set_by_cmd_b4_enable",
+            /* .Basename       = */ "cfe",
+            /* .Extension      = */ "tlm",
 
-            /* .FileNameType  = */ DS_BY_COUNT,
-            /* .EnableState   = */ DS_DISABLED,
-            /* .MaxFileSize   = */ (1024 * 1024 * 2), /* 2 M-bytes */
-            /* .MaxFileAge    = */ (60 * 60 * 2),     /* 2 hours */
-            /* .SequenceCount = */ 5000,
+            /* .FileNameType   = */ DS_BY_COUNT,
+            /* .EnableState    = */ DS_DISABLED,
+            /* .MaxFileSize    = */ (1024 * 1024 * 2), /* 2 M-bytes */
+            /* .MaxFileAge     = */ (60 * 60 * 2),     /* 2 hours */
+            /* .SequenceCount  = */ 5000,
+            /* .BufferSize     = */ 0,
+            /* .Preallocate    = */ DS_DISABLED,
+            /* .SyncPolicy     = */ DS_SYNC_NONE,
+            /* .SyncInterval   = */ 0,
+            /* .DirectIO       = */ DS_DISABLED,
+            /* .IndexSeconds   = */ 0,
+            /* .IndexBytes     = */ 0,
+            /* .Codec          = */ DS_CODEC_NONE,
+            /* .DeltaKeyframe  = */ 0,
+            /* .SuperframeSize = */ 0,
+            /* .SuperframeAge  = */ 0,
         },
         /* File Index 06 */
         {
 #if (DS_MOVE_FILES == true)
-            /* .Movename      = */ DS_EMPTY_STRING,
+            /* .Movename       = */ DS_EMPTY_STRING,
 #endif
-            /* .Pathname      = */ DS_EMPTY_STRING,
-            /* .Basename      = */ DS_EMPTY_STRING,
-            /* .Extension     = */ DS_EMPTY_STRING,
+            /* .Pathname       = */ DS_EMPTY_STRING,
+            /* .Basename       = */ DS_EMPTY_STRING,
+            /* .Extension      = */ DS_EMPTY_STRING,
 
-            /* .FileNameType  = */ DS_UNUSED,
-            /* .EnableState   = */ DS_UNUSED,
-            /* .MaxFileSize   = */ DS_UNUSED,
-            /* .MaxFileAge    = */ DS_UNUSED,
-            /* .SequenceCount = */ DS_UNUSED,
+            /* .FileNameType   = */ DS_UNUSED,
+            /* .EnableState    = */ DS_UNUSED,
+            /* .MaxFileSize    = */ DS_UNUSED,
+            /* .MaxFileAge     = */ DS_UNUSED,
+            /* .SequenceCount  = */ DS_UNUSED,
+            /* .BufferSize     = */ 0,
+            /* .Preallocate    = */ DS_DISABLED,
+            /* .SyncPolicy     = */ DS_SYNC_NONE,
+            /* .SyncInterval   = */ 0,
+            /* .DirectIO       = */ DS_DISABLED,
+            /* .IndexSeconds   = */ 0,
+            /* .IndexBytes     = */ 0,
+            /* .Codec          = */ DS_CODEC_NONE,
+            /* .DeltaKeyframe  = */ 0,
+            /* .SuperframeSize = */ 0,
+            /* .SuperframeAge  = */ 0,
         },
         /* File Index 07 */
         {
 #if (DS_MOVE_FILES == true)
-            /* .Movename      = */ DS_EMPTY_STRING,
+            /* .Movename       = */ DS_EMPTY_STRING,
 #endif
-            /* .Pathname      = */ DS_EMPTY_STRING,
-            /* .Basename      = */ DS_EMPTY_STRING,
-            /* .Extension     = */ DS_EMPTY_STRING,
+            /* .Pathname       = */ DS_EMPTY_STRING,
+            /* .Basename       = */ DS_EMPTY_STRING,
+            /* .Extension      = */ DS_EMPTY_STRING,
 
-            /* .FileNameType  = */ DS_UNUSED,
-            /* .EnableState   = */ DS_UNUSED,
-            /* .MaxFileSize   = */ DS_UNUSED,
-            /* .MaxFileAge    = */ DS_UNUSED,
-            /* .SequenceCount = */ DS_UNUSED,
+            /* .FileNameType   = */ DS_UNUSED,
+            /* .EnableState    = */ DS_UNUSED,
+            /* .MaxFileSize    = */ DS_UNUSED,
+            /* .MaxFileAge     = */ DS_UNUSED,
+            /* .SequenceCount  = */ DS_UNUSED,
+            /* .BufferSize     = */ 0,
+            /* .Preallocate    = */ DS_DISABLED,
+            /* .SyncPolicy     = */ DS_SYNC_NONE,
+            /* .SyncInterval   = */ 0,
+            /* .DirectIO       = */ DS_DISABLED,
+            /* .IndexSeconds   = */ 0,
+            /* .IndexBytes     = */ 0,
+            /* .Codec          = */ DS_CODEC_NONE,
+            /* .DeltaKeyframe  = */ 0,
+            /* .SuperframeSize = */ 0,
+            /* .SuperframeAge  = */ 0,
         },
         /* File Index 08 */
         {
 #if (DS_MOVE_FILES == true)
-            /* .Movename      = */ DS_EMPTY_STRING,
+            /* .Movename       = */ DS_EMPTY_STRING,
 #endif
-            /* .Pathname      = */ DS_EMPTY_STRING,
-            /* .Basename      = */ DS_EMPTY_STRING,
-            /* .Extension     = */ DS_EMPTY_STRING,
+            /* .Pathname       = */ DS_EMPTY_STRING,
+            /* .Basename       = */ DS_EMPTY_STRING,
+            /* .Extension      = */ DS_EMPTY_STRING,
 
-            /* .FileNameType  = */ DS_UNUSED,
-            /* .EnableState   = */ DS_UNUSED,
-            /* .MaxFileSize   = */ DS_UNUSED,
-            /* .MaxFileAge    = */ DS_UNUSED,
-            /* .SequenceCount = */ DS_UNUSED,
+            /* .FileNameType   = */ DS_UNUSED,
+            /* .EnableState    = */ DS_UNUSED,
+            /* .MaxFileSize    = */ DS_UNUSED,
+            /* .MaxFileAge     = */ DS_UNUSED,
+            /* .SequenceCount  = */ DS_UNUSED,
+            /* .BufferSize     = */ 0,
+            /* .Preallocate    = */ DS_DISABLED,
+            /* .SyncPolicy     = */ DS_SYNC_NONE,
+            /* .SyncInterval   = */ 0,
+            /* .DirectIO       = */ DS_DISABLED,
+            /* .IndexSeconds   = */ 0,
+            /* .IndexBytes     = */ 0,
+            /* .Codec          = */ DS_CODEC_NONE,
+            /* .DeltaKeyframe  = */ 0,
+            /* .SuperframeSize = */ 0,
+            /* .SuperframeAge  = */ 0,
         },
         /* File Index 09 */
         {
 #if (DS_MOVE_FILES == true)
-            /* .Movename      = */ DS_EMPTY_STRING,
+            /* .Movename       = */ DS_EMPTY_STRING,
 #endif
-            /* .Pathname      = */ DS_EMPTY_STRING,
-            /* .Basename      = */ DS_EMPTY_STRING,
-            /* .Extension     = */ DS_EMPTY_STRING,
+            /* .Pathname       = */ DS_EMPTY_STRING,
+            /* .Basename       = */ DS_EMPTY_STRING,
+            /* .Extension      = */ DS_EMPTY_STRING,
 
-            /* .FileNameType  = */ DS_UNUSED,
-            /* .EnableState   = */ DS_UNUSED,
-            /* .MaxFileSize   = */ DS_UNUSED,
-            /* .MaxFileAge    = */ DS_UNUSED,
-            /* .SequenceCount = */ DS_UNUSED,
+            /* .FileNameType   = */ DS_UNUSED,
+            /* .EnableState    = */ DS_UNUSED,
+            /* .MaxFileSize    = */ DS_UNUSED,
+            /* .MaxFileAge     = */ DS_UNUSED,
+            /* .SequenceCount  = */ DS_UNUSED,
+            /* .BufferSize     = */ 0,
+            /* .Preallocate    = */ DS_DISABLED,
+            /* .SyncPolicy     = */ DS_SYNC_NONE,
+            /* .SyncInterval   = */ 0,
+            /* .DirectIO       = */ DS_DISABLED,
+            /* .IndexSeconds   = */ 0,
+            /* .IndexBytes     = */ 0,
+            /* .Codec          = */ DS_CODEC_NONE,
+            /* .DeltaKeyframe  = */ 0,
+            /* .SuperframeSize = */ 0,
+            /* .SuperframeAge  = */ 0,
         },
         /* File Index 10 */
         {
 #if (DS_MOVE_FILES == true)
-            /* .Movename      = */ DS_EMPTY_STRING,
+            /* .Movename       = */ DS_EMPTY_STRING,
 #endif
-            /* .Pathname      = */ DS_EMPTY_STRING,
-            /* .Basename      = */ DS_EMPTY_STRING,
-            /* .Extension     = */ DS_EMPTY_STRING,
+            /* .Pathname       = */ DS_EMPTY_STRING,
+            /* .Basename       = */ DS_EMPTY_STRING,
+            /* .Extension      = */ DS_EMPTY_STRING,
 
-            /* .FileNameType  = */ DS_UNUSED,
-            /* .EnableState   = */ DS_UNUSED,
-            /* .MaxFileSize   = */ DS_UNUSED,
-            /* .MaxFileAge    = */ DS_UNUSED,
-            /* .SequenceCount = */ DS_UNUSED,
+            /* .FileNameType   = */ DS_UNUSED,
+            /* .EnableState    = */ DS_UNUSED,
+            /* .MaxFileSize    = */ DS_UNUSED,
+            /* .MaxFileAge     = */ DS_UNUSED,
+            /* .SequenceCount  = */ DS_UNUSED,
+            /* .BufferSize     = */ 0,
+            /* .Preallocate    = */ DS_DISABLED,
+            /* .SyncPolicy     = */ DS_SYNC_NONE,
+            /* .SyncInterval   = */ 0,
+            /* .DirectIO       = */ DS_DISABLED,
+            /* .IndexSeconds   = */ 0,
+            /* .IndexBytes     = */ 0,
+            /* .Codec          = */ DS_CODEC_NONE,
+            /* .DeltaKeyframe  = */ 0,
+            /* .SuperframeSize = */ 0,
+            /* .SuperframeAge  = */ 0,
         },
         /* File Index 11 */
         {
 #if (DS_MOVE_FILES == true)
-            /* .Movename      = */ DS_EMPTY_STRING,
+            /* .Movename       = */ DS_EMPTY_STRING,
 #endif
-            /* .Pathname      = */ DS_EMPTY_STRING,
-            /* .Basename      = */ DS_EMPTY_STRING,
-            /* .Extension     = */ DS_EMPTY_STRING,
+            /* .Pathname       = */ DS_EMPTY_STRING,
+            /* .Basename       = */ DS_EMPTY_STRING,
+            /* .Extension      = */ DS_EMPTY_STRING,
 
-            /* .FileNameType  = */ DS_UNUSED,
-            /* .EnableState   = */ DS_UNUSED,
-            /* .MaxFileSize   = */ DS_UNUSED,
-            /* .MaxFileAge    = */ DS_UNUSED,
-            /* .SequenceCount = */ DS_UNUSED,
+            /* .FileNameType   = */ DS_UNUSED,
+            /* .EnableState    = */ DS_UNUSED,
+            /* .MaxFileSize    = */ DS_UNUSED,
+            /* .MaxFileAge     = */ DS_UNUSED,
+            /* .SequenceCount  = */ DS_UNUSED,
+            /* .BufferSize     = */ 0,
+            /* .Preallocate    = */ DS_DISABLED,
+            /* .SyncPolicy     = */ DS_SYNC_NONE,
+            /* .SyncInterval   = */ 0,
+            /* .DirectIO       = */ DS_DISABLED,
+            /* .IndexSeconds   = */ 0,
+            /* .IndexBytes     = */ 0,
+            /* .Codec          = */ DS_CODEC_NONE,
+            /* .DeltaKeyframe  = */ 0,
+            /* .SuperframeSize = */ 0,
+            /* .SuperframeAge  = */ 0,
         },
         /* File Index 12 */
         {
 #if (DS_MOVE_FILES == true)
-            /* .Movename      = */ DS_EMPTY_STRING,
+            /* .Movename       = */ DS_EMPTY_STRING,
 #endif
-            /* .Pathname      = */ DS_EMPTY_STRING,
-            /* .Basename      = */ DS_EMPTY_STRING,
-            /* .Extension     = */ DS_EMPTY_STRING,
+            /* .Pathname       = */ DS_EMPTY_STRING,
+            /* .Basename       = */ DS_EMPTY_STRING,
+            /* .Extension      = */ DS_EMPTY_STRING,
 
-            /* .FileNameType  = */ DS_UNUSED,
-            /* .EnableState   = */ DS_UNUSED,
-            /* .MaxFileSize   = */ DS_UNUSED,
-            /* .MaxFileAge    = */ DS_UNUSED,
-            /* .SequenceCount = */ DS_UNUSED,
+            /* .FileNameType   = */ DS_UNUSED,
+            /* .EnableState    = */ DS_UNUSED,
+            /* .MaxFileSize    = */ DS_UNUSED,
+            /* .MaxFileAge     = */ DS_UNUSED,
+            /* .SequenceCount  = */ DS_UNUSED,
+            /* .BufferSize     = */ 0,
+            /* .Preallocate    = */ DS_DISABLED,
+            /* .SyncPolicy     = */ DS_SYNC_NONE,
+            /* .SyncInterval   = */ 0,
+            /* .DirectIO       = */ DS_DISABLED,
+            /* .IndexSeconds   = */ 0,
+            /* .IndexBytes     = */ 0,
+            /* .Codec          = */ DS_CODEC_NONE,
+            /* .DeltaKeyframe  = */ 0,
+            /* .SuperframeSize = */ 0,
+            /* .SuperframeAge  = */ 0,
         },
         /* File Index 13 */
         {
 #if (DS_MOVE_FILES == true)
-            /* .Movename      = */ DS_EMPTY_STRING,
+            /* .Movename       = */ DS_EMPTY_STRING,
 #endif
-            /* .Pathname      = */ DS_EMPTY_STRING,
-            /* .Basename      = */ DS_EMPTY_STRING,
-            /* .Extension     = */ DS_EMPTY_STRING,
+            /* .Pathname       = */ DS_EMPTY_STRING,
+            /* .Basename       = */ DS_EMPTY_STRING,
+            /* .Extension      = */ DS_EMPTY_STRING,
 
-            /* .FileNameType  = */ DS_UNUSED,
-            /* .EnableState   = */ DS_UNUSED,
-            /* .MaxFileSize   = */ DS_UNUSED,
-            /* .MaxFileAge    = */ DS_UNUSED,
-            /* .SequenceCount = */ DS_UNUSED,
+            /* .FileNameType   = */ DS_UNUSED,
+            /* .EnableState    = */ DS_UNUSED,
+            /* .MaxFileSize    = */ DS_UNUSED,
+            /* .MaxFileAge     = */ DS_UNUSED,
+            /* .SequenceCount  = */ DS_UNUSED,
+            /* .BufferSize     = */ 0,
+            /* .Preallocate    = */ DS_DISABLED,
+            /* .SyncPolicy     = */ DS_SYNC_NONE,
+            /* .SyncInterval   = */ 0,
+            /* .DirectIO       = */ DS_DISABLED,
+            /* .IndexSeconds   = */ 0,
+            /* .IndexBytes     = */ 0,
+            /* .Codec          = */ DS_CODEC_NONE,
+            /* .DeltaKeyframe  = */ 0,
+            /* .SuperframeSize = */ 0,
+            /* .SuperframeAge  = */ 0,
         },
         /* File Index 14 */
         {
 #if (DS_MOVE_FILES == true)
-            /* .Movename      = */ DS_EMPTY_STRING,
+            /* .Movename       = */ DS_EMPTY_STRING,
 #endif
-            /* .Pathname      = */ DS_EMPTY_STRING,
-            /* .Basename      = */ DS_EMPTY_STRING,
-            /* .Extension     = */ DS_EMPTY_STRING,
+            /* .Pathname       = */ DS_EMPTY_STRING,
+            /* .Basename       = */ DS_EMPTY_STRING,
+            /* .Extension      = */ DS_EMPTY_STRING,
 
-            /* .FileNameType  = */ DS_UNUSED,
-            /* .EnableState   = */ DS_UNUSED,
-            /* .MaxFileSize   = */ DS_UNUSED,
-            /* .MaxFileAge    = */ DS_UNUSED,
-            /* .SequenceCount = */ DS_UNUSED,
+            /* .FileNameType   = */ DS_UNUSED,
+            /* .EnableState    = */ DS_UNUSED,
+            /* .MaxFileSize    = */ DS_UNUSED,
+            /* .MaxFileAge     = */ DS_UNUSED,
+            /* .SequenceCount  = */ DS_UNUSED,
+            /* .BufferSize     = */ 0,
+            /* .Preallocate    = */ DS_DISABLED,
+            /* .SyncPolicy     = */ DS_SYNC_NONE,
+            /* .SyncInterval   = */ 0,
+            /* .DirectIO       = */ DS_DISABLED,
+            /* .IndexSeconds   = */ 0,
+            /* .IndexBytes     = */ 0,
+            /* .Codec          = */ DS_CODEC_NONE,
+            /* .DeltaKeyframe  = */ 0,
+            /* .SuperframeSize = */ 0,
+            /* .SuperframeAge  = */ 0,
         },
         /* File Index 15 */
         {
 #if (DS_MOVE_FILES == true)
-            /* .Movename      = */ DS_EMPTY_STRING,
+            /* .Movename       = */ DS_EMPTY_STRING,
 #endif
-            /* .Pathname      = */ DS_EMPTY_STRING,
-            /* .Basename      = */ DS_EMPTY_STRING,
-            /* .Extension     = */ DS_EMPTY_STRING,
+            /* .Pathname       = */ DS_EMPTY_STRING,
+            /* .Basename       = */ DS_EMPTY_STRING,
+            /* .Extension      = */ DS_EMPTY_STRING,
 
-            /* .FileNameType  = */ DS_UNUSED,
-            /* .EnableState   = */ DS_UNUSED,
-            /* .MaxFileSize   = */ DS_UNUSED,
-            /* .MaxFileAge    = */ DS_UNUSED,
-            /* .SequenceCount = */ DS_UNUSED,
+            /* .FileNameType   = */ DS_UNUSED,
+            /* .EnableState    = */ DS_UNUSED,
+            /* .MaxFileSize    = */ DS_UNUSED,
+            /* .MaxFileAge     = */ DS_UNUSED,
+            /* .SequenceCount  = */ DS_UNUSED,
+            /* .BufferSize     = */ 0,
+            /* .Preallocate    = */ DS_DISABLED,
+            /* .SyncPolicy     = */ DS_SYNC_NONE,
+            /* .SyncInterval   = */ 0,
+            /* .DirectIO       = */ DS_DISABLED,
+            /* .IndexSeconds   = */ 0,
+            /* .IndexBytes     = */ 0,
+            /* .Codec          = */ DS_CODEC_NONE,
+            /* .DeltaKeyframe  = */ 0,
+            /* .SuperframeSize = */ 0,
+            /* .SuperframeAge  = */ 0,
         },
     }};
 
@@ -0,0 +1,293 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,917-1, and identified as “CFS Data Storage
+ * (DS) application version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  CFS Data Storage (DS) compressed block decoder (ground tool)
+ *
+ *  Walks the block frames of a DS file written with a table Codec (see
+ *  DS_CodecFrame_t in fsw/src/ds_codec.h), checks the CRC of each block
+ *  and decompresses it with the flight decoder in fsw/src/ds_codec.c.
+ *  The file headers are copied as-is, so the output is the file DS
+ *  would have written without compression.
+ *
+ *  Usage: ds_codec_decode <input file> <output file> <header bytes>
+ *
+ *  Header bytes is the size of the cFE and DS file headers to copy.
+ *  A damaged block is reported and skipped, and decoding continues at
+ *  the next block sync word.  Frames are read in the host byte order,
+ *  so run on a host with the spacecraft byte order.  Block CRCs are
+ *  checked with the cFE default CRC-16.
+ *
+ *  Built with DS_TOOLS_NO_MAIN defined, only the decoder is compiled so
+ *  that the unit tests can decode files written by the flight code.
+ */
+
+#include "cfe.h"
+
+#include "ds_platform_cfg.h"
+#include "ds_extern_typedefs.h"
+#include "ds_codec.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "ds_tools.h"
+
+/*
+** cFE CRC-16 (CFE_ES_CrcType_CRC_16): reflected polynomial 0xA001, zero initial value...
+*/
+uint32_t DS_CodecCrc16(const void *Data, size_t Length)
+{
+    const uint8_t *Bytes = Data;
+    uint16_t       Crc   = 0;
+    size_t         i;
+    int            Bit;
+
+    for (i = 0; i < Length; i++)
+    {
+        Crc ^= Bytes[i];
+
+        for (Bit = 0; Bit < 8; Bit++)
+        {
+            Crc = (Crc & 1) ? ((Crc >> 1) ^ 0xA001) : (Crc >> 1);
+        }
+    }
+
+    return Crc;
+}
+
+/*
+** Decode blocks from the current input position to the end of the input...
+*/
+int DS_CodecDecodeFile(FILE *Input, FILE *Output, unsigned long *Blocks, unsigned long *Errors)
+{
+    DS_CodecFrame_t Frame;
+    uint8_t *       Data     = NULL;
+    uint8_t *       Raw      = NULL;
+    uint8_t *       NewData  = NULL;
+    size_t          Size     = 0;
+    size_t          Capacity = 0;
+    size_t          Position = 0;
+    size_t          Count    = 0;
+    const uint8_t * Payload  = NULL;
+    const char *    Problem  = NULL;
+    int             Synced   = 1;
+    int             Status   = EXIT_SUCCESS;
+
+    *Blocks = 0;
+    *Errors = 0;
+
+    /*
+    ** Files are at most the table MaxFileSize, so read the rest of it...
+    */
+    do
+    {
+        if (Size == Capacity)
+        {
+            Capacity = (Capacity == 0) ? 65536 : (Capacity * 2);
+            NewData  = realloc(Data, Capacity);
+
+            if (NewData == NULL)
+            {
+                fprintf(stderr, "out of memory\n");
+                Status = EXIT_FAILURE;
+            }
+            else
+            {
+                Data = NewData;
+            }
+        }
+
+        if (Status == EXIT_SUCCESS)
+        {
+            Count = fread(&Data[Size], 1, Capacity - Size, Input);
+            Size += Count;
+        }
+    } while ((Status == EXIT_SUCCESS) && (Count > 0));
+
+    if (ferror(Input))
+    {
+        perror("input");
+        Status = EXIT_FAILURE;
+    }
+
+    while ((Status == EXIT_SUCCESS) && ((Position + sizeof(Frame)) <= Size))
+    {
+        memcpy(&Frame, &Data[Position], sizeof(Frame));
+        Payload = &Data[Position + sizeof(Frame)];
+        Problem = NULL;
+
+        if (Frame.Sync != DS_CODEC_FRAME_SYNC)
+        {
+            /*
+            ** Report the first lost byte only, then look for the next block...
+            */
+            if (Synced)
+            {
+                fprintf(stderr, "offset %lu: no block sync word\n", (unsigned long)Position);
+                (*Errors)++;
+            }
+
+            Synced = 0;
+            Position++;
+            continue;
+        }
+
+        Synced = 1;
+
+        if (Frame.Length > (Size - Position - sizeof(Frame)))
+        {
+            Problem = "truncated";
+        }
+        else if (DS_CodecCrc16(Payload, Frame.Length) != Frame.Crc)
+        {
+            Problem = "bad CRC";
+        }
+        else if (Frame.Codec == DS_CODEC_NONE)
+        {
+            if (Frame.Length != Frame.RawLength)
+            {
+                Problem = "bad stored length";
+            }
+            else if (fwrite(Payload, 1, Frame.Length, Output) != Frame.Length)
+            {
+                perror("output");
+                Status = EXIT_FAILURE;
+            }
+        }
+        else
+        {
+            Raw = realloc(Raw, (Frame.RawLength != 0) ? Frame.RawLength : 1);
+
+            if (Raw == NULL)
+            {
+                fprintf(stderr, "out of memory\n");
+                Status = EXIT_FAILURE;
+            }
+            else if ((Frame.RawLength == 0) ||
+                     (DS_CodecDecompress(Frame.Codec, Payload, Frame.Length, Raw, Frame.RawLength) != Frame.RawLength))
+            {
+                Problem = "bad compressed data";
+            }
+            else if (fwrite(Raw, 1, Frame.RawLength, Output) != Frame.RawLength)
+            {
+                perror("output");
+                Status = EXIT_FAILURE;
+            }
+        }
+
+        if (Problem != NULL)
+        {
+            /*
+            ** Damaged block - its length cannot be trusted, so resynchronize...
+            */
+            fprintf(stderr, "offset %lu: block %lu %s\n", (unsigned long)Position, *Blocks + *Errors, Problem);
+            (*Errors)++;
+
+            Synced = 0;
+            Position++;
+        }
+        else if (Status == EXIT_SUCCESS)
+        {
+            (*Blocks)++;
+            Position += sizeof(Frame) + Frame.Length;
+        }
+    }
+
+    if ((Status == EXIT_SUCCESS) && (Position < Size))
+    {
+        fprintf(stderr, "offset %lu: truncated block frame\n", (unsigned long)Position);
+        (*Errors)++;
+    }
+
+    if (*Errors != 0)
+    {
+        Status = EXIT_FAILURE;
+    }
+
+    free(Raw);
+    free(Data);
+
+    return Status;
+}
+
+#ifndef DS_TOOLS_NO_MAIN
+int main(int argc, char *argv[])
+{
+    FILE *        Input;
+    FILE *        Output;
+    uint8_t *     Header;
+    long          HeaderBytes;
+    unsigned long Blocks = 0;
+    unsigned long Errors = 0;
+    int           Status = EXIT_SUCCESS;
+
+    if (argc != 4)
+    {
+        fprintf(stderr, "usage: %s <input file> <output file> <header bytes>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    Input = fopen(argv[1], "rb");
+    if (Input == NULL)
+    {
+        perror(argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    Output = fopen(argv[2], "wb");
+    if (Output == NULL)
+    {
+        perror(argv[2]);
+        fclose(Input);
+        return EXIT_FAILURE;
+    }
+
+    /*
+    ** File headers are not compressed...
+    */
+    HeaderBytes = strtol(argv[3], NULL, 0);
+    Header      = malloc((HeaderBytes > 0) ? HeaderBytes : 1);
+
+    if ((Header == NULL) || (HeaderBytes < 0) || (fread(Header, 1, HeaderBytes, Input) != (size_t)HeaderBytes) ||
+        (fwrite(Header, 1, HeaderBytes, Output) != (size_t)HeaderBytes))
+    {
+        fprintf(stderr, "%s: cannot copy %ld header bytes\n", argv[1], HeaderBytes);
+        Status = EXIT_FAILURE;
+    }
+    else
+    {
+        Status = DS_CodecDecodeFile(Input, Output, &Blocks, &Errors);
+    }
+
+    printf("%lu blocks, %lu errors\n", Blocks, Errors);
+
+    free(Header);
+    fclose(Input);
+    if (fclose(Output) != 0)
+    {
+        Status = EXIT_FAILURE;
+    }
+
+    return Status;
+}
+#endif
@@ -0,0 +1,269 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,917-1, and identified as “CFS Data Storage
+ * (DS) application version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  CFS Data Storage (DS) delta record decoder (ground tool)
+ *
+ *  Rebuilds the packets of a DS file written with a non-zero table
+ *  DeltaKeyframe (see DS_DeltaRecord_t in fsw/src/ds_file.h) and writes
+ *  them back to back, as DS would have stored them without delta
+ *  records.  Runs on the ground, so it uses only the C library.
+ *
+ *  Usage: ds_delta_decode <input file> <output file> <header bytes>
+ *
+ *  Header bytes is the size of the cFE and DS file headers to skip.
+ *  Compressed files must be decompressed first (see ds_codec_decode).
+ *  Records are read in the host byte order, so run on a host with the
+ *  spacecraft byte order.
+ *
+ *  Built with DS_TOOLS_NO_MAIN defined, only the decoder is compiled so
+ *  that the unit tests can decode files written by the flight code.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "ds_tools.h"
+
+#define DS_DELTA_KEYFRAME 0
+#define DS_DELTA_XOR      1
+
+typedef struct
+{
+    uint32_t MessageID;
+    uint16_t Type;
+    uint16_t Count;
+    uint32_t Length;
+} DS_DeltaRecord_t;
+
+typedef struct
+{
+    uint32_t MessageID;
+    uint32_t Length;
+    uint8_t *Packet;
+} DS_DeltaPacket_t;
+
+static DS_DeltaPacket_t *Packets     = NULL;
+static size_t            PacketCount = 0;
+
+/*
+** Last packet of a message ID (created when first seen)...
+*/
+static DS_DeltaPacket_t *DS_DeltaFind(uint32_t MessageID)
+{
+    DS_DeltaPacket_t *Entry = NULL;
+    size_t            i;
+
+    for (i = 0; (i < PacketCount) && (Entry == NULL); i++)
+    {
+        if (Packets[i].MessageID == MessageID)
+        {
+            Entry = &Packets[i];
+        }
+    }
+
+    if (Entry == NULL)
+    {
+        Entry = realloc(Packets, (PacketCount + 1) * sizeof(*Packets));
+        if (Entry != NULL)
+        {
+            Packets = Entry;
+            Entry   = &Packets[PacketCount++];
+            memset(Entry, 0, sizeof(*Entry));
+            Entry->MessageID = MessageID;
+        }
+    }
+
+    return Entry;
+}
+
+/*
+** Same rules as DS_FileDeltaDecode: (skip, count) pairs, trailing bytes unchanged...
+*/
+static int DS_DeltaDecode(uint8_t *Packet, uint32_t Length, const uint8_t *Data, uint32_t DataLength)
+{
+    uint32_t InPos  = 0;
+    uint32_t OutPos = 0;
+    uint32_t Skip;
+    uint32_t Count;
+    int      Valid = 1;
+
+    while ((InPos < DataLength) && Valid)
+    {
+        if ((InPos + 2) > DataLength)
+        {
+            Valid = 0;
+        }
+        else
+        {
+            Skip  = Data[InPos];
+            Count = Data[InPos + 1];
+            InPos += 2;
+
+            if (((OutPos + Skip + Count) > Length) || ((InPos + Count) > DataLength))
+            {
+                Valid = 0;
+            }
+            else
+            {
+                OutPos += Skip;
+
+                while (Count > 0)
+                {
+                    Packet[OutPos++] ^= Data[InPos++];
+                    Count--;
+                }
+            }
+        }
+    }
+
+    return Valid;
+}
+
+/*
+** Decode records from the current input position to the end of the input...
+*/
+int DS_DeltaDecodeFile(FILE *Input, FILE *Output, unsigned long *Records)
+{
+    DS_DeltaRecord_t  Record;
+    DS_DeltaPacket_t *Entry;
+    uint8_t *         Data   = NULL;
+    int               Status = EXIT_SUCCESS;
+    size_t            i;
+
+    *Records = 0;
+
+    while ((Status == EXIT_SUCCESS) && (fread(&Record, sizeof(Record), 1, Input) == 1))
+    {
+        Entry = DS_DeltaFind(Record.MessageID);
+        Data  = realloc(Data, (Record.Length != 0) ? Record.Length : 1);
+
+        if ((Entry == NULL) || (Data == NULL))
+        {
+            fprintf(stderr, "out of memory\n");
+            Status = EXIT_FAILURE;
+        }
+        else if (fread(Data, 1, Record.Length, Input) != Record.Length)
+        {
+            fprintf(stderr, "record %lu: truncated\n", *Records);
+            Status = EXIT_FAILURE;
+        }
+        else if (Record.Type == DS_DELTA_KEYFRAME)
+        {
+            free(Entry->Packet);
+            Entry->Packet = Data;
+            Entry->Length = Record.Length;
+            Data          = NULL;
+        }
+        else if ((Record.Type != DS_DELTA_XOR) || (Entry->Packet == NULL) ||
+                 !DS_DeltaDecode(Entry->Packet, Entry->Length, Data, Record.Length))
+        {
+            fprintf(stderr, "record %lu: bad delta for message ID 0x%lX\n", *Records,
+                    (unsigned long)Record.MessageID);
+            Status = EXIT_FAILURE;
+        }
+
+        if ((Status == EXIT_SUCCESS) && (fwrite(Entry->Packet, 1, Entry->Length, Output) != Entry->Length))
+        {
+            perror("output");
+            Status = EXIT_FAILURE;
+        }
+
+        (*Records)++;
+    }
+
+    if (ferror(Input))
+    {
+        perror("input");
+        Status = EXIT_FAILURE;
+    }
+
+    /*
+    ** Previous packets only apply within one file...
+    */
+    for (i = 0; i < PacketCount; i++)
+    {
+        free(Packets[i].Packet);
+    }
+
+    free(Packets);
+    free(Data);
+
+    Packets     = NULL;
+    PacketCount = 0;
+
+    return Status;
+}
+
+#ifndef DS_TOOLS_NO_MAIN
+int main(int argc, char *argv[])
+{
+    FILE *        Input;
+    FILE *        Output;
+    unsigned long Records = 0;
+    int           Status  = EXIT_SUCCESS;
+
+    if (argc != 4)
+    {
+        fprintf(stderr, "usage: %s <input file> <output file> <header bytes>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    Input = fopen(argv[1], "rb");
+    if (Input == NULL)
+    {
+        perror(argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    Output = fopen(argv[2], "wb");
+    if (Output == NULL)
+    {
+        perror(argv[2]);
+        fclose(Input);
+        return EXIT_FAILURE;
+    }
+
+    if (fseek(Input, strtol(argv[3], NULL, 0), SEEK_SET) != 0)
+    {
+        perror(argv[1]);
+        Status = EXIT_FAILURE;
+    }
+    else
+    {
+        Status = DS_DeltaDecodeFile(Input, Output, &Records);
+    }
+
+    if (Status == EXIT_SUCCESS)
+    {
+        printf("%lu records\n", Records);
+    }
+
+    fclose(Input);
+    if (fclose(Output) != 0)
+    {
+        Status = EXIT_FAILURE;
+    }
+
+    return Status;
+}
+#endif
@@ -0,0 +1,82 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,917-1, and identified as “CFS Data Storage
+ * (DS) application version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  CFS Data Storage (DS) ground tool decoders
+ *
+ *  Decoders shared by the ground tools and the unit tests.  Only C
+ *  library types are used here, so this header can be included next
+ *  to the flight software headers.
+ */
+#ifndef DS_TOOLS_H
+#define DS_TOOLS_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ *  \brief Decode delta records
+ *
+ *  \par Description
+ *       Reads delta records from the current position of Input to the
+ *       end of the file and writes each rebuilt packet to Output.
+ *
+ *  \param[in]  Input   Delta records (file headers already skipped)
+ *  \param[in]  Output  Rebuilt packets
+ *  \param[out] Records Number of records decoded
+ *
+ *  \return EXIT_SUCCESS, or EXIT_FAILURE for a damaged file or an I/O error
+ */
+int DS_DeltaDecodeFile(FILE *Input, FILE *Output, unsigned long *Records);
+
+/**
+ *  \brief Decode compressed blocks
+ *
+ *  \par Description
+ *       Reads block frames from the current position of Input to the
+ *       end of the file, checks the CRC of each block and writes the
+ *       decompressed data to Output.  Damaged blocks are counted and
+ *       skipped; decoding continues at the next block sync word.
+ *
+ *  \param[in]  Input  Block frames (file headers already skipped)
+ *  \param[in]  Output Decompressed data
+ *  \param[out] Blocks Number of blocks decoded
+ *  \param[out] Errors Number of damaged blocks and lost byte runs
+ *
+ *  \return EXIT_SUCCESS, or EXIT_FAILURE if any block was damaged or for an I/O error
+ */
+int DS_CodecDecodeFile(FILE *Input, FILE *Output, unsigned long *Blocks, unsigned long *Errors);
+
+/**
+ *  \brief Compute a block CRC
+ *
+ *  \par Description
+ *       Computes the cFE default CRC (CRC-16) that the flight software
+ *       stores in each block frame.
+ *
+ *  \param[in] Data   Block data
+ *  \param[in] Length Block data length (bytes)
+ *
+ *  \return CRC value
+ */
+uint32_t DS_CodecCrc16(const void *Data, size_t Length);
+
+#endif
@@ -0,0 +1,185 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,917-1, and identified as “CFS Data Storage
+ * (DS) application version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  CFS Data Storage (DS) file write latency benchmark (host tool)
+ *
+ *  Writes a file the way DS writes a destination file - one write per
+ *  record, appended until the file reaches its maximum size - and
+ *  reports the latency of the individual writes.  Run it once with and
+ *  once without preallocation on the target file system to see whether
+ *  DS_FILE_PREALLOCATE is worth enabling there.
+ *
+ *  Usage: ds_write_bench <file> <file size> <record size> [prealloc]
+ *
+ *  With "prealloc", storage for the whole file is reserved first in the
+ *  same way as DS_FsExtAllocate (fallocate with FALLOC_FL_KEEP_SIZE),
+ *  and the file is trimmed to its length at the end, as DS does when the
+ *  file is closed.  The file is removed when the benchmark ends.
+ */
+
+/*
+** fallocate() is only declared for GNU sources (must precede all includes)...
+*/
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+/*
+** Write latency in nanoseconds...
+*/
+static long long DS_BenchElapsed(const struct timespec *Start, const struct timespec *Stop)
+{
+    return ((long long)(Stop->tv_sec - Start->tv_sec) * 1000000000LL) + (Stop->tv_nsec - Start->tv_nsec);
+}
+
+static int DS_BenchCompare(const void *A, const void *B)
+{
+    long long Left  = *(const long long *)A;
+    long long Right = *(const long long *)B;
+
+    return (Left > Right) - (Left < Right);
+}
+
+int main(int argc, char *argv[])
+{
+    int             Status   = EXIT_SUCCESS;
+    int             FileDesc = -1;
+    unsigned long   FileSize;
+    unsigned long   RecordSize;
+    unsigned long   Records;
+    unsigned long   i;
+    int             Prealloc = 0;
+    char           *Record   = NULL;
+    long long      *Latency  = NULL;
+    long long       Total    = 0;
+    struct timespec Start;
+    struct timespec Stop;
+
+    if ((argc < 4) || (argc > 5) || ((argc == 5) && (strcmp(argv[4], "prealloc") != 0)))
+    {
+        fprintf(stderr, "Usage: %s <file> <file size> <record size> [prealloc]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    FileSize   = strtoul(argv[2], NULL, 0);
+    RecordSize = strtoul(argv[3], NULL, 0);
+    Prealloc   = (argc == 5);
+
+    if ((RecordSize == 0) || (FileSize < RecordSize))
+    {
+        fprintf(stderr, "%s: file size must be at least one record\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    Records = FileSize / RecordSize;
+    Record  = malloc(RecordSize);
+    Latency = malloc(Records * sizeof(*Latency));
+
+    if ((Record == NULL) || (Latency == NULL))
+    {
+        fprintf(stderr, "%s: out of memory\n", argv[0]);
+        Status = EXIT_FAILURE;
+    }
+    else
+    {
+        memset(Record, 0xA5, RecordSize);
+
+        FileDesc = open(argv[1], O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+        if (FileDesc < 0)
+        {
+            perror(argv[1]);
+            Status = EXIT_FAILURE;
+        }
+    }
+
+    if ((Status == EXIT_SUCCESS) && Prealloc)
+    {
+#ifdef FALLOC_FL_KEEP_SIZE
+        if (fallocate(FileDesc, FALLOC_FL_KEEP_SIZE, 0, (off_t)FileSize) != 0)
+        {
+            perror("fallocate");
+            Status = EXIT_FAILURE;
+        }
+#else
+        fprintf(stderr, "%s: FALLOC_FL_KEEP_SIZE is not available on this host\n", argv[0]);
+        Status = EXIT_FAILURE;
+#endif
+    }
+
+    for (i = 0; (i < Records) && (Status == EXIT_SUCCESS); i++)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &Start);
+
+        if (write(FileDesc, Record, RecordSize) != (ssize_t)RecordSize)
+        {
+            perror("write");
+            Status = EXIT_FAILURE;
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &Stop);
+
+        Latency[i] = DS_BenchElapsed(&Start, &Stop);
+        Total += Latency[i];
+    }
+
+    if ((Status == EXIT_SUCCESS) && Prealloc)
+    {
+        /*
+        ** Release the unused storage, as the DS finalizer does...
+        */
+        if (ftruncate(FileDesc, (off_t)(Records * RecordSize)) != 0)
+        {
+            perror("ftruncate");
+            Status = EXIT_FAILURE;
+        }
+    }
+
+    if (FileDesc >= 0)
+    {
+        close(FileDesc);
+        unlink(argv[1]);
+    }
+
+    if (Status == EXIT_SUCCESS)
+    {
+        qsort(Latency, Records, sizeof(*Latency), DS_BenchCompare);
+
+        printf("%lu writes of %lu bytes (%s)\n", Records, RecordSize, Prealloc ? "preallocated" : "not preallocated");
+        printf("  min  %10lld ns\n", Latency[0]);
+        printf("  avg  %10lld ns\n", Total / (long long)Records);
+        printf("  p50  %10lld ns\n", Latency[Records / 2]);
+        printf("  p99  %10lld ns\n", Latency[(Records * 99) / 100]);
+        printf("  max  %10lld ns\n", Latency[Records - 1]);
+    }
+
+    free(Record);
+    free(Latency);
+
+    return Status;
+}
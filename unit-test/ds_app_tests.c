@@ -54,6 +54,22 @@
 uint8 call_count_CFE_EVS_SendEvent;
 uint8 call_count_CFE_ES_WriteToSysLog;
 
+/* Keeps a copy of the record handed to the storage writer */
+DS_WriterRecord_t UT_DS_WriterRecord;
+
+void UT_DS_WriterSubmit_CustomHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const DS_WriterRecord_t *Record = UT_Hook_GetArgValueByName(Context, "Record", const DS_WriterRecord_t *);
+
+    UT_DS_WriterRecord = *Record;
+}
+
+/* Storage writer has a destination file open when the ring is drained */
+void UT_DS_WriterDrain_CustomHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    DS_AppData.FileStatus[0].FileHandle = DS_UT_OBJID_1;
+}
+
 /*
  * Function Definitions
  */
@@ -74,12 +90,42 @@ void DS_AppMain_Test_Nominal(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
 
+    UT_SetHandlerFunction(UT_KEY(DS_WriterDrain), &UT_DS_WriterDrain_CustomHandler, NULL);
+
     /* Execute the function being tested */
     DS_AppMain();
 
-    /* Verify results */
+    /* Verify results - open files are closed (flushing buffered data) before the CDS commit */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 0);
+    UtAssert_STUB_COUNT(DS_WriterDrain, 1);
+    UtAssert_STUB_COUNT(DS_FileCloseDest, 1);
+    UtAssert_STUB_COUNT(DS_FileCloseSpare, DS_DEST_FILE_CNT);
+    UtAssert_STUB_COUNT(DS_FileRetryFinalize, DS_DEST_FILE_CNT);
+    UtAssert_STUB_COUNT(DS_TableCommitCDS, 1);
+    UtAssert_STUB_COUNT(DS_WriterLock, 1);
+    UtAssert_STUB_COUNT(DS_WriterUnlock, 1);
+}
+
+void DS_AppMain_Test_DrainTimeout(void)
+{
+    /* Set to exit loop after first run */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RunLoop), true);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, false);
+
+    /* Storage writer does not empty the ring */
+    UT_SetDefaultReturnValue(UT_KEY(DS_WriterDrain), false);
+
+    /* Execute the function being tested */
+    DS_AppMain();
+
+    /* Verify results - files are left to the storage writer */
+    UtAssert_STUB_COUNT(DS_WriterDrain, 1);
+    UtAssert_STUB_COUNT(DS_FileCloseDest, 0);
+    UtAssert_STUB_COUNT(DS_TableCommitCDS, 0);
+    UtAssert_STUB_COUNT(DS_WriterLock, 0);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
+    UtAssert_STUB_COUNT(CFE_ES_ExitApp, 1);
 }
 
 void DS_AppMain_Test_AppInitializeError(void)
@@ -139,7 +185,51 @@ void DS_AppMain_Test_SBTimeout(void)
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_STUB_COUNT(DS_FileTestAge, 1);
+    UtAssert_STUB_COUNT(DS_WriterSubmit, 1);
+}
+
+void DS_AppProcessBatch_Test_PipeEmpty(void)
+{
+    /* Poll twice successfully, then report an empty pipe */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 3, CFE_SB_NO_MESSAGE);
+
+    DS_AppData.MaxBatchSize = 1;
+
+    /* Execute the function being tested */
+    DS_AppProcessBatch(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 3);
+    UtAssert_UINT32_EQ(DS_AppData.DisabledPktCounter, 3);
+    UtAssert_UINT32_EQ(DS_AppData.LastBatchSize, 3);
+    UtAssert_UINT32_EQ(DS_AppData.MaxBatchSize, 3);
+    UtAssert_UINT32_EQ(DS_AppData.BatchCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.BatchPktCounter, 3);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_AppProcessBatch_Test_BatchLimit(void)
+{
+    /* Pipe always has another packet waiting */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SUCCESS);
+
+    DS_AppData.MaxBatchSize    = DS_APP_PIPE_BATCH_LIMIT + 1;
+    DS_AppData.BatchCounter    = 1;
+    DS_AppData.BatchPktCounter = 1;
+
+    /* Execute the function being tested */
+    DS_AppProcessBatch(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, DS_APP_PIPE_BATCH_LIMIT - 1);
+    UtAssert_UINT32_EQ(DS_AppData.DisabledPktCounter, DS_APP_PIPE_BATCH_LIMIT);
+    UtAssert_UINT32_EQ(DS_AppData.LastBatchSize, DS_APP_PIPE_BATCH_LIMIT);
+    UtAssert_UINT32_EQ(DS_AppData.MaxBatchSize, DS_APP_PIPE_BATCH_LIMIT + 1);
+    UtAssert_UINT32_EQ(DS_AppData.BatchCounter, 2);
+    UtAssert_UINT32_EQ(DS_AppData.BatchPktCounter, DS_APP_PIPE_BATCH_LIMIT + 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
 void DS_AppInitialize_Test_Nominal(void)
@@ -254,15 +344,12 @@ void DS_AppInitialize_Test_SBSubscribeDSError(void)
 
 void DS_AppProcessMsg_Test_CmdStore(void)
 {
-    DS_HashLink_t     HashLink;
     size_t            forced_Size    = sizeof(DS_NoopCmd_t);
     CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
     CFE_MSG_FcnCode_t forced_CmdCode = DS_NOOP_CC;
 
     DS_AppData.AppEnableState = DS_DISABLED;
 
-    DS_AppData.HashTable[187]                  = &HashLink;
-    HashLink.Index                             = 0;
     DS_AppData.FilterTblPtr->Packet->MessageID = DS_UT_MID_1;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
@@ -288,15 +375,12 @@ void DS_AppProcessMsg_Test_CmdStore(void)
 
 void DS_AppProcessMsg_Test_CmdNoStore(void)
 {
-    DS_HashLink_t     HashLink;
     size_t            forced_Size    = sizeof(DS_NoopCmd_t);
     CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
     CFE_MSG_FcnCode_t forced_CmdCode = DS_NOOP_CC;
 
     DS_AppData.AppEnableState = DS_DISABLED;
 
-    DS_AppData.HashTable[187]                  = &HashLink;
-    HashLink.Index                             = 0;
     DS_AppData.FilterTblPtr->Packet->MessageID = DS_UT_MID_1;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
@@ -322,14 +406,11 @@ void DS_AppProcessMsg_Test_CmdNoStore(void)
 
 void DS_AppProcessMsg_Test_HKStore(void)
 {
-    DS_HashLink_t  HashLink;
     size_t         forced_Size  = sizeof(DS_NoopCmd_t);
     CFE_SB_MsgId_t forced_MsgID = CFE_SB_ValueToMsgId(DS_SEND_HK_MID);
 
     DS_AppData.AppEnableState = DS_DISABLED;
 
-    DS_AppData.HashTable[188]                  = &HashLink;
-    HashLink.Index                             = 0;
     DS_AppData.FilterTblPtr->Packet->MessageID = DS_UT_MID_1;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
@@ -355,14 +436,11 @@ void DS_AppProcessMsg_Test_HKStore(void)
 
 void DS_AppProcessMsg_Test_HKNoStore(void)
 {
-    DS_HashLink_t  HashLink;
     size_t         forced_Size  = sizeof(DS_NoopCmd_t);
     CFE_SB_MsgId_t forced_MsgID = CFE_SB_ValueToMsgId(DS_SEND_HK_MID);
 
     DS_AppData.AppEnableState = DS_DISABLED;
 
-    DS_AppData.HashTable[188]                  = &HashLink;
-    HashLink.Index                             = 0;
     DS_AppData.FilterTblPtr->Packet->MessageID = DS_UT_MID_1;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
@@ -520,7 +598,125 @@ void DS_AppProcessCmd_Test_SetFilterParms(void)
     UtAssert_STUB_COUNT(DS_CmdSetFilterParms, 1);
 }
 
-void DS_AppProcessCmd_Test_SetDestType(void)
+void DS_AppProcessCmd_Test_AddMID(void)
+{
+    size_t            forced_Size    = sizeof(DS_AddMidCmd_t);
+    CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
+    CFE_MSG_FcnCode_t forced_CmdCode = DS_ADD_MID_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
+
+    /* Execute the function being tested */
+    DS_AppProcessCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(DS_CmdAddMID, 1);
+}
+
+void DS_AppProcessCmd_Test_RemoveMID(void)
+{
+    size_t            forced_Size    = sizeof(DS_RemoveMidCmd_t);
+    CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
+    CFE_MSG_FcnCode_t forced_CmdCode = DS_REMOVE_MID_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
+
+    /* Execute the function being tested */
+    DS_AppProcessCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(DS_CmdRemoveMID, 1);
+}
+
+void DS_AppProcessCmd_Test_GetDedupInfo(void)
+{
+    size_t            forced_Size    = sizeof(DS_GetDedupInfoCmd_t);
+    CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
+    CFE_MSG_FcnCode_t forced_CmdCode = DS_GET_DEDUP_INFO_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
+
+    /* Execute the function being tested */
+    DS_AppProcessCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(DS_CmdGetDedupInfo, 1);
+}
+
+void DS_AppProcessCmd_Test_InvalidCommandCode(void)
+{
+    size_t            forced_Size    = sizeof(DS_CloseAllCmd_t);
+    CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
+    CFE_MSG_FcnCode_t forced_CmdCode = 99;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
+
+    /* Execute the function being tested */
+    DS_AppProcessCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void DS_AppProcessCmd_Test_FileCmd(void)
+{
+    size_t            forced_Size    = sizeof(DS_CloseAllCmd_t);
+    CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
+    CFE_MSG_FcnCode_t forced_CmdCode = DS_CLOSE_ALL_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
+
+    UT_SetHandlerFunction(UT_KEY(DS_WriterSubmit), &UT_DS_WriterSubmit_CustomHandler, NULL);
+
+    /* Execute the function being tested */
+    DS_AppProcessCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results - command is run by the storage writer, not here */
+    UtAssert_STUB_COUNT(DS_WriterSubmit, 1);
+    UtAssert_UINT32_EQ(UT_DS_WriterRecord.Type, DS_WRITER_COMMAND);
+    UtAssert_STUB_COUNT(DS_CmdCloseAll, 0);
+    UtAssert_STUB_COUNT(DS_WriterLock, 0);
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_AppProcessCmd_Test_FileCmdDropped(void)
+{
+    size_t            forced_Size    = sizeof(DS_FlushFileCmd_t);
+    CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
+    CFE_MSG_FcnCode_t forced_CmdCode = DS_FLUSH_FILE_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
+
+    /* Storage writer ring is full */
+    UT_SetDefaultReturnValue(UT_KEY(DS_WriterSubmit), false);
+
+    /* Execute the function being tested */
+    DS_AppProcessCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(DS_WriterSubmit, 1);
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_WRITER_CMD_DROP_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_AppProcessFileCmd_Test_SetDestType(void)
 {
     size_t            forced_Size    = sizeof(DS_DestTypeCmd_t);
     CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
@@ -531,13 +727,13 @@ void DS_AppProcessCmd_Test_SetDestType(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
 
     /* Execute the function being tested */
-    DS_AppProcessCmd(&UT_CmdBuf.Buf);
+    DS_AppProcessFileCmd(&UT_CmdBuf.Buf);
 
     /* Verify results */
     UtAssert_STUB_COUNT(DS_CmdSetDestType, 1);
 }
 
-void DS_AppProcessCmd_Test_SetDestState(void)
+void DS_AppProcessFileCmd_Test_SetDestState(void)
 {
     size_t            forced_Size    = sizeof(DS_DestStateCmd_t);
     CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
@@ -548,13 +744,13 @@ void DS_AppProcessCmd_Test_SetDestState(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
 
     /* Execute the function being tested */
-    DS_AppProcessCmd(&UT_CmdBuf.Buf);
+    DS_AppProcessFileCmd(&UT_CmdBuf.Buf);
 
     /* Verify results */
     UtAssert_STUB_COUNT(DS_CmdSetDestState, 1);
 }
 
-void DS_AppProcessCmd_Test_SetDestPath(void)
+void DS_AppProcessFileCmd_Test_SetDestPath(void)
 {
     size_t            forced_Size    = sizeof(DS_DestPathCmd_t);
     CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
@@ -565,13 +761,13 @@ void DS_AppProcessCmd_Test_SetDestPath(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
 
     /* Execute the function being tested */
-    DS_AppProcessCmd(&UT_CmdBuf.Buf);
+    DS_AppProcessFileCmd(&UT_CmdBuf.Buf);
 
     /* Verify results */
     UtAssert_STUB_COUNT(DS_CmdSetDestPath, 1);
 }
 
-void DS_AppProcessCmd_Test_SetDestBase(void)
+void DS_AppProcessFileCmd_Test_SetDestBase(void)
 {
     size_t            forced_Size    = sizeof(DS_DestBaseCmd_t);
     CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
@@ -582,13 +778,13 @@ void DS_AppProcessCmd_Test_SetDestBase(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
 
     /* Execute the function being tested */
-    DS_AppProcessCmd(&UT_CmdBuf.Buf);
+    DS_AppProcessFileCmd(&UT_CmdBuf.Buf);
 
     /* Verify results */
     UtAssert_STUB_COUNT(DS_CmdSetDestBase, 1);
 }
 
-void DS_AppProcessCmd_Test_SetDestExt(void)
+void DS_AppProcessFileCmd_Test_SetDestExt(void)
 {
     size_t            forced_Size    = sizeof(DS_DestExtCmd_t);
     CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
@@ -599,13 +795,13 @@ void DS_AppProcessCmd_Test_SetDestExt(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
 
     /* Execute the function being tested */
-    DS_AppProcessCmd(&UT_CmdBuf.Buf);
+    DS_AppProcessFileCmd(&UT_CmdBuf.Buf);
 
     /* Verify results */
     UtAssert_STUB_COUNT(DS_CmdSetDestExt, 1);
 }
 
-void DS_AppProcessCmd_Test_SetDestSize(void)
+void DS_AppProcessFileCmd_Test_SetDestSize(void)
 {
     size_t            forced_Size    = sizeof(DS_DestSizeCmd_t);
     CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
@@ -616,13 +812,13 @@ void DS_AppProcessCmd_Test_SetDestSize(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
 
     /* Execute the function being tested */
-    DS_AppProcessCmd(&UT_CmdBuf.Buf);
+    DS_AppProcessFileCmd(&UT_CmdBuf.Buf);
 
     /* Verify results */
     UtAssert_STUB_COUNT(DS_CmdSetDestSize, 1);
 }
 
-void DS_AppProcessCmd_Test_SetDestAge(void)
+void DS_AppProcessFileCmd_Test_SetDestAge(void)
 {
     size_t            forced_Size    = sizeof(DS_DestAgeCmd_t);
     CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
@@ -633,13 +829,13 @@ void DS_AppProcessCmd_Test_SetDestAge(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
 
     /* Execute the function being tested */
-    DS_AppProcessCmd(&UT_CmdBuf.Buf);
+    DS_AppProcessFileCmd(&UT_CmdBuf.Buf);
 
     /* Verify results */
     UtAssert_STUB_COUNT(DS_CmdSetDestAge, 1);
 }
 
-void DS_AppProcessCmd_Test_SetDestCount(void)
+void DS_AppProcessFileCmd_Test_SetDestCount(void)
 {
     size_t            forced_Size    = sizeof(DS_DestCountCmd_t);
     CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
@@ -650,13 +846,13 @@ void DS_AppProcessCmd_Test_SetDestCount(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
 
     /* Execute the function being tested */
-    DS_AppProcessCmd(&UT_CmdBuf.Buf);
+    DS_AppProcessFileCmd(&UT_CmdBuf.Buf);
 
     /* Verify results */
     UtAssert_STUB_COUNT(DS_CmdSetDestCount, 1);
 }
 
-void DS_AppProcessCmd_Test_CloseFile(void)
+void DS_AppProcessFileCmd_Test_CloseFile(void)
 {
     uint32            i;
     size_t            forced_Size    = sizeof(DS_CloseFileCmd_t);
@@ -673,13 +869,13 @@ void DS_AppProcessCmd_Test_CloseFile(void)
     }
 
     /* Execute the function being tested */
-    DS_AppProcessCmd(&UT_CmdBuf.Buf);
+    DS_AppProcessFileCmd(&UT_CmdBuf.Buf);
 
     /* Verify results */
     UtAssert_STUB_COUNT(DS_CmdCloseFile, 1);
 }
 
-void DS_AppProcessCmd_Test_GetFileInfo(void)
+void DS_AppProcessFileCmd_Test_GetFileInfo(void)
 {
     size_t            forced_Size    = sizeof(DS_GetFileInfoCmd_t);
     CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
@@ -690,188 +886,386 @@ void DS_AppProcessCmd_Test_GetFileInfo(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
 
     /* Execute the function being tested */
-    DS_AppProcessCmd(&UT_CmdBuf.Buf);
+    DS_AppProcessFileCmd(&UT_CmdBuf.Buf);
 
     /* Verify results */
     UtAssert_STUB_COUNT(DS_CmdGetFileInfo, 1);
 }
 
-void DS_AppProcessCmd_Test_AddMID(void)
+void DS_AppProcessFileCmd_Test_CloseAll(void)
 {
-    size_t            forced_Size    = sizeof(DS_AddMidCmd_t);
+    uint32            i;
+    size_t            forced_Size    = sizeof(DS_CloseAllCmd_t);
     CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
-    CFE_MSG_FcnCode_t forced_CmdCode = DS_ADD_MID_CC;
+    CFE_MSG_FcnCode_t forced_CmdCode = DS_CLOSE_ALL_CC;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
 
+    for (i = 0; i < DS_DEST_FILE_CNT; i++)
+    {
+        DS_AppData.FileStatus[i].FileHandle = OS_OBJECT_ID_UNDEFINED;
+    }
+
     /* Execute the function being tested */
-    DS_AppProcessCmd(&UT_CmdBuf.Buf);
+    DS_AppProcessFileCmd(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_STUB_COUNT(DS_CmdAddMID, 1);
+    UtAssert_STUB_COUNT(DS_CmdCloseAll, 1);
 }
 
-void DS_AppProcessCmd_Test_RemoveMID(void)
+void DS_AppProcessFileCmd_Test_FlushFile(void)
 {
-    size_t            forced_Size    = sizeof(DS_RemoveMidCmd_t);
+    size_t            forced_Size    = sizeof(DS_FlushFileCmd_t);
     CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
-    CFE_MSG_FcnCode_t forced_CmdCode = DS_REMOVE_MID_CC;
+    CFE_MSG_FcnCode_t forced_CmdCode = DS_FLUSH_FILE_CC;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
 
     /* Execute the function being tested */
-    DS_AppProcessCmd(&UT_CmdBuf.Buf);
+    DS_AppProcessFileCmd(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_STUB_COUNT(DS_CmdRemoveMID, 1);
+    UtAssert_STUB_COUNT(DS_CmdFlushFile, 1);
 }
 
-void DS_AppProcessCmd_Test_CloseAll(void)
+void DS_AppProcessFileCmd_Test_InvalidCommandCode(void)
 {
-    uint32            i;
-    size_t            forced_Size    = sizeof(DS_CloseAllCmd_t);
+    size_t            forced_Size    = sizeof(DS_NoopCmd_t);
     CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
-    CFE_MSG_FcnCode_t forced_CmdCode = DS_CLOSE_ALL_CC;
+    CFE_MSG_FcnCode_t forced_CmdCode = DS_NOOP_CC;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
 
-    for (i = 0; i < DS_DEST_FILE_CNT; i++)
-    {
-        DS_AppData.FileStatus[i].FileHandle = OS_OBJECT_ID_UNDEFINED;
-    }
+    /* Execute the function being tested */
+    DS_AppProcessFileCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results - only destination file commands are run by the storage writer */
+    UtAssert_STUB_COUNT(DS_CmdNoop, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileCmdRejectedCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void DS_AppProcessHK_Test(void)
+{
+    /* Most values in the HK packet can't be checked because they're stored in a local variable. */
+
+    UT_SetHandlerFunction(UT_KEY(DS_WriterSubmit), &UT_DS_WriterSubmit_CustomHandler, NULL);
 
     /* Execute the function being tested */
-    DS_AppProcessCmd(&UT_CmdBuf.Buf);
+    DS_AppProcessHK();
 
-    /* Verify results */
-    UtAssert_STUB_COUNT(DS_CmdCloseAll, 1);
+    /* Verify results - snapshot and finalizer statistics are each read under their own mutex */
+    UtAssert_STUB_COUNT(OS_MutSemTake, 2);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 2);
+    UtAssert_STUB_COUNT(DS_WriterSubmit, 1);
+    UtAssert_UINT32_EQ(UT_DS_WriterRecord.Type, DS_WRITER_WORK);
+    UtAssert_UINT32_EQ(UT_DS_WriterRecord.Work, DS_WRITER_WORK_RATE);
+
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+
+    /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
+    UtAssert_BOOL_TRUE(TLM_STRUCT_DATA_IS_32_ALIGNED(DS_HkPacket_t));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_AppProcessCmd_Test_InvalidCommandCode(void)
+void DS_AppProcessHK_Test_SnprintfFail(void)
 {
-    size_t            forced_Size    = sizeof(DS_CloseAllCmd_t);
-    CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
-    CFE_MSG_FcnCode_t forced_CmdCode = 99;
+    /* Most values in the HK packet can't be checked because they're stored in a local variable. */
 
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
+    UT_SetDeferredRetcode(UT_KEY(stub_snprintf), 1, -1);
 
     /* Execute the function being tested */
-    DS_AppProcessCmd(&UT_CmdBuf.Buf);
+    DS_AppProcessHK();
 
     /* Verify results */
-    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(DS_WriterSubmit, 1);
+
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+
+    /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
+    UtAssert_BOOL_TRUE(TLM_STRUCT_DATA_IS_32_ALIGNED(DS_HkPacket_t));
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_APPHK_FILTER_TBL_PRINT_ERR_EID);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 }
 
-void DS_AppProcessHK_Test(void)
+void DS_AppProcessHK_Test_TblFail(void)
 {
-    uint32 i;
-
     /* Most values in the HK packet can't be checked because they're stored in a local variable. */
 
-    for (i = 0; i < DS_DEST_FILE_CNT; i++)
-    {
-        DS_AppData.FileStatus[i].FileGrowth = 99;
-    }
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetInfo), -1);
 
     /* Execute the function being tested */
     DS_AppProcessHK();
 
     /* Verify results */
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[0].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[0].FileGrowth, 0);
-
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT / 2].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT / 2].FileGrowth, 0);
-
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT - 1].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT - 1].FileGrowth, 0);
+    UtAssert_STUB_COUNT(DS_WriterSubmit, 1);
 
     UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
 
     /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
     UtAssert_BOOL_TRUE(TLM_STRUCT_DATA_IS_32_ALIGNED(DS_HkPacket_t));
 
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 }
 
-void DS_AppProcessHK_Test_SnprintfFail(void)
+void DS_AppSchedInit_Test(void)
 {
-    uint32 i;
+    /* Execute the function being tested */
+    DS_AppSchedInit();
+
+    /* Verify results (scheduler clock is zero in unit test) */
+    UtAssert_UINT32_EQ(DS_AppData.Sched.AgeTime, 0);
+    UtAssert_UINT32_EQ(DS_AppData.Sched.AgeDeadline, 0);
+    UtAssert_UINT32_EQ(DS_AppData.Sched.TableDeadline, 0);
+    UtAssert_UINT32_EQ(DS_AppData.Sched.FlushDeadline, DS_SCHED_FLUSH_PERIOD);
+    UtAssert_UINT32_EQ(DS_AppData.Sched.CDSDeadline, DS_SCHED_CDS_PERIOD);
+}
 
-    /* Most values in the HK packet can't be checked because they're stored in a local variable. */
+void DS_AppSchedTimeout_Test_Earliest(void)
+{
+    DS_AppData.Sched.AgeDeadline   = 750;
+    DS_AppData.Sched.TableDeadline = 250;
+    DS_AppData.Sched.FlushDeadline = 500;
+    DS_AppData.Sched.CDSDeadline   = 1000;
 
-    for (i = 0; i < DS_DEST_FILE_CNT; i++)
-    {
-        DS_AppData.FileStatus[i].FileGrowth = 99;
-    }
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_AppSchedTimeout(), 250);
+}
 
-    UT_SetDeferredRetcode(UT_KEY(stub_snprintf), 1, -1);
+void DS_AppSchedTimeout_Test_Limit(void)
+{
+    DS_AppData.Sched.AgeDeadline   = DS_SB_TIMEOUT + 1;
+    DS_AppData.Sched.TableDeadline = DS_SB_TIMEOUT + 2;
+    DS_AppData.Sched.FlushDeadline = DS_SB_TIMEOUT + 3;
+    DS_AppData.Sched.CDSDeadline   = DS_SB_TIMEOUT + 4;
 
     /* Execute the function being tested */
-    DS_AppProcessHK();
+    UtAssert_INT32_EQ(DS_AppSchedTimeout(), DS_SB_TIMEOUT);
+}
+
+void DS_AppSchedTimeout_Test_Passed(void)
+{
+    /* Deadline in the past (clock is zero in unit test) */
+    DS_AppData.Sched.AgeDeadline   = (uint32)-10;
+    DS_AppData.Sched.TableDeadline = 250;
+    DS_AppData.Sched.FlushDeadline = 500;
+    DS_AppData.Sched.CDSDeadline   = 1000;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_AppSchedTimeout(), CFE_SB_POLL);
+}
+
+void DS_AppSchedRun_Test_Due(void)
+{
+    /* File ages last charged 3.5 seconds ago, all deadlines passed */
+    DS_AppData.Sched.AgeTime       = (uint32)-3500;
+    DS_AppData.Sched.AgeDeadline   = 0;
+    DS_AppData.Sched.TableDeadline = 0;
+    DS_AppData.Sched.FlushDeadline = 0;
+    DS_AppData.Sched.CDSDeadline   = 0;
+
+    UT_SetHandlerFunction(UT_KEY(DS_WriterSubmit), &UT_DS_WriterSubmit_CustomHandler, NULL);
+
+    /* Execute the function being tested */
+    DS_AppSchedRun();
+
+    /* Verify results - one record for all file maintenance */
+    UtAssert_STUB_COUNT(DS_WriterSubmit, 1);
+    UtAssert_UINT32_EQ(UT_DS_WriterRecord.Type, DS_WRITER_WORK);
+    UtAssert_UINT32_EQ(UT_DS_WriterRecord.Work,
+                       DS_WRITER_WORK_AGE | DS_WRITER_WORK_DEST_TBL | DS_WRITER_WORK_FLUSH | DS_WRITER_WORK_CDS);
+    UtAssert_UINT32_EQ(UT_DS_WriterRecord.AgeSeconds, 3);
+
+    /* The half second is carried to the next charge */
+    UtAssert_UINT32_EQ(DS_AppData.Sched.AgeTime, (uint32)-500);
+    UtAssert_UINT32_EQ(DS_AppData.Sched.AgeDeadline, DS_SCHED_AGE_PERIOD - 500);
+
+    UtAssert_STUB_COUNT(DS_TableManageFilter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.Sched.TableDeadline, DS_SCHED_TABLE_PERIOD);
+    UtAssert_UINT32_EQ(DS_AppData.Sched.FlushDeadline, DS_SCHED_FLUSH_PERIOD);
+    UtAssert_UINT32_EQ(DS_AppData.Sched.CDSDeadline, DS_SCHED_CDS_PERIOD);
+
+    /* Destination files are not touched by the main task */
+    UtAssert_STUB_COUNT(DS_FileTestAge, 0);
+    UtAssert_STUB_COUNT(DS_TableManageDestFile, 0);
+    UtAssert_STUB_COUNT(DS_FileFlushBuffer, 0);
+    UtAssert_STUB_COUNT(DS_TableCommitCDS, 0);
+    UtAssert_STUB_COUNT(DS_WriterLock, 0);
+}
+
+void DS_AppSchedRun_Test_RingFull(void)
+{
+    /* File ages last charged 3.5 seconds ago */
+    DS_AppData.Sched.AgeTime       = (uint32)-3500;
+    DS_AppData.Sched.AgeDeadline   = 0;
+    DS_AppData.Sched.TableDeadline = DS_SCHED_TABLE_PERIOD;
+    DS_AppData.Sched.FlushDeadline = DS_SCHED_FLUSH_PERIOD;
+    DS_AppData.Sched.CDSDeadline   = DS_SCHED_CDS_PERIOD;
+
+    /* Storage writer ring is full */
+    UT_SetDefaultReturnValue(UT_KEY(DS_WriterSubmit), false);
+
+    /* Execute the function being tested */
+    DS_AppSchedRun();
+
+    /* Verify results - uncharged time is kept for the next charge */
+    UtAssert_STUB_COUNT(DS_WriterSubmit, 1);
+    UtAssert_UINT32_EQ(DS_AppData.Sched.AgeTime, (uint32)-3500);
+    UtAssert_UINT32_EQ(DS_AppData.Sched.AgeDeadline, DS_SCHED_AGE_PERIOD);
+}
+
+void DS_AppSchedRun_Test_TableDue(void)
+{
+    DS_AppData.Sched.AgeTime       = 0;
+    DS_AppData.Sched.AgeDeadline   = DS_SCHED_AGE_PERIOD;
+    DS_AppData.Sched.TableDeadline = 0;
+    DS_AppData.Sched.FlushDeadline = DS_SCHED_FLUSH_PERIOD;
+    DS_AppData.Sched.CDSDeadline   = DS_SCHED_CDS_PERIOD;
+
+    UT_SetHandlerFunction(UT_KEY(DS_WriterSubmit), &UT_DS_WriterSubmit_CustomHandler, NULL);
+
+    /* Execute the function being tested */
+    DS_AppSchedRun();
 
     /* Verify results */
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[0].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[0].FileGrowth, 0);
+    UtAssert_STUB_COUNT(DS_WriterSubmit, 1);
+    UtAssert_UINT32_EQ(UT_DS_WriterRecord.Work, DS_WRITER_WORK_DEST_TBL);
+    UtAssert_STUB_COUNT(DS_TableManageFilter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.Sched.AgeDeadline, DS_SCHED_AGE_PERIOD);
+}
 
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT / 2].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT / 2].FileGrowth, 0);
+void DS_AppSchedRun_Test_NotDue(void)
+{
+    DS_AppData.Sched.AgeTime       = 0;
+    DS_AppData.Sched.AgeDeadline   = DS_SCHED_AGE_PERIOD;
+    DS_AppData.Sched.TableDeadline = DS_SCHED_TABLE_PERIOD;
+    DS_AppData.Sched.FlushDeadline = DS_SCHED_FLUSH_PERIOD;
+    DS_AppData.Sched.CDSDeadline   = DS_SCHED_CDS_PERIOD;
 
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT - 1].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT - 1].FileGrowth, 0);
+    /* Execute the function being tested */
+    DS_AppSchedRun();
 
-    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    /* Verify results */
+    UtAssert_STUB_COUNT(DS_WriterSubmit, 0);
+    UtAssert_STUB_COUNT(DS_TableManageFilter, 0);
+}
 
-    /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
-    UtAssert_BOOL_TRUE(TLM_STRUCT_DATA_IS_32_ALIGNED(DS_HkPacket_t));
+void DS_AppProcessWork_Test_Due(void)
+{
+    DS_WriterRecord_t Record;
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_APPHK_FILTER_TBL_PRINT_ERR_EID);
+    memset(&Record, 0, sizeof(Record));
+    Record.Type       = DS_WRITER_WORK;
+    Record.Work       = DS_WRITER_WORK_AGE | DS_WRITER_WORK_DEST_TBL | DS_WRITER_WORK_FLUSH | DS_WRITER_WORK_CDS;
+    Record.AgeSeconds = 3;
 
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    DS_AppData.FileStatus[0].FileHandle = DS_UT_OBJID_1;
+
+    /* Execute the function being tested */
+    DS_AppProcessWork(&Record);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(DS_FileTestAge, 1);
+    UtAssert_STUB_COUNT(DS_TableManageDestFile, 1);
+    UtAssert_STUB_COUNT(DS_FileFlushBuffer, 1);
+    UtAssert_STUB_COUNT(DS_TableCommitCDS, 1);
+    UtAssert_STUB_COUNT(DS_FileRetryFinalize, DS_DEST_FILE_CNT);
+    UtAssert_STUB_COUNT(DS_FileTestPreopen, 1);
+    UtAssert_STUB_COUNT(DS_TableMarkCDS, 0);
+    UtAssert_STUB_COUNT(DS_CmdResetFileCounters, 0);
 }
 
-void DS_AppProcessHK_Test_TblFail(void)
+void DS_AppProcessWork_Test_TableOnly(void)
 {
-    uint32 i;
+    DS_WriterRecord_t Record;
 
-    /* Most values in the HK packet can't be checked because they're stored in a local variable. */
+    memset(&Record, 0, sizeof(Record));
+    Record.Type = DS_WRITER_WORK;
+    Record.Work = DS_WRITER_WORK_DEST_TBL;
+
+    /* Execute the function being tested */
+    DS_AppProcessWork(&Record);
+
+    /* Verify results - files are not pre-opened without an age or flush deadline */
+    UtAssert_STUB_COUNT(DS_TableManageDestFile, 1);
+    UtAssert_STUB_COUNT(DS_FileTestAge, 0);
+    UtAssert_STUB_COUNT(DS_FileFlushBuffer, 0);
+    UtAssert_STUB_COUNT(DS_TableCommitCDS, 0);
+    UtAssert_STUB_COUNT(DS_FileRetryFinalize, 0);
+    UtAssert_STUB_COUNT(DS_FileTestPreopen, 0);
+}
+
+void DS_AppProcessWork_Test_Rate(void)
+{
+    uint32            i;
+    DS_WriterRecord_t Record;
+
+    memset(&Record, 0, sizeof(Record));
+    Record.Type          = DS_WRITER_WORK;
+    Record.Work          = DS_WRITER_WORK_RATE;
+    Record.RateMillisecs = 2000;
 
     for (i = 0; i < DS_DEST_FILE_CNT; i++)
     {
-        DS_AppData.FileStatus[i].FileGrowth = 99;
+        DS_AppData.FileStatus[i].FileGrowth = 100;
     }
 
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetInfo), -1);
-
     /* Execute the function being tested */
-    DS_AppProcessHK();
+    DS_AppProcessWork(&Record);
 
     /* Verify results */
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[0].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[0].FileRate, 50);
     UtAssert_UINT32_EQ(DS_AppData.FileStatus[0].FileGrowth, 0);
 
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT / 2].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT / 2].FileGrowth, 0);
-
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT - 1].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT - 1].FileRate, 50);
     UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT - 1].FileGrowth, 0);
+}
 
-    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+void DS_AppProcessWork_Test_RateNoTime(void)
+{
+    DS_WriterRecord_t Record;
 
-    /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
-    UtAssert_BOOL_TRUE(TLM_STRUCT_DATA_IS_32_ALIGNED(DS_HkPacket_t));
+    memset(&Record, 0, sizeof(Record));
+    Record.Type = DS_WRITER_WORK;
+    Record.Work = DS_WRITER_WORK_RATE;
 
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    DS_AppData.FileStatus[0].FileGrowth = 99;
+
+    /* Execute the function being tested */
+    DS_AppProcessWork(&Record);
+
+    /* Verify results - nominal HK cycle is used without a measured interval */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[0].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[0].FileGrowth, 0);
+}
+
+void DS_AppProcessWork_Test_AppStateReset(void)
+{
+    DS_WriterRecord_t Record;
+
+    memset(&Record, 0, sizeof(Record));
+    Record.Type = DS_WRITER_WORK;
+    Record.Work = DS_WRITER_WORK_APP_STATE | DS_WRITER_WORK_RESET;
+
+    /* Execute the function being tested */
+    DS_AppProcessWork(&Record);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(DS_TableMarkCDS, 1);
+    UtAssert_STUB_COUNT(DS_CmdResetFileCounters, 1);
+    UtAssert_STUB_COUNT(DS_TableCommitCDS, 1);
+    UtAssert_STUB_COUNT(DS_FileTestPreopen, 0);
 }
 
 void DS_AppStorePacket_Test_Nominal(void)
@@ -969,10 +1363,14 @@ void DS_AppStorePacket_Test_DestFileTableNotLoaded(void)
 void UtTest_Setup(void)
 {
     UT_DS_TEST_ADD(DS_AppMain_Test_Nominal);
+    UT_DS_TEST_ADD(DS_AppMain_Test_DrainTimeout);
     UT_DS_TEST_ADD(DS_AppMain_Test_AppInitializeError);
     UT_DS_TEST_ADD(DS_AppMain_Test_SBError);
     UT_DS_TEST_ADD(DS_AppMain_Test_SBTimeout);
 
+    UT_DS_TEST_ADD(DS_AppProcessBatch_Test_PipeEmpty);
+    UT_DS_TEST_ADD(DS_AppProcessBatch_Test_BatchLimit);
+
     UT_DS_TEST_ADD(DS_AppInitialize_Test_Nominal);
     UT_DS_TEST_ADD(DS_AppInitialize_Test_EVSRegisterError);
     UT_DS_TEST_ADD(DS_AppInitialize_Test_SBCreatePipeError);
@@ -992,25 +1390,46 @@ void UtTest_Setup(void)
     UT_DS_TEST_ADD(DS_AppProcessCmd_Test_SetFilterFile);
     UT_DS_TEST_ADD(DS_AppProcessCmd_Test_SetFilterType);
     UT_DS_TEST_ADD(DS_AppProcessCmd_Test_SetFilterParms);
-    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_SetDestType);
-    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_SetDestState);
-    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_SetDestPath);
-    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_SetDestBase);
-    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_SetDestExt);
-    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_SetDestSize);
-    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_SetDestAge);
-    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_SetDestCount);
-    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_CloseFile);
-    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_GetFileInfo);
     UT_DS_TEST_ADD(DS_AppProcessCmd_Test_AddMID);
     UT_DS_TEST_ADD(DS_AppProcessCmd_Test_RemoveMID);
-    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_CloseAll);
+    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_GetDedupInfo);
     UT_DS_TEST_ADD(DS_AppProcessCmd_Test_InvalidCommandCode);
+    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_FileCmd);
+    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_FileCmdDropped);
+
+    UT_DS_TEST_ADD(DS_AppProcessFileCmd_Test_SetDestType);
+    UT_DS_TEST_ADD(DS_AppProcessFileCmd_Test_SetDestState);
+    UT_DS_TEST_ADD(DS_AppProcessFileCmd_Test_SetDestPath);
+    UT_DS_TEST_ADD(DS_AppProcessFileCmd_Test_SetDestBase);
+    UT_DS_TEST_ADD(DS_AppProcessFileCmd_Test_SetDestExt);
+    UT_DS_TEST_ADD(DS_AppProcessFileCmd_Test_SetDestSize);
+    UT_DS_TEST_ADD(DS_AppProcessFileCmd_Test_SetDestAge);
+    UT_DS_TEST_ADD(DS_AppProcessFileCmd_Test_SetDestCount);
+    UT_DS_TEST_ADD(DS_AppProcessFileCmd_Test_CloseFile);
+    UT_DS_TEST_ADD(DS_AppProcessFileCmd_Test_GetFileInfo);
+    UT_DS_TEST_ADD(DS_AppProcessFileCmd_Test_CloseAll);
+    UT_DS_TEST_ADD(DS_AppProcessFileCmd_Test_FlushFile);
+    UT_DS_TEST_ADD(DS_AppProcessFileCmd_Test_InvalidCommandCode);
 
     UT_DS_TEST_ADD(DS_AppProcessHK_Test);
     UT_DS_TEST_ADD(DS_AppProcessHK_Test_SnprintfFail);
     UT_DS_TEST_ADD(DS_AppProcessHK_Test_TblFail);
 
+    UT_DS_TEST_ADD(DS_AppSchedInit_Test);
+    UT_DS_TEST_ADD(DS_AppSchedTimeout_Test_Earliest);
+    UT_DS_TEST_ADD(DS_AppSchedTimeout_Test_Limit);
+    UT_DS_TEST_ADD(DS_AppSchedTimeout_Test_Passed);
+    UT_DS_TEST_ADD(DS_AppSchedRun_Test_Due);
+    UT_DS_TEST_ADD(DS_AppSchedRun_Test_RingFull);
+    UT_DS_TEST_ADD(DS_AppSchedRun_Test_TableDue);
+    UT_DS_TEST_ADD(DS_AppSchedRun_Test_NotDue);
+
+    UT_DS_TEST_ADD(DS_AppProcessWork_Test_Due);
+    UT_DS_TEST_ADD(DS_AppProcessWork_Test_TableOnly);
+    UT_DS_TEST_ADD(DS_AppProcessWork_Test_Rate);
+    UT_DS_TEST_ADD(DS_AppProcessWork_Test_RateNoTime);
+    UT_DS_TEST_ADD(DS_AppProcessWork_Test_AppStateReset);
+
     UT_DS_TEST_ADD(DS_AppStorePacket_Test_Nominal);
     UT_DS_TEST_ADD(DS_AppStorePacket_Test_DSDisabled);
     UT_DS_TEST_ADD(DS_AppStorePacket_Test_FilterTableNotLoaded);
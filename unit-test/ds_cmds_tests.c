@@ -136,6 +136,10 @@ void DS_CmdReset_Test_Nominal(void)
     char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Reset counters command");
 
+    DS_AppData.DuplicatePktCounter[0] = 1;
+    DS_AppData.RateLimitedPktCounter  = 1;
+    DS_AppData.FlushCounter           = 1;
+
     /* Execute the function being tested */
     DS_CmdReset(&UT_CmdBuf.Buf);
 
@@ -146,15 +150,20 @@ void DS_CmdReset_Test_Nominal(void)
     UtAssert_True(DS_AppData.IgnoredPktCounter == 0, "DS_AppData.IgnoredPktCounter == 0");
     UtAssert_True(DS_AppData.FilteredPktCounter == 0, "DS_AppData.FilteredPktCounter == 0");
     UtAssert_True(DS_AppData.PassedPktCounter == 0, "DS_AppData.PassedPktCounter == 0");
-    UtAssert_True(DS_AppData.FileWriteCounter == 0, "DS_AppData.FileWriteCounter == 0");
-    UtAssert_True(DS_AppData.FileWriteErrCounter == 0, "DS_AppData.FileWriteErrCounter == 0");
-    UtAssert_True(DS_AppData.FileUpdateCounter == 0, "DS_AppData.FileUpdateCounter == 0");
-    UtAssert_True(DS_AppData.FileUpdateErrCounter == 0, "DS_AppData.FileUpdateErrCounter == 0");
-    UtAssert_True(DS_AppData.DestTblLoadCounter == 0, "DS_AppData.DestTblLoadCounter == 0");
-    UtAssert_True(DS_AppData.DestTblErrCounter == 0, "DS_AppData.DestTblErrCounter == 0");
+    UtAssert_True(DS_AppData.DuplicatePktCounter[0] == 0, "DS_AppData.DuplicatePktCounter[0] == 0");
+    UtAssert_True(DS_AppData.RateLimitedPktCounter == 0, "DS_AppData.RateLimitedPktCounter == 0");
+    UtAssert_True(DS_AppData.LastBatchSize == 0, "DS_AppData.LastBatchSize == 0");
+    UtAssert_True(DS_AppData.MaxBatchSize == 0, "DS_AppData.MaxBatchSize == 0");
+    UtAssert_True(DS_AppData.BatchCounter == 0, "DS_AppData.BatchCounter == 0");
+    UtAssert_True(DS_AppData.BatchPktCounter == 0, "DS_AppData.BatchPktCounter == 0");
     UtAssert_True(DS_AppData.FilterTblLoadCounter == 0, "DS_AppData.FilterTblLoadCounter == 0");
     UtAssert_True(DS_AppData.FilterTblErrCounter == 0, "DS_AppData.FilterTblErrCounter == 0");
 
+    /* Counters kept by the storage writer are reset by the storage writer */
+    UtAssert_True(DS_AppData.FlushCounter == 1, "DS_AppData.FlushCounter == 1");
+    UtAssert_STUB_COUNT(DS_WriterSubmit, 1);
+    UtAssert_STUB_COUNT(DS_CmdResetFileCounters, 0);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
 
@@ -203,6 +212,47 @@ void DS_CmdReset_Test_InvalidCommandLength(void)
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
 }
 
+void DS_CmdResetFileCounters_Test(void)
+{
+    DS_AppData.FileCmdAcceptedCounter = 1;
+    DS_AppData.FileCmdRejectedCounter = 1;
+    DS_AppData.FlushCounter           = 1;
+    DS_AppData.RotationCounter        = 1;
+    DS_AppData.FinalizeCounter        = 1;
+    DS_AppData.FileWriteCounter       = 1;
+    DS_AppData.DestTblLoadCounter     = 1;
+    DS_AppData.CmdAcceptedCounter     = 1;
+
+    /* Execute the function being tested */
+    DS_CmdResetFileCounters();
+
+    /* Verify results */
+    UtAssert_True(DS_AppData.FileCmdAcceptedCounter == 0, "DS_AppData.FileCmdAcceptedCounter == 0");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 0, "DS_AppData.FileCmdRejectedCounter == 0");
+    UtAssert_True(DS_AppData.FlushCounter == 0, "DS_AppData.FlushCounter == 0");
+    UtAssert_True(DS_AppData.FlushByteCounter == 0, "DS_AppData.FlushByteCounter == 0");
+    UtAssert_True(DS_AppData.DirectFlushCounter == 0, "DS_AppData.DirectFlushCounter == 0");
+    UtAssert_True(DS_AppData.RotationCounter == 0, "DS_AppData.RotationCounter == 0");
+    UtAssert_True(DS_AppData.FileWriteCounter == 0, "DS_AppData.FileWriteCounter == 0");
+    UtAssert_True(DS_AppData.FileWriteErrCounter == 0, "DS_AppData.FileWriteErrCounter == 0");
+    UtAssert_True(DS_AppData.FileUpdateCounter == 0, "DS_AppData.FileUpdateCounter == 0");
+    UtAssert_True(DS_AppData.FileUpdateErrCounter == 0, "DS_AppData.FileUpdateErrCounter == 0");
+    UtAssert_True(DS_AppData.FinalizeCounter == 0, "DS_AppData.FinalizeCounter == 0");
+    UtAssert_True(DS_AppData.MaxFinalizeTime == 0, "DS_AppData.MaxFinalizeTime == 0");
+    UtAssert_True(DS_AppData.SyncCounter == 0, "DS_AppData.SyncCounter == 0");
+    UtAssert_True(DS_AppData.SyncErrCounter == 0, "DS_AppData.SyncErrCounter == 0");
+    UtAssert_True(DS_AppData.MaxSyncTime == 0, "DS_AppData.MaxSyncTime == 0");
+    UtAssert_True(DS_AppData.DestTblLoadCounter == 0, "DS_AppData.DestTblLoadCounter == 0");
+    UtAssert_True(DS_AppData.DestTblErrCounter == 0, "DS_AppData.DestTblErrCounter == 0");
+
+    /* Main task command counters are not changed */
+    UtAssert_True(DS_AppData.CmdAcceptedCounter == 1, "DS_AppData.CmdAcceptedCounter == 1");
+
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void DS_CmdSetAppState_Test_Nominal(void)
 {
     int32 strCmpResult;
@@ -227,6 +277,8 @@ void DS_CmdSetAppState_Test_Nominal(void)
     /* Verify results */
     UtAssert_INT32_EQ(DS_AppData.CmdRejectedCounter, 0);
     UtAssert_INT32_EQ(DS_AppData.CmdAcceptedCounter, 1);
+    UtAssert_STUB_COUNT(DS_WriterSubmit, 1);
+    UtAssert_STUB_COUNT(DS_TableMarkCDS, 0);
     UtAssert_True(DS_AppData.AppEnableState == true, "DS_AppData.AppEnableState == true");
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_ENADIS_CMD_EID);
@@ -315,8 +367,6 @@ void DS_CmdSetAppState_Test_InvalidAppState(void)
 
 void DS_CmdSetFilterFile_Test_Nominal(void)
 {
-    DS_HashLink_t HashLink;
-
     size_t            forced_Size             = sizeof(DS_FilterFileCmd_t);
     CFE_SB_MsgId_t    forced_MsgID            = CFE_SB_ValueToMsgId(DS_CMD_MID);
     CFE_MSG_FcnCode_t forced_CmdCode          = DS_SET_FILTER_FILE_CC;
@@ -335,8 +385,6 @@ void DS_CmdSetFilterFile_Test_Nominal(void)
     UT_CmdBuf.FilterFileCmd.MessageID        = DS_UT_MID_1;
     UT_CmdBuf.FilterFileCmd.FileTableIndex   = 4;
 
-    DS_AppData.HashTable[187]                  = &HashLink;
-    HashLink.Index                             = 0;
     DS_AppData.FilterTblPtr->Packet->MessageID = DS_UT_MID_1;
     DS_AppData.FilterTblPtr->Packet[forced_FilterTableIndex]
         .Filter[UT_CmdBuf.FilterFileCmd.FilterParmsIndex]
@@ -360,6 +408,8 @@ void DS_CmdSetFilterFile_Test_Nominal(void)
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
 
+    UtAssert_STUB_COUNT(DS_TableCompileRoute, 1);
+
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FILE_CMD_EID);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
@@ -557,8 +607,6 @@ void DS_CmdSetFilterFile_Test_FilterTableNotLoaded(void)
 
 void DS_CmdSetFilterFile_Test_MessageIDNotInFilterTable(void)
 {
-    DS_HashLink_t HashLink;
-
     size_t            forced_Size    = sizeof(DS_FilterFileCmd_t);
     CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
     CFE_MSG_FcnCode_t forced_CmdCode = DS_SET_FILTER_FILE_CC;
@@ -576,8 +624,6 @@ void DS_CmdSetFilterFile_Test_MessageIDNotInFilterTable(void)
     UT_CmdBuf.FilterFileCmd.MessageID        = DS_UT_MID_2;
     UT_CmdBuf.FilterFileCmd.FileTableIndex   = 4;
 
-    DS_AppData.HashTable[187]                  = &HashLink;
-    HashLink.Index                             = 0;
     DS_AppData.FilterTblPtr->Packet->MessageID = DS_UT_MID_1;
 
     UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyFileIndex), true);
@@ -603,8 +649,6 @@ void DS_CmdSetFilterFile_Test_MessageIDNotInFilterTable(void)
 
 void DS_CmdSetFilterType_Test_Nominal(void)
 {
-    DS_HashLink_t HashLink;
-
     size_t            forced_Size    = sizeof(DS_FilterTypeCmd_t);
     CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
     CFE_MSG_FcnCode_t forced_CmdCode = DS_SET_FILTER_TYPE_CC;
@@ -622,11 +666,9 @@ void DS_CmdSetFilterType_Test_Nominal(void)
     UT_CmdBuf.FilterTypeCmd.MessageID        = DS_UT_MID_1;
     UT_CmdBuf.FilterTypeCmd.FilterType       = 1;
 
-    DS_AppData.HashTable[187]                  = &HashLink;
-    HashLink.Index                             = 0;
     DS_AppData.FilterTblPtr->Packet->MessageID = DS_UT_MID_1;
 
-    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyType), true);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyFilterType), true);
 
     /* Execute the function being tested */
     DS_CmdSetFilterType(&UT_CmdBuf.Buf);
@@ -641,6 +683,8 @@ void DS_CmdSetFilterType_Test_Nominal(void)
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
 
+    UtAssert_STUB_COUNT(DS_TableCompileRoute, 1);
+
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FTYPE_CMD_EID);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
@@ -811,7 +855,7 @@ void DS_CmdSetFilterType_Test_FilterTableNotLoaded(void)
     UT_CmdBuf.FilterTypeCmd.FilterParmsIndex = 1;
     UT_CmdBuf.FilterTypeCmd.FilterType       = 1;
 
-    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyType), true);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyFilterType), true);
 
     /* Reset table pointer to NULL (set in test setup) */
     DS_AppData.FilterTblPtr = NULL;
@@ -835,8 +879,6 @@ void DS_CmdSetFilterType_Test_FilterTableNotLoaded(void)
 
 void DS_CmdSetFilterType_Test_MessageIDNotInFilterTable(void)
 {
-    DS_HashLink_t HashLink;
-
     size_t            forced_Size    = sizeof(DS_FilterTypeCmd_t);
     CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
     CFE_MSG_FcnCode_t forced_CmdCode = DS_SET_FILTER_TYPE_CC;
@@ -854,11 +896,9 @@ void DS_CmdSetFilterType_Test_MessageIDNotInFilterTable(void)
     UT_CmdBuf.FilterTypeCmd.FilterParmsIndex = 1;
     UT_CmdBuf.FilterTypeCmd.FilterType       = 1;
 
-    DS_AppData.HashTable[187]                  = &HashLink;
-    HashLink.Index                             = 0;
     DS_AppData.FilterTblPtr->Packet->MessageID = DS_UT_MID_1;
 
-    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyType), true);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyFilterType), true);
     UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), DS_INDEX_NONE);
 
     /* Execute the function being tested */
@@ -881,8 +921,6 @@ void DS_CmdSetFilterType_Test_MessageIDNotInFilterTable(void)
 
 void DS_CmdSetFilterParms_Test_Nominal(void)
 {
-    DS_HashLink_t HashLink;
-
     size_t            forced_Size    = sizeof(DS_FilterParmsCmd_t);
     CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
     CFE_MSG_FcnCode_t forced_CmdCode = DS_SET_FILTER_PARMS_CC;
@@ -902,8 +940,6 @@ void DS_CmdSetFilterParms_Test_Nominal(void)
     UT_CmdBuf.FilterParmsCmd.Algorithm_X      = 0;
     UT_CmdBuf.FilterParmsCmd.Algorithm_O      = 0;
 
-    DS_AppData.HashTable[187]                  = &HashLink;
-    HashLink.Index                             = 0;
     DS_AppData.FilterTblPtr->Packet->MessageID = DS_UT_MID_1;
 
     UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyParms), true);
@@ -929,6 +965,8 @@ void DS_CmdSetFilterParms_Test_Nominal(void)
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
 
+    UtAssert_STUB_COUNT(DS_TableCompileRoute, 1);
+
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_PARMS_CMD_EID);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
@@ -1047,8 +1085,6 @@ void DS_CmdSetFilterParms_Test_InvalidFilterParametersIndex(void)
 
 void DS_CmdSetFilterParms_Test_InvalidFilterAlgorithm(void)
 {
-    DS_HashLink_t HashLink;
-
     size_t            forced_Size    = sizeof(DS_FilterParmsCmd_t);
     CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
     CFE_MSG_FcnCode_t forced_CmdCode = DS_SET_FILTER_PARMS_CC;
@@ -1068,8 +1104,6 @@ void DS_CmdSetFilterParms_Test_InvalidFilterAlgorithm(void)
     UT_CmdBuf.FilterParmsCmd.Algorithm_X      = 1;
     UT_CmdBuf.FilterParmsCmd.Algorithm_O      = 1;
 
-    DS_AppData.HashTable[187]                  = &HashLink;
-    HashLink.Index                             = 0;
     DS_AppData.FilterTblPtr->Packet->MessageID = DS_UT_MID_1;
 
     /* Execute the function being tested */
@@ -1090,6 +1124,38 @@ void DS_CmdSetFilterParms_Test_InvalidFilterAlgorithm(void)
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
 }
 
+void DS_CmdSetFilterParms_Test_ByteRateBurst(void)
+{
+    size_t            forced_Size    = sizeof(DS_FilterParmsCmd_t);
+    CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
+    CFE_MSG_FcnCode_t forced_CmdCode = DS_SET_FILTER_PARMS_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
+
+    UT_CmdBuf.FilterParmsCmd.FilterParmsIndex = 2;
+    UT_CmdBuf.FilterParmsCmd.MessageID        = DS_UT_MID_1;
+    UT_CmdBuf.FilterParmsCmd.Algorithm_N      = 1;
+    UT_CmdBuf.FilterParmsCmd.Algorithm_X      = 1;
+    UT_CmdBuf.FilterParmsCmd.Algorithm_O      = 0;
+
+    DS_AppData.FilterTblPtr->Packet->MessageID = DS_UT_MID_1;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyParms), true);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyBurst), false);
+
+    /* Execute the function being tested */
+    DS_CmdSetFilterParms(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_STUB_COUNT(DS_TableCompileRoute, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_PARMS_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
 void DS_CmdSetFilterParms_Test_FilterTableNotLoaded(void)
 {
     size_t            forced_Size    = sizeof(DS_FilterParmsCmd_t);
@@ -1133,8 +1199,6 @@ void DS_CmdSetFilterParms_Test_FilterTableNotLoaded(void)
 
 void DS_CmdSetFilterParms_Test_MessageIDNotInFilterTable(void)
 {
-    DS_HashLink_t HashLink;
-
     size_t            forced_Size    = sizeof(DS_FilterParmsCmd_t);
     CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
     CFE_MSG_FcnCode_t forced_CmdCode = DS_SET_FILTER_PARMS_CC;
@@ -1151,8 +1215,6 @@ void DS_CmdSetFilterParms_Test_MessageIDNotInFilterTable(void)
     UT_CmdBuf.FilterParmsCmd.FilterParmsIndex = 2;
     UT_CmdBuf.FilterParmsCmd.MessageID        = DS_UT_MID_2;
 
-    DS_AppData.HashTable[187]                  = &HashLink;
-    HashLink.Index                             = 0;
     DS_AppData.FilterTblPtr->Packet->MessageID = DS_UT_MID_1;
 
     UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyParms), true);
@@ -1201,11 +1263,13 @@ void DS_CmdSetDestType_Test_Nominal(void)
     DS_CmdSetDestType(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdAcceptedCounter == 1, "DS_AppData.CmdAcceptedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdAcceptedCounter == 1, "DS_AppData.FileCmdAcceptedCounter == 1");
 
     UtAssert_True(DS_AppData.DestFileTblPtr->File[UT_CmdBuf.DestTypeCmd.FileTableIndex].FileNameType == 2,
                   "DS_AppData.DestFileTblPtr->File[UT_CmdBuf.DestTypeCmd.FileTableIndex].FileNameType == 2");
 
+    UtAssert_STUB_COUNT(DS_FileCloseSpare, 1);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
 
@@ -1240,7 +1304,7 @@ void DS_CmdSetDestType_Test_InvalidCommandLength(void)
     DS_CmdSetDestType(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -1275,7 +1339,7 @@ void DS_CmdSetDestType_Test_InvalidFileTableIndex(void)
     DS_CmdSetDestType(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -1313,7 +1377,7 @@ void DS_CmdSetDestType_Test_InvalidFilenameType(void)
     DS_CmdSetDestType(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -1354,7 +1418,7 @@ void DS_CmdSetDestType_Test_FileTableNotLoaded(void)
     DS_CmdSetDestType(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -1393,7 +1457,7 @@ void DS_CmdSetDestState_Test_Nominal(void)
     DS_CmdSetDestState(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdAcceptedCounter == 1, "DS_AppData.CmdAcceptedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdAcceptedCounter == 1, "DS_AppData.FileCmdAcceptedCounter == 1");
 
     UtAssert_True(DS_AppData.DestFileTblPtr->File[UT_CmdBuf.DestStateCmd.FileTableIndex].EnableState ==
                       UT_CmdBuf.DestStateCmd.EnableState,
@@ -1434,7 +1498,7 @@ void DS_CmdSetDestState_Test_InvalidCommandLength(void)
     DS_CmdSetDestState(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -1469,7 +1533,7 @@ void DS_CmdSetDestState_Test_InvalidFileTableIndex(void)
     DS_CmdSetDestState(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -1507,7 +1571,7 @@ void DS_CmdSetDestState_Test_InvalidFileState(void)
     DS_CmdSetDestState(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -1547,7 +1611,7 @@ void DS_CmdSetDestState_Test_FileTableNotLoaded(void)
     DS_CmdSetDestState(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -1585,7 +1649,7 @@ void DS_CmdSetDestPath_Test_Nominal(void)
     DS_CmdSetDestPath(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdAcceptedCounter == 1, "DS_AppData.CmdAcceptedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdAcceptedCounter == 1, "DS_AppData.FileCmdAcceptedCounter == 1");
 
     UtAssert_True(strncmp(DS_AppData.DestFileTblPtr->File[UT_CmdBuf.DestPathCmd.FileTableIndex].Pathname, "pathname",
                           sizeof(DS_AppData.DestFileTblPtr->File[0].Pathname)) == 0,
@@ -1626,7 +1690,7 @@ void DS_CmdSetDestPath_Test_InvalidCommandLength(void)
     DS_CmdSetDestPath(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -1661,7 +1725,7 @@ void DS_CmdSetDestPath_Test_InvalidFileTableIndex(void)
     DS_CmdSetDestPath(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -1701,7 +1765,7 @@ void DS_CmdSetDestPath_Test_FileTableNotLoaded(void)
     DS_CmdSetDestPath(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -1739,7 +1803,7 @@ void DS_CmdSetDestBase_Test_Nominal(void)
     DS_CmdSetDestBase(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdAcceptedCounter == 1, "DS_AppData.CmdAcceptedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdAcceptedCounter == 1, "DS_AppData.FileCmdAcceptedCounter == 1");
 
     UtAssert_True(strncmp(DS_AppData.DestFileTblPtr->File[UT_CmdBuf.DestBaseCmd.FileTableIndex].Basename, "base",
                           sizeof(DS_AppData.DestFileTblPtr->File[0].Basename)) == 0,
@@ -1780,7 +1844,7 @@ void DS_CmdSetDestBase_Test_InvalidCommandLength(void)
     DS_CmdSetDestBase(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -1815,7 +1879,7 @@ void DS_CmdSetDestBase_Test_InvalidFileTableIndex(void)
     DS_CmdSetDestBase(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -1855,7 +1919,7 @@ void DS_CmdSetDestBase_Test_FileTableNotLoaded(void)
     DS_CmdSetDestBase(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -1893,7 +1957,7 @@ void DS_CmdSetDestExt_Test_Nominal(void)
     DS_CmdSetDestExt(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdAcceptedCounter == 1, "DS_AppData.CmdAcceptedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdAcceptedCounter == 1, "DS_AppData.FileCmdAcceptedCounter == 1");
 
     UtAssert_True(strncmp(DS_AppData.DestFileTblPtr->File[UT_CmdBuf.DestExtCmd.FileTableIndex].Extension, "txt",
                           DS_EXTENSION_BUFSIZE) == 0,
@@ -1935,7 +1999,7 @@ void DS_CmdSetDestExt_Test_InvalidCommandLength(void)
     DS_CmdSetDestExt(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -1970,7 +2034,7 @@ void DS_CmdSetDestExt_Test_InvalidFileTableIndex(void)
     DS_CmdSetDestExt(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -2010,7 +2074,7 @@ void DS_CmdSetDestExt_Test_FileTableNotLoaded(void)
     DS_CmdSetDestExt(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -2049,7 +2113,7 @@ void DS_CmdSetDestSize_Test_Nominal(void)
     DS_CmdSetDestSize(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdAcceptedCounter == 1, "DS_AppData.CmdAcceptedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdAcceptedCounter == 1, "DS_AppData.FileCmdAcceptedCounter == 1");
 
     UtAssert_True(DS_AppData.DestFileTblPtr->File[UT_CmdBuf.DestSizeCmd.FileTableIndex].MaxFileSize == 100000000,
                   "DS_AppData.DestFileTblPtr->File[UT_CmdBuf.DestSizeCmd.FileTableIndex].MaxFileSize == 100000000");
@@ -2091,7 +2155,7 @@ void DS_CmdSetDestSize_Test_InvalidCommandLength(void)
     DS_CmdSetDestSize(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -2127,7 +2191,7 @@ void DS_CmdSetDestSize_Test_InvalidFileTableIndex(void)
     DS_CmdSetDestSize(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -2167,7 +2231,7 @@ void DS_CmdSetDestSize_Test_InvalidFileSizeLimit(void)
     DS_CmdSetDestSize(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -2208,7 +2272,7 @@ void DS_CmdSetDestSize_Test_FileTableNotLoaded(void)
     DS_CmdSetDestSize(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -2247,7 +2311,7 @@ void DS_CmdSetDestAge_Test_Nominal(void)
     DS_CmdSetDestAge(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdAcceptedCounter == 1, "DS_AppData.CmdAcceptedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdAcceptedCounter == 1, "DS_AppData.FileCmdAcceptedCounter == 1");
 
     UtAssert_True(DS_AppData.DestFileTblPtr->File[UT_CmdBuf.DestAgeCmd.FileTableIndex].MaxFileAge == 1000,
                   "DS_AppData.DestFileTblPtr->File[UT_CmdBuf.DestAgeCmd.FileTableIndex].MaxFileAge == 1000");
@@ -2289,7 +2353,7 @@ void DS_CmdSetDestAge_Test_InvalidCommandLength(void)
     DS_CmdSetDestAge(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -2325,7 +2389,7 @@ void DS_CmdSetDestAge_Test_InvalidFileTableIndex(void)
     DS_CmdSetDestAge(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -2364,7 +2428,7 @@ void DS_CmdSetDestAge_Test_InvalidFileAgeLimit(void)
     DS_CmdSetDestAge(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -2405,7 +2469,7 @@ void DS_CmdSetDestAge_Test_FileTableNotLoaded(void)
     DS_CmdSetDestAge(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -2444,7 +2508,7 @@ void DS_CmdSetDestCount_Test_Nominal(void)
     DS_CmdSetDestCount(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdAcceptedCounter == 1, "DS_AppData.CmdAcceptedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdAcceptedCounter == 1, "DS_AppData.FileCmdAcceptedCounter == 1");
 
     UtAssert_True(DS_AppData.DestFileTblPtr->File[UT_CmdBuf.DestCountCmd.FileTableIndex].SequenceCount == 1,
                   "DS_AppData.DestFileTblPtr->File[UT_CmdBuf.DestCountCmd.FileTableIndex].SequenceCount == 1");
@@ -2452,6 +2516,10 @@ void DS_CmdSetDestCount_Test_Nominal(void)
     UtAssert_True(DS_AppData.FileStatus[UT_CmdBuf.DestCountCmd.FileTableIndex].FileCount == 1,
                   "DS_AppData.FileStatus[UT_CmdBuf.DestCountCmd.FileTableIndex].FileCount == 1");
 
+    UtAssert_STUB_COUNT(DS_TableMarkCDS, 1);
+    UtAssert_STUB_COUNT(DS_TableCommitCDS, 1);
+    UtAssert_STUB_COUNT(DS_FileCloseSpare, 1);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
 
@@ -2489,7 +2557,7 @@ void DS_CmdSetDestCount_Test_InvalidCommandLength(void)
     DS_CmdSetDestCount(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -2525,7 +2593,7 @@ void DS_CmdSetDestCount_Test_InvalidFileTableIndex(void)
     DS_CmdSetDestCount(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -2565,7 +2633,7 @@ void DS_CmdSetDestCount_Test_InvalidFileSequenceCount(void)
     DS_CmdSetDestCount(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -2606,7 +2674,7 @@ void DS_CmdSetDestCount_Test_FileTableNotLoaded(void)
     DS_CmdSetDestCount(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -2623,8 +2691,7 @@ void DS_CmdSetDestCount_Test_FileTableNotLoaded(void)
 void DS_CmdCloseFile_Test_Nominal(void)
 {
     uint32 i;
-    uint8  call_count_DS_FileUpdateHeader = 0;
-    uint8  call_count_DS_FileCloseDest    = 0;
+    uint8  call_count_DS_FileCloseDest = 0;
 
     size_t            forced_Size    = sizeof(DS_CloseFileCmd_t);
     CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
@@ -2655,7 +2722,7 @@ void DS_CmdCloseFile_Test_Nominal(void)
     DS_CmdCloseFile(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdAcceptedCounter == 1, "DS_AppData.CmdAcceptedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdAcceptedCounter == 1, "DS_AppData.FileCmdAcceptedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -2668,9 +2735,6 @@ void DS_CmdCloseFile_Test_Nominal(void)
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    call_count_DS_FileUpdateHeader = UT_GetStubCount(UT_KEY(DS_FileUpdateHeader));
-    UtAssert_INT32_EQ(call_count_DS_FileUpdateHeader, 1);
-
     call_count_DS_FileCloseDest = UT_GetStubCount(UT_KEY(DS_FileCloseDest));
     UtAssert_INT32_EQ(call_count_DS_FileCloseDest, 1);
 
@@ -2681,8 +2745,7 @@ void DS_CmdCloseFile_Test_Nominal(void)
 void DS_CmdCloseFile_Test_NominalAlreadyClosed(void)
 {
     uint32 i;
-    uint8  call_count_DS_FileUpdateHeader = 0;
-    uint8  call_count_DS_FileCloseDest    = 0;
+    uint8  call_count_DS_FileCloseDest = 0;
 
     size_t            forced_Size    = sizeof(DS_CloseFileCmd_t);
     CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
@@ -2711,7 +2774,7 @@ void DS_CmdCloseFile_Test_NominalAlreadyClosed(void)
     DS_CmdCloseFile(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdAcceptedCounter == 1, "DS_AppData.CmdAcceptedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdAcceptedCounter == 1, "DS_AppData.FileCmdAcceptedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -2724,9 +2787,6 @@ void DS_CmdCloseFile_Test_NominalAlreadyClosed(void)
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    call_count_DS_FileUpdateHeader = UT_GetStubCount(UT_KEY(DS_FileUpdateHeader));
-    UtAssert_INT32_EQ(call_count_DS_FileUpdateHeader, 0);
-
     call_count_DS_FileCloseDest = UT_GetStubCount(UT_KEY(DS_FileCloseDest));
     UtAssert_INT32_EQ(call_count_DS_FileCloseDest, 0);
 
@@ -2755,7 +2815,7 @@ void DS_CmdCloseFile_Test_InvalidCommandLength(void)
     DS_CmdCloseFile(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -2792,7 +2852,7 @@ void DS_CmdCloseFile_Test_InvalidFileTableIndex(void)
     DS_CmdCloseFile(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -2806,6 +2866,163 @@ void DS_CmdCloseFile_Test_InvalidFileTableIndex(void)
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 }
 
+void DS_CmdFlushFile_Test_Nominal(void)
+{
+    uint32 i;
+    uint8  call_count_DS_FileFlushBuffer = 0;
+
+    size_t            forced_Size    = sizeof(DS_FlushFileCmd_t);
+    CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
+    CFE_MSG_FcnCode_t forced_CmdCode = DS_FLUSH_FILE_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
+
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "DEST FLUSH command: file table index = %%d");
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyFileIndex), true);
+
+    UT_CmdBuf.FlushFileCmd.FileTableIndex = 0;
+
+    DS_AppData.FileStatus[UT_CmdBuf.FlushFileCmd.FileTableIndex].FileHandle = DS_UT_OBJID_1;
+
+    for (i = 1; i < DS_DEST_FILE_CNT; i++)
+    {
+        DS_AppData.FileStatus[i].FileHandle = OS_OBJECT_ID_UNDEFINED;
+    }
+
+    /* Execute the function being tested */
+    DS_CmdFlushFile(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(DS_AppData.FileCmdAcceptedCounter == 1, "DS_AppData.FileCmdAcceptedCounter == 1");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FLUSH_FILE_CMD_EID);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_DS_FileFlushBuffer = UT_GetStubCount(UT_KEY(DS_FileFlushBuffer));
+    UtAssert_INT32_EQ(call_count_DS_FileFlushBuffer, 1);
+
+    /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
+    UtAssert_True(CMD_STRUCT_DATA_IS_32_ALIGNED(DS_FlushFileCmd_t), "DS_FlushFileCmd_t is 32-bit aligned");
+}
+
+void DS_CmdFlushFile_Test_NominalClosed(void)
+{
+    uint32 i;
+
+    size_t            forced_Size    = sizeof(DS_FlushFileCmd_t);
+    CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
+    CFE_MSG_FcnCode_t forced_CmdCode = DS_FLUSH_FILE_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyFileIndex), true);
+
+    UT_CmdBuf.FlushFileCmd.FileTableIndex = 0;
+
+    for (i = 0; i < DS_DEST_FILE_CNT; i++)
+    {
+        DS_AppData.FileStatus[i].FileHandle = OS_OBJECT_ID_UNDEFINED;
+    }
+
+    /* Execute the function being tested */
+    DS_CmdFlushFile(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(DS_AppData.FileCmdAcceptedCounter == 1, "DS_AppData.FileCmdAcceptedCounter == 1");
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FLUSH_FILE_CMD_EID);
+
+    UtAssert_STUB_COUNT(DS_FileFlushBuffer, 0);
+}
+
+void DS_CmdFlushFile_Test_InvalidCommandLength(void)
+{
+    size_t            forced_Size    = sizeof(DS_FlushFileCmd_t) + 1;
+    CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
+    CFE_MSG_FcnCode_t forced_CmdCode = DS_FLUSH_FILE_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
+
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Invalid DEST FLUSH command length: expected = %%d, actual = %%d");
+
+    UT_CmdBuf.FlushFileCmd.FileTableIndex = 0;
+
+    /* Execute the function being tested */
+    DS_CmdFlushFile(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FLUSH_FILE_CMD_ERR_EID);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+void DS_CmdFlushFile_Test_InvalidFileTableIndex(void)
+{
+    size_t            forced_Size    = sizeof(DS_FlushFileCmd_t);
+    CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
+    CFE_MSG_FcnCode_t forced_CmdCode = DS_FLUSH_FILE_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyFileIndex), false);
+
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Invalid DEST FLUSH command arg: file table index = %%d");
+
+    UT_CmdBuf.FlushFileCmd.FileTableIndex = 99;
+
+    /* Execute the function being tested */
+    DS_CmdFlushFile(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FLUSH_FILE_CMD_ERR_EID);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
 void DS_CmdCloseAll_Test_Nominal(void)
 {
     uint32 i;
@@ -2835,7 +3052,9 @@ void DS_CmdCloseAll_Test_Nominal(void)
     DS_CmdCloseAll(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdAcceptedCounter == 1, "DS_AppData.CmdAcceptedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdAcceptedCounter == 1, "DS_AppData.FileCmdAcceptedCounter == 1");
+    UtAssert_STUB_COUNT(DS_TableCommitCDS, 1);
+    UtAssert_STUB_COUNT(DS_FileCloseSpare, DS_DEST_FILE_CNT);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -2868,9 +3087,8 @@ void DS_CmdCloseAll_Test_CloseAll(void)
     UtAssert_VOIDCALL(DS_CmdCloseAll(&UT_CmdBuf.Buf));
 
     /* Verify results */
-    UtAssert_INT32_EQ(DS_AppData.CmdAcceptedCounter, 1);
+    UtAssert_INT32_EQ(DS_AppData.FileCmdAcceptedCounter, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_STUB_COUNT(DS_FileUpdateHeader, DS_DEST_FILE_CNT);
     UtAssert_STUB_COUNT(DS_FileCloseDest, DS_DEST_FILE_CNT);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_CLOSE_ALL_CMD_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
@@ -2898,7 +3116,7 @@ void DS_CmdCloseAll_Test_InvalidCommandLength(void)
     DS_CmdCloseAll(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -2943,7 +3161,7 @@ void DS_CmdGetFileInfo_Test_EnabledOpen(void)
     DS_CmdGetFileInfo(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdAcceptedCounter == 1, "DS_AppData.CmdAcceptedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdAcceptedCounter == 1, "DS_AppData.FileCmdAcceptedCounter == 1");
     /* Changes to DS_FileInfoPkt cannot easily be verified because DS_FileInfoPkt is a local variable */
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -2994,7 +3212,7 @@ void DS_CmdGetFileInfo_Test_DisabledClosed(void)
     DS_CmdGetFileInfo(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdAcceptedCounter == 1, "DS_AppData.CmdAcceptedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdAcceptedCounter == 1, "DS_AppData.FileCmdAcceptedCounter == 1");
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_GET_FILE_INFO_CMD_EID);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
@@ -3027,7 +3245,7 @@ void DS_CmdGetFileInfo_Test_InvalidCommandLength(void)
     DS_CmdGetFileInfo(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(DS_AppData.CmdRejectedCounter == 1, "DS_AppData.CmdRejectedCounter == 1");
+    UtAssert_True(DS_AppData.FileCmdRejectedCounter == 1, "DS_AppData.FileCmdRejectedCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -3041,10 +3259,80 @@ void DS_CmdGetFileInfo_Test_InvalidCommandLength(void)
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 }
 
+void DS_CmdGetDedupInfo_Test_Nominal(void)
+{
+    size_t            forced_Size    = sizeof(DS_GetDedupInfoCmd_t);
+    CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
+    CFE_MSG_FcnCode_t forced_CmdCode = DS_GET_DEDUP_INFO_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
+
+    DS_AppData.FilterTblPtr->Packet[0].MessageID = DS_UT_MID_1;
+    DS_AppData.DuplicatePktCounter[0]            = 7;
+
+    /* Execute the function being tested */
+    DS_CmdGetDedupInfo(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdAcceptedCounter, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_GET_DEDUP_INFO_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+
+    /* Verify telemetry struct size minus header is at least explicitly padded to 32-bit boundaries */
+    UtAssert_True(TLM_STRUCT_DATA_IS_32_ALIGNED(DS_DedupInfoPkt_t), "DS_DedupInfoPkt_t is 32-bit aligned");
+}
+
+void DS_CmdGetDedupInfo_Test_FilterTableNotLoaded(void)
+{
+    size_t            forced_Size    = sizeof(DS_GetDedupInfoCmd_t);
+    CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
+    CFE_MSG_FcnCode_t forced_CmdCode = DS_GET_DEDUP_INFO_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
+
+    DS_AppData.FilterTblPtr = NULL;
+
+    /* Execute the function being tested */
+    DS_CmdGetDedupInfo(&UT_CmdBuf.Buf);
+
+    /* Verify results - packet is still sent */
+    UtAssert_UINT32_EQ(DS_AppData.CmdAcceptedCounter, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_GET_DEDUP_INFO_CMD_EID);
+}
+
+void DS_CmdGetDedupInfo_Test_InvalidCommandLength(void)
+{
+    size_t            forced_Size    = sizeof(DS_GetDedupInfoCmd_t) + 1;
+    CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
+    CFE_MSG_FcnCode_t forced_CmdCode = DS_GET_DEDUP_INFO_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
+
+    /* Execute the function being tested */
+    DS_CmdGetDedupInfo(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_GET_DEDUP_INFO_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
 void DS_CmdAddMID_Test_Nominal(void)
 {
-    int32         FilterTableIndex;
-    DS_HashLink_t HashLink;
+    int32 FilterTableIndex;
 
     size_t            forced_Size    = sizeof(DS_AddMidCmd_t);
     CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
@@ -3064,24 +3352,15 @@ void DS_CmdAddMID_Test_Nominal(void)
 
     UT_CmdBuf.AddMidCmd.MessageID = DS_UT_MID_1;
 
-    DS_AppData.HashTable[0]                                   = &HashLink;
-    HashLink.Index                                            = 0;
-    DS_AppData.FilterTblPtr->Packet[HashLink.Index].MessageID = CFE_SB_INVALID_MSG_ID;
-    HashLink.Next                                             = (struct DS_HashTag *)&DS_AppData.HashTable[1];
-
-    DS_AppData.HashTable[1] = &HashLink;
-    HashLink.Index          = 1;
-    HashLink.Next           = (struct DS_HashTag *)&DS_AppData.HashTable[2];
-
-    DS_AppData.FilterTblPtr->Packet[HashLink.Index].MessageID = DS_UT_MID_2;
+    DS_AppData.FilterTblPtr->Packet[0].MessageID = CFE_SB_INVALID_MSG_ID;
+    DS_AppData.FilterTblPtr->Packet[1].MessageID = DS_UT_MID_2;
 
     FilterTableIndex = 0;
 
-    /* for nominal case, first call to DS_TableFindMsgID must return
-     * DS_INDEX_NONE and the second call must return something other than
-     * DS_INDEX_NONE */
+    /* for nominal case, DS_TableFindMsgID must return DS_INDEX_NONE and
+     * DS_TableAllocEntry must return something other than DS_INDEX_NONE */
     UT_SetDeferredRetcode(UT_KEY(DS_TableFindMsgID), 1, DS_INDEX_NONE);
-    UT_SetDeferredRetcode(UT_KEY(DS_TableFindMsgID), 1, 0);
+    UT_SetDeferredRetcode(UT_KEY(DS_TableAllocEntry), 1, FilterTableIndex);
 
     /* Execute the function being tested */
     DS_CmdAddMID(&UT_CmdBuf.Buf);
@@ -3135,13 +3414,11 @@ void DS_CmdAddMID_Test_Nominal(void)
     UtAssert_True(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET - 1].Algorithm_O == 0,
                   "DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET-1].Algorithm_O == 0");
 
-    /* UtAssert_True (DS_AppData.HashLinks[0].Index == 0, "DS_AppData.HashLinks[0].Index == 0"); */
-    /* UtAssert_True (DS_AppData.HashLinks[0].MessageID == DS_UT_MID_1, "DS_AppData.HashLinks[0].MessageID ==
-     * DS_UT_MID_1"); */
-
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
 
+    UtAssert_STUB_COUNT(DS_TableCompileRoute, 1);
+
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_ADD_MID_CMD_EID);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
@@ -3265,8 +3542,6 @@ void DS_CmdAddMID_Test_FilterTableNotLoaded(void)
 
 void DS_CmdAddMID_Test_MIDAlreadyInFilterTable(void)
 {
-    DS_HashLink_t HashLink;
-
     size_t            forced_Size    = sizeof(DS_AddMidCmd_t);
     CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
     CFE_MSG_FcnCode_t forced_CmdCode = DS_ADD_MID_CC;
@@ -3282,8 +3557,6 @@ void DS_CmdAddMID_Test_MIDAlreadyInFilterTable(void)
 
     UT_CmdBuf.AddMidCmd.MessageID = DS_UT_MID_1;
 
-    DS_AppData.HashTable[187]                  = &HashLink;
-    HashLink.Index                             = 0;
     DS_AppData.FilterTblPtr->Packet->MessageID = DS_UT_MID_1;
 
     UT_SetDeferredRetcode(UT_KEY(DS_TableFindMsgID), 1, 1);
@@ -3322,8 +3595,9 @@ void DS_CmdAddMID_Test_FilterTableFull(void)
 
     UT_CmdBuf.AddMidCmd.MessageID = DS_UT_MID_1;
 
-    /* both calls to DS_TableFindMsgID must return DS_INDEX_NONE */
+    /* DS_TableFindMsgID and DS_TableAllocEntry must both return DS_INDEX_NONE */
     UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), DS_INDEX_NONE);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableAllocEntry), DS_INDEX_NONE);
 
     /* Execute the function being tested */
     DS_CmdAddMID(&UT_CmdBuf.Buf);
@@ -3345,13 +3619,11 @@ void DS_CmdAddMID_Test_FilterTableFull(void)
 
 void DS_CmdRemoveMID_Test_Nominal(void)
 {
-    DS_HashLink_t     HashLink;
     size_t            forced_Size      = sizeof(DS_RemoveMidCmd_t);
     CFE_SB_MsgId_t    MessageID        = DS_UT_MID_1;
     CFE_SB_MsgId_t    forced_MsgID     = CFE_SB_ValueToMsgId(DS_CMD_MID);
     CFE_MSG_FcnCode_t forced_CmdCode   = DS_REMOVE_MID_CC;
     int32             FilterTableIndex = 0;
-    int32             HashTableIndex   = 1;
     int32             strCmpResult;
 
     char ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
@@ -3364,11 +3636,8 @@ void DS_CmdRemoveMID_Test_Nominal(void)
     /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
     UtAssert_True(CMD_STRUCT_DATA_IS_32_ALIGNED(DS_RemoveMidCmd_t), "DS_RemoveMidCmd_t is 32-bit aligned");
 
-    UT_CmdBuf.RemoveMidCmd.MessageID                          = MessageID;
-    HashLink.Index                                            = FilterTableIndex;
-    HashLink.MessageID                                        = MessageID;
-    DS_AppData.HashTable[HashTableIndex]                      = &HashLink;
-    DS_AppData.FilterTblPtr->Packet[HashLink.Index].MessageID = MessageID;
+    UT_CmdBuf.RemoveMidCmd.MessageID                            = MessageID;
+    DS_AppData.FilterTblPtr->Packet[FilterTableIndex].MessageID = MessageID;
 
     UT_SetDeferredRetcode(UT_KEY(DS_TableFindMsgID), 1, FilterTableIndex);
 
@@ -3378,9 +3647,6 @@ void DS_CmdRemoveMID_Test_Nominal(void)
     /* Verify results */
     UtAssert_INT32_EQ(CFE_SB_MsgIdToValue(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].MessageID),
                       CFE_SB_MsgIdToValue(CFE_SB_INVALID_MSG_ID));
-    UtAssert_INT32_EQ(DS_AppData.HashTable[HashTableIndex]->Index, 0);
-    UtAssert_INT32_EQ(CFE_SB_MsgIdToValue(DS_AppData.HashLinks[HashTableIndex].MessageID),
-                      CFE_SB_MsgIdToValue(CFE_SB_INVALID_MSG_ID));
 
     /* Check first elements */
     UtAssert_True(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[0].FileTableIndex == 0,
@@ -3432,8 +3698,10 @@ void DS_CmdRemoveMID_Test_Nominal(void)
 
     UtAssert_STUB_COUNT(CFE_MSG_GetSize, 1);
     UtAssert_STUB_COUNT(CFE_SB_IsValidMsgId, 1);
-    UtAssert_STUB_COUNT(DS_TableHashFunction, 1);
-    UtAssert_STUB_COUNT(DS_TableCreateHash, 1);
+    UtAssert_STUB_COUNT(DS_TableRemoveMsgID, 1);
+    UtAssert_STUB_COUNT(DS_TableCreateHash, 0);
+    UtAssert_STUB_COUNT(DS_TableCompileRoute, 1);
+    UtAssert_STUB_COUNT(DS_TableFreeEntry, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REMOVE_MID_CMD_EID);
@@ -3593,6 +3861,7 @@ void UtTest_Setup(void)
     UtTest_Add(DS_CmdReset_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_CmdReset_Test_Nominal");
     UtTest_Add(DS_CmdReset_Test_InvalidCommandLength, DS_Test_Setup, DS_Test_TearDown,
                "DS_CmdReset_Test_InvalidCommandLength");
+    UtTest_Add(DS_CmdResetFileCounters_Test, DS_Test_Setup, DS_Test_TearDown, "DS_CmdResetFileCounters_Test");
 
     UtTest_Add(DS_CmdSetAppState_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_CmdSetAppState_Test_Nominal");
     UtTest_Add(DS_CmdSetAppState_Test_InvalidCommandLength, DS_Test_Setup, DS_Test_TearDown,
@@ -3637,6 +3906,8 @@ void UtTest_Setup(void)
                "DS_CmdSetFilterParms_Test_InvalidFilterParametersIndex");
     UtTest_Add(DS_CmdSetFilterParms_Test_InvalidFilterAlgorithm, DS_Test_Setup, DS_Test_TearDown,
                "DS_CmdSetFilterParms_Test_InvalidFilterAlgorithm");
+    UtTest_Add(DS_CmdSetFilterParms_Test_ByteRateBurst, DS_Test_Setup, DS_Test_TearDown,
+               "DS_CmdSetFilterParms_Test_ByteRateBurst");
     UtTest_Add(DS_CmdSetFilterParms_Test_FilterTableNotLoaded, DS_Test_Setup, DS_Test_TearDown,
                "DS_CmdSetFilterParms_Test_FilterTableNotLoaded");
     UtTest_Add(DS_CmdSetFilterParms_Test_MessageIDNotInFilterTable, DS_Test_Setup, DS_Test_TearDown,
@@ -3724,6 +3995,14 @@ void UtTest_Setup(void)
     UtTest_Add(DS_CmdCloseFile_Test_InvalidFileTableIndex, DS_Test_Setup, DS_Test_TearDown,
                "DS_CmdCloseFile_Test_InvalidFileTableIndex");
 
+    UtTest_Add(DS_CmdFlushFile_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_CmdFlushFile_Test_Nominal");
+    UtTest_Add(DS_CmdFlushFile_Test_NominalClosed, DS_Test_Setup, DS_Test_TearDown,
+               "DS_CmdFlushFile_Test_NominalClosed");
+    UtTest_Add(DS_CmdFlushFile_Test_InvalidCommandLength, DS_Test_Setup, DS_Test_TearDown,
+               "DS_CmdFlushFile_Test_InvalidCommandLength");
+    UtTest_Add(DS_CmdFlushFile_Test_InvalidFileTableIndex, DS_Test_Setup, DS_Test_TearDown,
+               "DS_CmdFlushFile_Test_InvalidFileTableIndex");
+
     UtTest_Add(DS_CmdCloseAll_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_CmdCloseAll_Test_Nominal");
     UtTest_Add(DS_CmdCloseAll_Test_CloseAll, DS_Test_Setup, DS_Test_TearDown, "DS_CmdCloseAll_Test_CloseAll");
     UtTest_Add(DS_CmdCloseAll_Test_InvalidCommandLength, DS_Test_Setup, DS_Test_TearDown,
@@ -3736,6 +4015,12 @@ void UtTest_Setup(void)
     UtTest_Add(DS_CmdGetFileInfo_Test_InvalidCommandLength, DS_Test_Setup, DS_Test_TearDown,
                "DS_CmdGetFileInfo_Test_InvalidCommandLength");
 
+    UtTest_Add(DS_CmdGetDedupInfo_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_CmdGetDedupInfo_Test_Nominal");
+    UtTest_Add(DS_CmdGetDedupInfo_Test_FilterTableNotLoaded, DS_Test_Setup, DS_Test_TearDown,
+               "DS_CmdGetDedupInfo_Test_FilterTableNotLoaded");
+    UtTest_Add(DS_CmdGetDedupInfo_Test_InvalidCommandLength, DS_Test_Setup, DS_Test_TearDown,
+               "DS_CmdGetDedupInfo_Test_InvalidCommandLength");
+
     UtTest_Add(DS_CmdAddMID_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_CmdAddMID_Test_Nominal");
     UtTest_Add(DS_CmdAddMID_Test_InvalidCommandLength, DS_Test_Setup, DS_Test_TearDown,
                "DS_CmdAddMID_Test_InvalidCommandLength");
@@ -0,0 +1,259 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,917-1, and identified as “CFS Data Storage
+ * (DS) application version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   This file contains unit test cases for the functions contained in the file ds_codec.c
+ */
+
+/*
+ * Includes
+ */
+
+#include "ds_app.h"
+#include "ds_appdefs.h"
+#include "ds_test_utils.h"
+#include "ds_codec.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/*
+ * Helper Functions
+ */
+
+uint8 UT_DS_CodecData[DS_WRITE_BUFFER_MAX_SIZE];
+uint8 UT_DS_CodecBlock[DS_CODEC_BOUND(DS_WRITE_BUFFER_MAX_SIZE)];
+uint8 UT_DS_CodecCheck[DS_WRITE_BUFFER_MAX_SIZE];
+
+/* Telemetry-like data: a repeating packet with a changing counter */
+void UT_DS_CodecFillPackets(void)
+{
+    uint32 i;
+
+    for (i = 0; i < sizeof(UT_DS_CodecData); i++)
+    {
+        UT_DS_CodecData[i] = (uint8)(((i % 64) < 8) ? (i / 64) : (i % 64));
+    }
+}
+
+/* Data with no repeats for the match finder */
+void UT_DS_CodecFillRandom(void)
+{
+    uint32 i;
+    uint32 Seed = 12345;
+
+    for (i = 0; i < sizeof(UT_DS_CodecData); i++)
+    {
+        Seed               = (Seed * 1103515245) + 12345;
+        UT_DS_CodecData[i] = (uint8)(Seed >> 16);
+    }
+}
+
+/*
+ * Function Definitions
+ */
+
+#if (DS_FILE_COMPRESSION == true)
+void DS_CodecCompress_Test_Fast(void)
+{
+    uint32 Length;
+
+    UT_DS_CodecFillPackets();
+
+    /* Execute the function being tested */
+    Length = DS_CodecCompress(DS_CODEC_LZ_FAST, UT_DS_CodecData, sizeof(UT_DS_CodecData), UT_DS_CodecBlock,
+                              sizeof(UT_DS_CodecBlock), &DS_AppData.CodecWork);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(Length != 0);
+    UtAssert_UINT32_LT(Length, sizeof(UT_DS_CodecData) / 2);
+    UtAssert_UINT32_EQ(DS_CodecDecompress(DS_CODEC_LZ_FAST, UT_DS_CodecBlock, Length, UT_DS_CodecCheck,
+                                          sizeof(UT_DS_CodecCheck)),
+                       sizeof(UT_DS_CodecData));
+    UtAssert_MemCmp(UT_DS_CodecCheck, UT_DS_CodecData, sizeof(UT_DS_CodecData), "Decompressed data");
+}
+
+void DS_CodecCompress_Test_High(void)
+{
+    uint32 FastLength;
+    uint32 Length;
+
+    UT_DS_CodecFillPackets();
+    FastLength = DS_CodecCompress(DS_CODEC_LZ_FAST, UT_DS_CodecData, sizeof(UT_DS_CodecData), UT_DS_CodecBlock,
+                                  sizeof(UT_DS_CodecBlock), &DS_AppData.CodecWork);
+
+    /* Execute the function being tested */
+    Length = DS_CodecCompress(DS_CODEC_LZ_HIGH, UT_DS_CodecData, sizeof(UT_DS_CodecData), UT_DS_CodecBlock,
+                              sizeof(UT_DS_CodecBlock), &DS_AppData.CodecWork);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(Length != 0);
+    UtAssert_UINT32_LTEQ(Length, FastLength);
+    UtAssert_UINT32_EQ(DS_CodecDecompress(DS_CODEC_LZ_HIGH, UT_DS_CodecBlock, Length, UT_DS_CodecCheck,
+                                          sizeof(UT_DS_CodecCheck)),
+                       sizeof(UT_DS_CodecData));
+    UtAssert_MemCmp(UT_DS_CodecCheck, UT_DS_CodecData, sizeof(UT_DS_CodecData), "Decompressed data");
+}
+
+void DS_CodecCompress_Test_Incompressible(void)
+{
+    UT_DS_CodecFillRandom();
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(DS_CodecCompress(DS_CODEC_LZ_HIGH, UT_DS_CodecData, sizeof(UT_DS_CodecData),
+                                        UT_DS_CodecBlock, sizeof(UT_DS_CodecBlock), &DS_AppData.CodecWork),
+                       0);
+}
+
+void DS_CodecCompressLZ_Test_OutputFull(void)
+{
+    UT_DS_CodecFillPackets();
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(DS_CodecCompressLZ(UT_DS_CodecData, sizeof(UT_DS_CodecData), UT_DS_CodecBlock, 16,
+                                          &DS_AppData.CodecWork, 1),
+                       0);
+}
+#endif
+
+void DS_CodecCompress_Test_NotCompressed(void)
+{
+    UT_DS_CodecFillPackets();
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(DS_CodecCompress(DS_CODEC_NONE, UT_DS_CodecData, sizeof(UT_DS_CodecData), UT_DS_CodecBlock,
+                                        sizeof(UT_DS_CodecBlock), &DS_AppData.CodecWork),
+                       0);
+    UtAssert_UINT32_EQ(DS_CodecCompress(DS_CODEC_COUNT, UT_DS_CodecData, sizeof(UT_DS_CodecData), UT_DS_CodecBlock,
+                                        sizeof(UT_DS_CodecBlock), &DS_AppData.CodecWork),
+                       0);
+    UtAssert_UINT32_EQ(DS_CodecCompress(DS_CODEC_LZ_FAST, UT_DS_CodecData, DS_WRITE_BUFFER_MAX_SIZE + 1,
+                                        UT_DS_CodecBlock, sizeof(UT_DS_CodecBlock), &DS_AppData.CodecWork),
+                       0);
+}
+
+void DS_CodecPutSequence_Test_LongLengths(void)
+{
+    uint32 Length;
+    uint32 Position = 1;
+    uint32 Count    = 0;
+
+    memset(UT_DS_CodecData, 0xA5, 300);
+
+    /* Execute the function being tested */
+    Length = DS_CodecPutSequence(UT_DS_CodecBlock, 0, sizeof(UT_DS_CodecBlock), UT_DS_CodecData, 300, 300, 600);
+
+    /* Verify results - token, 2 literal length bytes, literals, offset, 3 match length bytes */
+    UtAssert_UINT32_EQ(Length, 1 + 2 + 300 + 2 + 3);
+    UtAssert_UINT32_EQ(UT_DS_CodecBlock[0], 0xFF);
+    UtAssert_BOOL_TRUE(DS_CodecGetLength(UT_DS_CodecBlock, Length, &Position, 15, &Count));
+    UtAssert_UINT32_EQ(Count, 300);
+    Position += 300 + 2;
+    UtAssert_BOOL_TRUE(DS_CodecGetLength(UT_DS_CodecBlock, Length, &Position, 15, &Count));
+    UtAssert_UINT32_EQ(Count, 600 - DS_CODEC_MIN_MATCH);
+    UtAssert_UINT32_EQ(Position, Length);
+}
+
+void DS_CodecPutSequence_Test_OutputFull(void)
+{
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(DS_CodecPutSequence(UT_DS_CodecBlock, 10, 12, UT_DS_CodecData, 4, 0, 0), 0);
+    UtAssert_UINT32_EQ(DS_CodecPutSequence(UT_DS_CodecBlock, 13, 12, UT_DS_CodecData, 0, 0, 0), 0);
+}
+
+void DS_CodecGetLength_Test_Truncated(void)
+{
+    uint8  Data[2]  = {255, 255};
+    uint32 Position = 0;
+    uint32 Count    = 0;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_CodecGetLength(Data, sizeof(Data), &Position, 15, &Count));
+    UtAssert_UINT32_EQ(Position, sizeof(Data));
+}
+
+void DS_CodecDecompress_Test_Match(void)
+{
+    /* "ab" then an overlapping 6 byte match at offset 2, then "c" */
+    uint8 Block[] = {0x22, 'a', 'b', 2, 0, 0x10, 'c'};
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(DS_CodecDecompress(DS_CODEC_LZ_FAST, Block, sizeof(Block), UT_DS_CodecCheck,
+                                          sizeof(UT_DS_CodecCheck)),
+                       9);
+
+    /* Verify results */
+    UtAssert_MemCmp(UT_DS_CodecCheck, "abababab" "c", 9, "Decompressed data");
+}
+
+void DS_CodecDecompress_Test_Invalid(void)
+{
+    uint8 BadOffset[]   = {0x20, 'a', 'b', 3, 0, 0x00};
+    uint8 NoLast[]      = {0x20, 'a', 'b', 2, 0};
+    uint8 ShortOffset[] = {0x20, 'a', 'b', 2};
+    uint8 ShortData[]   = {0x40, 'a', 'b'};
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(DS_CodecDecompress(DS_CODEC_NONE, ShortData, sizeof(ShortData), UT_DS_CodecCheck,
+                                          sizeof(UT_DS_CodecCheck)),
+                       0);
+    UtAssert_UINT32_EQ(DS_CodecDecompress(DS_CODEC_LZ_FAST, BadOffset, sizeof(BadOffset), UT_DS_CodecCheck,
+                                          sizeof(UT_DS_CodecCheck)),
+                       0);
+    UtAssert_UINT32_EQ(DS_CodecDecompress(DS_CODEC_LZ_FAST, NoLast, sizeof(NoLast), UT_DS_CodecCheck,
+                                          sizeof(UT_DS_CodecCheck)),
+                       0);
+    UtAssert_UINT32_EQ(DS_CodecDecompress(DS_CODEC_LZ_FAST, ShortOffset, sizeof(ShortOffset), UT_DS_CodecCheck,
+                                          sizeof(UT_DS_CodecCheck)),
+                       0);
+    UtAssert_UINT32_EQ(DS_CodecDecompress(DS_CODEC_LZ_FAST, ShortData, sizeof(ShortData), UT_DS_CodecCheck,
+                                          sizeof(UT_DS_CodecCheck)),
+                       0);
+    UtAssert_UINT32_EQ(DS_CodecDecompress(DS_CODEC_LZ_FAST, NoLast, 0, UT_DS_CodecCheck, sizeof(UT_DS_CodecCheck)),
+                       0);
+}
+
+void DS_CodecDecompress_Test_OutputFull(void)
+{
+    uint8 Block[] = {0x22, 'a', 'b', 2, 0, 0x10, 'c'};
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(DS_CodecDecompress(DS_CODEC_LZ_FAST, Block, sizeof(Block), UT_DS_CodecCheck, 1), 0);
+    UtAssert_UINT32_EQ(DS_CodecDecompress(DS_CODEC_LZ_FAST, Block, sizeof(Block), UT_DS_CodecCheck, 8), 0);
+}
+
+void UtTest_Setup(void)
+{
+#if (DS_FILE_COMPRESSION == true)
+    UT_DS_TEST_ADD(DS_CodecCompress_Test_Fast);
+    UT_DS_TEST_ADD(DS_CodecCompress_Test_High);
+    UT_DS_TEST_ADD(DS_CodecCompress_Test_Incompressible);
+    UT_DS_TEST_ADD(DS_CodecCompressLZ_Test_OutputFull);
+#endif
+    UT_DS_TEST_ADD(DS_CodecCompress_Test_NotCompressed);
+    UT_DS_TEST_ADD(DS_CodecPutSequence_Test_LongLengths);
+    UT_DS_TEST_ADD(DS_CodecPutSequence_Test_OutputFull);
+    UT_DS_TEST_ADD(DS_CodecGetLength_Test_Truncated);
+    UT_DS_TEST_ADD(DS_CodecDecompress_Test_Match);
+    UT_DS_TEST_ADD(DS_CodecDecompress_Test_Invalid);
+    UT_DS_TEST_ADD(DS_CodecDecompress_Test_OutputFull);
+}
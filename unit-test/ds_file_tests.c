@@ -36,6 +36,9 @@
 #include "ds_version.h"
 #include "ds_test_utils.h"
 #include "ds_table.h"
+#include "ds_writer.h"
+#include "ds_fsext.h"
+#include "ds_codec.h"
 
 /* UT includes */
 #include "uttest.h"
@@ -52,6 +55,42 @@ void UT_CFE_TIME_Print_CustomHandler(void *UserObj, UT_EntryKey_t FuncKey, const
     snprintf(PrintBuffer, CFE_TIME_PRINTED_STRING_SIZE, "1980-001-00:00.00.00000");
 }
 
+/* Keeps a copy of the closed file handed to the finalizer */
+DS_FinalizeEntry_t UT_DS_FinalizeEntry;
+
+void UT_DS_FinalizeEnqueue_CustomHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const DS_FinalizeEntry_t *Entry = UT_Hook_GetArgValueByName(Context, "Entry", const DS_FinalizeEntry_t *);
+
+    UT_DS_FinalizeEntry = *Entry;
+}
+
+#if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
+/* Keeps a copy of the DS file header written by the finalizer */
+DS_FileHeader_t UT_DS_FileHeader;
+
+void UT_DS_FsExtWriteAt_CustomHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const void *Data   = UT_Hook_GetArgValueByName(Context, "Data", const void *);
+    uint32      Length = UT_Hook_GetArgValueByName(Context, "Length", uint32);
+
+    if (Length == sizeof(UT_DS_FileHeader))
+    {
+        memcpy(&UT_DS_FileHeader, Data, Length);
+    }
+}
+#endif
+
+/* Keeps a copy of the record handed to the storage writer */
+DS_WriterRecord_t UT_DS_WriterRecord;
+
+void UT_DS_WriterSubmit_CustomHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const DS_WriterRecord_t *Record = UT_Hook_GetArgValueByName(Context, "Record", const DS_WriterRecord_t *);
+
+    UT_DS_WriterRecord = *Record;
+}
+
 /*
  * Helper Functions
  */
@@ -63,14 +102,31 @@ void UT_DS_SetDestFileEntry(DS_DestFileEntry_t *DestFileEntryPtr)
     strncpy(DestFileEntryPtr->Extension, "ext", sizeof(DestFileEntryPtr->Extension));
 }
 
+bool UT_DS_BloomMatch(const uint32 *MidBloom, uint32 MessageValue)
+{
+    bool   Match = true;
+    uint32 Bit   = 0;
+    uint32 i     = 0;
+
+    for (i = 0; i < DS_FILE_BLOOM_HASH_CNT; i++)
+    {
+        Bit = DS_FileBloomBit(MessageValue, i);
+        if ((MidBloom[Bit / 32] & ((uint32)1 << (Bit % 32))) == 0)
+        {
+            Match = false;
+        }
+    }
+
+    return Match;
+}
+
 /*
  * Function Definitions
  */
 
 void DS_FileStorePacket_Test_Nominal(void)
 {
-    CFE_SB_MsgId_t          MessageID = DS_UT_MID_1;
-    DS_HashLink_t           HashLink;
+    CFE_SB_MsgId_t          MessageID       = DS_UT_MID_1;
     size_t                  forced_Size     = sizeof(DS_NoopCmd_t);
     CFE_SB_MsgId_t          forced_MsgID    = CFE_SB_ValueToMsgId(DS_CMD_MID);
     CFE_MSG_FcnCode_t       forced_CmdCode  = DS_NOOP_CC;
@@ -84,30 +140,194 @@ void DS_FileStorePacket_Test_Nominal(void)
 
     DS_AppData.DestFileTblPtr->File[0].MaxFileSize = forced_Size * 2;
 
-    DS_AppData.HashTable[187]                                   = &HashLink;
-    HashLink.Index                                              = 0;
-    DS_AppData.FilterTblPtr->Packet[0].MessageID                = DS_UT_MID_1;
-    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_N    = 1;
-    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_X    = 3;
-    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_O    = 0;
-    DS_AppData.FilterTblPtr->Packet[0].Filter[0].FilterType     = 1;
-    DS_AppData.FilterTblPtr->Packet[0].Filter[0].FileTableIndex = 0;
-    DS_AppData.FileStatus[0].FileState                          = DS_ENABLED;
-    DS_AppData.FileStatus[0].FileHandle                         = DS_UT_OBJID_1;
-    DS_AppData.FileStatus[0].FileSize                           = 0;
+    DS_AppData.RoutePlan[0].FilterCount           = 1;
+    DS_AppData.RoutePlan[0].Filter[0].Algorithm_N = 1;
+    DS_AppData.RoutePlan[0].Filter[0].Algorithm_X = 3;
+    DS_AppData.RoutePlan[0].Filter[0].Algorithm_O = 0;
+    DS_AppData.RoutePlan[0].Filter[0].FilterType  = DS_BY_COUNT;
+    DS_AppData.RoutePlan[0].Filter[0].FileIndex   = 0;
+    DS_AppData.FileStatus[0].FileState            = DS_ENABLED;
+    DS_AppData.FileStatus[0].FileHandle           = DS_UT_OBJID_1;
+    DS_AppData.FileStatus[0].FileSize             = 0;
+
+    /* Execute the function being tested */
+    DS_FileStorePacket(MessageID, &UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.PassedPktCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileStorePacket_Test_Submit(void)
+{
+    CFE_SB_MsgId_t          MessageID       = DS_UT_MID_1;
+    CFE_MSG_SequenceCount_t forced_SeqCount = 0;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSequenceCount), &forced_SeqCount, sizeof(forced_SeqCount), false);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), 0);
+
+    DS_AppData.RoutePlan[0].FilterCount           = 1;
+    DS_AppData.RoutePlan[0].Filter[0].Algorithm_N = 1;
+    DS_AppData.RoutePlan[0].Filter[0].Algorithm_X = 3;
+    DS_AppData.RoutePlan[0].Filter[0].Algorithm_O = 0;
+    DS_AppData.RoutePlan[0].Filter[0].FilterType  = DS_BY_COUNT;
+    DS_AppData.RoutePlan[0].Filter[0].FileIndex   = 0;
+    DS_AppData.FileStatus[0].FileState            = DS_ENABLED;
+
+    UT_SetHandlerFunction(UT_KEY(DS_WriterSubmit), &UT_DS_WriterSubmit_CustomHandler, NULL);
 
     /* Execute the function being tested */
     DS_FileStorePacket(MessageID, &UT_CmdBuf.Buf);
 
+    /* Verify results - packet is handed to the storage writer, not written here */
+    UtAssert_UINT32_EQ(DS_AppData.PassedPktCounter, 1);
+    UtAssert_STUB_COUNT(DS_WriterSubmit, 1);
+    UtAssert_UINT32_EQ(UT_DS_WriterRecord.Type, DS_WRITER_PACKET);
+    UtAssert_UINT32_EQ(UT_DS_WriterRecord.DestCount, 1);
+    UtAssert_UINT32_EQ(UT_DS_WriterRecord.DestIndex[0], 0);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileStorePacket_Test_ContentDuplicate(void)
+{
+    CFE_SB_MsgId_t MessageID = DS_UT_MID_1;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), 0);
+
+    DS_AppData.RoutePlan[0].FilterCount           = 1;
+    DS_AppData.RoutePlan[0].Filter[0].Algorithm_N = 1;
+    DS_AppData.RoutePlan[0].Filter[0].Algorithm_X = 3;
+    DS_AppData.RoutePlan[0].Filter[0].Algorithm_O = 0;
+    DS_AppData.RoutePlan[0].Filter[0].FilterType  = DS_BY_CONTENT;
+    DS_AppData.RoutePlan[0].Filter[0].FileIndex   = 0;
+    DS_AppData.FileStatus[0].FileState            = DS_ENABLED;
+
+    /* Execute the function being tested - same payload twice */
+    DS_FileStorePacket(MessageID, &UT_CmdBuf.Buf);
+    DS_FileStorePacket(MessageID, &UT_CmdBuf.Buf);
+
+    /* Verify results - first packet is stored, the repeat is counted as a duplicate */
+    UtAssert_UINT32_EQ(DS_AppData.PassedPktCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FilteredPktCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.DuplicatePktCounter[0], 1);
+    UtAssert_STUB_COUNT(DS_WriterSubmit, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileStorePacket_Test_RateLimited(void)
+{
+    CFE_SB_MsgId_t     MessageID = DS_UT_MID_1;
+    CFE_TIME_SysTime_t forced_Time[2];
+
+    memset(forced_Time, 0, sizeof(forced_Time));
+    UT_SetDataBuffer(UT_KEY(CFE_TIME_GetMET), forced_Time, sizeof(forced_Time), false);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), 0);
+
+    DS_AppData.RoutePlan[0].FilterCount           = 1;
+    DS_AppData.RoutePlan[0].Filter[0].Algorithm_N = 1;
+    DS_AppData.RoutePlan[0].Filter[0].Algorithm_X = 1;
+    DS_AppData.RoutePlan[0].Filter[0].Algorithm_O = 0;
+    DS_AppData.RoutePlan[0].Filter[0].FilterType  = DS_BY_PKT_RATE;
+    DS_AppData.RoutePlan[0].Filter[0].FileIndex   = 0;
+    DS_AppData.FileStatus[0].FileState            = DS_ENABLED;
+
+    /* Execute the function being tested - burst of one packet at the same time */
+    DS_FileStorePacket(MessageID, &UT_CmdBuf.Buf);
+    DS_FileStorePacket(MessageID, &UT_CmdBuf.Buf);
+
+    /* Verify results - second packet is dropped and counted as rate limited */
+    UtAssert_UINT32_EQ(DS_AppData.PassedPktCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FilteredPktCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.RateLimitedPktCounter, 1);
+    UtAssert_STUB_COUNT(DS_WriterSubmit, 1);
+    UtAssert_STUB_COUNT(CFE_TIME_GetMET, 2);
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileStorePacket_Test_Predicate(void)
+{
+    CFE_SB_MsgId_t MessageID = DS_UT_MID_1;
+    size_t         forced_Size;
+    union
+    {
+        CFE_SB_Buffer_t Buf;
+        uint8           Bytes[32];
+    } Packet;
+
+    forced_Size = sizeof(Packet.Bytes);
+    memset(Packet.Bytes, 0, sizeof(Packet.Bytes));
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), 0);
+
+    DS_AppData.RoutePlan[0].FilterCount           = 1;
+    DS_AppData.RoutePlan[0].Filter[0].Algorithm_N = 1;
+    DS_AppData.RoutePlan[0].Filter[0].Algorithm_X = 1;
+    DS_AppData.RoutePlan[0].Filter[0].FilterType  = DS_BY_PREDICATE;
+    DS_AppData.RoutePlan[0].Filter[0].FileIndex   = 0;
+    DS_AppData.RoutePlan[0].MinLength             = 32;
+    DS_AppData.RoutePlan[0].PredicateCount        = 1;
+    DS_AppData.RoutePlan[0].Predicate[0].Offset   = 20;
+    DS_AppData.RoutePlan[0].Predicate[0].Mask     = 0xFF;
+    DS_AppData.RoutePlan[0].Predicate[0].Value    = 0x07;
+    DS_AppData.RoutePlan[0].Predicate[0].Expect   = true;
+    DS_AppData.FileStatus[0].FileState            = DS_ENABLED;
+
+    /* Execute the function being tested - mode byte does not match, then matches */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+    DS_FileStorePacket(MessageID, &Packet.Buf);
+
+    Packet.Bytes[20] = 0x07;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+    DS_FileStorePacket(MessageID, &Packet.Buf);
+
     /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FilteredPktCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.PassedPktCounter, 1);
+    UtAssert_STUB_COUNT(DS_WriterSubmit, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileStorePacket_Test_MultipleDest(void)
+{
+    CFE_SB_MsgId_t          MessageID       = DS_UT_MID_1;
+    CFE_MSG_SequenceCount_t forced_SeqCount = 4;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSequenceCount), &forced_SeqCount, sizeof(forced_SeqCount), false);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), 0);
+
+    DS_AppData.RoutePlan[0].FilterCount           = 2;
+    DS_AppData.RoutePlan[0].Filter[0].Algorithm_N = 1;
+    DS_AppData.RoutePlan[0].Filter[0].Algorithm_X = 2;
+    DS_AppData.RoutePlan[0].Filter[0].Algorithm_O = 0;
+    DS_AppData.RoutePlan[0].Filter[0].FilterType  = DS_BY_COUNT;
+    DS_AppData.RoutePlan[0].Filter[0].FileIndex   = 0;
+    DS_AppData.RoutePlan[0].Filter[1].Algorithm_N = 1;
+    DS_AppData.RoutePlan[0].Filter[1].Algorithm_X = 4;
+    DS_AppData.RoutePlan[0].Filter[1].Algorithm_O = 0;
+    DS_AppData.RoutePlan[0].Filter[1].FilterType  = DS_BY_COUNT;
+    DS_AppData.RoutePlan[0].Filter[1].FileIndex   = 1;
+    DS_AppData.FileStatus[0].FileState            = DS_ENABLED;
+    DS_AppData.FileStatus[1].FileState            = DS_ENABLED;
+
+    UT_SetHandlerFunction(UT_KEY(DS_WriterSubmit), &UT_DS_WriterSubmit_CustomHandler, NULL);
+
+    /* Execute the function being tested */
+    DS_FileStorePacket(MessageID, &UT_CmdBuf.Buf);
+
+    /* Verify results - sequence count is read once for both filters */
     UtAssert_UINT32_EQ(DS_AppData.PassedPktCounter, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_GetSequenceCount, 1);
+    UtAssert_STUB_COUNT(DS_WriterSubmit, 1);
+    UtAssert_UINT32_EQ(UT_DS_WriterRecord.DestCount, 2);
+    UtAssert_UINT32_EQ(UT_DS_WriterRecord.DestIndex[0], 0);
+    UtAssert_UINT32_EQ(UT_DS_WriterRecord.DestIndex[1], 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
 void DS_FileStorePacket_Test_PacketNotInTable(void)
 {
     CFE_SB_MsgId_t MessageID = DS_UT_MID_1;
-    DS_HashLink_t  HashLink;
 
     size_t            forced_Size    = sizeof(DS_NoopCmd_t);
     CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
@@ -119,9 +339,6 @@ void DS_FileStorePacket_Test_PacketNotInTable(void)
 
     DS_AppData.DestFileTblPtr->File[0].MaxFileSize = 10;
 
-    DS_AppData.HashTable[187] = &HashLink;
-    HashLink.Index            = 0;
-
     UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), DS_INDEX_NONE);
 
     /* Execute the function being tested */
@@ -134,8 +351,7 @@ void DS_FileStorePacket_Test_PacketNotInTable(void)
 
 void DS_FileStorePacket_Test_PassedFilterFalse(void)
 {
-    CFE_SB_MsgId_t          MessageID = DS_UT_MID_1;
-    DS_HashLink_t           HashLink;
+    CFE_SB_MsgId_t          MessageID       = DS_UT_MID_1;
     size_t                  forced_Size     = sizeof(DS_NoopCmd_t);
     CFE_SB_MsgId_t          forced_MsgID    = CFE_SB_ValueToMsgId(DS_CMD_MID);
     CFE_MSG_FcnCode_t       forced_CmdCode  = DS_NOOP_CC;
@@ -148,14 +364,13 @@ void DS_FileStorePacket_Test_PassedFilterFalse(void)
 
     DS_AppData.DestFileTblPtr->File[0].MaxFileSize = 10;
 
-    DS_AppData.HashTable[187]                                = &HashLink;
-    HashLink.Index                                           = 0;
-    DS_AppData.FilterTblPtr->Packet[0].MessageID             = DS_UT_MID_1;
-    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_N = 1;
-    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_X = 3;
-    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_O = 1;
-    DS_AppData.FilterTblPtr->Packet[0].Filter[0].FilterType  = 1;
-    DS_AppData.FileStatus[0].FileState                       = DS_ENABLED;
+    DS_AppData.RoutePlan[0].FilterCount           = 1;
+    DS_AppData.RoutePlan[0].Filter[0].Algorithm_N = 1;
+    DS_AppData.RoutePlan[0].Filter[0].Algorithm_X = 3;
+    DS_AppData.RoutePlan[0].Filter[0].Algorithm_O = 1;
+    DS_AppData.RoutePlan[0].Filter[0].FilterType  = DS_BY_COUNT;
+    DS_AppData.RoutePlan[0].Filter[0].FileIndex   = 0;
+    DS_AppData.FileStatus[0].FileState            = DS_ENABLED;
 
     /* Execute the function being tested */
     DS_FileStorePacket(MessageID, &UT_CmdBuf.Buf);
@@ -167,8 +382,7 @@ void DS_FileStorePacket_Test_PassedFilterFalse(void)
 
 void DS_FileStorePacket_Test_DisabledDest(void)
 {
-    CFE_SB_MsgId_t    MessageID = DS_UT_MID_1;
-    DS_HashLink_t     HashLink;
+    CFE_SB_MsgId_t    MessageID      = DS_UT_MID_1;
     size_t            forced_Size    = sizeof(DS_NoopCmd_t);
     CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
     CFE_MSG_FcnCode_t forced_CmdCode = DS_NOOP_CC;
@@ -179,14 +393,13 @@ void DS_FileStorePacket_Test_DisabledDest(void)
 
     DS_AppData.DestFileTblPtr->File[0].MaxFileSize = 10;
 
-    DS_AppData.HashTable[187]                                = &HashLink;
-    HashLink.Index                                           = 0;
-    DS_AppData.FilterTblPtr->Packet[0].MessageID             = DS_UT_MID_1;
-    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_N = 1;
-    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_X = 3;
-    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_O = 1;
-    DS_AppData.FilterTblPtr->Packet[0].Filter[0].FilterType  = 1;
-    DS_AppData.FileStatus[0].FileState                       = DS_DISABLED;
+    DS_AppData.RoutePlan[0].FilterCount           = 1;
+    DS_AppData.RoutePlan[0].Filter[0].Algorithm_N = 1;
+    DS_AppData.RoutePlan[0].Filter[0].Algorithm_X = 3;
+    DS_AppData.RoutePlan[0].Filter[0].Algorithm_O = 1;
+    DS_AppData.RoutePlan[0].Filter[0].FilterType  = DS_BY_COUNT;
+    DS_AppData.RoutePlan[0].Filter[0].FileIndex   = 0;
+    DS_AppData.FileStatus[0].FileState            = DS_DISABLED;
 
     /* Execute the function being tested */
     DS_FileStorePacket(MessageID, &UT_CmdBuf.Buf);
@@ -196,10 +409,9 @@ void DS_FileStorePacket_Test_DisabledDest(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_FileStorePacket_Test_InvalidIndex(void)
+void DS_FileStorePacket_Test_NoActiveFilters(void)
 {
-    CFE_SB_MsgId_t    MessageID = DS_UT_MID_1;
-    DS_HashLink_t     HashLink;
+    CFE_SB_MsgId_t    MessageID      = DS_UT_MID_1;
     size_t            forced_Size    = sizeof(DS_NoopCmd_t);
     CFE_SB_MsgId_t    forced_MsgID   = CFE_SB_ValueToMsgId(DS_CMD_MID);
     CFE_MSG_FcnCode_t forced_CmdCode = DS_NOOP_CC;
@@ -210,15 +422,8 @@ void DS_FileStorePacket_Test_InvalidIndex(void)
 
     DS_AppData.DestFileTblPtr->File[0].MaxFileSize = 10;
 
-    DS_AppData.HashTable[187]                                   = &HashLink;
-    HashLink.Index                                              = 0;
-    DS_AppData.FilterTblPtr->Packet[0].MessageID                = DS_UT_MID_1;
-    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_N    = 1;
-    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_X    = 3;
-    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_O    = 1;
-    DS_AppData.FilterTblPtr->Packet[0].Filter[0].FilterType     = 1;
-    DS_AppData.FilterTblPtr->Packet[0].Filter[0].FileTableIndex = DS_DEST_FILE_CNT;
-    DS_AppData.FileStatus[0].FileState                          = DS_ENABLED;
+    DS_AppData.RoutePlan[0].FilterCount = 0;
+    DS_AppData.FileStatus[0].FileState  = DS_ENABLED;
 
     /* Execute the function being tested */
     DS_FileStorePacket(MessageID, &UT_CmdBuf.Buf);
@@ -293,6 +498,7 @@ void DS_FileSetupWrite_Test_MaxFileSizeExceeded(void)
 
     DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize = 5;
     DS_AppData.FileStatus[FileIndex].FileSize              = 10;
+    DS_AppData.FileStatus[FileIndex].FileState             = DS_ENABLED;
 
     UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
     strncpy(DS_AppData.FileStatus[FileIndex].FileName, "directory1/",
@@ -308,6 +514,54 @@ void DS_FileSetupWrite_Test_MaxFileSizeExceeded(void)
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_UINT32_EQ(DS_AppData.RotationCounter, 1);
+}
+
+void DS_FileSetupWrite_Test_DeltaRecordSize(void)
+{
+    int32  FileIndex   = 0;
+    size_t forced_Size = sizeof(DS_NoopCmd_t);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] = '\0';
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize = 100;
+    DS_AppData.FileStatus[FileIndex].DeltaKeyframe         = 4;
+    DS_AppData.FileStatus[FileIndex].FileSize              = 100 - sizeof(DS_NoopCmd_t);
+
+    /* Execute the function being tested */
+    DS_FileSetupWrite(FileIndex, &UT_CmdBuf.Buf);
+
+    /* Verify results - packet fits but the record header does not */
+    UtAssert_STUB_COUNT(DS_FinalizeEnqueue, 1);
+}
+
+void DS_FileSetupWrite_Test_Preopen(void)
+{
+    int32  FileIndex   = 0;
+    size_t forced_Size = sizeof(DS_NoopCmd_t);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+
+    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize  = 1000;
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileAge   = 1000;
+
+    /* Packet still fits, file is already past the pre-open threshold */
+    DS_AppData.FileStatus[FileIndex].FileHandle = DS_UT_OBJID_1;
+    DS_AppData.FileStatus[FileIndex].FileState  = DS_ENABLED;
+    DS_AppData.FileStatus[FileIndex].FileSize   = 10 * DS_FILE_PREOPEN_PERCENT;
+
+    /* Execute the function being tested */
+    DS_FileSetupWrite(FileIndex, &UT_CmdBuf.Buf);
+
+    /* Verify results - next file opened by the writer without waiting for the age tick */
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].SpareHandle));
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
 void DS_FileWriteData_Test_Nominal(void)
@@ -364,145 +618,410 @@ void DS_FileWriteData_Test_Error(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_WRITE_FILE_ERR_EID);
 }
 
-#if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
-void DS_FileWriteHeader_Test_PlatformConfigCFE_Nominal(void)
+void DS_FileWriteData_Test_CompressedOversize(void)
 {
-    int32 FileIndex = 0;
+    int32  FileIndex  = 0;
+    uint32 DataLength = 20;
 
-    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = 1;
+    DS_AppData.DestFileTblPtr->File[FileIndex].BufferSize = 10;
+    DS_AppData.FileStatus[FileIndex].Codec                = DS_CODEC_LZ_FAST;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_CodecCompress), 8);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), sizeof(DS_CodecFrame_t) + 8);
 
     /* Execute the function being tested */
-    DS_FileWriteHeader(FileIndex);
+    DS_FileWriteData(FileIndex, &UT_CmdBuf.Buf, DataLength);
 
-    /* Verify results */
+    /* Verify results - packet is a block of its own */
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, sizeof(DS_CodecFrame_t) + 8);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileGrowth, DataLength);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].BufferedBytes, 0);
+    UtAssert_STUB_COUNT(OS_write, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
-
-    UtAssert_UINT32_EQ(DS_AppData.FileWriteCounter, 2);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, sizeof(CFE_FS_Header_t) + sizeof(DS_FileHeader_t));
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileGrowth, sizeof(CFE_FS_Header_t) + sizeof(DS_FileHeader_t));
 }
-#endif
 
-#if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
-void DS_FileWriteHeader_Test_PrimaryHeaderError(void)
+void DS_FileWriteData_Test_CompressedError(void)
 {
-    int32 FileIndex = 0;
+    int32  FileIndex  = 0;
+    uint32 DataLength = 20;
 
     /* Set up the handle */
     OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
 
-    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = 1;
-    DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0]  = '\0';
-    /* Set to generate primary header error */
-    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), -1);
+    DS_AppData.DestFileTblPtr->File[FileIndex].BufferSize  = 10;
+    DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] = '\0';
+    DS_AppData.FileStatus[FileIndex].Codec                 = DS_CODEC_LZ_FAST;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_CodecCompress), 8);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), -1);
 
     /* Execute the function being tested */
-    DS_FileWriteHeader(FileIndex);
+    DS_FileWriteData(FileIndex, &UT_CmdBuf.Buf, DataLength);
 
     /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteCounter, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileState, DS_DISABLED);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    /* Generates 1 event message we don't care about in this test */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_WRITE_FILE_ERR_EID);
 }
-#endif
 
-#if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
-void DS_FileWriteHeader_Test_SecondaryHeaderError(void)
+void DS_FileWriteData_Test_Buffered(void)
 {
-    int32 FileIndex = 0;
+    int32  FileIndex  = 0;
+    uint32 DataLength = 10;
 
-    /* Set up the handle */
-    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    DS_AppData.DestFileTblPtr->File[FileIndex].BufferSize = 64;
 
-    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = 1;
+    /* Execute the function being tested */
+    DS_FileWriteData(FileIndex, &UT_CmdBuf.Buf, DataLength);
 
-    DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] = '\0';
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].BufferedBytes, DataLength);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, DataLength);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileGrowth, DataLength);
+    UtAssert_UINT32_EQ(DS_AppData.FlushCounter, 0);
 
-    /* Set to generate secondary header error */
-    UT_SetDefaultReturnValue(UT_KEY(OS_write), -1);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileWriteData_Test_BufferFull(void)
+{
+    int32  FileIndex  = 0;
+    uint32 DataLength = 10;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].BufferSize = 20;
+    DS_AppData.FileStatus[FileIndex].BufferedBytes        = 10;
+
+    /* Set buffer flush to succeed */
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), 20);
 
     /* Execute the function being tested */
-    DS_FileWriteHeader(FileIndex);
+    DS_FileWriteData(FileIndex, &UT_CmdBuf.Buf, DataLength);
 
     /* Verify results */
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    /* Generates 1 event message we don't care about in this test */
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].BufferedBytes, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FlushCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FlushByteCounter, 20);
+
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
-#endif
 
-#if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
-void DS_FileWriteError_Test(void)
+void DS_FileWriteData_Test_BufferFlushError(void)
 {
-    int32  FileIndex   = 0;
-    uint32 DataLength  = 10;
-    int32  WriteResult = -1;
+    int32  FileIndex  = 0;
+    uint32 DataLength = 10;
 
     /* Set up the handle */
     OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
 
-    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = 1;
-
+    DS_AppData.DestFileTblPtr->File[FileIndex].BufferSize  = 20;
     DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] = '\0';
-    strncpy(DS_AppData.FileStatus[FileIndex].FileName, "filename", sizeof(DS_AppData.FileStatus[FileIndex].FileName));
+    DS_AppData.FileStatus[FileIndex].BufferedBytes         = 15;
+
+    /* Set to fail the flush that makes room for the packet */
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), -1);
 
     /* Execute the function being tested */
-    DS_FileWriteError(FileIndex, DataLength, WriteResult);
+    DS_FileWriteData(FileIndex, &UT_CmdBuf.Buf, DataLength);
 
     /* Verify results */
-    UtAssert_UINT32_EQ(DS_AppData.FileWriteErrCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteCounter, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].BufferedBytes, 0);
     UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileState, DS_DISABLED);
+    UtAssert_UINT32_EQ(DS_AppData.FlushCounter, 0);
+
+    UtAssert_STUB_COUNT(OS_write, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_WRITE_FILE_ERR_EID);
 }
-#endif
 
-void DS_FileCreateDest_Test_Nominal(void)
+void DS_FileWriteData_Test_SyncByBytes(void)
 {
-    uint32 FileIndex = 0;
-
-    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
-    strncpy(DS_AppData.FileStatus[FileIndex].FileName, "filename", sizeof(DS_AppData.FileStatus[FileIndex].FileName));
+    int32  FileIndex  = 0;
+    uint32 DataLength = 10;
 
-    DS_AppData.FileStatus[FileIndex].FileCount  = 1;
-    DS_AppData.FileStatus[FileIndex].FileHandle = DS_UT_OBJID_1;
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
 
-    /* Set to fail the condition "if (Result < 0)" */
-    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
+    DS_AppData.DestFileTblPtr->File[FileIndex].SyncPolicy   = DS_SYNC_BY_BYTES;
+    DS_AppData.DestFileTblPtr->File[FileIndex].SyncInterval = 16;
+    DS_AppData.FileStatus[FileIndex].SyncBytes              = 8;
 
-    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), DataLength);
 
     /* Execute the function being tested */
-    DS_FileCreateDest(FileIndex);
+    DS_FileWriteData(FileIndex, &UT_CmdBuf.Buf, DataLength);
 
     /* Verify results */
-#if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
-    UtAssert_INT32_EQ(DS_AppData.FileWriteCounter, 3);
-#else
-    UtAssert_INT32_EQ(DS_AppData.FileWriteCounter, 1);
-#endif
-
-    /* the file handle should have been reset and should not be closed */
-    UtAssert_BOOL_FALSE(OS_ObjectIdEqual(DS_AppData.FileStatus[FileIndex].FileHandle, DS_UT_OBJID_1));
-    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
-
-    UtAssert_INT32_EQ(DS_AppData.FileStatus[FileIndex].FileCount, 2);
-
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].SyncBytes, 0);
+    UtAssert_UINT32_EQ(DS_AppData.SyncCounter, 1);
+    UtAssert_STUB_COUNT(DS_FsExtSync, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
-    UtAssert_STUB_COUNT(DS_TableUpdateCDS, 1);
 }
 
-void DS_FileCreateDest_Test_StringTerminate(void)
+void DS_FileWriteData_Test_SyncNotDue(void)
 {
-    uint32 FileIndex = 0;
+    int32  FileIndex  = 0;
+    uint32 DataLength = 10;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].SyncPolicy   = DS_SYNC_BY_BYTES;
+    DS_AppData.DestFileTblPtr->File[FileIndex].SyncInterval = 16;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), DataLength);
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_FileCreateDest(FileIndex));
+    DS_FileWriteData(FileIndex, &UT_CmdBuf.Buf, DataLength);
 
     /* Verify results */
-    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].SyncBytes, DataLength);
+    UtAssert_UINT32_EQ(DS_AppData.SyncCounter, 0);
+    UtAssert_STUB_COUNT(DS_FsExtSync, 0);
 }
 
-void DS_FileCreateDest_Test_NominalRollover(void)
+void DS_FileWriteData_Test_Direct(void)
+{
+    int32  FileIndex  = 0;
+    uint32 DataLength = 10;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].BufferSize = DS_DIRECT_IO_BLOCK_SIZE;
+    DS_AppData.FileStatus[FileIndex].Direct               = true;
+    DS_AppData.FileStatus[FileIndex].DirectOffset         = 100;
+
+    /* Execute the function being tested */
+    DS_FileWriteData(FileIndex, &UT_CmdBuf.Buf, DataLength);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].BufferedBytes, DataLength);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, DataLength);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(DS_FsExtWriteDirect, 0);
+}
+
+void DS_FileWriteDirect_Test_LeadIn(void)
+{
+    int32  FileIndex  = 0;
+    uint32 DataLength = 10;
+
+    /* Header ends 100 bytes into the file - first buffer ends on the block boundary */
+    DS_AppData.DestFileTblPtr->File[FileIndex].BufferSize = DS_DIRECT_IO_BLOCK_SIZE;
+    DS_AppData.FileStatus[FileIndex].Direct               = true;
+    DS_AppData.FileStatus[FileIndex].DirectOffset         = 100;
+    DS_AppData.FileStatus[FileIndex].BufferedBytes        = DS_DIRECT_IO_BLOCK_SIZE - 100 - 6;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), DS_DIRECT_IO_BLOCK_SIZE - 100);
+
+    /* Execute the function being tested */
+    DS_FileWriteDirect(FileIndex, &UT_CmdBuf.Buf, DataLength);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].DirectOffset, DS_DIRECT_IO_BLOCK_SIZE);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].BufferedBytes, 4);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, DataLength);
+    UtAssert_UINT32_EQ(DS_AppData.DirectFlushCounter, 0);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(DS_FsExtWriteDirect, 0);
+}
+
+void DS_FileWriteDirect_Test_Split(void)
+{
+    int32        FileIndex  = 0;
+    static uint8 Data[DS_DIRECT_IO_BLOCK_SIZE + 904];
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].BufferSize = DS_DIRECT_IO_BLOCK_SIZE;
+    DS_AppData.FileStatus[FileIndex].Direct               = true;
+    DS_AppData.FileStatus[FileIndex].DirectOffset         = DS_DIRECT_IO_BLOCK_SIZE;
+
+    /* Execute the function being tested */
+    DS_FileWriteDirect(FileIndex, Data, sizeof(Data));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].DirectOffset, 2 * DS_DIRECT_IO_BLOCK_SIZE);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].BufferedBytes, 904);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, sizeof(Data));
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.DirectFlushCounter, 1);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(DS_FsExtWriteDirect, 1);
+}
+
+void DS_FileWriteDirect_Test_FlushError(void)
+{
+    int32        FileIndex  = 0;
+    static uint8 Data[DS_DIRECT_IO_BLOCK_SIZE];
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].BufferSize  = DS_DIRECT_IO_BLOCK_SIZE;
+    DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] = '\0';
+    DS_AppData.FileStatus[FileIndex].Direct                = true;
+    DS_AppData.FileStatus[FileIndex].DirectOffset          = DS_DIRECT_IO_BLOCK_SIZE;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_FsExtWriteDirect), OS_ERROR);
+
+    /* Execute the function being tested */
+    DS_FileWriteDirect(FileIndex, Data, sizeof(Data));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteCounter, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteErrCounter, 1);
+    UtAssert_BOOL_FALSE(DS_AppData.FileStatus[FileIndex].Direct);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileState, DS_DISABLED);
+    UtAssert_STUB_COUNT(DS_FsExtCloseDirect, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_WRITE_FILE_ERR_EID);
+}
+
+#if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
+void DS_FileWriteHeader_Test_PlatformConfigCFE_Nominal(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = 1;
+
+    /* Execute the function being tested */
+    DS_FileWriteHeader(FileIndex);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteCounter, 2);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, sizeof(CFE_FS_Header_t) + sizeof(DS_FileHeader_t));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileGrowth, sizeof(CFE_FS_Header_t) + sizeof(DS_FileHeader_t));
+}
+#endif
+
+#if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
+void DS_FileWriteHeader_Test_PrimaryHeaderError(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = 1;
+    DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0]  = '\0';
+    /* Set to generate primary header error */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), -1);
+
+    /* Execute the function being tested */
+    DS_FileWriteHeader(FileIndex);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    /* Generates 1 event message we don't care about in this test */
+}
+#endif
+
+#if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
+void DS_FileWriteHeader_Test_SecondaryHeaderError(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = 1;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] = '\0';
+
+    /* Set to generate secondary header error */
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), -1);
+
+    /* Execute the function being tested */
+    DS_FileWriteHeader(FileIndex);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    /* Generates 1 event message we don't care about in this test */
+}
+#endif
+
+#if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
+void DS_FileWriteError_Test(void)
+{
+    int32  FileIndex   = 0;
+    uint32 DataLength  = 10;
+    int32  WriteResult = -1;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = 1;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] = '\0';
+    strncpy(DS_AppData.FileStatus[FileIndex].FileName, "filename", sizeof(DS_AppData.FileStatus[FileIndex].FileName));
+
+    /* Execute the function being tested */
+    DS_FileWriteError(FileIndex, DataLength, WriteResult);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteErrCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileState, DS_DISABLED);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_WRITE_FILE_ERR_EID);
+}
+#endif
+
+void DS_FileCreateDest_Test_Nominal(void)
+{
+    uint32 FileIndex = 0;
+
+    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
+    strncpy(DS_AppData.FileStatus[FileIndex].FileName, "filename", sizeof(DS_AppData.FileStatus[FileIndex].FileName));
+
+    DS_AppData.FileStatus[FileIndex].FileCount  = 1;
+    DS_AppData.FileStatus[FileIndex].FileHandle = DS_UT_OBJID_1;
+
+    /* Set to fail the condition "if (Result < 0)" */
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
+    DS_AppData.DestFileTblPtr->File[FileIndex].Codec        = DS_CODEC_LZ_FAST;
+
+    /* Execute the function being tested */
+    DS_FileCreateDest(FileIndex);
+
+    /* Verify results */
+#if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
+    UtAssert_INT32_EQ(DS_AppData.FileWriteCounter, 3);
+#else
+    UtAssert_INT32_EQ(DS_AppData.FileWriteCounter, 1);
+#endif
+
+    /* the file handle should have been reset and should not be closed */
+    UtAssert_BOOL_FALSE(OS_ObjectIdEqual(DS_AppData.FileStatus[FileIndex].FileHandle, DS_UT_OBJID_1));
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
+
+    UtAssert_INT32_EQ(DS_AppData.FileStatus[FileIndex].FileCount, 2);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].Codec, DS_CODEC_LZ_FAST);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(DS_TableReserveCDS, 1);
+}
+
+void DS_FileCreateDest_Test_StringTerminate(void)
+{
+    uint32 FileIndex = 0;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCreateDest(FileIndex));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+}
+
+void DS_FileCreateDest_Test_NominalRollover(void)
 {
     uint32 FileIndex = 0;
 
@@ -534,7 +1053,7 @@ void DS_FileCreateDest_Test_NominalRollover(void)
     UtAssert_INT32_EQ(DS_AppData.FileStatus[FileIndex].FileCount, 3);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
-    UtAssert_STUB_COUNT(DS_TableUpdateCDS, 1);
+    UtAssert_STUB_COUNT(DS_TableReserveCDS, 1);
 }
 
 void DS_FileCreateDest_Test_Error(void)
@@ -589,118 +1108,269 @@ void DS_FileCreateDest_Test_ClosedFileHandle(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 }
 
-void DS_FileCreateName_Test_Nominal(void)
+void DS_FileCreateDest_Test_Preopened(void)
 {
-    int32 FileIndex    = 0;
-    char  StrCompare[] = "path/base00000001.ext";
+    uint32 FileIndex = 0;
 
-    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
     UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
 
-    DS_AppData.FileStatus[FileIndex].FileCount = 1;
+    DS_AppData.FileStatus[FileIndex].FileCount   = 1;
+    DS_AppData.FileStatus[FileIndex].SpareHandle = DS_UT_OBJID_1;
+    DS_AppData.FileStatus[FileIndex].SpareSize   = 100;
+    strncpy(DS_AppData.FileStatus[FileIndex].SpareName, "sparename",
+            sizeof(DS_AppData.FileStatus[FileIndex].SpareName));
+    DS_AppData.FileStatus[FileIndex].SparePreallocated = true;
 
     /* Execute the function being tested */
-    DS_FileCreateName(FileIndex);
+    DS_FileCreateDest(FileIndex);
 
     /* Verify results */
+    UtAssert_BOOL_TRUE(OS_ObjectIdEqual(DS_AppData.FileStatus[FileIndex].FileHandle, DS_UT_OBJID_1));
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].SpareHandle));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 100);
+    UtAssert_BOOL_TRUE(DS_AppData.FileStatus[FileIndex].Preallocated);
+    UtAssert_BOOL_FALSE(DS_AppData.FileStatus[FileIndex].SparePreallocated);
     UtAssert_STRINGBUF_EQ(DS_AppData.FileStatus[FileIndex].FileName, sizeof(DS_AppData.FileStatus[FileIndex].FileName),
-                          StrCompare, sizeof(StrCompare));
+                          "sparename", sizeof("sparename"));
+    UtAssert_True(DS_AppData.FileStatus[FileIndex].SpareName[0] == 0, "SpareName cleared");
+    UtAssert_INT32_EQ(DS_AppData.FileStatus[FileIndex].FileCount, 2);
+    UtAssert_UINT32_EQ(DS_AppData.PreopenHitCounter, 1);
 
+    /* promoted file is no longer removed after a processor reset */
+    UtAssert_STUB_COUNT(DS_FinalizeUpdateSpareCDS, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(DS_TableReserveCDS, 1);
 }
 
-void DS_FileCreateName_Test_NominalWithSeparator(void)
+void DS_FileCreateDest_Test_Preallocate(void)
 {
-    int32 FileIndex    = 0;
-    char  StrCompare[] = "path/base00000001.ext";
+    uint32 FileIndex = 0;
 
-    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
     UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
-    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Pathname, "path/",
-            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Pathname));
-
-    DS_AppData.FileStatus[FileIndex].FileCount = 1;
+    DS_AppData.DestFileTblPtr->File[FileIndex].Preallocate = DS_ENABLED;
 
     /* Execute the function being tested */
-    DS_FileCreateName(FileIndex);
+    DS_FileCreateDest(FileIndex);
 
     /* Verify results */
-    UtAssert_STRINGBUF_EQ(DS_AppData.FileStatus[FileIndex].FileName, sizeof(DS_AppData.FileStatus[FileIndex].FileName),
-                          StrCompare, sizeof(StrCompare));
-
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
+    UtAssert_BOOL_TRUE(DS_AppData.FileStatus[FileIndex].Preallocated);
+    UtAssert_STUB_COUNT(DS_FsExtAllocate, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_FileCreateName_Test_NominalWithPeriod(void)
+void DS_FilePreallocate_Test_Disabled(void)
 {
-    int32 FileIndex    = 0;
-    char  StrCompare[] = "path/base00000001.ext";
-
-    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
-    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
-    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Extension, ".ext",
-            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Extension));
+    uint32 FileIndex = 0;
 
-    DS_AppData.FileStatus[FileIndex].FileCount = 1;
+    DS_AppData.DestFileTblPtr->File[FileIndex].Preallocate = DS_DISABLED;
 
     /* Execute the function being tested */
-    DS_FileCreateName(FileIndex);
+    UtAssert_BOOL_FALSE(DS_FilePreallocate(FileIndex, "filename"));
 
     /* Verify results */
-    UtAssert_STRINGBUF_EQ(DS_AppData.FileStatus[FileIndex].FileName, sizeof(DS_AppData.FileStatus[FileIndex].FileName),
-                          StrCompare, sizeof(StrCompare));
-
+    UtAssert_STUB_COUNT(DS_FsExtAllocate, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_FileCreateName_Test_EmptyPath(void)
+void DS_FilePreallocate_Test_Nominal(void)
 {
-    int32 FileIndex = 0;
-
-    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
-    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
-    DS_AppData.DestFileTblPtr->File[FileIndex].Pathname[0] = '\0';
+    uint32 FileIndex = 0;
 
-    DS_AppData.FileStatus[FileIndex].FileCount = 1;
+    DS_AppData.DestFileTblPtr->File[FileIndex].Preallocate = DS_ENABLED;
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize = 2048;
 
     /* Execute the function being tested */
-    DS_FileCreateName(FileIndex);
+    UtAssert_BOOL_TRUE(DS_FilePreallocate(FileIndex, "filename"));
 
     /* Verify results */
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileState, DS_DISABLED);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FILE_CREATE_EMPTY_PATH_ERR_EID);
+    UtAssert_STUB_COUNT(DS_FsExtAllocate, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_FileCreateName_Test_Error(void)
+void DS_FilePreallocate_Test_Error(void)
 {
-    int32 FileIndex = 0;
-    int32 i;
-
-    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
-    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
+    uint32 FileIndex = 0;
 
-    for (i = 0; i < DS_TOTAL_FNAME_BUFSIZE - 2; i++)
-    {
-        DS_AppData.DestFileTblPtr->File[FileIndex].Basename[i] = 'a';
-    }
+    DS_AppData.DestFileTblPtr->File[FileIndex].Preallocate = DS_ENABLED;
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize = 2048;
 
-    DS_AppData.DestFileTblPtr->File[FileIndex].Basename[DS_TOTAL_FNAME_BUFSIZE - 1] = '\0';
+    UT_SetDefaultReturnValue(UT_KEY(DS_FsExtAllocate), OS_ERROR);
 
     /* Execute the function being tested */
-    DS_FileCreateName(FileIndex);
+    UtAssert_BOOL_FALSE(DS_FilePreallocate(FileIndex, "filename"));
 
     /* Verify results */
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileState, DS_DISABLED);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FILE_PREALLOC_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FILE_NAME_ERR_EID);
 }
 
-void DS_FileCreateName_Test_PathBaseSeqTooLarge(void)
+void DS_FileOpenDirect_Test_Disabled(void)
 {
-    int32 FileIndex   = 0;
+    uint32 FileIndex = 0;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].DirectIO = DS_DISABLED;
+    DS_AppData.FileStatus[FileIndex].FileSize           = 100;
+
+    /* Execute the function being tested */
+    DS_FileOpenDirect(FileIndex);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(DS_AppData.FileStatus[FileIndex].Direct);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].DirectOffset, 100);
+    UtAssert_STUB_COUNT(DS_FsExtOpenDirect, 0);
+}
+
+void DS_FileOpenDirect_Test_Nominal(void)
+{
+    uint32 FileIndex = 0;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].DirectIO = DS_ENABLED;
+    DS_AppData.FileStatus[FileIndex].FileSize           = 100;
+
+    /* Execute the function being tested */
+    DS_FileOpenDirect(FileIndex);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(DS_AppData.FileStatus[FileIndex].Direct);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].DirectOffset, 100);
+    UtAssert_STUB_COUNT(DS_FsExtOpenDirect, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileOpenDirect_Test_Error(void)
+{
+    uint32 FileIndex = 0;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].DirectIO = DS_ENABLED;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_FsExtOpenDirect), OS_ERROR);
+
+    /* Execute the function being tested */
+    DS_FileOpenDirect(FileIndex);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(DS_AppData.FileStatus[FileIndex].Direct);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FILE_DIRECT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_FileCreateName_Test_Nominal(void)
+{
+    int32 FileIndex    = 0;
+    char  StrCompare[] = "path/base00000001.ext";
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
+    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
+
+    DS_AppData.FileStatus[FileIndex].FileCount = 1;
+
+    /* Execute the function being tested */
+    DS_FileCreateName(FileIndex, DS_AppData.FileStatus[FileIndex].FileName);
+
+    /* Verify results */
+    UtAssert_STRINGBUF_EQ(DS_AppData.FileStatus[FileIndex].FileName, sizeof(DS_AppData.FileStatus[FileIndex].FileName),
+                          StrCompare, sizeof(StrCompare));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileCreateName_Test_NominalWithSeparator(void)
+{
+    int32 FileIndex    = 0;
+    char  StrCompare[] = "path/base00000001.ext";
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
+    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
+    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Pathname, "path/",
+            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Pathname));
+
+    DS_AppData.FileStatus[FileIndex].FileCount = 1;
+
+    /* Execute the function being tested */
+    DS_FileCreateName(FileIndex, DS_AppData.FileStatus[FileIndex].FileName);
+
+    /* Verify results */
+    UtAssert_STRINGBUF_EQ(DS_AppData.FileStatus[FileIndex].FileName, sizeof(DS_AppData.FileStatus[FileIndex].FileName),
+                          StrCompare, sizeof(StrCompare));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileCreateName_Test_NominalWithPeriod(void)
+{
+    int32 FileIndex    = 0;
+    char  StrCompare[] = "path/base00000001.ext";
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
+    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
+    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Extension, ".ext",
+            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Extension));
+
+    DS_AppData.FileStatus[FileIndex].FileCount = 1;
+
+    /* Execute the function being tested */
+    DS_FileCreateName(FileIndex, DS_AppData.FileStatus[FileIndex].FileName);
+
+    /* Verify results */
+    UtAssert_STRINGBUF_EQ(DS_AppData.FileStatus[FileIndex].FileName, sizeof(DS_AppData.FileStatus[FileIndex].FileName),
+                          StrCompare, sizeof(StrCompare));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileCreateName_Test_EmptyPath(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
+    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
+    DS_AppData.DestFileTblPtr->File[FileIndex].Pathname[0] = '\0';
+
+    DS_AppData.FileStatus[FileIndex].FileCount = 1;
+
+    /* Execute the function being tested */
+    DS_FileCreateName(FileIndex, DS_AppData.FileStatus[FileIndex].FileName);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileState, DS_DISABLED);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FILE_CREATE_EMPTY_PATH_ERR_EID);
+}
+
+void DS_FileCreateName_Test_Error(void)
+{
+    int32 FileIndex = 0;
+    int32 i;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
+    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
+
+    for (i = 0; i < DS_TOTAL_FNAME_BUFSIZE - 2; i++)
+    {
+        DS_AppData.DestFileTblPtr->File[FileIndex].Basename[i] = 'a';
+    }
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].Basename[DS_TOTAL_FNAME_BUFSIZE - 1] = '\0';
+
+    /* Execute the function being tested */
+    DS_FileCreateName(FileIndex, DS_AppData.FileStatus[FileIndex].FileName);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileState, DS_DISABLED);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FILE_NAME_ERR_EID);
+}
+
+void DS_FileCreateName_Test_PathBaseSeqTooLarge(void)
+{
+    int32 FileIndex   = 0;
     int32 PathnameLen = (DS_TOTAL_FNAME_BUFSIZE - DS_SEQUENCE_DIGITS - 1) / 2;
     int32 BasenameLen = DS_TOTAL_FNAME_BUFSIZE - DS_SEQUENCE_DIGITS - 1 - PathnameLen;
 
@@ -712,7 +1382,7 @@ void DS_FileCreateName_Test_PathBaseSeqTooLarge(void)
     memset(DS_AppData.DestFileTblPtr->File[FileIndex].Basename, 'b', BasenameLen);
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_FileCreateName(FileIndex));
+    UtAssert_VOIDCALL(DS_FileCreateName(FileIndex, DS_AppData.FileStatus[FileIndex].FileName));
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
@@ -736,7 +1406,7 @@ void DS_FileCreateName_Test_PathBaseSeqExtTooLarge(void)
             sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Extension));
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_FileCreateName(FileIndex));
+    UtAssert_VOIDCALL(DS_FileCreateName(FileIndex, DS_AppData.FileStatus[FileIndex].FileName));
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
@@ -758,7 +1428,7 @@ void DS_FileCreateName_Test_ExtensionZero(void)
     DS_AppData.DestFileTblPtr->File[FileIndex].Extension[0] = '\0';
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_FileCreateName(FileIndex));
+    UtAssert_VOIDCALL(DS_FileCreateName(FileIndex, DS_AppData.FileStatus[FileIndex].FileName));
 
     /* Verify results */
     UtAssert_STRINGBUF_EQ(DS_AppData.FileStatus[FileIndex].FileName, sizeof(DS_AppData.FileStatus[FileIndex].FileName),
@@ -843,228 +1513,1973 @@ void DS_FileCreateSequence_Test_BadFilenameType(void)
 #if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
 void DS_FileUpdateHeader_Test_PlatformConfigCFE_Nominal(void)
 {
-    int32 FileIndex = 0;
+    DS_FinalizeEntry_t Entry;
+
+    memset(&Entry, 0, sizeof(Entry));
+
+    strncpy(Entry.FileName, "directory1/filename", sizeof(Entry.FileName));
+    Entry.CloseTime.Seconds   = 10;
+    Entry.FileTableIndex      = 2;
+    Entry.FileNameType        = DS_BY_TIME;
+    Entry.Summary.PacketCount = 5;
+
+    memset(&UT_DS_FileHeader, 0, sizeof(UT_DS_FileHeader));
+    UT_SetHandlerFunction(UT_KEY(DS_FsExtWriteAt), &UT_DS_FsExtWriteAt_CustomHandler, NULL);
+
+    /* Execute the function being tested */
+    DS_FileUpdateHeader(&Entry);
+
+    /* Verify results - one write covers the close time and the summary */
+    UtAssert_UINT32_EQ(UT_DS_FileHeader.CloseSeconds, 10);
+    UtAssert_UINT32_EQ(UT_DS_FileHeader.FileTableIndex, 2);
+    UtAssert_UINT32_EQ(UT_DS_FileHeader.FileNameType, DS_BY_TIME);
+    UtAssert_STRINGBUF_EQ(UT_DS_FileHeader.FileName, sizeof(UT_DS_FileHeader.FileName), Entry.FileName,
+                          sizeof(Entry.FileName));
+    UtAssert_UINT32_EQ(UT_DS_FileHeader.Version, DS_FILE_HEADER_VERSION);
+    UtAssert_UINT32_EQ(UT_DS_FileHeader.PacketCount, 5);
+    UtAssert_UINT32_EQ(DS_AppData.FileUpdateCounter, 1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+    UtAssert_STUB_COUNT(DS_FsExtWriteAt, 1);
+    UtAssert_STUB_COUNT(OS_lseek, 0);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+#endif
+
+#if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
+void DS_FileUpdateHeader_Test_WriteError(void)
+{
+    DS_FinalizeEntry_t Entry;
+
+    memset(&Entry, 0, sizeof(Entry));
+
+    /* Set to fail condition "if (Result == OS_SUCCESS)" */
+    UT_SetDefaultReturnValue(UT_KEY(DS_FsExtWriteAt), OS_ERROR);
+
+    /* Execute the function being tested */
+    DS_FileUpdateHeader(&Entry);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileUpdateErrCounter, 1);
+    UtAssert_STUB_COUNT(DS_FsExtWriteAt, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+#endif
+
+#if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
+void DS_FileUpdateHeader_Test_OsalFallback(void)
+{
+    DS_FinalizeEntry_t Entry;
+
+    memset(&Entry, 0, sizeof(Entry));
+
+    strncpy(Entry.FileName, "directory1/filename", sizeof(Entry.FileName));
+
+    /* Positional writes not configured */
+    UT_SetDefaultReturnValue(UT_KEY(DS_FsExtWriteAt), OS_ERR_NOT_IMPLEMENTED);
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, sizeof(CFE_FS_Header_t));
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, sizeof(DS_FileHeader_t));
 
     /* Execute the function being tested */
-    DS_FileUpdateHeader(FileIndex);
+    DS_FileUpdateHeader(&Entry);
 
     /* Verify results */
     UtAssert_UINT32_EQ(DS_AppData.FileUpdateCounter, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_lseek, 1);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 #endif
 
 #if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
-void DS_FileUpdateHeader_Test_WriteError(void)
+void DS_FileUpdateHeader_Test_OsalFallbackError(void)
+{
+    DS_FinalizeEntry_t Entry;
+
+    memset(&Entry, 0, sizeof(Entry));
+
+    /* Positional writes not configured and the seek fails */
+    UT_SetDefaultReturnValue(UT_KEY(DS_FsExtWriteAt), OS_ERR_NOT_IMPLEMENTED);
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), OS_ERROR);
+
+    /* Execute the function being tested */
+    DS_FileUpdateHeader(&Entry);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileUpdateErrCounter, 1);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+#endif
+
+void DS_FileCloseDest_Test_FlushError(void)
 {
     int32 FileIndex = 0;
 
-    /* Set to fail condition "if (Result == sizeof(CFE_TIME_SysTime_t))" */
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] = '\0';
+    DS_AppData.FileStatus[FileIndex].BufferedBytes         = 10;
+
+    /* Set to fail the buffer flush */
     UT_SetDefaultReturnValue(UT_KEY(OS_write), -1);
 
     /* Execute the function being tested */
-    DS_FileUpdateHeader(FileIndex);
+    DS_FileCloseDest(FileIndex);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileState, DS_DISABLED);
+    UtAssert_STUB_COUNT(DS_FinalizeEnqueue, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_WRITE_FILE_ERR_EID);
+}
+
+void DS_FileCloseDest_Test_Direct(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] = '\0';
+    DS_AppData.FileStatus[FileIndex].Direct                = true;
+    DS_AppData.FileStatus[FileIndex].DirectFd              = 3;
+
+    /* Execute the function being tested */
+    DS_FileCloseDest(FileIndex);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(DS_AppData.FileStatus[FileIndex].Direct);
+    UtAssert_INT32_EQ(DS_AppData.FileStatus[FileIndex].DirectFd, -1);
+    UtAssert_STUB_COUNT(DS_FsExtCloseDirect, 1);
+    UtAssert_STUB_COUNT(DS_FinalizeEnqueue, 1);
+}
+
+void DS_FileCloseDest_Test_Summary(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] = '\0';
+    DS_AppData.FileStatus[FileIndex].Summary.PacketCount   = 5;
+    DS_AppData.FileStatus[FileIndex].Summary.MidCount      = 1;
+
+    /* Execute the function being tested */
+    DS_FileCloseDest(FileIndex);
+
+    /* Verify results - summary goes with the closed file */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].Summary.PacketCount, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].Summary.MidCount, 0);
+    UtAssert_STUB_COUNT(DS_FinalizeEnqueue, 1);
+}
+
+#if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
+void DS_FileCloseDest_Test_DataBytes(void)
+{
+    int32  FileIndex  = 0;
+    uint32 HeaderSize = sizeof(CFE_FS_Header_t) + sizeof(DS_FileHeader_t);
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] = '\0';
+    DS_AppData.FileStatus[FileIndex].FileSize              = HeaderSize + 100;
+
+    UT_SetHandlerFunction(UT_KEY(DS_FinalizeEnqueue), &UT_DS_FinalizeEnqueue_CustomHandler, NULL);
+
+    /* Execute the function being tested */
+    DS_FileCloseDest(FileIndex);
+
+    /* Verify results - stored bytes following the headers */
+    UtAssert_STUB_COUNT(DS_FinalizeEnqueue, 1);
+    UtAssert_UINT32_EQ(UT_DS_FinalizeEntry.Summary.DataBytes, 100);
+}
+
+void DS_FileCloseDest_Test_DataBytesIndex(void)
+{
+    int32  FileIndex  = 0;
+    uint32 HeaderSize = sizeof(CFE_FS_Header_t) + sizeof(DS_FileHeader_t);
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] = '\0';
+    DS_AppData.FileStatus[FileIndex].FileSize              = HeaderSize + 100;
+    DS_AppData.FileStatus[FileIndex].Summary.IndexOffset   = HeaderSize + 60;
+
+    UT_SetHandlerFunction(UT_KEY(DS_FinalizeEnqueue), &UT_DS_FinalizeEnqueue_CustomHandler, NULL);
+
+    /* Execute the function being tested */
+    DS_FileCloseDest(FileIndex);
+
+    /* Verify results - the trailing index is not packet data */
+    UtAssert_STUB_COUNT(DS_FinalizeEnqueue, 1);
+    UtAssert_UINT32_EQ(UT_DS_FinalizeEntry.Summary.DataBytes, 60);
+    UtAssert_UINT32_EQ(UT_DS_FinalizeEntry.FileTableIndex, FileIndex);
+    UtAssert_UINT32_EQ(UT_DS_FinalizeEntry.FileNameType,
+                       DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType);
+}
+#endif
+
+void DS_FileCloseDest_Test_Codec(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] = '\0';
+    DS_AppData.FileStatus[FileIndex].Codec                 = DS_CODEC_LZ_HIGH;
+    DS_AppData.FileStatus[FileIndex].CodecInBytes          = 4096;
+    DS_AppData.FileStatus[FileIndex].CodecOutBytes         = 1024;
+    DS_AppData.FileStatus[FileIndex].CodecTime             = 500;
+
+    /* Execute the function being tested */
+    DS_FileCloseDest(FileIndex);
+
+    /* Verify results - statistics go with the closed file */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].Codec, DS_CODEC_NONE);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].CodecInBytes, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].CodecOutBytes, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].CodecTime, 0);
+    UtAssert_STUB_COUNT(DS_FinalizeEnqueue, 1);
+}
+
+void DS_FileCloseDest_Test_Delta(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] = '\0';
+    DS_AppData.FileStatus[FileIndex].DeltaKeyframe         = 10;
+    DS_AppData.FileStatus[FileIndex].DeltaNext             = 1;
+    DS_AppData.FileStatus[FileIndex].DeltaInBytes          = 4096;
+    DS_AppData.FileStatus[FileIndex].DeltaOutBytes         = 1024;
+    DS_AppData.FileStatus[FileIndex].Delta[0].Length       = 64;
+
+    /* Execute the function being tested */
+    DS_FileCloseDest(FileIndex);
+
+    /* Verify results - next file starts with keyframes */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].DeltaKeyframe, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].DeltaNext, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].DeltaInBytes, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].DeltaOutBytes, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].Delta[0].Length, 0);
+}
+
+void DS_FileCloseDest_Test_Superframe(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] = '\0';
+    DS_AppData.FileStatus[FileIndex].SuperframeSize        = DS_SUPERFRAME_MIN_SIZE;
+    DS_AppData.FileStatus[FileIndex].SuperframeCount       = 1;
+    DS_AppData.FileStatus[FileIndex].SuperframeUsed        = 22;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), DS_SUPERFRAME_MIN_SIZE);
+
+    /* Execute the function being tested */
+    DS_FileCloseDest(FileIndex);
+
+    /* Verify results - partial superframe written before the file is closed */
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].SuperframeSize, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].SuperframeCount, 0);
+    UtAssert_STUB_COUNT(DS_FinalizeEnqueue, 1);
+}
+
+void DS_FileCloseDest_Test_QueueFull(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] = '\0';
+    strncpy(DS_AppData.FileStatus[FileIndex].FileName, "directory1/filename",
+            sizeof(DS_AppData.FileStatus[FileIndex].FileName));
+
+    /* Finalizer queue is full */
+    UT_SetDefaultReturnValue(UT_KEY(DS_FinalizeEnqueue), false);
+
+    /* Execute the function being tested */
+    DS_FileCloseDest(FileIndex);
+
+    /* Verify results - file is kept by the destination, not finalized here */
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
+    UtAssert_BOOL_TRUE(DS_AppData.FileStatus[FileIndex].FinalizePending);
+    UtAssert_STRINGBUF_EQ(DS_AppData.FileStatus[FileIndex].FinalizeEntry.FileName,
+                          sizeof(DS_AppData.FileStatus[FileIndex].FinalizeEntry.FileName), "directory1/filename",
+                          sizeof("directory1/filename"));
+    UtAssert_STUB_COUNT(DS_FinalizeEnqueue, 1);
+    UtAssert_STUB_COUNT(DS_FileFinalize, 0);
+}
+
+void DS_FileCloseDest_Test_Pending(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle and an earlier closed file still waiting */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] = '\0';
+    DS_AppData.FileStatus[FileIndex].FinalizePending       = true;
+
+    /* Queue is full once, then there is room */
+    UT_SetDeferredRetcode(UT_KEY(DS_FinalizeEnqueue), 1, false);
+
+    /* Execute the function being tested */
+    DS_FileCloseDest(FileIndex);
+
+    /* Verify results - earlier file is queued first, after one wait */
+    UtAssert_BOOL_FALSE(DS_AppData.FileStatus[FileIndex].FinalizePending);
+    UtAssert_STUB_COUNT(DS_FinalizeEnqueue, 3);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+}
+
+void DS_FileRetryFinalize_Test_None(void)
+{
+    int32 FileIndex = 0;
+
+    /* Execute the function being tested */
+    DS_FileRetryFinalize(FileIndex, false);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(DS_FinalizeEnqueue, 0);
+}
+
+void DS_FileRetryFinalize_Test_Queued(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.FileStatus[FileIndex].FinalizePending = true;
+
+    /* Execute the function being tested */
+    DS_FileRetryFinalize(FileIndex, false);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(DS_AppData.FileStatus[FileIndex].FinalizePending);
+    UtAssert_STUB_COUNT(DS_FinalizeEnqueue, 1);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+}
+
+void DS_FileRetryFinalize_Test_QueueFull(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.FileStatus[FileIndex].FinalizePending = true;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_FinalizeEnqueue), false);
+
+    /* Execute the function being tested */
+    DS_FileRetryFinalize(FileIndex, false);
+
+    /* Verify results - tried once, file still waiting */
+    UtAssert_BOOL_TRUE(DS_AppData.FileStatus[FileIndex].FinalizePending);
+    UtAssert_STUB_COUNT(DS_FinalizeEnqueue, 1);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+}
+
+void DS_FileFlushBuffer_Test_Empty(void)
+{
+    int32 FileIndex = 0;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileFlushBuffer(FileIndex), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FlushCounter, 0);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileSummaryUpdate_Test_Nominal(void)
+{
+    int32              FileIndex    = 0;
+    CFE_SB_MsgId_t     forced_MsgID = CFE_SB_ValueToMsgId(DS_CMD_MID);
+    CFE_TIME_SysTime_t forced_Time  = {100, 200};
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &forced_Time, sizeof(forced_Time), false);
+
+    DS_AppData.FileStatus[FileIndex].FileHandle = DS_UT_OBJID_1;
+
+    /* Execute the function being tested */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
+    DS_FileSummaryUpdate(FileIndex, &UT_CmdBuf.Buf, 10);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
+    DS_FileSummaryUpdate(FileIndex, &UT_CmdBuf.Buf, 20);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].Summary.PacketCount, 2);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].Summary.FirstTime.Seconds, 100);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].Summary.FirstTime.Subseconds, 200);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].Summary.MidCount, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].Summary.MidList[0], DS_CMD_MID);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].Summary.MidOverflow, 0);
+    UtAssert_BOOL_TRUE(UT_DS_BloomMatch(DS_AppData.FileStatus[FileIndex].Summary.MidBloom, DS_CMD_MID));
+    UtAssert_BOOL_FALSE(UT_DS_BloomMatch(DS_AppData.FileStatus[FileIndex].Summary.MidBloom, DS_CMD_MID + 1));
+}
+
+void DS_FileSummaryUpdate_Test_NewMid(void)
+{
+    int32          FileIndex    = 0;
+    CFE_SB_MsgId_t forced_MsgID = CFE_SB_ValueToMsgId(DS_CMD_MID);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
+
+    DS_AppData.FileStatus[FileIndex].FileHandle          = DS_UT_OBJID_1;
+    DS_AppData.FileStatus[FileIndex].Summary.PacketCount = 1;
+    DS_AppData.FileStatus[FileIndex].Summary.MidCount    = 1;
+    DS_AppData.FileStatus[FileIndex].Summary.MidList[0]  = DS_CMD_MID + 1;
+
+    /* Execute the function being tested */
+    DS_FileSummaryUpdate(FileIndex, &UT_CmdBuf.Buf, 10);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].Summary.PacketCount, 2);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].Summary.MidCount, 2);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].Summary.MidList[1], DS_CMD_MID);
+}
+
+void DS_FileSummaryUpdate_Test_MidOverflow(void)
+{
+    int32          FileIndex    = 0;
+    CFE_SB_MsgId_t forced_MsgID = CFE_SB_ValueToMsgId(DS_CMD_MID);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
+
+    DS_AppData.FileStatus[FileIndex].FileHandle       = DS_UT_OBJID_1;
+    DS_AppData.FileStatus[FileIndex].Summary.MidCount = DS_FILE_HEADER_MID_CNT;
+
+    /* Execute the function being tested */
+    DS_FileSummaryUpdate(FileIndex, &UT_CmdBuf.Buf, 10);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].Summary.MidCount, DS_FILE_HEADER_MID_CNT);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].Summary.MidOverflow, 1);
+    UtAssert_BOOL_TRUE(UT_DS_BloomMatch(DS_AppData.FileStatus[FileIndex].Summary.MidBloom, DS_CMD_MID));
+}
+
+void DS_FileBloomBit_Test(void)
+{
+    uint32 i = 0;
+
+    /* Execute the function being tested */
+    for (i = 0; i < 100; i++)
+    {
+        UtAssert_True(DS_FileBloomBit(i, i % DS_FILE_BLOOM_HASH_CNT) < DS_FILE_BLOOM_BITS, "Bit in range");
+    }
+
+    /* Verify results - first hash is the documented function */
+    UtAssert_True(DS_FileBloomBit(DS_CMD_MID, 0) == ((DS_CMD_MID * 0x9E3779B1) % DS_FILE_BLOOM_BITS),
+                  "First hash");
+}
+
+void DS_FileSummaryUpdate_Test_FileClosed(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.FileStatus[FileIndex].FileHandle = OS_OBJECT_ID_UNDEFINED;
+
+    /* Execute the function being tested */
+    DS_FileSummaryUpdate(FileIndex, &UT_CmdBuf.Buf, 10);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].Summary.PacketCount, 0);
+    UtAssert_STUB_COUNT(CFE_MSG_GetMsgId, 0);
+}
+
+void DS_FileIndexUpdate_Test_Disabled(void)
+{
+    int32              FileIndex  = 0;
+    CFE_TIME_SysTime_t PacketTime = {100, 0};
+
+    /* Execute the function being tested */
+    DS_FileIndexUpdate(FileIndex, PacketTime, 200);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].IndexCount, 0);
+}
+
+void DS_FileIndexUpdate_Test_ByBytes(void)
+{
+    int32              FileIndex  = 0;
+    CFE_TIME_SysTime_t PacketTime = {100, 0};
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].IndexBytes = 1000;
+
+    /* Execute the function being tested */
+    DS_FileIndexUpdate(FileIndex, PacketTime, 200);
+    DS_FileIndexUpdate(FileIndex, PacketTime, 1100);
+    DS_FileIndexUpdate(FileIndex, PacketTime, 1200);
+
+    /* Verify results - first packet, then only after 1000 bytes */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].IndexCount, 2);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].Index[0].Offset, 200);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].Index[0].Seconds, 100);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].Index[1].Offset, 1200);
+}
+
+void DS_FileIndexUpdate_Test_BySeconds(void)
+{
+    int32              FileIndex  = 0;
+    CFE_TIME_SysTime_t PacketTime = {100, 0};
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].IndexSeconds = 10;
+
+    /* Execute the function being tested */
+    DS_FileIndexUpdate(FileIndex, PacketTime, 200);
+    PacketTime.Seconds = 109;
+    DS_FileIndexUpdate(FileIndex, PacketTime, 300);
+    PacketTime.Seconds = 110;
+    DS_FileIndexUpdate(FileIndex, PacketTime, 400);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].IndexCount, 2);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].Index[1].Seconds, 110);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].Index[1].Offset, 400);
+}
+
+void DS_FileIndexUpdate_Test_Full(void)
+{
+    int32              FileIndex  = 0;
+    CFE_TIME_SysTime_t PacketTime = {0, 0};
+    uint32             i          = 0;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].IndexBytes = 100;
+
+    for (i = 0; i < DS_FILE_INDEX_MAX_CNT; i++)
+    {
+        DS_AppData.FileStatus[FileIndex].Index[i].Offset = i * 100;
+    }
+    DS_AppData.FileStatus[FileIndex].IndexCount = DS_FILE_INDEX_MAX_CNT;
+
+    /* Execute the function being tested */
+    DS_FileIndexUpdate(FileIndex, PacketTime, DS_FILE_INDEX_MAX_CNT * 100);
+
+    /* Verify results - every other sample kept and spacing doubled */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].IndexCount, (DS_FILE_INDEX_MAX_CNT / 2) + 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].IndexShift, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].Index[1].Offset, 200);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].Index[DS_FILE_INDEX_MAX_CNT / 2].Offset,
+                       DS_FILE_INDEX_MAX_CNT * 100);
+
+    /* Next sample needs twice the spacing */
+    DS_FileIndexUpdate(FileIndex, PacketTime, (DS_FILE_INDEX_MAX_CNT * 100) + 100);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].IndexCount, (DS_FILE_INDEX_MAX_CNT / 2) + 1);
+}
+
+void DS_FileWriteIndex_Test_Nominal(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].BufferSize = DS_WRITE_BUFFER_MAX_SIZE;
+    DS_AppData.FileStatus[FileIndex].FileHandle           = DS_UT_OBJID_1;
+    DS_AppData.FileStatus[FileIndex].FileSize             = 1000;
+    DS_AppData.FileStatus[FileIndex].IndexCount           = 2;
+    DS_AppData.FileStatus[FileIndex].IndexShift           = 1;
+
+    /* Execute the function being tested */
+    DS_FileWriteIndex(FileIndex);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].Summary.IndexOffset, 1000);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize,
+                       1000 + sizeof(DS_FileIndexHeader_t) + (2 * sizeof(DS_FileIndexEntry_t)));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].IndexCount, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].IndexShift, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileWriteIndex_Test_Empty(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.FileStatus[FileIndex].FileHandle = DS_UT_OBJID_1;
+    DS_AppData.FileStatus[FileIndex].FileSize   = 1000;
+
+    /* Execute the function being tested */
+    DS_FileWriteIndex(FileIndex);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].Summary.IndexOffset, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 1000);
+}
+
+void DS_FileWriteIndex_Test_WriteError(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] = '\0';
+    DS_AppData.FileStatus[FileIndex].FileSize              = 1000;
+    DS_AppData.FileStatus[FileIndex].IndexCount            = 2;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), OS_ERROR);
+
+    /* Execute the function being tested */
+    DS_FileWriteIndex(FileIndex);
+
+    /* Verify results - file closed without an index */
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileState, DS_DISABLED);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].Summary.IndexOffset, 0);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(DS_FinalizeEnqueue, 1);
+}
+
+void DS_FileFlushBuffer_Test_Nominal(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.FileStatus[FileIndex].BufferedBytes = 32;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), 32);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileFlushBuffer(FileIndex), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].BufferedBytes, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FlushCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FlushByteCounter, 32);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileFlushBuffer_Test_Error(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] = '\0';
+    DS_AppData.FileStatus[FileIndex].BufferedBytes         = 32;
+
+    /* Set to fail condition "if (Result == (int32)Length)" */
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), 16);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileFlushBuffer(FileIndex), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].BufferedBytes, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileState, DS_DISABLED);
+    UtAssert_UINT32_EQ(DS_AppData.FlushCounter, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteErrCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_WRITE_FILE_ERR_EID);
+}
+
+void DS_FileFlushBuffer_Test_Compressed(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.FileStatus[FileIndex].Codec         = DS_CODEC_LZ_FAST;
+    DS_AppData.FileStatus[FileIndex].BufferedBytes = 100;
+    DS_AppData.FileStatus[FileIndex].FileSize      = 200;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_CodecCompress), 10);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), sizeof(DS_CodecFrame_t) + 10);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileFlushBuffer(FileIndex), CFE_SUCCESS);
+
+    /* Verify results - file size counts the block, not the packets */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].BufferedBytes, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 100 + sizeof(DS_CodecFrame_t) + 10);
+    UtAssert_UINT32_EQ(DS_AppData.FlushCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FlushByteCounter, sizeof(DS_CodecFrame_t) + 10);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileFlushBuffer_Test_CompressedError(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] = '\0';
+    DS_AppData.FileStatus[FileIndex].Codec                 = DS_CODEC_LZ_FAST;
+    DS_AppData.FileStatus[FileIndex].BufferedBytes         = 100;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_CodecCompress), 10);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileFlushBuffer(FileIndex), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileState, DS_DISABLED);
+    UtAssert_UINT32_EQ(DS_AppData.FlushCounter, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteErrCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_WRITE_FILE_ERR_EID);
+}
+
+void DS_FileWriteBlock_Test_Compressed(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.FileStatus[FileIndex].Codec = DS_CODEC_LZ_HIGH;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_CodecCompress), 10);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), sizeof(DS_CodecFrame_t) + 10);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileWriteBlock(FileIndex, DS_WRITE_BUFFER(FileIndex), 100), sizeof(DS_CodecFrame_t) + 10);
+
+    /* Verify results - frame and block in one write */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].CodecInBytes, 100);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].CodecOutBytes, sizeof(DS_CodecFrame_t) + 10);
+    UtAssert_UINT32_EQ(((DS_CodecFrame_t *)DS_AppData.CodecWork.Block)->Sync, DS_CODEC_FRAME_SYNC);
+    UtAssert_UINT32_EQ(((DS_CodecFrame_t *)DS_AppData.CodecWork.Block)->Codec, DS_CODEC_LZ_HIGH);
+    UtAssert_UINT32_EQ(((DS_CodecFrame_t *)DS_AppData.CodecWork.Block)->RawLength, 100);
+    UtAssert_UINT32_EQ(((DS_CodecFrame_t *)DS_AppData.CodecWork.Block)->Length, 10);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 1);
+}
+
+void DS_FileWriteBlock_Test_Stored(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.FileStatus[FileIndex].Codec = DS_CODEC_LZ_FAST;
+
+    /* Block did not get smaller - frame, then packet data */
+    UT_SetDefaultReturnValue(UT_KEY(DS_CodecCompress), 0);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, sizeof(DS_CodecFrame_t));
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), 100);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileWriteBlock(FileIndex, DS_WRITE_BUFFER(FileIndex), 100), sizeof(DS_CodecFrame_t) + 100);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].CodecInBytes, 100);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].CodecOutBytes, sizeof(DS_CodecFrame_t) + 100);
+    UtAssert_STUB_COUNT(OS_write, 2);
+}
+
+void DS_FileWriteBlock_Test_ShortWrite(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.FileStatus[FileIndex].Codec = DS_CODEC_LZ_FAST;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_CodecCompress), 10);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), 5);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileWriteBlock(FileIndex, DS_WRITE_BUFFER(FileIndex), 100), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].CodecInBytes, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].CodecOutBytes, 0);
+}
+
+void DS_FileWriteBlock_Test_StoredError(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.FileStatus[FileIndex].Codec = DS_CODEC_LZ_FAST;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_CodecCompress), 0);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileWriteBlock(FileIndex, DS_WRITE_BUFFER(FileIndex), 100), -1);
+
+    /* Verify results - packet data not written after the frame failed */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].CodecInBytes, 0);
+    UtAssert_STUB_COUNT(OS_write, 1);
+}
+
+void DS_FileWritePacket_Test_Raw(void)
+{
+    int32 FileIndex = 0;
+
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    DS_AppData.DestFileTblPtr->File[FileIndex].BufferSize = DS_WRITE_BUFFER_MAX_SIZE;
+
+    /* Execute the function being tested */
+    DS_FileWritePacket(FileIndex, &UT_CmdBuf.Buf, sizeof(UT_CmdBuf.Buf));
+
+    /* Verify results - packet stored as-is */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].BufferedBytes, sizeof(UT_CmdBuf.Buf));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].DeltaInBytes, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].DeltaOutBytes, 0);
+    UtAssert_STUB_COUNT(CFE_MSG_GetMsgId, 0);
+}
+
+void DS_FileWritePacket_Test_Superframe(void)
+{
+    int32 FileIndex = 0;
+
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    DS_AppData.DestFileTblPtr->File[FileIndex].BufferSize = DS_WRITE_BUFFER_MAX_SIZE;
+    DS_AppData.FileStatus[FileIndex].SuperframeSize       = DS_SUPERFRAME_MIN_SIZE;
+    DS_AppData.FileStatus[FileIndex].DeltaKeyframe        = 10;
+
+    /* Execute the function being tested */
+    DS_FileWritePacket(FileIndex, &UT_CmdBuf.Buf, 20);
+
+    /* Verify results - packet waits in the superframe */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].SuperframeCount, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].SuperframeUsed, sizeof(uint16) + 20);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].BufferedBytes, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].DeltaInBytes, 0);
+}
+
+void DS_FileWritePacket_Test_Delta(void)
+{
+    int32            FileIndex = 0;
+    uint8 *          Buffer    = DS_WRITE_BUFFER(FileIndex);
+    uint8            Rebuilt[64];
+    DS_DeltaRecord_t Record;
+    uint32           Offset;
+    union
+    {
+        CFE_SB_Buffer_t Buf;
+        uint8           Bytes[64];
+    } Packet;
+    uint8 Previous[sizeof(Packet.Bytes)];
+
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    DS_AppData.DestFileTblPtr->File[FileIndex].BufferSize = DS_WRITE_BUFFER_MAX_SIZE;
+    DS_AppData.FileStatus[FileIndex].DeltaKeyframe        = 4;
+
+    memset(Packet.Bytes, 0x5A, sizeof(Packet.Bytes));
+    memcpy(Previous, Packet.Bytes, sizeof(Previous));
+
+    /* Execute the function being tested - first packet is a keyframe */
+    DS_FileWritePacket(FileIndex, &Packet.Buf, sizeof(Packet.Bytes));
+
+    memcpy(&Record, Buffer, sizeof(Record));
+    UtAssert_UINT32_EQ(Record.Type, DS_DELTA_KEYFRAME);
+    UtAssert_UINT32_EQ(Record.Count, 0);
+    UtAssert_UINT32_EQ(Record.Length, sizeof(Packet.Bytes));
+    UtAssert_MemCmp(&Buffer[sizeof(Record)], Packet.Bytes, sizeof(Packet.Bytes), "Keyframe holds the packet");
+
+    /* Second packet with two changed bytes is a delta */
+    Offset          = DS_AppData.FileStatus[FileIndex].BufferedBytes;
+    Packet.Bytes[6] = 0x01;
+    Packet.Bytes[7] = 0x02;
+    DS_FileWritePacket(FileIndex, &Packet.Buf, sizeof(Packet.Bytes));
+
+    memcpy(&Record, &Buffer[Offset], sizeof(Record));
+    UtAssert_UINT32_EQ(Record.Type, DS_DELTA_XOR);
+    UtAssert_UINT32_EQ(Record.Count, 1);
+    UtAssert_UINT32_EQ(Record.Length, 4);
+
+    /* Verify results - delta rebuilds the packet byte-exact */
+    UtAssert_BOOL_TRUE(
+        DS_FileDeltaDecode(Previous, sizeof(Rebuilt), &Buffer[Offset + sizeof(Record)], Record.Length, Rebuilt));
+    UtAssert_MemCmp(Rebuilt, Packet.Bytes, sizeof(Rebuilt), "Delta rebuilds the packet");
+
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].DeltaInBytes, 2 * sizeof(Packet.Bytes));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].DeltaOutBytes,
+                       2 * sizeof(Record) + sizeof(Packet.Bytes) + 4);
+}
+
+void DS_FileWritePacket_Test_Keyframe(void)
+{
+    int32            FileIndex = 0;
+    uint8 *          Buffer    = DS_WRITE_BUFFER(FileIndex);
+    DS_DeltaRecord_t Record;
+    uint32           Offset = 0;
+    uint32           i;
+    union
+    {
+        CFE_SB_Buffer_t Buf;
+        uint8           Bytes[64];
+    } Packet;
+
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    DS_AppData.DestFileTblPtr->File[FileIndex].BufferSize = DS_WRITE_BUFFER_MAX_SIZE;
+    DS_AppData.FileStatus[FileIndex].DeltaKeyframe        = 3;
+
+    memset(Packet.Bytes, 0, sizeof(Packet.Bytes));
+
+    /* Execute the function being tested - keyframe, two deltas, keyframe */
+    for (i = 0; i < 4; i++)
+    {
+        Offset           = DS_AppData.FileStatus[FileIndex].BufferedBytes;
+        Packet.Bytes[10] = (uint8)i;
+        DS_FileWritePacket(FileIndex, &Packet.Buf, sizeof(Packet.Bytes));
+    }
+
+    /* Verify results */
+    memcpy(&Record, &Buffer[Offset], sizeof(Record));
+    UtAssert_UINT32_EQ(Record.Type, DS_DELTA_KEYFRAME);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].DeltaOutBytes,
+                       4 * sizeof(Record) + 2 * sizeof(Packet.Bytes) + 2 * 3);
+}
+
+void DS_FileWritePacket_Test_LengthChange(void)
+{
+    int32            FileIndex = 0;
+    uint8 *          Buffer    = DS_WRITE_BUFFER(FileIndex);
+    DS_DeltaRecord_t Record;
+    uint32           Offset;
+    union
+    {
+        CFE_SB_Buffer_t Buf;
+        uint8           Bytes[64];
+    } Packet;
+
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    DS_AppData.DestFileTblPtr->File[FileIndex].BufferSize = DS_WRITE_BUFFER_MAX_SIZE;
+    DS_AppData.FileStatus[FileIndex].DeltaKeyframe        = 10;
+
+    memset(Packet.Bytes, 0, sizeof(Packet.Bytes));
+    DS_FileWritePacket(FileIndex, &Packet.Buf, sizeof(Packet.Bytes));
+    Offset = DS_AppData.FileStatus[FileIndex].BufferedBytes;
+
+    /* Execute the function being tested */
+    DS_FileWritePacket(FileIndex, &Packet.Buf, sizeof(Packet.Bytes) / 2);
+
+    /* Verify results - a shorter packet cannot be a delta */
+    memcpy(&Record, &Buffer[Offset], sizeof(Record));
+    UtAssert_UINT32_EQ(Record.Type, DS_DELTA_KEYFRAME);
+    UtAssert_UINT32_EQ(Record.Length, sizeof(Packet.Bytes) / 2);
+}
+
+void DS_FileWritePacket_Test_Oversize(void)
+{
+    int32           FileIndex = 0;
+    DS_DeltaSlot_t *Slot;
+    union
+    {
+        CFE_SB_Buffer_t Buf;
+        uint8           Bytes[DS_DELTA_MAX_PKT_SIZE + 1];
+    } Packet;
+
+    memset(Packet.Bytes, 0, sizeof(Packet.Bytes));
+
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    DS_AppData.DestFileTblPtr->File[FileIndex].BufferSize = DS_WRITE_BUFFER_MAX_SIZE;
+    DS_AppData.FileStatus[FileIndex].DeltaKeyframe        = 10;
+    DS_AppData.FileStatus[FileIndex].Delta[0].Length      = 8;
+    DS_AppData.FileStatus[FileIndex].Delta[0].Count       = 1;
+
+    /* Execute the function being tested */
+    DS_FileWritePacket(FileIndex, &Packet.Buf, sizeof(Packet.Bytes));
+
+    /* Verify results - keyframe written and the message ID starts over */
+    Slot = &DS_AppData.FileStatus[FileIndex].Delta[0];
+    UtAssert_UINT32_EQ(Slot->Length, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].DeltaOutBytes,
+                       sizeof(DS_DeltaRecord_t) + sizeof(Packet.Bytes));
+}
+
+void DS_FileWritePacket_Test_Error(void)
+{
+    int32 FileIndex = 0;
+
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    DS_AppData.FileStatus[FileIndex].DeltaKeyframe = 10;
+
+    /* Record header write fails */
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), -1);
+
+    /* Execute the function being tested */
+    DS_FileWritePacket(FileIndex, &UT_CmdBuf.Buf, sizeof(UT_CmdBuf.Buf));
+
+    /* Verify results - packet not written after the header failed */
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].DeltaInBytes, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].DeltaOutBytes, 0);
+}
+
+void DS_FileDeltaSlot_Test(void)
+{
+    int32           FileIndex = 0;
+    DS_DeltaSlot_t *Slot;
+    uint32          i;
+
+    /* Fill every slot */
+    for (i = 0; i < DS_DELTA_MID_CNT; i++)
+    {
+        Slot         = DS_FileDeltaSlot(FileIndex, 100 + i);
+        Slot->Length = 8;
+        UtAssert_ADDRESS_EQ(Slot, &DS_AppData.FileStatus[FileIndex].Delta[i]);
+    }
+
+    /* Existing message ID keeps its slot */
+    UtAssert_ADDRESS_EQ(DS_FileDeltaSlot(FileIndex, 100), &DS_AppData.FileStatus[FileIndex].Delta[0]);
+
+    /* New message ID replaces the slot assigned longest ago */
+    Slot = DS_FileDeltaSlot(FileIndex, 200);
+    UtAssert_ADDRESS_EQ(Slot, &DS_AppData.FileStatus[FileIndex].Delta[0]);
+    UtAssert_UINT32_EQ(Slot->MessageID, 200);
+    UtAssert_UINT32_EQ(Slot->Length, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].DeltaNext, 1 % DS_DELTA_MID_CNT);
+}
+
+void DS_FileDeltaEncode_Test_NotSmaller(void)
+{
+    uint8 Previous[16];
+    uint8 Packet[16];
+    uint8 Output[16];
+
+    memset(Previous, 0, sizeof(Previous));
+    memset(Packet, 0xFF, sizeof(Packet));
+
+    /* Execute the function being tested - every byte changed */
+    UtAssert_UINT32_EQ(DS_FileDeltaEncode(Previous, Packet, sizeof(Packet), Output, sizeof(Output)), 0);
+
+    /* Output buffer too small for the delta */
+    memset(Packet, 0, sizeof(Packet) / 2);
+    UtAssert_UINT32_EQ(DS_FileDeltaEncode(Previous, Packet, sizeof(Packet), Output, 4), 0);
+}
+
+void DS_FileDeltaDecode_Test_Invalid(void)
+{
+    uint8 Previous[16];
+    uint8 Packet[16];
+    uint8 PastEnd[]   = {14, 4, 1, 2, 3, 4};
+    uint8 Truncated[] = {2, 4, 1};
+    uint8 NoCount[]   = {2};
+
+    memset(Previous, 0, sizeof(Previous));
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_FileDeltaDecode(Previous, sizeof(Packet), PastEnd, sizeof(PastEnd), Packet));
+    UtAssert_BOOL_FALSE(DS_FileDeltaDecode(Previous, sizeof(Packet), Truncated, sizeof(Truncated), Packet));
+    UtAssert_BOOL_FALSE(DS_FileDeltaDecode(Previous, sizeof(Packet), NoCount, sizeof(NoCount), Packet));
+}
+
+void DS_FileSuperframeAdd_Test_NoRoom(void)
+{
+    int32                 FileIndex = 0;
+    DS_SuperframeHeader_t Header;
+    uint16                Prefix;
+
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    DS_AppData.DestFileTblPtr->File[FileIndex].BufferSize = DS_WRITE_BUFFER_MAX_SIZE;
+    DS_AppData.FileStatus[FileIndex].SuperframeSize       = DS_SUPERFRAME_MIN_SIZE;
+
+    /* Two packets fit, the third does not */
+    DS_FileSuperframeAdd(FileIndex, &UT_CmdBuf.Buf, 20);
+    DS_FileSuperframeAdd(FileIndex, &UT_CmdBuf.Buf, 20);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].BufferedBytes, 0);
+
+    /* Execute the function being tested */
+    DS_FileSuperframeAdd(FileIndex, &UT_CmdBuf.Buf, 20);
+
+    /* Verify results - full superframe written, new one started */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].BufferedBytes, DS_SUPERFRAME_MIN_SIZE);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].SuperframeCount, 1);
+
+    memcpy(&Header, DS_WRITE_BUFFER(FileIndex), sizeof(Header));
+    memcpy(&Prefix, &DS_WRITE_BUFFER(FileIndex)[sizeof(Header)], sizeof(Prefix));
+    UtAssert_UINT32_EQ(Header.Sync, DS_SUPERFRAME_SYNC);
+    UtAssert_UINT32_EQ(Header.PacketCount, 2);
+    UtAssert_UINT32_EQ(Header.Length, DS_SUPERFRAME_MIN_SIZE);
+    UtAssert_UINT32_EQ(Header.Used, 2 * (sizeof(uint16) + 20));
+    UtAssert_UINT32_EQ(Prefix, 20);
+    UtAssert_MemCmp(&DS_WRITE_BUFFER(FileIndex)[sizeof(Header) + sizeof(Prefix)], &UT_CmdBuf.Buf, 20,
+                    "Packet follows its length");
+}
+
+void DS_FileSuperframeAdd_Test_Full(void)
+{
+    int32  FileIndex = 0;
+    uint32 Length    = DS_SUPERFRAME_MIN_SIZE - sizeof(DS_SuperframeHeader_t) - sizeof(uint16);
+
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    DS_AppData.DestFileTblPtr->File[FileIndex].BufferSize = DS_WRITE_BUFFER_MAX_SIZE;
+    DS_AppData.FileStatus[FileIndex].SuperframeSize       = DS_SUPERFRAME_MIN_SIZE;
+
+    /* Execute the function being tested */
+    DS_FileSuperframeAdd(FileIndex, (const CFE_SB_Buffer_t *)DS_AppData.DeltaRecord, Length);
+
+    /* Verify results - no other packet fits, so it is written now */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].BufferedBytes, DS_SUPERFRAME_MIN_SIZE);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].SuperframeCount, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].SuperframeUsed, 0);
+}
+
+void DS_FileSuperframeAdd_Test_Oversize(void)
+{
+    int32                 FileIndex = 0;
+    DS_SuperframeHeader_t Header;
+
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    DS_AppData.DestFileTblPtr->File[FileIndex].BufferSize = DS_WRITE_BUFFER_MAX_SIZE;
+    DS_AppData.FileStatus[FileIndex].SuperframeSize       = DS_SUPERFRAME_MIN_SIZE;
+
+    /* Execute the function being tested */
+    DS_FileSuperframeAdd(FileIndex, (const CFE_SB_Buffer_t *)DS_AppData.DeltaRecord, 100);
+
+    /* Verify results - record of its own, padded to a superframe boundary */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].BufferedBytes, 2 * DS_SUPERFRAME_MIN_SIZE);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].SuperframeCount, 0);
+
+    memcpy(&Header, DS_WRITE_BUFFER(FileIndex), sizeof(Header));
+    UtAssert_UINT32_EQ(Header.PacketCount, 1);
+    UtAssert_UINT32_EQ(Header.Length, 2 * DS_SUPERFRAME_MIN_SIZE);
+    UtAssert_UINT32_EQ(Header.Used, sizeof(uint16) + 100);
+}
+
+void DS_FileSuperframeAdd_Test_Error(void)
+{
+    int32 FileIndex = 0;
+
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    DS_AppData.FileStatus[FileIndex].SuperframeSize  = DS_SUPERFRAME_MIN_SIZE;
+    DS_AppData.FileStatus[FileIndex].SuperframeCount = 1;
+    DS_AppData.FileStatus[FileIndex].SuperframeUsed  = 40;
+
+    /* Superframe write fails */
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), -1);
+
+    /* Execute the function being tested */
+    DS_FileSuperframeAdd(FileIndex, &UT_CmdBuf.Buf, 20);
+
+    /* Verify results - packet dropped with the closed file */
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].SuperframeCount, 0);
+}
+
+void DS_FileSuperframeFlush_Test_Empty(void)
+{
+    int32 FileIndex = 0;
+
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    DS_AppData.FileStatus[FileIndex].SuperframeSize = DS_SUPERFRAME_MIN_SIZE;
+
+    /* Execute the function being tested */
+    DS_FileSuperframeFlush(FileIndex);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_write, 0);
+}
+
+void DS_FileSuperframeGrowth_Test(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.FileStatus[FileIndex].SuperframeSize = DS_SUPERFRAME_MIN_SIZE;
+
+    /* Execute the function being tested - new superframe */
+    UtAssert_UINT32_EQ(DS_FileSuperframeGrowth(FileIndex, 20), DS_SUPERFRAME_MIN_SIZE);
+    UtAssert_UINT32_EQ(DS_FileSuperframeGrowth(FileIndex, 100), 2 * DS_SUPERFRAME_MIN_SIZE);
+
+    /* Packet fits the current superframe */
+    DS_AppData.FileStatus[FileIndex].SuperframeCount = 1;
+    DS_AppData.FileStatus[FileIndex].SuperframeUsed  = 22;
+    UtAssert_UINT32_EQ(DS_FileSuperframeGrowth(FileIndex, 20), DS_SUPERFRAME_MIN_SIZE);
+
+    /* Current superframe is written first */
+    DS_AppData.FileStatus[FileIndex].SuperframeUsed = 40;
+    UtAssert_UINT32_EQ(DS_FileSuperframeGrowth(FileIndex, 20), 2 * DS_SUPERFRAME_MIN_SIZE);
+}
+
+void DS_FileFlushBuffer_Test_Direct(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.FileStatus[FileIndex].Direct        = true;
+    DS_AppData.FileStatus[FileIndex].DirectOffset  = DS_DIRECT_IO_BLOCK_SIZE;
+    DS_AppData.FileStatus[FileIndex].BufferedBytes = 100;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileFlushBuffer(FileIndex), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(DS_FsExtWriteDirect, 1);
+    UtAssert_STUB_COUNT(OS_write, 0);
+}
+
+void DS_FileFlushDirect_Test_Partial(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.FileStatus[FileIndex].Direct        = true;
+    DS_AppData.FileStatus[FileIndex].DirectOffset  = DS_DIRECT_IO_BLOCK_SIZE;
+    DS_AppData.FileStatus[FileIndex].BufferedBytes = DS_DIRECT_IO_BLOCK_SIZE + 100;
+    DS_AppData.FileStatus[FileIndex].DirectTail    = 40;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileFlushDirect(FileIndex), CFE_SUCCESS);
+
+    /* Verify results - whole block is done, padded partial block is kept */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].DirectOffset, 2 * DS_DIRECT_IO_BLOCK_SIZE);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].BufferedBytes, 100);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].DirectTail, 100);
+    UtAssert_UINT32_EQ(DS_AppData.FlushCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FlushByteCounter, DS_DIRECT_IO_BLOCK_SIZE + 60);
+    UtAssert_UINT32_EQ(DS_AppData.DirectFlushCounter, 1);
+    UtAssert_STUB_COUNT(DS_FsExtWriteDirect, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileFlushDirect_Test_NoNewData(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.FileStatus[FileIndex].Direct        = true;
+    DS_AppData.FileStatus[FileIndex].BufferedBytes = 100;
+    DS_AppData.FileStatus[FileIndex].DirectTail    = 100;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileFlushDirect(FileIndex), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].BufferedBytes, 100);
+    UtAssert_STUB_COUNT(DS_FsExtWriteDirect, 0);
+}
+
+void DS_FileFlushDirect_Test_Error(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] = '\0';
+    DS_AppData.FileStatus[FileIndex].Direct                = true;
+    DS_AppData.FileStatus[FileIndex].BufferedBytes         = 100;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_FsExtWriteDirect), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileFlushDirect(FileIndex), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].BufferedBytes, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileState, DS_DISABLED);
+    UtAssert_UINT32_EQ(DS_AppData.DirectFlushCounter, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_WRITE_FILE_ERR_EID);
+}
+
+void DS_FileTestSync_Test_ByTime(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].SyncPolicy   = DS_SYNC_BY_TIME;
+    DS_AppData.DestFileTblPtr->File[FileIndex].SyncInterval = 10;
+    DS_AppData.DestFileTblPtr->File[FileIndex].BufferSize   = 64;
+    DS_AppData.FileStatus[FileIndex].SyncBytes              = 32;
+    DS_AppData.FileStatus[FileIndex].SyncAge                = 10;
+    DS_AppData.FileStatus[FileIndex].BufferedBytes          = 32;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), 32);
+
+    /* Execute the function being tested */
+    DS_FileTestSync(FileIndex);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].BufferedBytes, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].SyncBytes, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].SyncAge, 0);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(DS_FsExtSync, 1);
+}
+
+void DS_FileTestSync_Test_ByTimeNoData(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].SyncPolicy   = DS_SYNC_BY_TIME;
+    DS_AppData.DestFileTblPtr->File[FileIndex].SyncInterval = 10;
+    DS_AppData.FileStatus[FileIndex].SyncAge                = 20;
+
+    /* Execute the function being tested */
+    DS_FileTestSync(FileIndex);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(DS_FsExtSync, 0);
+}
+
+void DS_FileTestSync_Test_OnClose(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].SyncPolicy = DS_SYNC_ON_CLOSE;
+    DS_AppData.FileStatus[FileIndex].SyncBytes            = 1024;
+    DS_AppData.FileStatus[FileIndex].SyncAge              = 1024;
+
+    /* Execute the function being tested */
+    DS_FileTestSync(FileIndex);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(DS_FsExtSync, 0);
+}
+
+void DS_FileTestSync_Test_FlushError(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].SyncPolicy   = DS_SYNC_BY_BYTES;
+    DS_AppData.DestFileTblPtr->File[FileIndex].SyncInterval = 16;
+    DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0]  = '\0';
+    DS_AppData.FileStatus[FileIndex].SyncBytes              = 32;
+    DS_AppData.FileStatus[FileIndex].BufferedBytes          = 32;
+
+    /* Set buffer flush to fail */
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), -1);
+
+    /* Execute the function being tested */
+    DS_FileTestSync(FileIndex);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(DS_FsExtSync, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_WRITE_FILE_ERR_EID);
+}
+
+void DS_FileSync_Test_Nominal(void)
+{
+    DS_AppData.MaxSyncTime = 50;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileSync("directory1/filename"), OS_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.SyncCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.SyncErrCounter, 0);
+    UtAssert_UINT32_EQ(DS_AppData.LastSyncTime, 0);
+    UtAssert_UINT32_EQ(DS_AppData.MaxSyncTime, 50);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileSync_Test_Error(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(DS_FsExtSync), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileSync("directory1/filename"), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.SyncCounter, 0);
+    UtAssert_UINT32_EQ(DS_AppData.SyncErrCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FILE_SYNC_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+#if (DS_MOVE_FILES == true)
+void DS_FileCloseDest_Test_PlatformConfigMoveFiles_Nominal(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    strncpy(DS_AppData.FileStatus[FileIndex].FileName, "directory1/filename",
+            sizeof(DS_AppData.FileStatus[FileIndex].FileName));
+    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "directory2/movename/",
+            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
+
+    /* Execute the function being tested */
+    DS_FileCloseDest(FileIndex);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileName[0], 0);
+    UtAssert_STUB_COUNT(DS_FinalizeEnqueue, 1);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(OS_mv, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+#endif
+
+#if (DS_MOVE_FILES == true)
+void DS_FileCloseDest_Test_PlatformConfigMoveFiles_FilenameTooLarge(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    strncpy(DS_AppData.FileStatus[FileIndex].FileName, "directory1/filenamefilenamefilenamefilenamefilenamefilename",
+            sizeof(DS_AppData.FileStatus[FileIndex].FileName));
+    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "directory2/movename/",
+            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
+
+    /* Execute the function being tested */
+    DS_FileCloseDest(FileIndex);
+
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileName[0], 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_MOVE_FILE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+#endif
+
+#if (DS_MOVE_FILES == true)
+void DS_FileCloseDest_Test_PlatformConfigMoveFiles_FilenameNull(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "directory2/movename",
+            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCloseDest(FileIndex));
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileName[0], 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_MOVE_FILE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+#endif
+
+#if (DS_MOVE_FILES == false)
+void DS_FileCloseDest_Test_MoveFilesFalse(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    /* Execute the function being tested */
+    DS_FileCloseDest(FileIndex);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileHandle, OS_OBJECT_ID_UNDEFINED);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileName[0], 0);
+    UtAssert_STUB_COUNT(DS_FinalizeEnqueue, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+#endif
+
+void DS_FileFinalize_Test_Nominal(void)
+{
+    DS_FinalizeEntry_t Entry;
+
+    memset(&Entry, 0, sizeof(Entry));
+
+    /* Set up the handle */
+    OS_OpenCreate(&Entry.FileHandle, NULL, 0, 0);
+
+    strncpy(Entry.FileName, "directory1/filename", sizeof(Entry.FileName));
+
+    /* Execute the function being tested */
+    DS_FileFinalize(&Entry);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(Entry.FileHandle));
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(OS_mv, 0);
+    UtAssert_STUB_COUNT(DS_FsExtTruncate, 0);
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileFinalize_Test_Recovered(void)
+{
+    DS_FinalizeEntry_t Entry;
+
+    memset(&Entry, 0, sizeof(Entry));
+
+    strncpy(Entry.FileName, "directory1/filename", sizeof(Entry.FileName));
+
+    /* Execute the function being tested */
+    DS_FileFinalize(&Entry);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(Entry.FileHandle));
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(DS_FsExtWriteAt, DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE);
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileFinalize_Test_Truncate(void)
+{
+    DS_FinalizeEntry_t Entry;
+
+    memset(&Entry, 0, sizeof(Entry));
+
+    /* Set up the handle */
+    OS_OpenCreate(&Entry.FileHandle, NULL, 0, 0);
+
+    strncpy(Entry.FileName, "directory1/filename", sizeof(Entry.FileName));
+    Entry.Truncate          = true;
+    Entry.FileInfo.FileSize = 100;
+
+    /* Execute the function being tested */
+    DS_FileFinalize(&Entry);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(DS_FsExtTruncate, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileFinalize_Test_TruncateError(void)
+{
+    DS_FinalizeEntry_t Entry;
+
+    memset(&Entry, 0, sizeof(Entry));
+
+    /* Set up the handle */
+    OS_OpenCreate(&Entry.FileHandle, NULL, 0, 0);
+
+    strncpy(Entry.FileName, "directory1/filename", sizeof(Entry.FileName));
+    Entry.Truncate          = true;
+    Entry.FileInfo.FileSize = 100;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_FsExtTruncate), OS_ERROR);
+
+    /* Execute the function being tested */
+    DS_FileFinalize(&Entry);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FILE_PREALLOC_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_FileFinalize_Test_Sync(void)
+{
+    DS_FinalizeEntry_t Entry;
+
+    memset(&Entry, 0, sizeof(Entry));
+
+    /* Set up the handle */
+    OS_OpenCreate(&Entry.FileHandle, NULL, 0, 0);
+
+    strncpy(Entry.FileName, "directory1/filename", sizeof(Entry.FileName));
+    Entry.Sync = true;
+
+    /* Execute the function being tested */
+    DS_FileFinalize(&Entry);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(DS_FsExtSync, 1);
+    UtAssert_UINT32_EQ(DS_AppData.SyncCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+#if (DS_MOVE_FILES == true)
+void DS_FileFinalize_Test_PlatformConfigMoveFiles_Nominal(void)
+{
+    DS_FinalizeEntry_t Entry;
+
+    memset(&Entry, 0, sizeof(Entry));
+
+    /* Set up the handle */
+    OS_OpenCreate(&Entry.FileHandle, NULL, 0, 0);
+
+    strncpy(Entry.FileName, "directory1/filename", sizeof(Entry.FileName));
+    strncpy(Entry.MoveName, "directory2/movename/filename", sizeof(Entry.MoveName));
+
+    /* Execute the function being tested */
+    DS_FileFinalize(&Entry);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(OS_mv, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+#endif
+
+#if (DS_MOVE_FILES == true)
+void DS_FileFinalize_Test_PlatformConfigMoveFiles_MoveError(void)
+{
+    DS_FinalizeEntry_t Entry;
+
+    memset(&Entry, 0, sizeof(Entry));
+
+    /* Set up the handle */
+    OS_OpenCreate(&Entry.FileHandle, NULL, 0, 0);
+
+    strncpy(Entry.FileName, "directory1/filename", sizeof(Entry.FileName));
+    strncpy(Entry.MoveName, "directory2/movename/filename", sizeof(Entry.MoveName));
+
+    /* Set to generate error message DS_MOVE_FILE_ERR_EID */
+    UT_SetDefaultReturnValue(UT_KEY(OS_mv), -1);
+
+    /* Execute the function being tested */
+    DS_FileFinalize(&Entry);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_MOVE_FILE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+#endif
+
+void DS_FileTestAge_Test_Nominal(void)
+{
+    int32  FileIndex      = 0;
+    uint32 ElapsedSeconds = 2;
+    uint32 i;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    for (i = 0; i < DS_DEST_FILE_CNT; i++)
+    {
+        strncpy(DS_AppData.FileStatus[i].FileName, "directory1/filename", sizeof(DS_AppData.FileStatus[i].FileName));
+    }
+
+    DS_AppData.FileStatus[FileIndex].FileAge              = 0;
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileAge = 3;
+
+    /* Execute the function being tested */
+    DS_FileTestAge(ElapsedSeconds);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileTestAge_Test_NullTable(void)
+{
+    uint32 ElapsedSeconds     = 2;
+    DS_AppData.DestFileTblPtr = NULL;
+
+    /* Execute the function being tested */
+    DS_FileTestAge(ElapsedSeconds);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileTestAge_Test_ExceedMaxAge(void)
+{
+    int32  FileIndex      = 0;
+    uint32 ElapsedSeconds = 2;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileAge = 1;
+
+    /* Execute the function being tested */
+    DS_FileTestAge(ElapsedSeconds);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileTestAge_Test_Sync(void)
+{
+    int32  FileIndex      = 0;
+    uint32 ElapsedSeconds = 2;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileAge   = 100;
+    DS_AppData.DestFileTblPtr->File[FileIndex].SyncPolicy   = DS_SYNC_BY_TIME;
+    DS_AppData.DestFileTblPtr->File[FileIndex].SyncInterval = 5;
+    DS_AppData.FileStatus[FileIndex].SyncBytes              = 10;
+    DS_AppData.FileStatus[FileIndex].SyncAge                = 3;
+
+    /* Execute the function being tested */
+    DS_FileTestAge(ElapsedSeconds);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 2);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].SyncAge, 0);
+    UtAssert_STUB_COUNT(DS_FsExtSync, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileTestAge_Test_Superframe(void)
+{
+    int32  FileIndex      = 0;
+    uint32 ElapsedSeconds = 2;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileAge    = 100;
+    DS_AppData.DestFileTblPtr->File[FileIndex].BufferSize    = DS_WRITE_BUFFER_MAX_SIZE;
+    DS_AppData.DestFileTblPtr->File[FileIndex].SuperframeAge = 5;
+    DS_AppData.FileStatus[FileIndex].SuperframeSize          = DS_SUPERFRAME_MIN_SIZE;
+    DS_AppData.FileStatus[FileIndex].SuperframeCount         = 1;
+    DS_AppData.FileStatus[FileIndex].SuperframeUsed          = 22;
+    DS_AppData.FileStatus[FileIndex].SuperframeAge           = 3;
+
+    /* Execute the function being tested */
+    DS_FileTestAge(ElapsedSeconds);
 
-    /* Verify results */
-    UtAssert_UINT32_EQ(DS_AppData.FileUpdateErrCounter, 1);
+    /* Verify results - partial superframe has waited long enough */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].SuperframeCount, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].BufferedBytes, DS_SUPERFRAME_MIN_SIZE);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
-#endif
 
-#if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
-void DS_FileUpdateHeader_Test_PlatformConfigCFE_SeekError(void)
+void DS_FileOpenSpare_Test_Nominal(void)
 {
-    int32 FileIndex = 0;
+    uint32 FileIndex = 0;
 
-    /* Set to fail condition "if (Result == sizeof(CFE_FS_Header_t))" */
-    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), -1);
+    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
+    DS_AppData.FileStatus[FileIndex].FileCount              = 1;
+    strncpy(DS_AppData.FileStatus[FileIndex].FileName, "filename", sizeof(DS_AppData.FileStatus[FileIndex].FileName));
 
     /* Execute the function being tested */
-    DS_FileUpdateHeader(FileIndex);
+    DS_FileOpenSpare(FileIndex);
 
     /* Verify results */
-    UtAssert_UINT32_EQ(DS_AppData.FileUpdateErrCounter, 1);
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].SpareHandle));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].SpareSize, DS_AppData.FileStatus[FileIndex].FileGrowth);
+    UtAssert_True(DS_AppData.FileStatus[FileIndex].SpareName[0] != 0, "SpareName set");
+
+    /* the sequence count is only used up when the file is put in service */
+    UtAssert_INT32_EQ(DS_AppData.FileStatus[FileIndex].FileCount, 1);
+
+    /* name is saved so an unused file is removed after a processor reset */
+    UtAssert_STUB_COUNT(DS_FinalizeUpdateSpareCDS, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
-#endif
 
-#if (DS_MOVE_FILES == true)
-void DS_FileCloseDest_Test_PlatformConfigMoveFiles_Nominal(void)
+void DS_FileOpenSpare_Test_SameName(void)
 {
-    int32 FileIndex = 0;
-
-    /* Set up the handle */
-    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    uint32 FileIndex = 0;
 
-    strncpy(DS_AppData.FileStatus[FileIndex].FileName, "directory1/filename",
-            sizeof(DS_AppData.FileStatus[FileIndex].FileName));
-    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "directory2/movename/",
-            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
+    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
+    DS_AppData.FileStatus[FileIndex].FileCount              = 1;
+    DS_FileCreateName(FileIndex, DS_AppData.FileStatus[FileIndex].FileName);
 
     /* Execute the function being tested */
-    DS_FileCloseDest(FileIndex);
+    DS_FileOpenSpare(FileIndex);
 
     /* Verify results */
-    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 0);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 0);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileName[0], 0);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].SpareHandle));
+    UtAssert_True(DS_AppData.FileStatus[FileIndex].SpareName[0] == 0, "SpareName cleared");
+    UtAssert_STUB_COUNT(DS_FinalizeUpdateSpareCDS, 0);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
-#endif
 
-#if (DS_MOVE_FILES == true)
-void DS_FileCloseDest_Test_PlatformConfigMoveFiles_MoveError(void)
+void DS_FileOpenSpare_Test_CreateError(void)
 {
-    int32 FileIndex = 0;
-
-    /* Set up the handle */
-    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    uint32 FileIndex = 0;
 
-    strncpy(DS_AppData.FileStatus[FileIndex].FileName, "directory1/filename",
-            sizeof(DS_AppData.FileStatus[FileIndex].FileName));
-    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "directory2/movename/",
-            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
+    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
+    DS_AppData.FileStatus[FileIndex].FileState = DS_ENABLED;
 
-    /* Set to generate error message DS_MOVE_FILE_ERR_EID */
-    UT_SetDefaultReturnValue(UT_KEY(OS_mv), -1);
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), -1);
 
     /* Execute the function being tested */
-    DS_FileCloseDest(FileIndex);
+    DS_FileOpenSpare(FileIndex);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].SpareHandle));
+    UtAssert_True(DS_AppData.FileStatus[FileIndex].SpareName[0] == 0, "SpareName cleared");
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteErrCounter, 1);
+
+    /* saved name is cleared again */
+    UtAssert_STUB_COUNT(DS_FinalizeUpdateSpareCDS, 2);
+
+    /* the current file keeps going, creation is retried at rotation time */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileState, DS_ENABLED);
 
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 0);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 0);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileName[0], 0);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_MOVE_FILE_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_CREATE_FILE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
-#endif
 
-#if (DS_MOVE_FILES == true)
-void DS_FileCloseDest_Test_PlatformConfigMoveFiles_FilenameTooLarge(void)
+#if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
+void DS_FileOpenSpare_Test_HeaderError(void)
 {
-    int32 FileIndex = 0;
+    uint32 FileIndex = 0;
 
-    /* Set up the handle */
-    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
 
-    strncpy(DS_AppData.FileStatus[FileIndex].FileName, "directory1/filenamefilenamefilenamefilenamefilenamefilename",
-            sizeof(DS_AppData.FileStatus[FileIndex].FileName));
-    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "directory2/movename/",
-            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), -1);
 
     /* Execute the function being tested */
-    DS_FileCloseDest(FileIndex);
+    DS_FileOpenSpare(FileIndex);
 
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 0);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 0);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileName[0], 0);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_MOVE_FILE_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    /* Verify results */
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].SpareHandle));
+    UtAssert_True(DS_AppData.FileStatus[FileIndex].SpareName[0] == 0, "SpareName cleared");
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteErrCounter, 1);
+
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_WRITE_FILE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 #endif
 
-#if (DS_MOVE_FILES == true)
-void DS_FileCloseDest_Test_PlatformConfigMoveFiles_FilenameNull(void)
+void DS_FileCloseSpare_Test_Nominal(void)
 {
-    int32 FileIndex = 0;
+    uint32 FileIndex = 0;
 
-    /* Set up the handle */
-    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    DS_AppData.FileStatus[FileIndex].SpareHandle = DS_UT_OBJID_1;
+    DS_AppData.FileStatus[FileIndex].SpareSize   = 100;
+    strncpy(DS_AppData.FileStatus[FileIndex].SpareName, "sparename",
+            sizeof(DS_AppData.FileStatus[FileIndex].SpareName));
 
-    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "directory2/movename",
-            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
+    /* Execute the function being tested */
+    DS_FileCloseSpare(FileIndex);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].SpareHandle));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].SpareSize, 0);
+    UtAssert_True(DS_AppData.FileStatus[FileIndex].SpareName[0] == 0, "SpareName cleared");
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(DS_FinalizeUpdateSpareCDS, 1);
+}
 
+void DS_FileCloseSpare_Test_NoSpare(void)
+{
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_FileCloseDest(FileIndex));
+    DS_FileCloseSpare(0);
 
     /* Verify results */
-    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 0);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 0);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileName[0], 0);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_MOVE_FILE_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(DS_FinalizeUpdateSpareCDS, 0);
 }
-#endif
 
-#if (DS_MOVE_FILES == false)
-void DS_FileCloseDest_Test_MoveFilesFalse(void)
+void DS_FileTestPreopen_Test_Nominal(void)
 {
-    int32 FileIndex = 0;
+    uint32 i;
 
-    /* Set up the handle */
-    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    for (i = 0; i < DS_DEST_FILE_CNT; i++)
+    {
+        UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[i]);
+        DS_AppData.DestFileTblPtr->File[i].MaxFileSize = 1000;
+        DS_AppData.DestFileTblPtr->File[i].MaxFileAge  = 1000;
+    }
+
+    /* File 0 is nearly full, file 1 is nearly too old, file 2 is neither */
+    DS_AppData.FileStatus[0].FileHandle = DS_UT_OBJID_1;
+    DS_AppData.FileStatus[0].FileState  = DS_ENABLED;
+    DS_AppData.FileStatus[0].FileSize   = 10 * DS_FILE_PREOPEN_PERCENT;
+
+    DS_AppData.FileStatus[1].FileHandle = DS_UT_OBJID_1;
+    DS_AppData.FileStatus[1].FileState  = DS_ENABLED;
+    DS_AppData.FileStatus[1].FileAge    = 10 * DS_FILE_PREOPEN_PERCENT;
+
+    DS_AppData.FileStatus[2].FileHandle = DS_UT_OBJID_1;
+    DS_AppData.FileStatus[2].FileState  = DS_ENABLED;
+    DS_AppData.FileStatus[2].FileSize   = 10;
+    DS_AppData.FileStatus[2].FileAge    = 10;
 
     /* Execute the function being tested */
-    DS_FileCloseDest(FileIndex);
+    DS_FileTestPreopen();
 
     /* Verify results */
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileHandle, OS_OBJECT_ID_UNDEFINED);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 0);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 0);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileName[0], 0);
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(DS_AppData.FileStatus[0].SpareHandle));
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(DS_AppData.FileStatus[1].SpareHandle));
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[2].SpareHandle));
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
-#endif
 
-void DS_FileTestAge_Test_Nominal(void)
+void DS_FileTestPreopen_Test_NotEligible(void)
 {
-    int32  FileIndex      = 0;
-    uint32 ElapsedSeconds = 2;
     uint32 i;
 
-    /* Set up the handle */
-    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
-
     for (i = 0; i < DS_DEST_FILE_CNT; i++)
     {
-        strncpy(DS_AppData.FileStatus[i].FileName, "directory1/filename", sizeof(DS_AppData.FileStatus[i].FileName));
+        UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[i]);
+        DS_AppData.DestFileTblPtr->File[i].MaxFileSize = 1000;
+        DS_AppData.DestFileTblPtr->File[i].MaxFileAge  = 1000;
+        DS_AppData.FileStatus[i].FileSize              = 1000;
     }
 
-    DS_AppData.FileStatus[FileIndex].FileAge              = 0;
-    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileAge = 3;
+    /* File 0 is closed, file 1 is disabled, file 2 already has a next file */
+    DS_AppData.FileStatus[0].FileState = DS_ENABLED;
+
+    DS_AppData.FileStatus[1].FileHandle = DS_UT_OBJID_1;
+    DS_AppData.FileStatus[1].FileState  = DS_DISABLED;
+
+    DS_AppData.FileStatus[2].FileHandle  = DS_UT_OBJID_1;
+    DS_AppData.FileStatus[2].SpareHandle = DS_UT_OBJID_1;
+    DS_AppData.FileStatus[2].FileState   = DS_ENABLED;
 
     /* Execute the function being tested */
-    DS_FileTestAge(ElapsedSeconds);
+    DS_FileTestPreopen();
 
     /* Verify results */
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 2);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
 }
 
-void DS_FileTestAge_Test_NullTable(void)
+void DS_FileTestPreopen_Test_NullTable(void)
 {
-    uint32 ElapsedSeconds     = 2;
     DS_AppData.DestFileTblPtr = NULL;
 
     /* Execute the function being tested */
-    DS_FileTestAge(ElapsedSeconds);
+    DS_FileTestPreopen();
 
     /* Verify results */
-    UtAssert_STUB_COUNT(OS_close, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
 }
 
-void DS_FileTestAge_Test_ExceedMaxAge(void)
+void DS_FileRotationDone_Test(void)
 {
-    int32  FileIndex      = 0;
-    uint32 ElapsedSeconds = 2;
-
-    /* Set up the handle */
-    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    CFE_TIME_SysTime_t StartTime = {0, 0};
 
-    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileAge = 1;
+    DS_AppData.MaxRotationTime = 50;
 
     /* Execute the function being tested */
-    DS_FileTestAge(ElapsedSeconds);
+    DS_FileRotationDone(StartTime);
 
     /* Verify results */
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_UINT32_EQ(DS_AppData.RotationCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.LastRotationTime, 0);
+    UtAssert_UINT32_EQ(DS_AppData.MaxRotationTime, 50);
+}
+
+void DS_FileElapsedTime_Test(void)
+{
+    CFE_TIME_SysTime_t StartTime = {0, 0};
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(DS_FileElapsedTime(StartTime), 0);
 }
 
 void DS_IsPacketFiltered_Test_AlgX0(void)
@@ -1263,15 +3678,20 @@ void DS_FileTransmit_Test_Nominal(void)
 {
     DS_FileCompletePktBuf_t  PktBuf;
     DS_FileCompletePktBuf_t *PktBufPtr = &PktBuf;
+    DS_FileInfo_t            FileInfo;
+
+    memset(&FileInfo, 0, sizeof(FileInfo));
+    FileInfo.FileSize = 100;
 
     /* setup for a call to CFE_SB_AllocateMessageBuffer() */
     memset(PktBufPtr, 0, sizeof(*PktBufPtr));
     UT_SetDataBuffer(UT_KEY(CFE_SB_AllocateMessageBuffer), &PktBufPtr, sizeof(PktBufPtr), true);
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_FileTransmit(&DS_AppData.FileStatus[0]));
+    UtAssert_VOIDCALL(DS_FileTransmit(&FileInfo));
 
     /* Verify results */
+    UtAssert_UINT32_EQ(PktBuf.Pkt.FileInfo.FileSize, 100);
     UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 1);
     UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
     UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 1);
@@ -1280,8 +3700,12 @@ void DS_FileTransmit_Test_Nominal(void)
 
 void DS_FileTransmit_Test_NoBuf(void)
 {
+    DS_FileInfo_t FileInfo;
+
+    memset(&FileInfo, 0, sizeof(FileInfo));
+
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_FileTransmit(&DS_AppData.FileStatus[0]));
+    UtAssert_VOIDCALL(DS_FileTransmit(&FileInfo));
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 1);
@@ -1290,20 +3714,303 @@ void DS_FileTransmit_Test_NoBuf(void)
     UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 0);
 }
 
+void DS_IsRouteFiltered_Test_MatchesModulo(void)
+{
+    DS_RouteFilter_t RouteFilter;
+    uint16           GroupSize[] = {1, 2, 3, 7, 10, 255, 1000, 4097, 65521, 65535};
+    uint32           Mismatches  = 0;
+    uint32           i;
+    uint32           Value;
+    bool             Expected;
+
+    memset(&RouteFilter, 0, sizeof(RouteFilter));
+
+    for (i = 0; i < sizeof(GroupSize) / sizeof(GroupSize[0]); i++)
+    {
+        RouteFilter.Algorithm_X = GroupSize[i];
+        RouteFilter.Algorithm_N = (GroupSize[i] + 1) / 2;
+        RouteFilter.Algorithm_O = GroupSize[i] / 3;
+        RouteFilter.Reciprocal  = DS_ROUTE_RECIPROCAL(GroupSize[i]);
+
+        for (Value = 0; Value <= 0xFFFF; Value++)
+        {
+            Expected = (Value < RouteFilter.Algorithm_O) ||
+                       (((Value - RouteFilter.Algorithm_O) % RouteFilter.Algorithm_X) >= RouteFilter.Algorithm_N);
+
+            if (DS_IsRouteFiltered(&RouteFilter, (uint16)Value) != Expected)
+            {
+                Mismatches++;
+            }
+        }
+    }
+
+    /* Verify results - division-free result must match the modulo result for every value */
+    UtAssert_UINT32_EQ(Mismatches, 0);
+}
+
+void DS_IsPredicateFiltered_Test_Match(void)
+{
+    DS_RoutePlan_t RoutePlan;
+    union
+    {
+        CFE_SB_Buffer_t Buf;
+        uint8           Bytes[16];
+    } Packet;
+
+    memset(&RoutePlan, 0, sizeof(RoutePlan));
+    memset(Packet.Bytes, 0, sizeof(Packet.Bytes));
+
+    /* Mode byte 12 must equal 3 and status bit 0x80 of byte 13 must be clear */
+    RoutePlan.MinLength           = sizeof(Packet.Bytes);
+    RoutePlan.PredicateCount      = 2;
+    RoutePlan.Predicate[0].Offset = 12;
+    RoutePlan.Predicate[0].Mask   = 0xFF;
+    RoutePlan.Predicate[0].Value  = 3;
+    RoutePlan.Predicate[0].Expect = true;
+    RoutePlan.Predicate[1].Offset = 13;
+    RoutePlan.Predicate[1].Mask   = 0x80;
+    RoutePlan.Predicate[1].Value  = 0x80;
+    RoutePlan.Predicate[1].Expect = false;
+
+    Packet.Bytes[12] = 3;
+    Packet.Bytes[13] = 0x7F;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_IsPredicateFiltered(&RoutePlan, &Packet.Buf, sizeof(Packet.Bytes)));
+
+    Packet.Bytes[13] = 0x80;
+    UtAssert_BOOL_TRUE(DS_IsPredicateFiltered(&RoutePlan, &Packet.Buf, sizeof(Packet.Bytes)));
+
+    Packet.Bytes[12] = 4;
+    Packet.Bytes[13] = 0;
+    UtAssert_BOOL_TRUE(DS_IsPredicateFiltered(&RoutePlan, &Packet.Buf, sizeof(Packet.Bytes)));
+}
+
+void DS_IsPredicateFiltered_Test_TooShort(void)
+{
+    DS_RoutePlan_t RoutePlan;
+    union
+    {
+        CFE_SB_Buffer_t Buf;
+        uint8           Bytes[16];
+    } Packet;
+
+    memset(&RoutePlan, 0, sizeof(RoutePlan));
+    memset(Packet.Bytes, 0, sizeof(Packet.Bytes));
+
+    RoutePlan.MinLength = sizeof(Packet.Bytes);
+
+    /* Execute the function being tested - packet shorter than MinLength never matches */
+    UtAssert_BOOL_TRUE(DS_IsPredicateFiltered(&RoutePlan, &Packet.Buf, sizeof(Packet.Bytes) - 1));
+}
+
+void DS_FilterPacketFingerprint_Test_IgnoresHeader(void)
+{
+    CFE_MSG_Type_t forced_Type = CFE_MSG_Type_Tlm;
+    size_t         forced_Size;
+    uint64         Original;
+    uint64         NewHeader;
+    uint64         NewPayload;
+    union
+    {
+        CFE_SB_Buffer_t Buf;
+        uint8           Bytes[64];
+    } Packet;
+
+    forced_Size = sizeof(Packet.Bytes);
+    memset(Packet.Bytes, 0x5A, sizeof(Packet.Bytes));
+
+    /* Execute the function being tested */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &forced_Type, sizeof(forced_Type), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+    Original = DS_FilterPacketFingerprint(&Packet.Buf);
+
+    Packet.Bytes[sizeof(CFE_MSG_TelemetryHeader_t) - 1]++;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &forced_Type, sizeof(forced_Type), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+    NewHeader = DS_FilterPacketFingerprint(&Packet.Buf);
+
+    Packet.Bytes[sizeof(CFE_MSG_TelemetryHeader_t)]++;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &forced_Type, sizeof(forced_Type), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+    NewPayload = DS_FilterPacketFingerprint(&Packet.Buf);
+
+    /* Verify results - header changes are ignored, payload changes are not */
+    UtAssert_True(Original == NewHeader, "Original == NewHeader");
+    UtAssert_True(Original != NewPayload, "Original != NewPayload");
+}
+
+void DS_IsContentFiltered_Test_KeepAlive(void)
+{
+    DS_RouteFilter_t RouteFilter;
+
+    memset(&RouteFilter, 0, sizeof(RouteFilter));
+    RouteFilter.Algorithm_N = 1;
+    RouteFilter.Algorithm_X = 3;
+
+    /* Execute the function being tested - one repeat in every 3 is kept */
+    UtAssert_BOOL_FALSE(DS_IsContentFiltered(&RouteFilter, 0x1234));
+    UtAssert_BOOL_TRUE(DS_IsContentFiltered(&RouteFilter, 0x1234));
+    UtAssert_BOOL_TRUE(DS_IsContentFiltered(&RouteFilter, 0x1234));
+    UtAssert_BOOL_FALSE(DS_IsContentFiltered(&RouteFilter, 0x1234));
+    UtAssert_BOOL_TRUE(DS_IsContentFiltered(&RouteFilter, 0x1234));
+
+    /* Verify results - a new payload is stored at once */
+    UtAssert_BOOL_FALSE(DS_IsContentFiltered(&RouteFilter, 0x5678));
+    UtAssert_True(RouteFilter.Fingerprint == 0x5678, "RouteFilter.Fingerprint == 0x5678");
+    UtAssert_UINT32_EQ(RouteFilter.Repeats, 0);
+}
+
+void DS_IsRateFiltered_Test_Packets(void)
+{
+    DS_RouteFilter_t   RouteFilter;
+    CFE_TIME_SysTime_t PacketTime = {100, 0};
+
+    memset(&RouteFilter, 0, sizeof(RouteFilter));
+    RouteFilter.FilterType  = DS_BY_PKT_RATE;
+    RouteFilter.Algorithm_N = 2;
+    RouteFilter.Algorithm_X = 4;
+
+    /* Execute the function being tested - bucket starts full (burst of 4) */
+    UtAssert_BOOL_FALSE(DS_IsRateFiltered(&RouteFilter, PacketTime, 0));
+    UtAssert_BOOL_FALSE(DS_IsRateFiltered(&RouteFilter, PacketTime, 0));
+    UtAssert_BOOL_FALSE(DS_IsRateFiltered(&RouteFilter, PacketTime, 0));
+    UtAssert_BOOL_FALSE(DS_IsRateFiltered(&RouteFilter, PacketTime, 0));
+    UtAssert_BOOL_TRUE(DS_IsRateFiltered(&RouteFilter, PacketTime, 0));
+
+    /* Half a second at 2 per second refills one packet */
+    PacketTime.Subseconds = 0x80000000;
+    UtAssert_BOOL_FALSE(DS_IsRateFiltered(&RouteFilter, PacketTime, 0));
+    UtAssert_BOOL_TRUE(DS_IsRateFiltered(&RouteFilter, PacketTime, 0));
+
+    /* A long gap refills the whole burst and no more */
+    PacketTime.Seconds = 200;
+    UtAssert_BOOL_FALSE(DS_IsRateFiltered(&RouteFilter, PacketTime, 0));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(RouteFilter.Tokens, 3 << DS_RATE_TOKEN_SHIFT);
+}
+
+void DS_IsRateFiltered_Test_Bytes(void)
+{
+    DS_RouteFilter_t   RouteFilter;
+    CFE_TIME_SysTime_t PacketTime = {100, 0};
+
+    memset(&RouteFilter, 0, sizeof(RouteFilter));
+    RouteFilter.FilterType  = DS_BY_BYTE_RATE;
+    RouteFilter.Algorithm_N = 100;
+    RouteFilter.Algorithm_X = 200;
+
+    /* Execute the function being tested - 200 byte burst holds three 64 byte packets */
+    UtAssert_BOOL_FALSE(DS_IsRateFiltered(&RouteFilter, PacketTime, 64));
+    UtAssert_BOOL_FALSE(DS_IsRateFiltered(&RouteFilter, PacketTime, 64));
+    UtAssert_BOOL_FALSE(DS_IsRateFiltered(&RouteFilter, PacketTime, 64));
+    UtAssert_BOOL_TRUE(DS_IsRateFiltered(&RouteFilter, PacketTime, 64));
+
+    /* One second adds 100 bytes to the 8 left over */
+    PacketTime.Seconds++;
+    UtAssert_BOOL_FALSE(DS_IsRateFiltered(&RouteFilter, PacketTime, 64));
+    UtAssert_BOOL_TRUE(DS_IsRateFiltered(&RouteFilter, PacketTime, 64));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(RouteFilter.Tokens, 44 << DS_RATE_TOKEN_SHIFT);
+}
+
+void DS_IsRateFiltered_Test_BytesScaled(void)
+{
+    DS_RouteFilter_t   RouteFilter;
+    CFE_TIME_SysTime_t PacketTime = {100, 0};
+
+    memset(&RouteFilter, 0, sizeof(RouteFilter));
+    RouteFilter.FilterType  = DS_BY_BYTE_RATE;
+    RouteFilter.Algorithm_N = 1000;
+    RouteFilter.Algorithm_X = 2000;
+    RouteFilter.Algorithm_O = 10;
+
+    /* Execute the function being tested - 2000 KiB burst holds two 1000 KiB packets */
+    UtAssert_BOOL_FALSE(DS_IsRateFiltered(&RouteFilter, PacketTime, 1000 * 1024));
+    UtAssert_BOOL_FALSE(DS_IsRateFiltered(&RouteFilter, PacketTime, 1000 * 1024));
+    UtAssert_BOOL_TRUE(DS_IsRateFiltered(&RouteFilter, PacketTime, 1));
+
+    /* Half a second at 1000 KiB per second refills 500 KiB */
+    PacketTime.Subseconds = 0x80000000;
+    UtAssert_BOOL_TRUE(DS_IsRateFiltered(&RouteFilter, PacketTime, 1000 * 1024));
+
+    /* Verify results */
+    UtAssert_True(RouteFilter.Tokens == ((uint64)500 * 1024) << DS_RATE_TOKEN_SHIFT,
+                  "RouteFilter.Tokens == 500 KiB");
+}
+
+void DS_IsRateFiltered_Test_TimeBackwards(void)
+{
+    DS_RouteFilter_t   RouteFilter;
+    CFE_TIME_SysTime_t PacketTime = {100, 0};
+
+    memset(&RouteFilter, 0, sizeof(RouteFilter));
+    RouteFilter.FilterType  = DS_BY_PKT_RATE;
+    RouteFilter.Algorithm_N = 1;
+    RouteFilter.Algorithm_X = 1;
+
+    UtAssert_BOOL_FALSE(DS_IsRateFiltered(&RouteFilter, PacketTime, 0));
+
+    /* Execute the function being tested - earlier time refills nothing */
+    PacketTime.Seconds = 50;
+    UtAssert_BOOL_TRUE(DS_IsRateFiltered(&RouteFilter, PacketTime, 0));
+
+    /* Verify results - refill is measured from the new time */
+    UtAssert_UINT32_EQ(RouteFilter.RefillTime.Seconds, 50);
+    PacketTime.Seconds = 51;
+    UtAssert_BOOL_FALSE(DS_IsRateFiltered(&RouteFilter, PacketTime, 0));
+}
+
+void DS_IsContentFiltered_Test_NoRepeats(void)
+{
+    DS_RouteFilter_t RouteFilter;
+
+    memset(&RouteFilter, 0, sizeof(RouteFilter));
+    RouteFilter.Algorithm_N = 1;
+    RouteFilter.Algorithm_X = 1;
+
+    /* Execute the function being tested - a group of 1 keeps every packet */
+    UtAssert_BOOL_FALSE(DS_IsContentFiltered(&RouteFilter, 0x1234));
+    UtAssert_BOOL_FALSE(DS_IsContentFiltered(&RouteFilter, 0x1234));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(RouteFilter.Repeats, 0);
+}
+
 void UtTest_Setup(void)
 {
     UT_DS_TEST_ADD(DS_FileStorePacket_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileStorePacket_Test_Submit);
+    UT_DS_TEST_ADD(DS_FileStorePacket_Test_ContentDuplicate);
+    UT_DS_TEST_ADD(DS_FileStorePacket_Test_RateLimited);
+    UT_DS_TEST_ADD(DS_FileStorePacket_Test_Predicate);
+    UT_DS_TEST_ADD(DS_FileStorePacket_Test_MultipleDest);
     UT_DS_TEST_ADD(DS_FileStorePacket_Test_PacketNotInTable);
     UT_DS_TEST_ADD(DS_FileStorePacket_Test_PassedFilterFalse);
     UT_DS_TEST_ADD(DS_FileStorePacket_Test_DisabledDest);
-    UT_DS_TEST_ADD(DS_FileStorePacket_Test_InvalidIndex);
+    UT_DS_TEST_ADD(DS_FileStorePacket_Test_NoActiveFilters);
 
     UT_DS_TEST_ADD(DS_FileSetupWrite_Test_Nominal);
     UT_DS_TEST_ADD(DS_FileSetupWrite_Test_FileHandleClosed);
     UT_DS_TEST_ADD(DS_FileSetupWrite_Test_MaxFileSizeExceeded);
+    UT_DS_TEST_ADD(DS_FileSetupWrite_Test_DeltaRecordSize);
+    UT_DS_TEST_ADD(DS_FileSetupWrite_Test_Preopen);
 
     UT_DS_TEST_ADD(DS_FileWriteData_Test_Nominal);
     UT_DS_TEST_ADD(DS_FileWriteData_Test_Error);
+    UT_DS_TEST_ADD(DS_FileWriteData_Test_CompressedOversize);
+    UT_DS_TEST_ADD(DS_FileWriteData_Test_CompressedError);
+    UT_DS_TEST_ADD(DS_FileWriteData_Test_Buffered);
+    UT_DS_TEST_ADD(DS_FileWriteData_Test_BufferFull);
+    UT_DS_TEST_ADD(DS_FileWriteData_Test_BufferFlushError);
+    UT_DS_TEST_ADD(DS_FileWriteData_Test_SyncByBytes);
+    UT_DS_TEST_ADD(DS_FileWriteData_Test_SyncNotDue);
+    UT_DS_TEST_ADD(DS_FileWriteData_Test_Direct);
+    UT_DS_TEST_ADD(DS_FileWriteDirect_Test_LeadIn);
+    UT_DS_TEST_ADD(DS_FileWriteDirect_Test_Split);
+    UT_DS_TEST_ADD(DS_FileWriteDirect_Test_FlushError);
 
 #if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
     UT_DS_TEST_ADD(DS_FileWriteHeader_Test_PlatformConfigCFE_Nominal);
@@ -1324,6 +4031,16 @@ void UtTest_Setup(void)
     UT_DS_TEST_ADD(DS_FileCreateDest_Test_ClosedFileHandle);
 #endif
 
+    UT_DS_TEST_ADD(DS_FileCreateDest_Test_Preopened);
+    UT_DS_TEST_ADD(DS_FileCreateDest_Test_Preallocate);
+
+    UT_DS_TEST_ADD(DS_FilePreallocate_Test_Disabled);
+    UT_DS_TEST_ADD(DS_FilePreallocate_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FilePreallocate_Test_Error);
+    UT_DS_TEST_ADD(DS_FileOpenDirect_Test_Disabled);
+    UT_DS_TEST_ADD(DS_FileOpenDirect_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileOpenDirect_Test_Error);
+
     UT_DS_TEST_ADD(DS_FileCreateName_Test_Nominal);
     UT_DS_TEST_ADD(DS_FileCreateName_Test_NominalWithSeparator);
     UT_DS_TEST_ADD(DS_FileCreateName_Test_NominalWithPeriod);
@@ -1342,22 +4059,114 @@ void UtTest_Setup(void)
 #if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
     UT_DS_TEST_ADD(DS_FileUpdateHeader_Test_PlatformConfigCFE_Nominal);
     UT_DS_TEST_ADD(DS_FileUpdateHeader_Test_WriteError);
-    UT_DS_TEST_ADD(DS_FileUpdateHeader_Test_PlatformConfigCFE_SeekError);
+    UT_DS_TEST_ADD(DS_FileUpdateHeader_Test_OsalFallback);
+    UT_DS_TEST_ADD(DS_FileUpdateHeader_Test_OsalFallbackError);
 #endif
 
+    UT_DS_TEST_ADD(DS_FileFlushBuffer_Test_Empty);
+    UT_DS_TEST_ADD(DS_FileSummaryUpdate_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileSummaryUpdate_Test_NewMid);
+    UT_DS_TEST_ADD(DS_FileSummaryUpdate_Test_MidOverflow);
+    UT_DS_TEST_ADD(DS_FileSummaryUpdate_Test_FileClosed);
+    UT_DS_TEST_ADD(DS_FileBloomBit_Test);
+    UT_DS_TEST_ADD(DS_FileIndexUpdate_Test_Disabled);
+    UT_DS_TEST_ADD(DS_FileIndexUpdate_Test_ByBytes);
+    UT_DS_TEST_ADD(DS_FileIndexUpdate_Test_BySeconds);
+    UT_DS_TEST_ADD(DS_FileIndexUpdate_Test_Full);
+    UT_DS_TEST_ADD(DS_FileWriteIndex_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileWriteIndex_Test_Empty);
+    UT_DS_TEST_ADD(DS_FileWriteIndex_Test_WriteError);
+    UT_DS_TEST_ADD(DS_FileFlushBuffer_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileFlushBuffer_Test_Error);
+    UT_DS_TEST_ADD(DS_FileFlushBuffer_Test_Compressed);
+    UT_DS_TEST_ADD(DS_FileFlushBuffer_Test_CompressedError);
+    UT_DS_TEST_ADD(DS_FileWriteBlock_Test_Compressed);
+    UT_DS_TEST_ADD(DS_FileWriteBlock_Test_Stored);
+    UT_DS_TEST_ADD(DS_FileWriteBlock_Test_ShortWrite);
+    UT_DS_TEST_ADD(DS_FileWriteBlock_Test_StoredError);
+    UT_DS_TEST_ADD(DS_FileWritePacket_Test_Raw);
+    UT_DS_TEST_ADD(DS_FileWritePacket_Test_Superframe);
+    UT_DS_TEST_ADD(DS_FileWritePacket_Test_Delta);
+    UT_DS_TEST_ADD(DS_FileWritePacket_Test_Keyframe);
+    UT_DS_TEST_ADD(DS_FileWritePacket_Test_LengthChange);
+    UT_DS_TEST_ADD(DS_FileWritePacket_Test_Oversize);
+    UT_DS_TEST_ADD(DS_FileWritePacket_Test_Error);
+    UT_DS_TEST_ADD(DS_FileDeltaSlot_Test);
+    UT_DS_TEST_ADD(DS_FileDeltaEncode_Test_NotSmaller);
+    UT_DS_TEST_ADD(DS_FileDeltaDecode_Test_Invalid);
+    UT_DS_TEST_ADD(DS_FileSuperframeAdd_Test_NoRoom);
+    UT_DS_TEST_ADD(DS_FileSuperframeAdd_Test_Full);
+    UT_DS_TEST_ADD(DS_FileSuperframeAdd_Test_Oversize);
+    UT_DS_TEST_ADD(DS_FileSuperframeAdd_Test_Error);
+    UT_DS_TEST_ADD(DS_FileSuperframeFlush_Test_Empty);
+    UT_DS_TEST_ADD(DS_FileSuperframeGrowth_Test);
+    UT_DS_TEST_ADD(DS_FileFlushBuffer_Test_Direct);
+    UT_DS_TEST_ADD(DS_FileFlushDirect_Test_Partial);
+    UT_DS_TEST_ADD(DS_FileFlushDirect_Test_NoNewData);
+    UT_DS_TEST_ADD(DS_FileFlushDirect_Test_Error);
+    UT_DS_TEST_ADD(DS_FileTestSync_Test_ByTime);
+    UT_DS_TEST_ADD(DS_FileTestSync_Test_ByTimeNoData);
+    UT_DS_TEST_ADD(DS_FileTestSync_Test_OnClose);
+    UT_DS_TEST_ADD(DS_FileTestSync_Test_FlushError);
+    UT_DS_TEST_ADD(DS_FileSync_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileSync_Test_Error);
+
 #if (DS_MOVE_FILES == true)
     UT_DS_TEST_ADD(DS_FileCloseDest_Test_PlatformConfigMoveFiles_Nominal);
-    UT_DS_TEST_ADD(DS_FileCloseDest_Test_PlatformConfigMoveFiles_MoveError);
     UT_DS_TEST_ADD(DS_FileCloseDest_Test_PlatformConfigMoveFiles_FilenameTooLarge);
     UT_DS_TEST_ADD(DS_FileCloseDest_Test_PlatformConfigMoveFiles_FilenameNull);
 #else
     UT_DS_TEST_ADD(DS_FileCloseDest_Test_MoveFilesFalse);
 #endif
+    UT_DS_TEST_ADD(DS_FileCloseDest_Test_FlushError);
+    UT_DS_TEST_ADD(DS_FileCloseDest_Test_Direct);
+    UT_DS_TEST_ADD(DS_FileCloseDest_Test_Summary);
+#if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
+    UT_DS_TEST_ADD(DS_FileCloseDest_Test_DataBytes);
+    UT_DS_TEST_ADD(DS_FileCloseDest_Test_DataBytesIndex);
+#endif
+    UT_DS_TEST_ADD(DS_FileCloseDest_Test_Codec);
+    UT_DS_TEST_ADD(DS_FileCloseDest_Test_Delta);
+    UT_DS_TEST_ADD(DS_FileCloseDest_Test_Superframe);
+    UT_DS_TEST_ADD(DS_FileCloseDest_Test_QueueFull);
+    UT_DS_TEST_ADD(DS_FileCloseDest_Test_Pending);
+
+    UT_DS_TEST_ADD(DS_FileRetryFinalize_Test_None);
+    UT_DS_TEST_ADD(DS_FileRetryFinalize_Test_Queued);
+    UT_DS_TEST_ADD(DS_FileRetryFinalize_Test_QueueFull);
+
+    UT_DS_TEST_ADD(DS_FileFinalize_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileFinalize_Test_Recovered);
+    UT_DS_TEST_ADD(DS_FileFinalize_Test_Truncate);
+    UT_DS_TEST_ADD(DS_FileFinalize_Test_TruncateError);
+    UT_DS_TEST_ADD(DS_FileFinalize_Test_Sync);
+#if (DS_MOVE_FILES == true)
+    UT_DS_TEST_ADD(DS_FileFinalize_Test_PlatformConfigMoveFiles_Nominal);
+    UT_DS_TEST_ADD(DS_FileFinalize_Test_PlatformConfigMoveFiles_MoveError);
+#endif
 
     UT_DS_TEST_ADD(DS_FileTestAge_Test_Nominal);
     UT_DS_TEST_ADD(DS_FileTestAge_Test_ExceedMaxAge);
+    UT_DS_TEST_ADD(DS_FileTestAge_Test_Sync);
+    UT_DS_TEST_ADD(DS_FileTestAge_Test_Superframe);
     UT_DS_TEST_ADD(DS_FileTestAge_Test_NullTable);
 
+    UT_DS_TEST_ADD(DS_FileOpenSpare_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileOpenSpare_Test_SameName);
+    UT_DS_TEST_ADD(DS_FileOpenSpare_Test_CreateError);
+#if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
+    UT_DS_TEST_ADD(DS_FileOpenSpare_Test_HeaderError);
+#endif
+    UT_DS_TEST_ADD(DS_FileCloseSpare_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileCloseSpare_Test_NoSpare);
+
+    UT_DS_TEST_ADD(DS_FileTestPreopen_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileTestPreopen_Test_NotEligible);
+    UT_DS_TEST_ADD(DS_FileTestPreopen_Test_NullTable);
+
+    UT_DS_TEST_ADD(DS_FileRotationDone_Test);
+    UT_DS_TEST_ADD(DS_FileElapsedTime_Test);
+
     UT_DS_TEST_ADD(DS_IsPacketFiltered_Test_AlgX0);
     UT_DS_TEST_ADD(DS_IsPacketFiltered_Test_AlgN0);
     UT_DS_TEST_ADD(DS_IsPacketFiltered_Test_AlgNGreaterX);
@@ -1368,6 +4177,16 @@ void UtTest_Setup(void)
     UT_DS_TEST_ADD(DS_IsPacketFiltered_Test_TimeFilter1);
     UT_DS_TEST_ADD(DS_IsPacketFiltered_Test_TimeFilter2);
     UT_DS_TEST_ADD(DS_IsPacketFiltered_Test_TimeFilter3);
+    UT_DS_TEST_ADD(DS_IsRouteFiltered_Test_MatchesModulo);
+    UT_DS_TEST_ADD(DS_IsPredicateFiltered_Test_Match);
+    UT_DS_TEST_ADD(DS_IsPredicateFiltered_Test_TooShort);
+    UT_DS_TEST_ADD(DS_FilterPacketFingerprint_Test_IgnoresHeader);
+    UT_DS_TEST_ADD(DS_IsContentFiltered_Test_KeepAlive);
+    UT_DS_TEST_ADD(DS_IsContentFiltered_Test_NoRepeats);
+    UT_DS_TEST_ADD(DS_IsRateFiltered_Test_Packets);
+    UT_DS_TEST_ADD(DS_IsRateFiltered_Test_Bytes);
+    UT_DS_TEST_ADD(DS_IsRateFiltered_Test_BytesScaled);
+    UT_DS_TEST_ADD(DS_IsRateFiltered_Test_TimeBackwards);
 
     UT_DS_TEST_ADD(DS_FileTransmit_Test_Nominal);
     UT_DS_TEST_ADD(DS_FileTransmit_Test_NoBuf);
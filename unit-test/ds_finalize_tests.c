@@ -0,0 +1,591 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,917-1, and identified as “CFS Data Storage
+ * (DS) application version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   This file contains unit test cases for the functions contained in the file ds_finalize.c
+ */
+
+/*
+ * Includes
+ */
+
+#include "ds_app.h"
+#include "ds_appdefs.h"
+#include "ds_file.h"
+#include "ds_msg.h"
+#include "ds_events.h"
+#include "ds_test_utils.h"
+#include "ds_finalize.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+
+/*
+ * Helper Functions
+ */
+
+DS_FinalizeCDSState_t UT_DS_SavedState;
+DS_FinalizeEntry_t    UT_DS_SavedEntry[2];
+
+void UT_DS_FinalizeSetupEntry(DS_FinalizeEntry_t *Entry)
+{
+    memset(Entry, 0, sizeof(*Entry));
+
+    strncpy(Entry->FileName, "file1", sizeof(Entry->FileName));
+    Entry->QueueTime = 10;
+}
+
+/* Restores the saved queue state, then the saved entries in order */
+void UT_CFE_ES_RestoreFromCDS_CustomHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    void * RestoreToMemory = UT_Hook_GetArgValueByName(Context, "RestoreToMemory", void *);
+    uint32 CallCount       = UT_GetStubCount(FuncKey);
+    int32  Status          = CFE_SUCCESS;
+
+    if (CallCount == 1)
+    {
+        memcpy(RestoreToMemory, &UT_DS_SavedState, sizeof(UT_DS_SavedState));
+    }
+    else
+    {
+        memcpy(RestoreToMemory, &UT_DS_SavedEntry[CallCount - 2], sizeof(DS_FinalizeEntry_t));
+    }
+
+    UT_Stub_GetInt32StatusCode(Context, &Status);
+    UT_Stub_SetReturnValue(FuncKey, Status);
+}
+
+/* Restores a saved pre-opened filename for the first destination only */
+void UT_CFE_ES_RestoreFromCDS_SpareHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    char *RestoreToMemory = UT_Hook_GetArgValueByName(Context, "RestoreToMemory", char *);
+    int32 Status          = CFE_SUCCESS;
+
+    if (UT_GetStubCount(FuncKey) == 1)
+    {
+        strncpy(RestoreToMemory, "sparename", DS_TOTAL_FNAME_BUFSIZE);
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, Status);
+}
+
+/*
+ * Function Definitions
+ */
+
+void DS_FinalizeInit_Test_Nominal(void)
+{
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FinalizeInit(), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(DS_AppData.FinalizeTaskActive);
+#if (DS_FILE_PREOPEN_PERCENT > 0)
+    UtAssert_STUB_COUNT(CFE_ES_RegisterCDS, DS_FINALIZE_QUEUE_DEPTH + 1 + DS_DEST_FILE_CNT);
+#else
+    UtAssert_STUB_COUNT(CFE_ES_RegisterCDS, DS_FINALIZE_QUEUE_DEPTH + 1);
+#endif
+    UtAssert_STUB_COUNT(OS_CountSemCreate, 1);
+    UtAssert_STUB_COUNT(OS_MutSemCreate, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FinalizeInit_Test_SemCreateError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemCreate), 1, OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FinalizeInit(), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(DS_AppData.FinalizeTaskActive);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_INIT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_FinalizeInit_Test_MutexCreateError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 1, OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FinalizeInit(), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(DS_AppData.FinalizeTaskActive);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_INIT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_FinalizeInit_Test_ChildTaskError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FinalizeInit(), -1);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(DS_AppData.FinalizeTaskActive);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_INIT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_FinalizeTask_Test_SemTakeError(void)
+{
+    DS_FinalizeEntry_t Entry;
+
+    UT_DS_FinalizeSetupEntry(&Entry);
+
+    DS_AppData.FinalizeTaskActive = true;
+    DS_FinalizeEnqueue(&Entry);
+
+    /* Finalize one file, then fail the semaphore take */
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTake), 2, OS_ERROR);
+
+    /* Execute the function being tested */
+    DS_FinalizeTask();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FinalizeQueue.Count, 0);
+    UtAssert_STUB_COUNT(DS_FileFinalize, 1);
+    UtAssert_BOOL_FALSE(DS_AppData.FinalizeTaskActive);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FINALIZE_TASK_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_FinalizeEnqueue_Test_Nominal(void)
+{
+    DS_FinalizeEntry_t Entry;
+
+    UT_DS_FinalizeSetupEntry(&Entry);
+
+    DS_AppData.FinalizeTaskActive = true;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_FinalizeEnqueue(&Entry));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FinalizeQueue.Count, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FinalizePeakCount, 1);
+    UtAssert_STRINGBUF_EQ(DS_AppData.FinalizeQueue.Entry[0].FileName, sizeof(DS_AppData.FinalizeQueue.Entry[0].FileName),
+                          "file1", sizeof("file1"));
+    UtAssert_STUB_COUNT(OS_CountSemGive, 1);
+    UtAssert_STUB_COUNT(DS_FileFinalize, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FinalizeCounter, 0);
+}
+
+void DS_FinalizeEnqueue_Test_CDS(void)
+{
+    DS_FinalizeEntry_t Entry;
+
+    UT_DS_FinalizeSetupEntry(&Entry);
+
+    DS_AppData.FinalizeTaskActive = true;
+
+    /* Non-zero handle means CDS is active */
+    DS_AppData.FinalizeCDSHandle = DS_UT_CDSHANDLE_1;
+
+    /* Execute the function being tested - queue, then finalize */
+    DS_FinalizeEnqueue(&Entry);
+    DS_FinalizeProcessNext();
+
+    /* Verify results - entry and state on enqueue, only state on dequeue */
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 3);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FinalizeEnqueue_Test_Full(void)
+{
+    DS_FinalizeEntry_t Entry;
+
+    UT_DS_FinalizeSetupEntry(&Entry);
+
+    DS_AppData.FinalizeTaskActive   = true;
+    DS_AppData.FinalizeQueue.Count = DS_FINALIZE_QUEUE_DEPTH;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_FinalizeEnqueue(&Entry));
+
+    /* Verify results - file is left to the caller, not finalized here */
+    UtAssert_UINT32_EQ(DS_AppData.FinalizeQueue.Count, DS_FINALIZE_QUEUE_DEPTH);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+    UtAssert_STUB_COUNT(DS_FileFinalize, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FinalizeCounter, 0);
+}
+
+void DS_FinalizeEnqueue_Test_Inactive(void)
+{
+    DS_FinalizeEntry_t Entry;
+
+    UT_DS_FinalizeSetupEntry(&Entry);
+
+    /* Two files stranded in the queue by a stopped finalizer task */
+    DS_AppData.FinalizeQueue.Head  = DS_FINALIZE_QUEUE_DEPTH - 1;
+    DS_AppData.FinalizeQueue.Count = 2;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_FinalizeEnqueue(&Entry));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FinalizeQueue.Count, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FinalizeQueue.Head, 1);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+    UtAssert_STUB_COUNT(DS_FileFinalize, 3);
+    UtAssert_UINT32_EQ(DS_AppData.FinalizeCounter, 3);
+}
+
+void DS_FinalizeProcessNext_Test_Nominal(void)
+{
+    DS_FinalizeEntry_t Entry;
+
+    UT_DS_FinalizeSetupEntry(&Entry);
+
+    DS_AppData.FinalizeTaskActive = true;
+    DS_FinalizeEnqueue(&Entry);
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_AppSchedClock), 25);
+
+    /* Execute the function being tested */
+    DS_FinalizeProcessNext();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FinalizeQueue.Count, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FinalizeQueue.Head, 1);
+    UtAssert_STUB_COUNT(DS_FileFinalize, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FinalizeCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.LastFinalizeTime, 15);
+}
+
+void DS_FinalizeProcessNext_Test_Empty(void)
+{
+    /* Execute the function being tested */
+    DS_FinalizeProcessNext();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FinalizeQueue.Count, 0);
+    UtAssert_STUB_COUNT(DS_FileFinalize, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FinalizeCounter, 0);
+}
+
+void DS_FinalizeCreateCDS_Test_New(void)
+{
+    /* Execute the function being tested */
+    DS_FinalizeCreateCDS();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FinalizeQueue.Count, 0);
+    UtAssert_STUB_COUNT(CFE_ES_RegisterCDS, DS_FINALIZE_QUEUE_DEPTH + 1);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+    UtAssert_STUB_COUNT(CFE_ES_RestoreFromCDS, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FinalizeCreateCDS_Test_Recover(void)
+{
+    memset(&UT_DS_SavedState, 0, sizeof(UT_DS_SavedState));
+    UT_DS_FinalizeSetupEntry(&UT_DS_SavedEntry[0]);
+    UT_DS_FinalizeSetupEntry(&UT_DS_SavedEntry[1]);
+
+    UT_DS_SavedState.Head  = DS_FINALIZE_QUEUE_DEPTH - 1;
+    UT_DS_SavedState.Count = 2;
+    OS_OpenCreate(&UT_DS_SavedEntry[0].FileHandle, NULL, 0, 0);
+    OS_OpenCreate(&UT_DS_SavedEntry[1].FileHandle, NULL, 0, 0);
+    strncpy(UT_DS_SavedEntry[1].FileName, "file2", sizeof(UT_DS_SavedEntry[1].FileName));
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RegisterCDS), CFE_ES_CDS_ALREADY_EXISTS);
+    UT_SetHandlerFunction(UT_KEY(CFE_ES_RestoreFromCDS), &UT_CFE_ES_RestoreFromCDS_CustomHandler, NULL);
+
+    /* Execute the function being tested */
+    DS_FinalizeCreateCDS();
+
+    /* Verify results - only the two saved entries are read back */
+    UtAssert_UINT32_EQ(DS_AppData.FinalizeQueue.Head, DS_FINALIZE_QUEUE_DEPTH - 1);
+    UtAssert_UINT32_EQ(DS_AppData.FinalizeQueue.Count, 2);
+    UtAssert_STUB_COUNT(CFE_ES_RestoreFromCDS, 3);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+    UtAssert_STRINGBUF_EQ(DS_AppData.FinalizeQueue.Entry[0].FileName, sizeof(DS_AppData.FinalizeQueue.Entry[0].FileName),
+                          "file2", sizeof("file2"));
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FinalizeQueue.Entry[DS_FINALIZE_QUEUE_DEPTH - 1].FileHandle));
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FinalizeQueue.Entry[0].FileHandle));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FINALIZE_RECOVER_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void DS_FinalizeCreateCDS_Test_RestoreError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RegisterCDS), CFE_ES_CDS_ALREADY_EXISTS);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RestoreFromCDS), -1);
+
+    /* Execute the function being tested */
+    DS_FinalizeCreateCDS();
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_EQUAL(DS_AppData.FinalizeCDSHandle, CFE_ES_CDS_BAD_HANDLE));
+    UtAssert_UINT32_EQ(DS_AppData.FinalizeQueue.Count, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_INIT_CDS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_FinalizeCreateCDS_Test_BadQueue(void)
+{
+    memset(&UT_DS_SavedState, 0, sizeof(UT_DS_SavedState));
+
+    UT_DS_SavedState.Count = DS_FINALIZE_QUEUE_DEPTH + 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RegisterCDS), CFE_ES_CDS_ALREADY_EXISTS);
+    UT_SetHandlerFunction(UT_KEY(CFE_ES_RestoreFromCDS), &UT_CFE_ES_RestoreFromCDS_CustomHandler, NULL);
+
+    /* Execute the function being tested */
+    DS_FinalizeCreateCDS();
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_EQUAL(DS_AppData.FinalizeCDSHandle, CFE_ES_CDS_BAD_HANDLE));
+    UtAssert_UINT32_EQ(DS_AppData.FinalizeQueue.Count, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_INIT_CDS_ERR_EID);
+}
+
+void DS_FinalizeCreateCDS_Test_RegisterEntryError(void)
+{
+    /* Head and count area registers, the first entry area does not */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RegisterCDS), 2, -1);
+
+    /* Execute the function being tested */
+    DS_FinalizeCreateCDS();
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_EQUAL(DS_AppData.FinalizeCDSHandle, CFE_ES_CDS_BAD_HANDLE));
+    UtAssert_STUB_COUNT(CFE_ES_RegisterCDS, 2);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_INIT_CDS_ERR_EID);
+}
+
+void DS_FinalizeUpdateCDS_Test_Entry(void)
+{
+    /* Non-zero handle means CDS is active */
+    DS_AppData.FinalizeCDSHandle = DS_UT_CDSHANDLE_1;
+
+    /* Execute the function being tested */
+    DS_FinalizeUpdateCDS(3);
+
+    /* Verify results - entry, then head and count */
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FinalizeUpdateCDS_Test_StateOnly(void)
+{
+    /* Non-zero handle means CDS is active */
+    DS_AppData.FinalizeCDSHandle = DS_UT_CDSHANDLE_1;
+
+    /* Execute the function being tested */
+    DS_FinalizeUpdateCDS(DS_INDEX_NONE);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FinalizeUpdateCDS_Test_Error(void)
+{
+    /* Non-zero handle means CDS is active */
+    DS_AppData.FinalizeCDSHandle = DS_UT_CDSHANDLE_1;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CopyToCDS), -1);
+
+    /* Execute the function being tested */
+    DS_FinalizeUpdateCDS(0);
+
+    /* Verify results - head and count are not saved over a failed entry */
+    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_EQUAL(DS_AppData.FinalizeCDSHandle, CFE_ES_CDS_BAD_HANDLE));
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_INIT_CDS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_FinalizeUpdateCDS_Test_Inactive(void)
+{
+    /* Execute the function being tested */
+    DS_FinalizeUpdateCDS(0);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+}
+
+#if (DS_FILE_PREOPEN_PERCENT > 0)
+void DS_FinalizeCreateSpareCDS_Test_New(void)
+{
+    /* Execute the function being tested */
+    DS_FinalizeCreateSpareCDS();
+
+    /* Verify results - every area starts with no pre-opened file */
+    UtAssert_STUB_COUNT(CFE_ES_RegisterCDS, DS_DEST_FILE_CNT);
+    UtAssert_STUB_COUNT(CFE_ES_RestoreFromCDS, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, DS_DEST_FILE_CNT);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FinalizeCreateSpareCDS_Test_Recover(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RegisterCDS), CFE_ES_CDS_ALREADY_EXISTS);
+
+    /* Only the first destination had an unused pre-opened file */
+    UT_SetHandlerFunction(UT_KEY(CFE_ES_RestoreFromCDS), &UT_CFE_ES_RestoreFromCDS_SpareHandler, NULL);
+
+    /* Execute the function being tested */
+    DS_FinalizeCreateSpareCDS();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_ES_RestoreFromCDS, DS_DEST_FILE_CNT);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, DS_DEST_FILE_CNT);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FINALIZE_SPARE_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void DS_FinalizeCreateSpareCDS_Test_Error(void)
+{
+    /* First area registers, the second does not */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RegisterCDS), 2, -1);
+
+    /* Execute the function being tested */
+    DS_FinalizeCreateSpareCDS();
+
+    /* Verify results - other destinations are not affected */
+    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_EQUAL(DS_AppData.SpareCDSHandle[1], CFE_ES_CDS_BAD_HANDLE));
+    UtAssert_STUB_COUNT(CFE_ES_RegisterCDS, DS_DEST_FILE_CNT);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, DS_DEST_FILE_CNT - 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_INIT_CDS_ERR_EID);
+}
+#endif
+
+void DS_FinalizeUpdateSpareCDS_Test_Nominal(void)
+{
+    char SpareName[DS_TOTAL_FNAME_BUFSIZE] = "sparename";
+
+    /* Non-zero handle means CDS is active */
+    DS_AppData.SpareCDSHandle[0] = DS_UT_CDSHANDLE_1;
+
+    /* Execute the function being tested */
+    DS_FinalizeUpdateSpareCDS(0, SpareName);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FinalizeUpdateSpareCDS_Test_Error(void)
+{
+    char SpareName[DS_TOTAL_FNAME_BUFSIZE] = "sparename";
+
+    /* Non-zero handle means CDS is active */
+    DS_AppData.SpareCDSHandle[0] = DS_UT_CDSHANDLE_1;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CopyToCDS), -1);
+
+    /* Execute the function being tested */
+    DS_FinalizeUpdateSpareCDS(0, SpareName);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_EQUAL(DS_AppData.SpareCDSHandle[0], CFE_ES_CDS_BAD_HANDLE));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_INIT_CDS_ERR_EID);
+}
+
+void DS_FinalizeUpdateSpareCDS_Test_Inactive(void)
+{
+    char SpareName[DS_TOTAL_FNAME_BUFSIZE] = "";
+
+    /* Execute the function being tested */
+    DS_FinalizeUpdateSpareCDS(0, SpareName);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+}
+
+void DS_FinalizeDone_Test(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(DS_AppSchedClock), 100);
+
+    /* Execute the function being tested */
+    DS_FinalizeDone(40);
+    DS_FinalizeDone(90);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FinalizeCounter, 2);
+    UtAssert_UINT32_EQ(DS_AppData.LastFinalizeTime, 10);
+    UtAssert_UINT32_EQ(DS_AppData.MaxFinalizeTime, 60);
+}
+
+void UtTest_Setup(void)
+{
+    UT_DS_TEST_ADD(DS_FinalizeInit_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FinalizeInit_Test_SemCreateError);
+    UT_DS_TEST_ADD(DS_FinalizeInit_Test_MutexCreateError);
+    UT_DS_TEST_ADD(DS_FinalizeInit_Test_ChildTaskError);
+
+    UT_DS_TEST_ADD(DS_FinalizeTask_Test_SemTakeError);
+
+    UT_DS_TEST_ADD(DS_FinalizeEnqueue_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FinalizeEnqueue_Test_CDS);
+    UT_DS_TEST_ADD(DS_FinalizeEnqueue_Test_Full);
+    UT_DS_TEST_ADD(DS_FinalizeEnqueue_Test_Inactive);
+
+    UT_DS_TEST_ADD(DS_FinalizeProcessNext_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FinalizeProcessNext_Test_Empty);
+
+    UT_DS_TEST_ADD(DS_FinalizeCreateCDS_Test_New);
+    UT_DS_TEST_ADD(DS_FinalizeCreateCDS_Test_Recover);
+    UT_DS_TEST_ADD(DS_FinalizeCreateCDS_Test_RestoreError);
+    UT_DS_TEST_ADD(DS_FinalizeCreateCDS_Test_BadQueue);
+    UT_DS_TEST_ADD(DS_FinalizeCreateCDS_Test_RegisterEntryError);
+
+    UT_DS_TEST_ADD(DS_FinalizeUpdateCDS_Test_Entry);
+    UT_DS_TEST_ADD(DS_FinalizeUpdateCDS_Test_StateOnly);
+    UT_DS_TEST_ADD(DS_FinalizeUpdateCDS_Test_Error);
+    UT_DS_TEST_ADD(DS_FinalizeUpdateCDS_Test_Inactive);
+
+#if (DS_FILE_PREOPEN_PERCENT > 0)
+    UT_DS_TEST_ADD(DS_FinalizeCreateSpareCDS_Test_New);
+    UT_DS_TEST_ADD(DS_FinalizeCreateSpareCDS_Test_Recover);
+    UT_DS_TEST_ADD(DS_FinalizeCreateSpareCDS_Test_Error);
+#endif
+    UT_DS_TEST_ADD(DS_FinalizeUpdateSpareCDS_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FinalizeUpdateSpareCDS_Test_Error);
+    UT_DS_TEST_ADD(DS_FinalizeUpdateSpareCDS_Test_Inactive);
+    UT_DS_TEST_ADD(DS_FinalizeDone_Test);
+}
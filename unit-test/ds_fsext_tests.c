@@ -0,0 +1,411 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,917-1, and identified as “CFS Data Storage
+ * (DS) application version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   This file contains unit test cases for the functions contained in the file ds_fsext.c
+ */
+
+/*
+ * Includes
+ */
+
+#include "ds_app.h"
+#include "ds_appdefs.h"
+#include "ds_test_utils.h"
+#include "ds_fsext.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+#include "stub_fcntl.h"
+#include "stub_unistd.h"
+
+/*
+ * Function Definitions
+ */
+
+#if (DS_FILE_PREALLOCATE == true)
+void DS_FsExtAllocate_Test_Nominal(void)
+{
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FsExtAllocate("/ram/file1", 1024), OS_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_TranslatePath, 1);
+    UtAssert_STUB_COUNT(stub_open, 1);
+    UtAssert_STUB_COUNT(stub_fallocate, 1);
+    UtAssert_STUB_COUNT(stub_close, 1);
+}
+
+void DS_FsExtAllocate_Test_TranslateError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(OS_TranslatePath), OS_FS_ERR_PATH_INVALID);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FsExtAllocate("/ram/file1", 1024), OS_FS_ERR_PATH_INVALID);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(stub_open, 0);
+}
+
+void DS_FsExtAllocate_Test_OpenError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(stub_open), -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FsExtAllocate("/ram/file1", 1024), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(stub_fallocate, 0);
+    UtAssert_STUB_COUNT(stub_close, 0);
+}
+
+void DS_FsExtAllocate_Test_AllocateError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(stub_fallocate), -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FsExtAllocate("/ram/file1", 1024), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(stub_close, 1);
+}
+#else
+void DS_FsExtAllocate_Test_NotImplemented(void)
+{
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FsExtAllocate("/ram/file1", 1024), OS_ERR_NOT_IMPLEMENTED);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_TranslatePath, 0);
+}
+#endif
+
+#if (DS_FILE_PREALLOCATE == true) || (DS_FILE_DIRECT_IO == true)
+void DS_FsExtTruncate_Test_Nominal(void)
+{
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FsExtTruncate("/ram/file1", 100), OS_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_TranslatePath, 1);
+    UtAssert_STUB_COUNT(stub_truncate, 1);
+}
+
+void DS_FsExtTruncate_Test_TranslateError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(OS_TranslatePath), OS_FS_ERR_PATH_INVALID);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FsExtTruncate("/ram/file1", 100), OS_FS_ERR_PATH_INVALID);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(stub_truncate, 0);
+}
+
+void DS_FsExtTruncate_Test_TruncateError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(stub_truncate), -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FsExtTruncate("/ram/file1", 100), OS_ERROR);
+}
+#else
+void DS_FsExtTruncate_Test_NotImplemented(void)
+{
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FsExtTruncate("/ram/file1", 100), OS_ERR_NOT_IMPLEMENTED);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_TranslatePath, 0);
+}
+#endif
+
+#if (DS_FILE_SYNC == true)
+void DS_FsExtSync_Test_Nominal(void)
+{
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FsExtSync("/ram/file1"), OS_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_TranslatePath, 1);
+    UtAssert_STUB_COUNT(stub_open, 1);
+    UtAssert_STUB_COUNT(stub_fsync, 1);
+    UtAssert_STUB_COUNT(stub_close, 1);
+}
+
+void DS_FsExtSync_Test_TranslateError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(OS_TranslatePath), OS_FS_ERR_PATH_INVALID);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FsExtSync("/ram/file1"), OS_FS_ERR_PATH_INVALID);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(stub_open, 0);
+}
+
+void DS_FsExtSync_Test_OpenError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(stub_open), -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FsExtSync("/ram/file1"), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(stub_fsync, 0);
+    UtAssert_STUB_COUNT(stub_close, 0);
+}
+
+void DS_FsExtSync_Test_SyncError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(stub_fsync), -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FsExtSync("/ram/file1"), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(stub_close, 1);
+}
+#else
+void DS_FsExtSync_Test_NotImplemented(void)
+{
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FsExtSync("/ram/file1"), OS_ERR_NOT_IMPLEMENTED);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_TranslatePath, 0);
+}
+#endif
+
+#if (DS_FILE_DIRECT_IO == true)
+void DS_FsExtOpenDirect_Test_Nominal(void)
+{
+    int32 FileDesc = -1;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FsExtOpenDirect("/ram/file1", &FileDesc), OS_SUCCESS);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(FileDesc, 3);
+    UtAssert_STUB_COUNT(OS_TranslatePath, 1);
+    UtAssert_STUB_COUNT(stub_open, 1);
+}
+
+void DS_FsExtOpenDirect_Test_TranslateError(void)
+{
+    int32 FileDesc = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_TranslatePath), OS_FS_ERR_PATH_INVALID);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FsExtOpenDirect("/ram/file1", &FileDesc), OS_FS_ERR_PATH_INVALID);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(FileDesc, -1);
+    UtAssert_STUB_COUNT(stub_open, 0);
+}
+
+void DS_FsExtOpenDirect_Test_OpenError(void)
+{
+    int32 FileDesc = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(stub_open), -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FsExtOpenDirect("/ram/file1", &FileDesc), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(FileDesc, -1);
+}
+
+void DS_FsExtWriteDirect_Test_Nominal(void)
+{
+    static uint8 Buffer[DS_DIRECT_IO_BLOCK_SIZE];
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FsExtWriteDirect(3, Buffer, sizeof(Buffer), 0), sizeof(Buffer));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(stub_pwrite, 1);
+}
+
+void DS_FsExtWriteDirect_Test_Error(void)
+{
+    static uint8 Buffer[DS_DIRECT_IO_BLOCK_SIZE];
+
+    UT_SetDefaultReturnValue(UT_KEY(stub_pwrite), -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FsExtWriteDirect(3, Buffer, sizeof(Buffer), 0), OS_ERROR);
+}
+
+void DS_FsExtCloseDirect_Test(void)
+{
+    /* Execute the function being tested */
+    DS_FsExtCloseDirect(3);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(stub_close, 1);
+}
+#else
+void DS_FsExtOpenDirect_Test_NotImplemented(void)
+{
+    int32 FileDesc = 0;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FsExtOpenDirect("/ram/file1", &FileDesc), OS_ERR_NOT_IMPLEMENTED);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(FileDesc, -1);
+    UtAssert_STUB_COUNT(OS_TranslatePath, 0);
+}
+#endif
+
+void DS_FsExtAllocateAvailable_Test(void)
+{
+    /* The override fcntl.h always declares FALLOC_FL_KEEP_SIZE */
+    UtAssert_BOOL_TRUE(DS_FsExtAllocateAvailable() == DS_FILE_PREALLOCATE);
+}
+
+void DS_FsExtDirectAvailable_Test(void)
+{
+    /* The override fcntl.h always declares O_DIRECT */
+    UtAssert_BOOL_TRUE(DS_FsExtDirectAvailable() == DS_FILE_DIRECT_IO);
+}
+
+#if (DS_FILE_POSITIONAL_WRITE == true)
+void DS_FsExtWriteAt_Test_Nominal(void)
+{
+    uint32 Data = 0;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FsExtWriteAt("/ram/file1", 64, &Data, sizeof(Data)), OS_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_TranslatePath, 1);
+    UtAssert_STUB_COUNT(stub_open, 1);
+    UtAssert_STUB_COUNT(stub_pwrite, 1);
+    UtAssert_STUB_COUNT(stub_close, 1);
+}
+
+void DS_FsExtWriteAt_Test_TranslateError(void)
+{
+    uint32 Data = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_TranslatePath), OS_FS_ERR_PATH_INVALID);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FsExtWriteAt("/ram/file1", 64, &Data, sizeof(Data)), OS_FS_ERR_PATH_INVALID);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(stub_open, 0);
+}
+
+void DS_FsExtWriteAt_Test_OpenError(void)
+{
+    uint32 Data = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(stub_open), -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FsExtWriteAt("/ram/file1", 64, &Data, sizeof(Data)), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(stub_pwrite, 0);
+    UtAssert_STUB_COUNT(stub_close, 0);
+}
+
+void DS_FsExtWriteAt_Test_WriteError(void)
+{
+    uint32 Data = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(stub_pwrite), 2);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FsExtWriteAt("/ram/file1", 64, &Data, sizeof(Data)), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(stub_close, 1);
+}
+#else
+void DS_FsExtWriteAt_Test_NotImplemented(void)
+{
+    uint32 Data = 0;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FsExtWriteAt("/ram/file1", 64, &Data, sizeof(Data)), OS_ERR_NOT_IMPLEMENTED);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_TranslatePath, 0);
+}
+#endif
+
+void UtTest_Setup(void)
+{
+#if (DS_FILE_PREALLOCATE == true)
+    UT_DS_TEST_ADD(DS_FsExtAllocate_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FsExtAllocate_Test_TranslateError);
+    UT_DS_TEST_ADD(DS_FsExtAllocate_Test_OpenError);
+    UT_DS_TEST_ADD(DS_FsExtAllocate_Test_AllocateError);
+#else
+    UT_DS_TEST_ADD(DS_FsExtAllocate_Test_NotImplemented);
+#endif
+
+#if (DS_FILE_PREALLOCATE == true) || (DS_FILE_DIRECT_IO == true)
+    UT_DS_TEST_ADD(DS_FsExtTruncate_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FsExtTruncate_Test_TranslateError);
+    UT_DS_TEST_ADD(DS_FsExtTruncate_Test_TruncateError);
+#else
+    UT_DS_TEST_ADD(DS_FsExtTruncate_Test_NotImplemented);
+#endif
+
+#if (DS_FILE_SYNC == true)
+    UT_DS_TEST_ADD(DS_FsExtSync_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FsExtSync_Test_TranslateError);
+    UT_DS_TEST_ADD(DS_FsExtSync_Test_OpenError);
+    UT_DS_TEST_ADD(DS_FsExtSync_Test_SyncError);
+#else
+    UT_DS_TEST_ADD(DS_FsExtSync_Test_NotImplemented);
+#endif
+
+#if (DS_FILE_DIRECT_IO == true)
+    UT_DS_TEST_ADD(DS_FsExtOpenDirect_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FsExtOpenDirect_Test_TranslateError);
+    UT_DS_TEST_ADD(DS_FsExtOpenDirect_Test_OpenError);
+    UT_DS_TEST_ADD(DS_FsExtWriteDirect_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FsExtWriteDirect_Test_Error);
+    UT_DS_TEST_ADD(DS_FsExtCloseDirect_Test);
+#else
+    UT_DS_TEST_ADD(DS_FsExtOpenDirect_Test_NotImplemented);
+#endif
+    UT_DS_TEST_ADD(DS_FsExtAllocateAvailable_Test);
+    UT_DS_TEST_ADD(DS_FsExtDirectAvailable_Test);
+
+#if (DS_FILE_POSITIONAL_WRITE == true)
+    UT_DS_TEST_ADD(DS_FsExtWriteAt_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FsExtWriteAt_Test_TranslateError);
+    UT_DS_TEST_ADD(DS_FsExtWriteAt_Test_OpenError);
+    UT_DS_TEST_ADD(DS_FsExtWriteAt_Test_WriteError);
+#else
+    UT_DS_TEST_ADD(DS_FsExtWriteAt_Test_NotImplemented);
+#endif
+}
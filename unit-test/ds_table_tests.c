@@ -29,6 +29,8 @@
 #include "ds_app.h"
 #include "ds_appdefs.h"
 #include "ds_table.h"
+#include "ds_file.h"
+#include "ds_fsext.h"
 #include "ds_msg.h"
 #include "ds_msgdefs.h"
 #include "ds_msgids.h"
@@ -159,11 +161,14 @@ void DS_TableManageDestFile_Test_TableInfoUpdated(void)
     UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &DS_AppData.DestFileTblPtr, sizeof(DS_AppData.DestFileTblPtr), true);
     DS_AppData.DestFileTblPtr = NULL;
 
+    DS_AppData.DataStoreHandle = DS_UT_CDSHANDLE_1;
+
     /* Execute the function being tested */
     DS_TableManageDestFile();
 
-    /* Verify results */
+    /* Verify results - table values are written to the CDS at once */
     UtAssert_UINT32_EQ(DS_AppData.DestTblLoadCounter, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
 
     UtAssert_UINT32_EQ(DS_AppData.FileStatus[0].FileState, 0);
     UtAssert_UINT32_EQ(DS_AppData.FileStatus[0].FileCount, 0);
@@ -229,6 +234,8 @@ void DS_TableManageDestFile_Test_TableInfoUpdatePending(void)
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_INFO_UPDATE_PENDING);
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_TBL_INFO_UPDATED);
 
+    DS_AppData.DataStoreHandle = DS_UT_CDSHANDLE_1;
+
     /* Execute the function being tested */
     DS_TableManageDestFile();
 
@@ -244,6 +251,14 @@ void DS_TableManageDestFile_Test_TableInfoUpdatePending(void)
     UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT - 1].FileState, DS_DEST_FILE_CNT - 1);
     UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT - 1].FileCount, DS_DEST_FILE_CNT - 1);
 
+    /* New sequence counts are written to the CDS at once */
+    UtAssert_UINT32_EQ(DS_AppData.DataStoreImage[DS_DEST_FILE_CNT - 1], DS_DEST_FILE_CNT - 1);
+    UtAssert_BOOL_FALSE(DS_AppData.DataStoreDirty[DS_DEST_FILE_CNT - 1]);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+
+    /* Next files opened ahead of time were named by the old table */
+    UtAssert_STUB_COUNT(DS_FileCloseSpare, DS_DEST_FILE_CNT);
+
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
@@ -454,21 +469,40 @@ void DS_TableVerifyDestFile_Test_CountBad(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
 }
 
+void UT_DS_SetupDestFileEntry(DS_DestFileEntry_t *DestFileEntry)
+{
+    /* Valid entry - each test changes only the field under test */
+    memset(DestFileEntry, 0, sizeof(*DestFileEntry));
+
+    DestFileEntry->FileNameType   = DS_BY_TIME;
+    DestFileEntry->EnableState    = DS_ENABLED;
+    DestFileEntry->MaxFileSize    = 2048;
+    DestFileEntry->MaxFileAge     = 100;
+    DestFileEntry->SequenceCount  = 1;
+    DestFileEntry->BufferSize     = 0;
+    DestFileEntry->Preallocate    = DS_DISABLED;
+    DestFileEntry->SyncPolicy     = DS_SYNC_NONE;
+    DestFileEntry->SyncInterval   = 0;
+    DestFileEntry->DirectIO       = DS_DISABLED;
+    DestFileEntry->IndexSeconds   = 0;
+    DestFileEntry->IndexBytes     = 0;
+    DestFileEntry->Codec          = DS_CODEC_NONE;
+    DestFileEntry->DeltaKeyframe  = 0;
+    DestFileEntry->SuperframeSize = 0;
+    DestFileEntry->SuperframeAge  = 0;
+
+    strncpy(DestFileEntry->Pathname, "path", DS_PATHNAME_BUFSIZE);
+    strncpy(DestFileEntry->Basename, "basename", DS_BASENAME_BUFSIZE);
+    strncpy(DestFileEntry->Extension, "ext", DS_EXTENSION_BUFSIZE);
+}
+
 void DS_TableVerifyDestFileEntry_Test_NominalErrZero(void)
 {
     DS_DestFileEntry_t DestFileEntry;
     uint32             TableIndex = 0;
     uint32             ErrorCount = 0;
 
-    DestFileEntry.FileNameType  = DS_BY_TIME;
-    DestFileEntry.EnableState   = DS_ENABLED;
-    DestFileEntry.MaxFileSize   = 2048;
-    DestFileEntry.MaxFileAge    = 100;
-    DestFileEntry.SequenceCount = 1;
-
-    strncpy(DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
-    strncpy(DestFileEntry.Basename, "basename", DS_BASENAME_BUFSIZE);
-    strncpy(DestFileEntry.Extension, "ext", DS_EXTENSION_BUFSIZE);
+    UT_DS_SetupDestFileEntry(&DestFileEntry);
 
     /* Execute the function being tested */
     UtAssert_BOOL_TRUE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
@@ -483,15 +517,9 @@ void DS_TableVerifyDestFileEntry_Test_InvalidPathnameErrZero(void)
     uint32             TableIndex = 0;
     uint32             ErrorCount = 0;
 
-    DestFileEntry.FileNameType  = DS_BY_TIME;
-    DestFileEntry.EnableState   = DS_ENABLED;
-    DestFileEntry.MaxFileSize   = 2048;
-    DestFileEntry.MaxFileAge    = 100;
-    DestFileEntry.SequenceCount = 1;
+    UT_DS_SetupDestFileEntry(&DestFileEntry);
 
     strncpy(DestFileEntry.Pathname, "***", DS_PATHNAME_BUFSIZE);
-    strncpy(DestFileEntry.Basename, "basename", DS_BASENAME_BUFSIZE);
-    strncpy(DestFileEntry.Extension, "ext", DS_EXTENSION_BUFSIZE);
 
     /* Execute the function being tested */
     UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
@@ -508,15 +536,9 @@ void DS_TableVerifyDestFileEntry_Test_InvalidBasenameErrZero(void)
     uint32             TableIndex = 0;
     uint32             ErrorCount = 0;
 
-    DestFileEntry.FileNameType  = DS_BY_TIME;
-    DestFileEntry.EnableState   = DS_ENABLED;
-    DestFileEntry.MaxFileSize   = 2048;
-    DestFileEntry.MaxFileAge    = 100;
-    DestFileEntry.SequenceCount = 1;
+    UT_DS_SetupDestFileEntry(&DestFileEntry);
 
-    strncpy(DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
     strncpy(DestFileEntry.Basename, "***", DS_BASENAME_BUFSIZE);
-    strncpy(DestFileEntry.Extension, "ext", DS_EXTENSION_BUFSIZE);
 
     /* Execute the function being tested */
     UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
@@ -533,15 +555,9 @@ void DS_TableVerifyDestFileEntry_Test_InvalidFilenameTypeErrZero(void)
     uint32             TableIndex = 0;
     uint32             ErrorCount = 0;
 
-    DestFileEntry.FileNameType  = 99;
-    DestFileEntry.EnableState   = DS_ENABLED;
-    DestFileEntry.MaxFileSize   = 2048;
-    DestFileEntry.MaxFileAge    = 100;
-    DestFileEntry.SequenceCount = 1;
+    UT_DS_SetupDestFileEntry(&DestFileEntry);
 
-    strncpy(DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
-    strncpy(DestFileEntry.Basename, "pathname", DS_BASENAME_BUFSIZE);
-    strncpy(DestFileEntry.Extension, "ext", DS_EXTENSION_BUFSIZE);
+    DestFileEntry.FileNameType = 99;
 
     /* Execute the function being tested */
     UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
@@ -558,15 +574,9 @@ void DS_TableVerifyDestFileEntry_Test_InvalidFileEnableStateErrZero(void)
     uint32             TableIndex = 0;
     uint32             ErrorCount = 0;
 
-    DestFileEntry.FileNameType  = DS_BY_TIME;
-    DestFileEntry.EnableState   = 99;
-    DestFileEntry.MaxFileSize   = 2048;
-    DestFileEntry.MaxFileAge    = 100;
-    DestFileEntry.SequenceCount = 1;
+    UT_DS_SetupDestFileEntry(&DestFileEntry);
 
-    strncpy(DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
-    strncpy(DestFileEntry.Basename, "pathname", DS_BASENAME_BUFSIZE);
-    strncpy(DestFileEntry.Extension, "ext", DS_EXTENSION_BUFSIZE);
+    DestFileEntry.EnableState = 99;
 
     /* Execute the function being tested */
     UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
@@ -583,15 +593,9 @@ void DS_TableVerifyDestFileEntry_Test_InvalidSizeErrZero(void)
     uint32             TableIndex = 0;
     uint32             ErrorCount = 0;
 
-    DestFileEntry.FileNameType  = DS_BY_TIME;
-    DestFileEntry.EnableState   = DS_ENABLED;
-    DestFileEntry.MaxFileSize   = DS_FILE_MIN_SIZE_LIMIT - 1;
-    DestFileEntry.MaxFileAge    = 100;
-    DestFileEntry.SequenceCount = 1;
+    UT_DS_SetupDestFileEntry(&DestFileEntry);
 
-    strncpy(DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
-    strncpy(DestFileEntry.Basename, "pathname", DS_BASENAME_BUFSIZE);
-    strncpy(DestFileEntry.Extension, "ext", DS_EXTENSION_BUFSIZE);
+    DestFileEntry.MaxFileSize = DS_FILE_MIN_SIZE_LIMIT - 1;
 
     /* Execute the function being tested */
     UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
@@ -608,15 +612,9 @@ void DS_TableVerifyDestFileEntry_Test_InvalidAgeErrZero(void)
     uint32             TableIndex = 0;
     uint32             ErrorCount = 0;
 
-    DestFileEntry.FileNameType  = DS_BY_TIME;
-    DestFileEntry.EnableState   = DS_ENABLED;
-    DestFileEntry.MaxFileSize   = 2048;
-    DestFileEntry.MaxFileAge    = DS_FILE_MIN_AGE_LIMIT - 1;
-    DestFileEntry.SequenceCount = 1;
+    UT_DS_SetupDestFileEntry(&DestFileEntry);
 
-    strncpy(DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
-    strncpy(DestFileEntry.Basename, "pathname", DS_BASENAME_BUFSIZE);
-    strncpy(DestFileEntry.Extension, "ext", DS_EXTENSION_BUFSIZE);
+    DestFileEntry.MaxFileAge = DS_FILE_MIN_AGE_LIMIT - 1;
 
     /* Execute the function being tested */
     UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
@@ -633,15 +631,28 @@ void DS_TableVerifyDestFileEntry_Test_InvalidSequenceCountErrZero(void)
     uint32             TableIndex = 0;
     uint32             ErrorCount = 0;
 
-    DestFileEntry.FileNameType  = DS_BY_TIME;
-    DestFileEntry.EnableState   = DS_ENABLED;
-    DestFileEntry.MaxFileSize   = 2048;
-    DestFileEntry.MaxFileAge    = 100;
+    UT_DS_SetupDestFileEntry(&DestFileEntry);
+
     DestFileEntry.SequenceCount = DS_MAX_SEQUENCE_COUNT + 1;
 
-    strncpy(DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
-    strncpy(DestFileEntry.Basename, "pathname", DS_BASENAME_BUFSIZE);
-    strncpy(DestFileEntry.Extension, "ext", DS_EXTENSION_BUFSIZE);
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FIL_TBL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_TableVerifyDestFileEntry_Test_InvalidBufferSizeErrZero(void)
+{
+    DS_DestFileEntry_t DestFileEntry;
+    uint32             TableIndex = 0;
+    uint32             ErrorCount = 0;
+
+    UT_DS_SetupDestFileEntry(&DestFileEntry);
+
+    DestFileEntry.BufferSize = DS_WRITE_BUFFER_MAX_SIZE + 1;
 
     /* Execute the function being tested */
     UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
@@ -658,15 +669,9 @@ void DS_TableVerifyDestFileEntry_Test_InvalidFilenameTypeErrNonZero(void)
     uint32             TableIndex = 0;
     uint32             ErrorCount = 1;
 
-    DestFileEntry.FileNameType  = 99;
-    DestFileEntry.EnableState   = DS_ENABLED;
-    DestFileEntry.MaxFileSize   = 2048;
-    DestFileEntry.MaxFileAge    = 100;
-    DestFileEntry.SequenceCount = 1;
+    UT_DS_SetupDestFileEntry(&DestFileEntry);
 
-    strncpy(DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
-    strncpy(DestFileEntry.Basename, "pathname", DS_BASENAME_BUFSIZE);
-    strncpy(DestFileEntry.Extension, "ext", DS_EXTENSION_BUFSIZE);
+    DestFileEntry.FileNameType = 99;
 
     /* Execute the function being tested */
     UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
@@ -681,15 +686,9 @@ void DS_TableVerifyDestFileEntry_Test_InvalidFileEnableStateErrNonZero(void)
     uint32             TableIndex = 0;
     uint32             ErrorCount = 1;
 
-    DestFileEntry.FileNameType  = DS_BY_TIME;
-    DestFileEntry.EnableState   = 99;
-    DestFileEntry.MaxFileSize   = 2048;
-    DestFileEntry.MaxFileAge    = 100;
-    DestFileEntry.SequenceCount = 1;
+    UT_DS_SetupDestFileEntry(&DestFileEntry);
 
-    strncpy(DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
-    strncpy(DestFileEntry.Basename, "pathname", DS_BASENAME_BUFSIZE);
-    strncpy(DestFileEntry.Extension, "ext", DS_EXTENSION_BUFSIZE);
+    DestFileEntry.EnableState = 99;
 
     /* Execute the function being tested */
     UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
@@ -704,15 +703,9 @@ void DS_TableVerifyDestFileEntry_Test_InvalidSizeErrNonZero(void)
     uint32             TableIndex = 0;
     uint32             ErrorCount = 1;
 
-    DestFileEntry.FileNameType  = DS_BY_TIME;
-    DestFileEntry.EnableState   = DS_ENABLED;
-    DestFileEntry.MaxFileSize   = DS_FILE_MIN_SIZE_LIMIT - 1;
-    DestFileEntry.MaxFileAge    = 100;
-    DestFileEntry.SequenceCount = 1;
+    UT_DS_SetupDestFileEntry(&DestFileEntry);
 
-    strncpy(DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
-    strncpy(DestFileEntry.Basename, "pathname", DS_BASENAME_BUFSIZE);
-    strncpy(DestFileEntry.Extension, "ext", DS_EXTENSION_BUFSIZE);
+    DestFileEntry.MaxFileSize = DS_FILE_MIN_SIZE_LIMIT - 1;
 
     /* Execute the function being tested */
     UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
@@ -727,15 +720,9 @@ void DS_TableVerifyDestFileEntry_Test_InvalidAgeErrNonZero(void)
     uint32             TableIndex = 0;
     uint32             ErrorCount = 1;
 
-    DestFileEntry.FileNameType  = DS_BY_TIME;
-    DestFileEntry.EnableState   = DS_ENABLED;
-    DestFileEntry.MaxFileSize   = 2048;
-    DestFileEntry.MaxFileAge    = DS_FILE_MIN_AGE_LIMIT - 1;
-    DestFileEntry.SequenceCount = 1;
+    UT_DS_SetupDestFileEntry(&DestFileEntry);
 
-    strncpy(DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
-    strncpy(DestFileEntry.Basename, "pathname", DS_BASENAME_BUFSIZE);
-    strncpy(DestFileEntry.Extension, "ext", DS_EXTENSION_BUFSIZE);
+    DestFileEntry.MaxFileAge = DS_FILE_MIN_AGE_LIMIT - 1;
 
     /* Execute the function being tested */
     UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
@@ -750,15 +737,26 @@ void DS_TableVerifyDestFileEntry_Test_InvalidSequenceCountErrNonZero(void)
     uint32             TableIndex = 0;
     uint32             ErrorCount = 1;
 
-    DestFileEntry.FileNameType  = DS_BY_TIME;
-    DestFileEntry.EnableState   = DS_ENABLED;
-    DestFileEntry.MaxFileSize   = 2048;
-    DestFileEntry.MaxFileAge    = 100;
+    UT_DS_SetupDestFileEntry(&DestFileEntry);
+
     DestFileEntry.SequenceCount = DS_MAX_SEQUENCE_COUNT + 1;
 
-    strncpy(DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
-    strncpy(DestFileEntry.Basename, "pathname", DS_BASENAME_BUFSIZE);
-    strncpy(DestFileEntry.Extension, "ext", DS_EXTENSION_BUFSIZE);
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyDestFileEntry_Test_InvalidBufferSizeErrNonZero(void)
+{
+    DS_DestFileEntry_t DestFileEntry;
+    uint32             TableIndex = 0;
+    uint32             ErrorCount = 1;
+
+    UT_DS_SetupDestFileEntry(&DestFileEntry);
+
+    DestFileEntry.BufferSize = DS_WRITE_BUFFER_MAX_SIZE + 1;
 
     /* Execute the function being tested */
     UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
@@ -767,6 +765,121 @@ void DS_TableVerifyDestFileEntry_Test_InvalidSequenceCountErrNonZero(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+void DS_TableVerifyDestFileEntry_Test_InvalidPreallocateErrZero(void)
+{
+    DS_DestFileEntry_t DestFileEntry;
+    uint32             TableIndex = 0;
+    uint32             ErrorCount = 0;
+
+    UT_DS_SetupDestFileEntry(&DestFileEntry);
+
+    DestFileEntry.Preallocate = 99;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FIL_TBL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_TableVerifyDestFileEntry_Test_InvalidSyncErrZero(void)
+{
+    DS_DestFileEntry_t DestFileEntry;
+    uint32             TableIndex = 0;
+    uint32             ErrorCount = 0;
+
+    UT_DS_SetupDestFileEntry(&DestFileEntry);
+
+    DestFileEntry.SyncPolicy = DS_SYNC_BY_BYTES;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FIL_TBL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_TableVerifyDestFileEntry_Test_InvalidDirectIOErrZero(void)
+{
+    DS_DestFileEntry_t DestFileEntry;
+    uint32             TableIndex = 0;
+    uint32             ErrorCount = 0;
+
+    UT_DS_SetupDestFileEntry(&DestFileEntry);
+
+    DestFileEntry.DirectIO = DS_ENABLED;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FIL_TBL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_TableVerifyDestFileEntry_Test_InvalidCodecErrZero(void)
+{
+    DS_DestFileEntry_t DestFileEntry;
+    uint32             TableIndex = 0;
+    uint32             ErrorCount = 0;
+
+    UT_DS_SetupDestFileEntry(&DestFileEntry);
+
+    DestFileEntry.Codec = DS_CODEC_LZ_FAST;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FIL_TBL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_TableVerifyDestFileEntry_Test_InvalidDeltaErrZero(void)
+{
+    DS_DestFileEntry_t DestFileEntry;
+    uint32             TableIndex = 0;
+    uint32             ErrorCount = 0;
+
+    UT_DS_SetupDestFileEntry(&DestFileEntry);
+
+    DestFileEntry.IndexBytes    = 4096;
+    DestFileEntry.DeltaKeyframe = 10;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FIL_TBL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_TableVerifyDestFileEntry_Test_InvalidSuperframeErrZero(void)
+{
+    DS_DestFileEntry_t DestFileEntry;
+    uint32             TableIndex = 0;
+    uint32             ErrorCount = 0;
+
+    UT_DS_SetupDestFileEntry(&DestFileEntry);
+
+    DestFileEntry.SuperframeSize = DS_SUPERFRAME_MAX_SIZE + 1;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FIL_TBL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
 void DS_TableVerifyFilter_Test_Nominal(void)
 {
     DS_FilterTable_t FilterTable;
@@ -822,7 +935,7 @@ void DS_TableVerifyFilter_Test_FilterTableVerificationError(void)
         FilterTable.Packet[i].MessageID = CFE_SB_INVALID_MSG_ID;
     }
 
-    FilterTable.Packet[0].Filter[0].FilterType = 3;
+    FilterTable.Packet[0].Filter[0].FilterType = 99;
 
     /* Execute the function being tested */
     UtAssert_INT32_EQ(DS_TableVerifyFilter(&FilterTable), DS_TABLE_VERIFY_ERR);
@@ -988,6 +1101,36 @@ void DS_TableVerifyFilterEntry_Test_InvalidFilterParmsErrZero(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
+void DS_TableVerifyFilterEntry_Test_ByteRateBurstErrZero(void)
+{
+    DS_PacketEntry_t PacketEntry;
+    uint32           TableIndex = 0;
+    uint32           ErrorCount = 0;
+
+    memset(&PacketEntry, 0, sizeof(PacketEntry));
+
+    PacketEntry.MessageID                = DS_UT_MID_1;
+    PacketEntry.MinLength                = 100;
+    PacketEntry.Filter[0].FileTableIndex = 0;
+    PacketEntry.Filter[0].Algorithm_N    = 1;
+    PacketEntry.Filter[0].Algorithm_X    = 3;
+    PacketEntry.Filter[0].Algorithm_O    = 5;
+    PacketEntry.Filter[0].FilterType     = DS_BY_BYTE_RATE;
+    DS_AppData.FileStatus[0].FileState   = DS_ENABLED;
+
+    /* Execute the function being tested - a 96 byte burst never holds a 100 byte packet */
+    UtAssert_BOOL_FALSE(DS_TableVerifyFilterEntry(&PacketEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FLT_TBL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    /* A 128 byte burst does */
+    PacketEntry.Filter[0].Algorithm_X = 4;
+    UtAssert_BOOL_TRUE(DS_TableVerifyFilterEntry(&PacketEntry, TableIndex, ErrorCount));
+}
+
 void DS_TableVerifyFilterEntry_Test_InvalidFileTableIndexErrNonZero(void)
 {
     DS_PacketEntry_t PacketEntry;
@@ -1057,6 +1200,98 @@ void DS_TableVerifyFilterEntry_Test_InvalidFilterParmsErrNonZero(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+void DS_TableVerifyFilterEntry_Test_Predicates(void)
+{
+    DS_PacketEntry_t PacketEntry;
+    uint32           TableIndex = 0;
+    uint32           ErrorCount = 0;
+
+    memset(&PacketEntry, 0, sizeof(PacketEntry));
+
+    PacketEntry.MessageID                = DS_UT_MID_1;
+    PacketEntry.Filter[0].FileTableIndex = 0;
+    PacketEntry.Filter[0].Algorithm_N    = 1;
+    PacketEntry.Filter[0].Algorithm_X    = 1;
+    PacketEntry.Filter[0].FilterType     = DS_BY_PREDICATE;
+    PacketEntry.MinLength                = 16;
+    PacketEntry.Predicate[1].Offset      = 15;
+    PacketEntry.Predicate[1].Compare     = DS_PREDICATE_EQUAL;
+    PacketEntry.Predicate[1].Mask        = 0x0F;
+    PacketEntry.Predicate[1].Value       = 0x03;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_TableVerifyFilterEntry(&PacketEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyFilterEntry_Test_InvalidPredicateErrZero(void)
+{
+    DS_PacketEntry_t PacketEntry;
+    uint32           TableIndex = 0;
+    uint32           ErrorCount = 0;
+
+    memset(&PacketEntry, 0, sizeof(PacketEntry));
+
+    /* Offset is past the declared minimum packet length */
+    PacketEntry.MessageID            = DS_UT_MID_1;
+    PacketEntry.MinLength            = 16;
+    PacketEntry.Predicate[0].Offset  = 16;
+    PacketEntry.Predicate[0].Compare = DS_PREDICATE_EQUAL;
+    PacketEntry.Predicate[0].Mask    = 0xFF;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyFilterEntry(&PacketEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FLT_TBL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_TableVerifyFilterEntry_Test_NoPredicatesErrZero(void)
+{
+    DS_PacketEntry_t PacketEntry;
+    uint32           TableIndex = 0;
+    uint32           ErrorCount = 0;
+
+    memset(&PacketEntry, 0, sizeof(PacketEntry));
+
+    PacketEntry.MessageID                = DS_UT_MID_1;
+    PacketEntry.Filter[0].FileTableIndex = 0;
+    PacketEntry.Filter[0].Algorithm_N    = 1;
+    PacketEntry.Filter[0].Algorithm_X    = 1;
+    PacketEntry.Filter[0].FilterType     = DS_BY_PREDICATE;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyFilterEntry(&PacketEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FLT_TBL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_TableVerifyFilterEntry_Test_InvalidPredicateErrNonZero(void)
+{
+    DS_PacketEntry_t PacketEntry;
+    uint32           TableIndex = 0;
+    uint32           ErrorCount = 1;
+
+    memset(&PacketEntry, 0, sizeof(PacketEntry));
+
+    PacketEntry.MessageID            = DS_UT_MID_1;
+    PacketEntry.MinLength            = 16;
+    PacketEntry.Predicate[0].Compare = 99;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyFilterEntry(&PacketEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void DS_TableEntryUnused_Test_Nominal(void)
 {
     DS_DestFileEntry_t DestFileEntry;
@@ -1112,7 +1347,7 @@ void DS_TableVerifyParms_Test_NominalOnlyXNonZero(void)
     uint16 Algorithm_O = 0;
 
     /* Execute the function being tested */
-    UtAssert_BOOL_TRUE(DS_TableVerifyParms(Algorithm_N, Algorithm_X, Algorithm_O));
+    UtAssert_BOOL_TRUE(DS_TableVerifyParms(DS_BY_COUNT, Algorithm_N, Algorithm_X, Algorithm_O));
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
@@ -1125,7 +1360,7 @@ void DS_TableVerifyParms_Test_NGreaterThanXOnlyNNonZero(void)
     uint16 Algorithm_O = 0;
 
     /* Execute the function being tested */
-    UtAssert_BOOL_FALSE(DS_TableVerifyParms(Algorithm_N, Algorithm_X, Algorithm_O));
+    UtAssert_BOOL_FALSE(DS_TableVerifyParms(DS_BY_COUNT, Algorithm_N, Algorithm_X, Algorithm_O));
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
@@ -1138,7 +1373,31 @@ void DS_TableVerifyParms_Test_OGreaterThanXOnlyONonZero(void)
     uint16 Algorithm_O = 1;
 
     /* Execute the function being tested */
-    UtAssert_BOOL_FALSE(DS_TableVerifyParms(Algorithm_N, Algorithm_X, Algorithm_O));
+    UtAssert_BOOL_FALSE(DS_TableVerifyParms(DS_BY_COUNT, Algorithm_N, Algorithm_X, Algorithm_O));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyParms_Test_ByteRateScale(void)
+{
+    /* Execute the function being tested - O is a byte scale, not an offset */
+    UtAssert_BOOL_TRUE(DS_TableVerifyParms(DS_BY_BYTE_RATE, 1, 2, DS_RATE_BYTE_SCALE_MAX));
+    UtAssert_BOOL_FALSE(DS_TableVerifyParms(DS_BY_BYTE_RATE, 1, 2, DS_RATE_BYTE_SCALE_MAX + 1));
+    UtAssert_BOOL_FALSE(DS_TableVerifyParms(DS_BY_BYTE_RATE, 3, 2, 0));
+    UtAssert_BOOL_FALSE(DS_TableVerifyParms(DS_BY_PKT_RATE, 1, 2, DS_RATE_BYTE_SCALE_MAX));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyBurst_Test(void)
+{
+    /* Execute the function being tested - 4 units of 1 KiB */
+    UtAssert_BOOL_TRUE(DS_TableVerifyBurst(DS_BY_BYTE_RATE, 4, 10, 4096));
+    UtAssert_BOOL_FALSE(DS_TableVerifyBurst(DS_BY_BYTE_RATE, 4, 10, 4097));
+    UtAssert_BOOL_TRUE(DS_TableVerifyBurst(DS_BY_BYTE_RATE, 4, 10, 0));
+    UtAssert_BOOL_TRUE(DS_TableVerifyBurst(DS_BY_PKT_RATE, 4, 0, 4097));
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
@@ -1151,7 +1410,7 @@ void DS_TableVerifyParms_Test_AllZero(void)
     uint16 Algorithm_O = 0;
 
     /* Execute the function being tested */
-    UtAssert_BOOL_TRUE(DS_TableVerifyParms(Algorithm_N, Algorithm_X, Algorithm_O));
+    UtAssert_BOOL_TRUE(DS_TableVerifyParms(DS_BY_COUNT, Algorithm_N, Algorithm_X, Algorithm_O));
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
@@ -1179,29 +1438,74 @@ void DS_TableVerifyType_Test_Fail(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_TableVerifyState_Test_NominalEnabled(void)
+void DS_TableVerifyFilterType_Test(void)
 {
-    uint16 EnableState = DS_ENABLED;
-
     /* Execute the function being tested */
-    UtAssert_BOOL_TRUE(DS_TableVerifyState(EnableState));
+    UtAssert_BOOL_TRUE(DS_TableVerifyFilterType(DS_BY_COUNT));
+    UtAssert_BOOL_TRUE(DS_TableVerifyFilterType(DS_BY_TIME));
+    UtAssert_BOOL_TRUE(DS_TableVerifyFilterType(DS_BY_CONTENT));
+    UtAssert_BOOL_TRUE(DS_TableVerifyFilterType(DS_BY_PKT_RATE));
+    UtAssert_BOOL_TRUE(DS_TableVerifyFilterType(DS_BY_BYTE_RATE));
+    UtAssert_BOOL_TRUE(DS_TableVerifyFilterType(DS_BY_PREDICATE));
+    UtAssert_BOOL_FALSE(DS_TableVerifyFilterType(99));
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_TableVerifyState_Test_NominalDisabled(void)
+void DS_TableVerifyPredicate_Test(void)
 {
-    uint16 EnableState = DS_DISABLED;
+    DS_FilterPredicate_t Predicate;
 
-    /* Execute the function being tested */
-    UtAssert_BOOL_TRUE(DS_TableVerifyState(EnableState));
+    memset(&Predicate, 0, sizeof(Predicate));
 
-    /* Verify results */
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
-}
+    /* Execute the function being tested - unused predicate is valid */
+    UtAssert_BOOL_TRUE(DS_TableVerifyPredicate(&Predicate, 0));
 
-void DS_TableVerifyState_Test_Fail(void)
+    Predicate.Offset  = 12;
+    Predicate.Compare = DS_PREDICATE_NOT_EQUAL;
+    Predicate.Mask    = 0xF0;
+    Predicate.Value   = 0x30;
+    UtAssert_BOOL_TRUE(DS_TableVerifyPredicate(&Predicate, 13));
+
+    /* Offset must be inside the shortest packet */
+    UtAssert_BOOL_FALSE(DS_TableVerifyPredicate(&Predicate, 12));
+
+    /* Value bits outside the mask can never be equal */
+    Predicate.Value = 0x31;
+    UtAssert_BOOL_FALSE(DS_TableVerifyPredicate(&Predicate, 13));
+
+    Predicate.Value   = 0x30;
+    Predicate.Compare = 3;
+    UtAssert_BOOL_FALSE(DS_TableVerifyPredicate(&Predicate, 13));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyState_Test_NominalEnabled(void)
+{
+    uint16 EnableState = DS_ENABLED;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_TableVerifyState(EnableState));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyState_Test_NominalDisabled(void)
+{
+    uint16 EnableState = DS_DISABLED;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_TableVerifyState(EnableState));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyState_Test_Fail(void)
 {
     uint16 EnableState = 99;
 
@@ -1278,6 +1582,127 @@ void DS_TableVerifyCount_Test_Fail(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+void DS_TableVerifyBufferSize_Test_Nominal(void)
+{
+    uint32 BufferSize = DS_WRITE_BUFFER_MAX_SIZE;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_TableVerifyBufferSize(BufferSize));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyBufferSize_Test_Fail(void)
+{
+    uint32 BufferSize = DS_WRITE_BUFFER_MAX_SIZE + 1;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyBufferSize(BufferSize));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyPreallocate_Test_Nominal(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_TableVerifyPreallocate(DS_DISABLED));
+    UtAssert_BOOL_TRUE(DS_TableVerifyPreallocate(DS_ENABLED));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyPreallocate_Test_NotAvailable(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(DS_FsExtAllocateAvailable), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_TableVerifyPreallocate(DS_DISABLED));
+    UtAssert_BOOL_FALSE(DS_TableVerifyPreallocate(DS_ENABLED));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyPreallocate_Test_Fail(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyPreallocate(99));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifySync_Test_Nominal(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_TableVerifySync(DS_SYNC_NONE, 0));
+    UtAssert_BOOL_TRUE(DS_TableVerifySync(DS_SYNC_ON_CLOSE, 0) == DS_FILE_SYNC);
+    UtAssert_BOOL_TRUE(DS_TableVerifySync(DS_SYNC_BY_BYTES, 4096) == DS_FILE_SYNC);
+    UtAssert_BOOL_TRUE(DS_TableVerifySync(DS_SYNC_BY_TIME, 10) == DS_FILE_SYNC);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifySync_Test_Fail(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifySync(DS_SYNC_BY_BYTES, 0));
+    UtAssert_BOOL_FALSE(DS_TableVerifySync(DS_SYNC_BY_TIME, 0));
+    UtAssert_BOOL_FALSE(DS_TableVerifySync(99, 10));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyDirectIO_Test_Nominal(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_TableVerifyDirectIO(DS_DISABLED, 0));
+    UtAssert_BOOL_TRUE(DS_TableVerifyDirectIO(DS_ENABLED, DS_DIRECT_IO_BLOCK_SIZE));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyDirectIO_Test_NotAvailable(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(DS_FsExtDirectAvailable), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_TableVerifyDirectIO(DS_DISABLED, 0));
+    UtAssert_BOOL_FALSE(DS_TableVerifyDirectIO(DS_ENABLED, DS_DIRECT_IO_BLOCK_SIZE));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyDirectIO_Test_Fail(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyDirectIO(DS_ENABLED, 0));
+    UtAssert_BOOL_FALSE(DS_TableVerifyDirectIO(DS_ENABLED, DS_DIRECT_IO_BLOCK_SIZE + 4));
+    UtAssert_BOOL_FALSE(DS_TableVerifyDirectIO(99, DS_DIRECT_IO_BLOCK_SIZE));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void UT_DS_ClearHashTable(void)
+{
+    int32 i;
+
+    for (i = 0; i < DS_HASH_TABLE_ENTRIES; i++)
+    {
+        DS_AppData.HashTable[i].MessageID = CFE_SB_INVALID_MSG_ID;
+        DS_AppData.HashTable[i].Index     = DS_HASH_SLOT_EMPTY;
+        DS_AppData.HashTable[i].Retained  = false;
+    }
+}
+
 void DS_TableSubscribe_Test_Unused(void)
 {
     /* Execute the function being tested */
@@ -1370,6 +1795,44 @@ void DS_TableUnsubscribe_Test_Data(void)
     UtAssert_STUB_COUNT(CFE_SB_Unsubscribe, 1);
 }
 
+void DS_TableResubscribe_Test_Nominal(void)
+{
+    CFE_SB_MsgId_t AddedMID = CFE_SB_ValueToMsgId(CFE_SB_MsgIdToValue(DS_UT_MID_2) + 1);
+
+    /* Old table had MID_1 and MID_2 */
+    UT_DS_ClearHashTable();
+    DS_TableAddMsgID(DS_UT_MID_1, 0);
+    DS_TableAddMsgID(DS_UT_MID_2, 1);
+
+    /* New table keeps MID_1, drops MID_2 and adds a third MID */
+    DS_AppData.FilterTblPtr->Packet[0].MessageID = AddedMID;
+    DS_AppData.FilterTblPtr->Packet[1].MessageID = DS_UT_MID_1;
+
+    /* Execute the function being tested */
+    DS_TableResubscribe();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_SubscribeEx, 1);
+    UtAssert_STUB_COUNT(CFE_SB_Unsubscribe, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableResubscribe_Test_Cmd(void)
+{
+    /* DS command packets are never unsubscribed */
+    UT_DS_ClearHashTable();
+    DS_TableAddMsgID(CFE_SB_ValueToMsgId(DS_CMD_MID), 0);
+    DS_TableAddMsgID(CFE_SB_ValueToMsgId(DS_SEND_HK_MID), 1);
+
+    /* Execute the function being tested */
+    DS_TableResubscribe();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_SubscribeEx, 0);
+    UtAssert_STUB_COUNT(CFE_SB_Unsubscribe, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void DS_TableCreateCDS_Test_NewCDSArea(void)
 {
     /* Execute the function being tested */
@@ -1447,6 +1910,28 @@ void DS_TableUpdateCDS_Test_Nominal(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+void DS_TableUpdateCDS_Test_Dirty(void)
+{
+    DS_AppData.DataStoreHandle = DS_UT_CDSHANDLE_1;
+
+    DS_AppData.FileStatus[0].FileCount = 5;
+    DS_AppData.FileStatus[1].FileCount = 5;
+    DS_AppData.DataStoreImage[0]       = 20;
+    DS_AppData.DataStoreImage[1]       = 20;
+
+    DS_TableMarkCDS(1);
+
+    /* Execute the function being tested */
+    DS_TableUpdateCDS();
+
+    /* Verify results - unchanged entry keeps its reservation */
+    UtAssert_UINT32_EQ(DS_AppData.DataStoreImage[0], 20);
+    UtAssert_UINT32_EQ(DS_AppData.DataStoreImage[1], 5);
+    UtAssert_BOOL_FALSE(DS_AppData.DataStoreDirty[1]);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void DS_TableUpdateCDS_Test_Error(void)
 {
     DS_AppData.DataStoreHandle = DS_UT_CDSHANDLE_1;
@@ -1463,6 +1948,89 @@ void DS_TableUpdateCDS_Test_Error(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
+void DS_TableCommitCDS_Test_Clean(void)
+{
+    DS_AppData.DataStoreHandle = DS_UT_CDSHANDLE_1;
+
+    /* Execute the function being tested */
+    DS_TableCommitCDS();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+}
+
+void DS_TableCommitCDS_Test_AppState(void)
+{
+    DS_AppData.DataStoreHandle = DS_UT_CDSHANDLE_1;
+    DS_AppData.AppEnableState  = DS_ENABLED;
+
+    DS_TableMarkCDS(DS_CDS_APP_STATE);
+
+    /* Execute the function being tested */
+    DS_TableCommitCDS();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.DataStoreImage[DS_CDS_APP_STATE], DS_ENABLED);
+    UtAssert_BOOL_FALSE(DS_AppData.DataStoreDirty[DS_CDS_APP_STATE]);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+}
+
+void DS_TableReserveCDS_Test_Reserve(void)
+{
+    DS_AppData.DataStoreHandle         = DS_UT_CDSHANDLE_1;
+    DS_AppData.DataStoreImage[0]       = 10;
+    DS_AppData.FileStatus[0].FileCount = 11;
+
+    /* Execute the function being tested */
+    DS_TableReserveCDS(0);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.DataStoreImage[0], 11 + DS_CDS_SEQ_RESERVE);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+}
+
+void DS_TableReserveCDS_Test_Covered(void)
+{
+    DS_AppData.DataStoreHandle         = DS_UT_CDSHANDLE_1;
+    DS_AppData.DataStoreImage[0]       = 10 + DS_CDS_SEQ_RESERVE;
+    DS_AppData.FileStatus[0].FileCount = 10;
+
+    /* Execute the function being tested */
+    DS_TableReserveCDS(0);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.DataStoreImage[0], 10 + DS_CDS_SEQ_RESERVE);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+}
+
+void DS_TableReserveCDS_Test_Rollover(void)
+{
+    DS_AppData.DataStoreHandle         = DS_UT_CDSHANDLE_1;
+    DS_AppData.DataStoreImage[0]       = DS_MAX_SEQUENCE_COUNT;
+    DS_AppData.FileStatus[0].FileCount = 1;
+
+    /* Execute the function being tested */
+    DS_TableReserveCDS(0);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.DataStoreImage[0], 1 + DS_CDS_SEQ_RESERVE);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+}
+
+void DS_TableReserveCDS_Test_MaxCount(void)
+{
+    DS_AppData.DataStoreHandle         = DS_UT_CDSHANDLE_1;
+    DS_AppData.DataStoreImage[0]       = DS_MAX_SEQUENCE_COUNT - 1;
+    DS_AppData.FileStatus[0].FileCount = DS_MAX_SEQUENCE_COUNT;
+
+    /* Execute the function being tested */
+    DS_TableReserveCDS(0);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.DataStoreImage[0], DS_MAX_SEQUENCE_COUNT);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+}
+
 void DS_TableHashFunction_Test(void)
 {
     CFE_SB_MsgId_t MessageID = DS_UT_MID_1;
@@ -1473,20 +2041,70 @@ void DS_TableHashFunction_Test(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+void DS_TableHashFunction_Test_SharedLowBits(void)
+{
+    uint32 Hash1;
+    uint32 Hash2;
+
+    /* MIDs that differ only above the low 8 bits must not share a preferred slot */
+    Hash1 = DS_TableHashFunction(CFE_SB_ValueToMsgId(0x0887));
+    Hash2 = DS_TableHashFunction(CFE_SB_ValueToMsgId(0x1887));
+
+    /* Verify results */
+    UtAssert_True(Hash1 != Hash2, "Hash1 != Hash2");
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void DS_TableCreateHash_Test_Nominal(void)
 {
-    uint32 HashIndex;
+    int32  i;
+    uint32 SlotsUsed = 0;
+
+    for (i = 0; i < DS_PACKETS_IN_FILTER_TABLE; i++)
+    {
+        DS_AppData.FilterTblPtr->Packet[i].MessageID = CFE_SB_INVALID_MSG_ID;
+    }
 
     DS_AppData.FilterTblPtr->Packet[0].MessageID = DS_UT_MID_1;
-    HashIndex                                    = DS_TableHashFunction(DS_AppData.FilterTblPtr->Packet[0].MessageID);
+    DS_AppData.FilterTblPtr->Packet[5].MessageID = DS_UT_MID_2;
 
     /* Execute the function being tested */
     DS_TableCreateHash();
 
+    /* Verify results - unused filter table entries are not indexed */
+    for (i = 0; i < DS_HASH_TABLE_ENTRIES; i++)
+    {
+        if (DS_AppData.HashTable[i].Index != DS_HASH_SLOT_EMPTY)
+        {
+            SlotsUsed++;
+        }
+    }
+
+    UtAssert_UINT32_EQ(SlotsUsed, 2);
+    UtAssert_INT32_EQ(DS_TableFindMsgID(DS_UT_MID_1), 0);
+    UtAssert_INT32_EQ(DS_TableFindMsgID(DS_UT_MID_2), 5);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableAddMsgID_Test_Collision(void)
+{
+    uint32 HashIndex;
+
+    UT_DS_ClearHashTable();
+
+    HashIndex = DS_TableHashFunction(DS_UT_MID_1);
+
+    DS_AppData.HashTable[HashIndex].MessageID = DS_UT_MID_2;
+    DS_AppData.HashTable[HashIndex].Index     = 3;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_TableAddMsgID(DS_UT_MID_1, 1), (HashIndex + 1) & DS_HASH_TABLE_MASK);
+
     /* Verify results */
-    UtAssert_UINT32_EQ(DS_AppData.HashLinks[0].Index, 0);
-    UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(DS_AppData.HashLinks[0].MessageID, DS_UT_MID_1));
-    UtAssert_ADDRESS_EQ(DS_AppData.HashTable[HashIndex], &DS_AppData.HashLinks[0]);
+    UtAssert_UINT32_EQ(DS_AppData.HashTable[(HashIndex + 1) & DS_HASH_TABLE_MASK].Index, 1);
+    UtAssert_UINT32_EQ(DS_AppData.HashTable[HashIndex].Index, 3);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
@@ -1494,16 +2112,37 @@ void DS_TableCreateHash_Test_Nominal(void)
 void DS_TableFindMsgID_Test(void)
 {
     CFE_SB_MsgId_t MessageID = DS_UT_MID_1;
-    DS_HashLink_t  HashLink;
     uint32         HashIndex;
 
-    HashIndex                                                 = DS_TableHashFunction(MessageID);
-    DS_AppData.HashTable[HashIndex]                           = &HashLink;
-    HashLink.Index                                            = 1;
-    DS_AppData.FilterTblPtr->Packet[HashLink.Index].MessageID = MessageID;
+    UT_DS_ClearHashTable();
+
+    HashIndex                                 = DS_TableHashFunction(MessageID);
+    DS_AppData.HashTable[HashIndex].MessageID = MessageID;
+    DS_AppData.HashTable[HashIndex].Index     = 1;
 
     /* Execute the function being tested */
-    UtAssert_INT32_EQ(DS_TableFindMsgID(MessageID), HashLink.Index);
+    UtAssert_INT32_EQ(DS_TableFindMsgID(MessageID), 1);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableFindMsgID_Test_Collision(void)
+{
+    CFE_SB_MsgId_t MessageID = DS_UT_MID_1;
+    uint32         HashIndex;
+
+    UT_DS_ClearHashTable();
+
+    HashIndex = DS_TableHashFunction(MessageID);
+
+    DS_AppData.HashTable[HashIndex].MessageID                             = DS_UT_MID_2;
+    DS_AppData.HashTable[HashIndex].Index                                 = 3;
+    DS_AppData.HashTable[(HashIndex + 1) & DS_HASH_TABLE_MASK].MessageID = MessageID;
+    DS_AppData.HashTable[(HashIndex + 1) & DS_HASH_TABLE_MASK].Index     = 1;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_TableFindMsgID(MessageID), 1);
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
@@ -1513,10 +2152,7 @@ void DS_TableFindMsgID_Test_NullTable(void)
 {
     CFE_SB_MsgId_t MessageID = DS_UT_MID_1;
 
-    for (int i = 0; i < DS_HASH_TABLE_ENTRIES; i++)
-    {
-        DS_AppData.HashTable[i] = NULL;
-    }
+    UT_DS_ClearHashTable();
 
     /* Execute the function being tested */
     UtAssert_INT32_EQ(DS_TableFindMsgID(MessageID), DS_INDEX_NONE);
@@ -1528,16 +2164,13 @@ void DS_TableFindMsgID_Test_NullTable(void)
 void DS_TableFindMsgID_Test_Mismatch(void)
 {
     CFE_SB_MsgId_t MessageID = DS_UT_MID_1;
-    DS_HashLink_t  HashLink;
     uint32         HashIndex;
 
-    HashIndex                       = DS_TableHashFunction(MessageID);
-    DS_AppData.HashTable[HashIndex] = &HashLink;
-
-    HashLink.Index = 1;
-    HashLink.Next  = NULL;
+    UT_DS_ClearHashTable();
 
-    DS_AppData.FilterTblPtr->Packet[HashLink.Index].MessageID = DS_UT_MID_2;
+    HashIndex                                 = DS_TableHashFunction(MessageID);
+    DS_AppData.HashTable[HashIndex].MessageID = DS_UT_MID_2;
+    DS_AppData.HashTable[HashIndex].Index     = 1;
 
     /* Execute the function being tested */
     UtAssert_INT32_EQ(DS_TableFindMsgID(MessageID), DS_INDEX_NONE);
@@ -1546,6 +2179,324 @@ void DS_TableFindMsgID_Test_Mismatch(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+void DS_TableRemoveMsgID_Test_Nominal(void)
+{
+    uint32 HashIndex;
+
+    UT_DS_ClearHashTable();
+
+    HashIndex = DS_TableHashFunction(DS_UT_MID_1);
+
+    DS_AppData.HashTable[HashIndex].MessageID = DS_UT_MID_1;
+    DS_AppData.HashTable[HashIndex].Index     = 1;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_TableRemoveMsgID(DS_UT_MID_1), HashIndex);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.HashTable[HashIndex].Index, DS_HASH_SLOT_EMPTY);
+    UtAssert_INT32_EQ(DS_TableFindMsgID(DS_UT_MID_1), DS_INDEX_NONE);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableRemoveMsgID_Test_ShiftBack(void)
+{
+    CFE_SB_MsgId_t MessageID;
+    uint32         HashIndex;
+    uint32         Value;
+
+    UT_DS_ClearHashTable();
+
+    /* Find a second MID with the same preferred slot as MID_1 */
+    HashIndex = DS_TableHashFunction(DS_UT_MID_1);
+    Value     = CFE_SB_MsgIdToValue(DS_UT_MID_1);
+
+    do
+    {
+        Value++;
+        MessageID = CFE_SB_ValueToMsgId(Value);
+    } while (DS_TableHashFunction(MessageID) != HashIndex);
+
+    DS_TableAddMsgID(DS_UT_MID_1, 1);
+    DS_TableAddMsgID(MessageID, 2);
+
+    /* Execute the function being tested */
+    DS_TableRemoveMsgID(DS_UT_MID_1);
+
+    /* Verify results - displaced MID moves back into its preferred slot */
+    UtAssert_UINT32_EQ(DS_AppData.HashTable[HashIndex].Index, 2);
+    UtAssert_UINT32_EQ(DS_AppData.HashTable[(HashIndex + 1) & DS_HASH_TABLE_MASK].Index, DS_HASH_SLOT_EMPTY);
+    UtAssert_INT32_EQ(DS_TableFindMsgID(DS_UT_MID_1), DS_INDEX_NONE);
+    UtAssert_INT32_EQ(DS_TableFindMsgID(MessageID), 2);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableRemoveMsgID_Test_NotFound(void)
+{
+    uint32 HashIndex;
+
+    UT_DS_ClearHashTable();
+
+    HashIndex = DS_TableHashFunction(DS_UT_MID_1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_TableRemoveMsgID(DS_UT_MID_1), DS_INDEX_NONE);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.HashTable[HashIndex].Index, DS_HASH_SLOT_EMPTY);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableAllocEntry_Test_Nominal(void)
+{
+    int32 i;
+
+    for (i = 0; i < DS_PACKETS_IN_FILTER_TABLE; i++)
+    {
+        DS_AppData.FilterTblPtr->Packet[i].MessageID = DS_UT_MID_1;
+    }
+
+    DS_AppData.FilterTblPtr->Packet[3].MessageID = CFE_SB_INVALID_MSG_ID;
+    DS_AppData.FilterTblPtr->Packet[7].MessageID = CFE_SB_INVALID_MSG_ID;
+
+    DS_TableCreateHash();
+
+    /* Execute the function being tested - lowest unused entries first */
+    UtAssert_INT32_EQ(DS_TableAllocEntry(), 3);
+    UtAssert_INT32_EQ(DS_TableAllocEntry(), 7);
+    UtAssert_INT32_EQ(DS_TableAllocEntry(), DS_INDEX_NONE);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableFreeEntry_Test_Nominal(void)
+{
+    DS_AppData.FreeEntryHead = DS_INDEX_NONE;
+
+    /* Execute the function being tested */
+    DS_TableFreeEntry(5);
+    DS_TableFreeEntry(2);
+
+    /* Verify results - most recently freed entry is allocated first */
+    UtAssert_INT32_EQ(DS_TableAllocEntry(), 2);
+    UtAssert_INT32_EQ(DS_TableAllocEntry(), 5);
+    UtAssert_INT32_EQ(DS_TableAllocEntry(), DS_INDEX_NONE);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableCreateHash_Test_Routes(void)
+{
+    DS_AppData.FilterTblPtr->Packet[0].MessageID             = DS_UT_MID_1;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_N = 1;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_X = 2;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].FilterType  = DS_BY_COUNT;
+
+    DS_AppData.RoutePlan[1].FilterCount = 1;
+    DS_AppData.DuplicatePktCounter[0]   = 5;
+
+    /* Execute the function being tested */
+    DS_TableCreateHash();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.RoutePlan[0].FilterCount, 1);
+    UtAssert_UINT32_EQ(DS_AppData.RoutePlan[1].FilterCount, 0);
+    UtAssert_UINT32_EQ(DS_AppData.DuplicatePktCounter[0], 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableCompileRoute_Test_Nominal(void)
+{
+    DS_PacketEntry_t *PacketEntry = &DS_AppData.FilterTblPtr->Packet[0];
+
+    /* Filter 0 is unused, filter 1 is active, filter 2 has invalid parms, filter 3 is active */
+    PacketEntry->Filter[1].FileTableIndex = 2;
+    PacketEntry->Filter[1].FilterType     = DS_BY_TIME;
+    PacketEntry->Filter[1].Algorithm_N    = 1;
+    PacketEntry->Filter[1].Algorithm_X    = 4;
+    PacketEntry->Filter[1].Algorithm_O    = 3;
+
+    PacketEntry->Filter[2].FileTableIndex = 1;
+    PacketEntry->Filter[2].FilterType     = DS_BY_COUNT;
+    PacketEntry->Filter[2].Algorithm_N    = 2;
+    PacketEntry->Filter[2].Algorithm_X    = 1;
+
+    PacketEntry->Filter[3].FileTableIndex = 1;
+    PacketEntry->Filter[3].FilterType     = DS_BY_CONTENT;
+    PacketEntry->Filter[3].Algorithm_N    = 1;
+    PacketEntry->Filter[3].Algorithm_X    = 1;
+
+    DS_AppData.RoutePlan[0].Filter[1].Primed = true;
+
+    /* Execute the function being tested */
+    DS_TableCompileRoute(0);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.RoutePlan[0].FilterCount, 2);
+    UtAssert_UINT32_EQ(DS_AppData.RoutePlan[0].Filter[0].FileIndex, 2);
+    UtAssert_UINT32_EQ(DS_AppData.RoutePlan[0].Filter[0].FilterType, DS_BY_TIME);
+    UtAssert_UINT32_EQ(DS_AppData.RoutePlan[0].Filter[0].Algorithm_N, 1);
+    UtAssert_UINT32_EQ(DS_AppData.RoutePlan[0].Filter[0].Algorithm_X, 4);
+    UtAssert_UINT32_EQ(DS_AppData.RoutePlan[0].Filter[0].Algorithm_O, 3);
+    UtAssert_UINT32_EQ(DS_AppData.RoutePlan[0].Filter[0].Reciprocal, 0x40000000);
+    UtAssert_UINT32_EQ(DS_AppData.RoutePlan[0].Filter[1].FileIndex, 1);
+    UtAssert_UINT32_EQ(DS_AppData.RoutePlan[0].Filter[1].FilterType, DS_BY_CONTENT);
+    UtAssert_BOOL_FALSE(DS_AppData.RoutePlan[0].Filter[1].Primed);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableCompileRoute_Test_Predicates(void)
+{
+    DS_PacketEntry_t *PacketEntry = &DS_AppData.FilterTblPtr->Packet[0];
+
+    PacketEntry->Filter[0].FileTableIndex = 1;
+    PacketEntry->Filter[0].FilterType     = DS_BY_PREDICATE;
+    PacketEntry->Filter[0].Algorithm_N    = 1;
+    PacketEntry->Filter[0].Algorithm_X    = 1;
+
+    /* Predicate 0 is past the minimum length, predicate 2 is unused */
+    PacketEntry->MinLength            = 16;
+    PacketEntry->Predicate[0].Offset  = 20;
+    PacketEntry->Predicate[0].Compare = DS_PREDICATE_EQUAL;
+    PacketEntry->Predicate[0].Mask    = 0xFF;
+    PacketEntry->Predicate[1].Offset  = 12;
+    PacketEntry->Predicate[1].Compare = DS_PREDICATE_NOT_EQUAL;
+    PacketEntry->Predicate[1].Mask    = 0x01;
+    PacketEntry->Predicate[3].Offset  = 13;
+    PacketEntry->Predicate[3].Compare = DS_PREDICATE_EQUAL;
+    PacketEntry->Predicate[3].Mask    = 0xFF;
+    PacketEntry->Predicate[3].Value   = 0x42;
+
+    /* Execute the function being tested */
+    DS_TableCompileRoute(0);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.RoutePlan[0].FilterCount, 1);
+    UtAssert_UINT32_EQ(DS_AppData.RoutePlan[0].MinLength, 16);
+    UtAssert_UINT32_EQ(DS_AppData.RoutePlan[0].PredicateCount, 2);
+    UtAssert_UINT32_EQ(DS_AppData.RoutePlan[0].Predicate[0].Offset, 12);
+    UtAssert_BOOL_FALSE(DS_AppData.RoutePlan[0].Predicate[0].Expect);
+    UtAssert_UINT32_EQ(DS_AppData.RoutePlan[0].Predicate[1].Value, 0x42);
+    UtAssert_BOOL_TRUE(DS_AppData.RoutePlan[0].Predicate[1].Expect);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableCompileRoute_Test_NoPredicates(void)
+{
+    DS_PacketEntry_t *PacketEntry = &DS_AppData.FilterTblPtr->Packet[0];
+
+    PacketEntry->Filter[0].FileTableIndex = 1;
+    PacketEntry->Filter[0].FilterType     = DS_BY_PREDICATE;
+    PacketEntry->Filter[0].Algorithm_N    = 1;
+    PacketEntry->Filter[0].Algorithm_X    = 1;
+
+    /* Execute the function being tested */
+    DS_TableCompileRoute(0);
+
+    /* Verify results - a predicate filter without predicates is omitted */
+    UtAssert_UINT32_EQ(DS_AppData.RoutePlan[0].FilterCount, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableCompileRoute_Test_InvalidFilters(void)
+{
+    DS_PacketEntry_t *PacketEntry = &DS_AppData.FilterTblPtr->Packet[0];
+
+    /* Invalid file index */
+    PacketEntry->Filter[0].FileTableIndex = DS_DEST_FILE_CNT;
+    PacketEntry->Filter[0].FilterType     = DS_BY_COUNT;
+    PacketEntry->Filter[0].Algorithm_N    = 1;
+    PacketEntry->Filter[0].Algorithm_X    = 1;
+
+    /* Invalid filter type */
+    PacketEntry->Filter[1].FilterType  = 99;
+    PacketEntry->Filter[1].Algorithm_N = 1;
+    PacketEntry->Filter[1].Algorithm_X = 1;
+
+    /* Invalid offset */
+    PacketEntry->Filter[2].FilterType  = DS_BY_TIME;
+    PacketEntry->Filter[2].Algorithm_N = 1;
+    PacketEntry->Filter[2].Algorithm_X = 2;
+    PacketEntry->Filter[2].Algorithm_O = 2;
+
+    DS_AppData.RoutePlan[0].FilterCount = DS_FILTERS_PER_PACKET;
+
+    /* Execute the function being tested */
+    DS_TableCompileRoute(0);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.RoutePlan[0].FilterCount, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyIndex_Test(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_TableVerifyIndex(0, 0));
+    UtAssert_BOOL_TRUE(DS_TableVerifyIndex(4096, 0) == (DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE));
+    UtAssert_BOOL_TRUE(DS_TableVerifyIndex(0, 60) == (DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyCodec_Test_Nominal(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_TableVerifyCodec(DS_CODEC_NONE, 0, DS_ENABLED, true));
+    UtAssert_BOOL_TRUE(DS_TableVerifyCodec(DS_CODEC_LZ_FAST, 4096, DS_DISABLED, false) == DS_FILE_COMPRESSION);
+    UtAssert_BOOL_TRUE(DS_TableVerifyCodec(DS_CODEC_LZ_HIGH, 4096, DS_DISABLED, false) == DS_FILE_COMPRESSION);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyDelta_Test(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_TableVerifyDelta(0, true));
+    UtAssert_BOOL_TRUE(DS_TableVerifyDelta(10, false));
+    UtAssert_BOOL_FALSE(DS_TableVerifyDelta(10, true));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifySuperframe_Test(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_TableVerifySuperframe(0, 10, true));
+    UtAssert_BOOL_TRUE(DS_TableVerifySuperframe(DS_SUPERFRAME_MIN_SIZE, 0, false));
+    UtAssert_BOOL_TRUE(DS_TableVerifySuperframe(DS_SUPERFRAME_MAX_SIZE, 0, false));
+    UtAssert_BOOL_FALSE(DS_TableVerifySuperframe(DS_SUPERFRAME_MIN_SIZE - 1, 0, false));
+    UtAssert_BOOL_FALSE(DS_TableVerifySuperframe(DS_SUPERFRAME_MAX_SIZE + 1, 0, false));
+    UtAssert_BOOL_FALSE(DS_TableVerifySuperframe(DS_SUPERFRAME_MIN_SIZE, 10, false));
+    UtAssert_BOOL_FALSE(DS_TableVerifySuperframe(DS_SUPERFRAME_MIN_SIZE, 0, true));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyCodec_Test_Fail(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyCodec(DS_CODEC_COUNT, 4096, DS_DISABLED, false));
+    UtAssert_BOOL_FALSE(DS_TableVerifyCodec(DS_CODEC_LZ_FAST, 0, DS_DISABLED, false));
+    UtAssert_BOOL_FALSE(DS_TableVerifyCodec(DS_CODEC_LZ_FAST, 4096, DS_ENABLED, false));
+    UtAssert_BOOL_FALSE(DS_TableVerifyCodec(DS_CODEC_LZ_HIGH, 4096, DS_DISABLED, true));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void UtTest_Setup(void)
 {
     UT_DS_TEST_ADD(DS_TableInit_Test_Nominal);
@@ -1578,12 +2529,20 @@ void UtTest_Setup(void)
     UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidSizeErrZero);
     UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidAgeErrZero);
     UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidSequenceCountErrZero);
+    UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidBufferSizeErrZero);
+    UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidPreallocateErrZero);
+    UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidSyncErrZero);
+    UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidDirectIOErrZero);
+    UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidCodecErrZero);
+    UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidDeltaErrZero);
+    UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidSuperframeErrZero);
 
     UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidFilenameTypeErrNonZero);
     UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidFileEnableStateErrNonZero);
     UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidSizeErrNonZero);
     UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidAgeErrNonZero);
     UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidSequenceCountErrNonZero);
+    UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidBufferSizeErrNonZero);
 
     UT_DS_TEST_ADD(DS_TableVerifyFilter_Test_Nominal);
     UT_DS_TEST_ADD(DS_TableVerifyFilter_Test_FilterTableVerificationError);
@@ -1594,9 +2553,14 @@ void UtTest_Setup(void)
     UT_DS_TEST_ADD(DS_TableVerifyFilterEntry_Test_InvalidFileTableIndexErrZero);
     UT_DS_TEST_ADD(DS_TableVerifyFilterEntry_Test_InvalidFilterTypeErrZero);
     UT_DS_TEST_ADD(DS_TableVerifyFilterEntry_Test_InvalidFilterParmsErrZero);
+    UT_DS_TEST_ADD(DS_TableVerifyFilterEntry_Test_ByteRateBurstErrZero);
     UT_DS_TEST_ADD(DS_TableVerifyFilterEntry_Test_InvalidFileTableIndexErrNonZero);
     UT_DS_TEST_ADD(DS_TableVerifyFilterEntry_Test_InvalidFilterTypeErrNonZero);
     UT_DS_TEST_ADD(DS_TableVerifyFilterEntry_Test_InvalidFilterParmsErrNonZero);
+    UT_DS_TEST_ADD(DS_TableVerifyFilterEntry_Test_Predicates);
+    UT_DS_TEST_ADD(DS_TableVerifyFilterEntry_Test_InvalidPredicateErrZero);
+    UT_DS_TEST_ADD(DS_TableVerifyFilterEntry_Test_NoPredicatesErrZero);
+    UT_DS_TEST_ADD(DS_TableVerifyFilterEntry_Test_InvalidPredicateErrNonZero);
 
     UT_DS_TEST_ADD(DS_TableEntryUnused_Test_Nominal);
     UT_DS_TEST_ADD(DS_TableEntryUnused_Test_Fail);
@@ -1608,9 +2572,13 @@ void UtTest_Setup(void)
     UT_DS_TEST_ADD(DS_TableVerifyParms_Test_NGreaterThanXOnlyNNonZero);
     UT_DS_TEST_ADD(DS_TableVerifyParms_Test_OGreaterThanXOnlyONonZero);
     UT_DS_TEST_ADD(DS_TableVerifyParms_Test_AllZero);
+    UT_DS_TEST_ADD(DS_TableVerifyParms_Test_ByteRateScale);
+    UT_DS_TEST_ADD(DS_TableVerifyBurst_Test);
 
     UT_DS_TEST_ADD(DS_TableVerifyType_Test_Nominal);
     UT_DS_TEST_ADD(DS_TableVerifyType_Test_Fail);
+    UT_DS_TEST_ADD(DS_TableVerifyFilterType_Test);
+    UT_DS_TEST_ADD(DS_TableVerifyPredicate_Test);
 
     UT_DS_TEST_ADD(DS_TableVerifyState_Test_NominalEnabled);
     UT_DS_TEST_ADD(DS_TableVerifyState_Test_NominalDisabled);
@@ -1625,6 +2593,23 @@ void UtTest_Setup(void)
     UT_DS_TEST_ADD(DS_TableVerifyCount_Test_Nominal);
     UT_DS_TEST_ADD(DS_TableVerifyCount_Test_Fail);
 
+    UT_DS_TEST_ADD(DS_TableVerifyBufferSize_Test_Nominal);
+    UT_DS_TEST_ADD(DS_TableVerifyBufferSize_Test_Fail);
+
+    UT_DS_TEST_ADD(DS_TableVerifyPreallocate_Test_Nominal);
+    UT_DS_TEST_ADD(DS_TableVerifyPreallocate_Test_Fail);
+    UT_DS_TEST_ADD(DS_TableVerifyPreallocate_Test_NotAvailable);
+    UT_DS_TEST_ADD(DS_TableVerifySync_Test_Nominal);
+    UT_DS_TEST_ADD(DS_TableVerifySync_Test_Fail);
+    UT_DS_TEST_ADD(DS_TableVerifyDirectIO_Test_Nominal);
+    UT_DS_TEST_ADD(DS_TableVerifyDirectIO_Test_Fail);
+    UT_DS_TEST_ADD(DS_TableVerifyDirectIO_Test_NotAvailable);
+    UT_DS_TEST_ADD(DS_TableVerifyIndex_Test);
+    UT_DS_TEST_ADD(DS_TableVerifyCodec_Test_Nominal);
+    UT_DS_TEST_ADD(DS_TableVerifyCodec_Test_Fail);
+    UT_DS_TEST_ADD(DS_TableVerifyDelta_Test);
+    UT_DS_TEST_ADD(DS_TableVerifySuperframe_Test);
+
     UT_DS_TEST_ADD(DS_TableSubscribe_Test_Unused);
     UT_DS_TEST_ADD(DS_TableSubscribe_Test_Cmd);
     UT_DS_TEST_ADD(DS_TableSubscribe_Test_SendHk);
@@ -1635,20 +2620,49 @@ void UtTest_Setup(void)
     UT_DS_TEST_ADD(DS_TableUnsubscribe_Test_SendHk);
     UT_DS_TEST_ADD(DS_TableUnsubscribe_Test_Data);
 
+    UT_DS_TEST_ADD(DS_TableResubscribe_Test_Nominal);
+    UT_DS_TEST_ADD(DS_TableResubscribe_Test_Cmd);
+
     UT_DS_TEST_ADD(DS_TableCreateCDS_Test_NewCDSArea);
     UT_DS_TEST_ADD(DS_TableCreateCDS_Test_PreExistingCDSArea);
     UT_DS_TEST_ADD(DS_TableCreateCDS_Test_RestoreFail);
     UT_DS_TEST_ADD(DS_TableCreateCDS_Test_Error);
 
     UT_DS_TEST_ADD(DS_TableUpdateCDS_Test_Nominal);
+    UT_DS_TEST_ADD(DS_TableUpdateCDS_Test_Dirty);
     UT_DS_TEST_ADD(DS_TableUpdateCDS_Test_Error);
 
+    UT_DS_TEST_ADD(DS_TableCommitCDS_Test_Clean);
+    UT_DS_TEST_ADD(DS_TableCommitCDS_Test_AppState);
+
+    UT_DS_TEST_ADD(DS_TableReserveCDS_Test_Reserve);
+    UT_DS_TEST_ADD(DS_TableReserveCDS_Test_Covered);
+    UT_DS_TEST_ADD(DS_TableReserveCDS_Test_Rollover);
+    UT_DS_TEST_ADD(DS_TableReserveCDS_Test_MaxCount);
+
     UT_DS_TEST_ADD(DS_TableHashFunction_Test);
+    UT_DS_TEST_ADD(DS_TableHashFunction_Test_SharedLowBits);
 
     UT_DS_TEST_ADD(DS_TableCreateHash_Test_Nominal);
 
+    UT_DS_TEST_ADD(DS_TableAddMsgID_Test_Collision);
+
     UT_DS_TEST_ADD(DS_TableFindMsgID_Test);
+    UT_DS_TEST_ADD(DS_TableFindMsgID_Test_Collision);
     UT_DS_TEST_ADD(DS_TableFindMsgID_Test_NullTable);
 
     UT_DS_TEST_ADD(DS_TableFindMsgID_Test_Mismatch);
+
+    UT_DS_TEST_ADD(DS_TableRemoveMsgID_Test_Nominal);
+    UT_DS_TEST_ADD(DS_TableRemoveMsgID_Test_ShiftBack);
+    UT_DS_TEST_ADD(DS_TableRemoveMsgID_Test_NotFound);
+
+    UT_DS_TEST_ADD(DS_TableAllocEntry_Test_Nominal);
+    UT_DS_TEST_ADD(DS_TableFreeEntry_Test_Nominal);
+
+    UT_DS_TEST_ADD(DS_TableCreateHash_Test_Routes);
+    UT_DS_TEST_ADD(DS_TableCompileRoute_Test_Nominal);
+    UT_DS_TEST_ADD(DS_TableCompileRoute_Test_InvalidFilters);
+    UT_DS_TEST_ADD(DS_TableCompileRoute_Test_Predicates);
+    UT_DS_TEST_ADD(DS_TableCompileRoute_Test_NoPredicates);
 }
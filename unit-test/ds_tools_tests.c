@@ -0,0 +1,326 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,917-1, and identified as “CFS Data Storage
+ * (DS) application version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   This file contains round trip tests for the ground tool decoders in the
+ *   tools directory: data is written by the functions in the file ds_file.c
+ *   and decoded by the ground tool decoders
+ */
+
+/*
+ * Includes
+ */
+
+#include "ds_app.h"
+#include "ds_appdefs.h"
+#include "ds_codec.h"
+#include "ds_file.h"
+#include "ds_test_utils.h"
+#include "ds_tools.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Helper Functions
+ */
+
+#define UT_DS_TOOLS_MAX_SIZE 4096
+
+FILE *UT_DS_ToolsWritten;  /* Bytes written to the destination file */
+FILE *UT_DS_ToolsExpected; /* Packets as given to DS */
+FILE *UT_DS_ToolsDecoded;  /* Ground tool output */
+
+uint8 UT_DS_ToolsExpectedData[UT_DS_TOOLS_MAX_SIZE];
+uint8 UT_DS_ToolsDecodedData[UT_DS_TOOLS_MAX_SIZE];
+uint8 UT_DS_ToolsWrittenData[UT_DS_TOOLS_MAX_SIZE];
+
+union
+{
+    CFE_SB_Buffer_t Buf;
+    uint8           Bytes[64];
+} UT_DS_ToolsPacket;
+
+/* Appends destination file writes to a host temporary file */
+void UT_OS_write_CaptureHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const void *buffer = UT_Hook_GetArgValueByName(Context, "buffer", const void *);
+    size_t      nbytes = UT_Hook_GetArgValueByName(Context, "nbytes", size_t);
+    int32       Status = (int32)fwrite(buffer, 1, nbytes, UT_DS_ToolsWritten);
+
+    UT_Stub_SetReturnValue(FuncKey, Status);
+}
+
+/* Computes block CRCs the way the cFE does, so the ground tool can check them */
+void UT_CFE_ES_CalculateCRC_Handler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const void *DataPtr    = UT_Hook_GetArgValueByName(Context, "DataPtr", const void *);
+    size_t      DataLength = UT_Hook_GetArgValueByName(Context, "DataLength", size_t);
+    uint32      Crc        = DS_CodecCrc16(DataPtr, DataLength);
+
+    UT_Stub_SetReturnValue(FuncKey, Crc);
+}
+
+void UT_DS_ToolsSetup(void)
+{
+    DS_Test_Setup();
+
+    UT_DS_ToolsWritten  = tmpfile();
+    UT_DS_ToolsExpected = tmpfile();
+    UT_DS_ToolsDecoded  = tmpfile();
+
+    UT_SetHandlerFunction(UT_KEY(OS_write), &UT_OS_write_CaptureHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_ES_CalculateCRC), &UT_CFE_ES_CalculateCRC_Handler, NULL);
+
+    DS_AppData.FileStatus[0].FileHandle = DS_UT_OBJID_1;
+    DS_AppData.FileStatus[0].FileState  = DS_ENABLED;
+}
+
+void UT_DS_ToolsTearDown(void)
+{
+    fclose(UT_DS_ToolsWritten);
+    fclose(UT_DS_ToolsExpected);
+    fclose(UT_DS_ToolsDecoded);
+
+    DS_Test_TearDown();
+}
+
+#define UT_DS_TOOLS_TEST_ADD(test) UtTest_Add(test, UT_DS_ToolsSetup, UT_DS_ToolsTearDown, #test)
+
+/* Reads a whole temporary file back */
+size_t UT_DS_ToolsReadAll(FILE *File, uint8 *Data)
+{
+    rewind(File);
+
+    return fread(Data, 1, UT_DS_TOOLS_MAX_SIZE, File);
+}
+
+/* Stores one packet with a counter that changes from packet to packet */
+void UT_DS_ToolsStorePacket(uint32 MessageValue, uint32 Length, uint8 Counter)
+{
+    CFE_SB_MsgId_t MessageID = CFE_SB_ValueToMsgId(MessageValue);
+    uint32         i;
+
+    for (i = 0; i < Length; i++)
+    {
+        UT_DS_ToolsPacket.Bytes[i] = (uint8)(MessageValue + i);
+    }
+
+    UT_DS_ToolsPacket.Bytes[12] = Counter;
+    UT_DS_ToolsPacket.Bytes[13] = Counter * 3;
+
+    fwrite(UT_DS_ToolsPacket.Bytes, 1, Length, UT_DS_ToolsExpected);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MessageID, sizeof(MessageID), true);
+    DS_FileWritePacket(0, &UT_DS_ToolsPacket.Buf, Length);
+}
+
+/* Stores data through the write buffer of a compressed destination */
+void UT_DS_ToolsStoreData(const uint8 *Data, uint32 Length)
+{
+    fwrite(Data, 1, Length, UT_DS_ToolsExpected);
+
+    DS_FileWriteData(0, Data, Length);
+}
+
+/* Writes five blocks: two compressed buffers of similar packets, a short
+   buffer flushed by an oversize chunk of noise that is stored as-is, and
+   the buffer left at the end */
+void UT_DS_ToolsStoreBlocks(void)
+{
+    static uint8 Noise[600];
+    uint32       Seed = 12345;
+    uint32       i;
+
+    DS_AppData.FileStatus[0].Codec                = DS_CODEC_LZ_HIGH;
+    DS_AppData.DestFileTblPtr->File[0].BufferSize = 256;
+
+    for (i = 0; i < sizeof(Noise); i++)
+    {
+        Seed     = (Seed * 1103515245) + 12345;
+        Noise[i] = (uint8)(Seed >> 16);
+    }
+
+    for (i = 0; i < 12; i++)
+    {
+        memset(UT_DS_ToolsPacket.Bytes, 0x5A, 48);
+        UT_DS_ToolsPacket.Bytes[12] = (uint8)i;
+        UT_DS_ToolsStoreData(UT_DS_ToolsPacket.Bytes, 48);
+    }
+
+    UT_DS_ToolsStoreData(Noise, sizeof(Noise));
+    UT_DS_ToolsStoreData(UT_DS_ToolsPacket.Bytes, 48);
+    UT_DS_ToolsStoreData(UT_DS_ToolsPacket.Bytes, 48);
+
+    DS_FileFlushBuffer(0);
+}
+
+/* Decodes the written bytes and compares them with the stored packets */
+void UT_DS_ToolsCheckDecoded(void)
+{
+    size_t ExpectedLength = UT_DS_ToolsReadAll(UT_DS_ToolsExpected, UT_DS_ToolsExpectedData);
+    size_t DecodedLength  = UT_DS_ToolsReadAll(UT_DS_ToolsDecoded, UT_DS_ToolsDecodedData);
+
+    UtAssert_UINT32_EQ(DecodedLength, ExpectedLength);
+    UtAssert_MemCmp(UT_DS_ToolsDecodedData, UT_DS_ToolsExpectedData, ExpectedLength, "Decoded packets");
+}
+
+/*
+ * Function Definitions
+ */
+
+void DS_DeltaDecodeFile_Test_RoundTrip(void)
+{
+    unsigned long Records = 0;
+
+    DS_AppData.FileStatus[0].DeltaKeyframe = 3;
+
+    /* Keyframes, XOR records against each message ID, a keyframe after
+       DeltaKeyframe packets and a keyframe when the length changes */
+    UT_DS_ToolsStorePacket(0x0801, 32, 0);
+    UT_DS_ToolsStorePacket(0x0801, 32, 1);
+    UT_DS_ToolsStorePacket(0x0802, 24, 0);
+    UT_DS_ToolsStorePacket(0x0801, 32, 2);
+    UT_DS_ToolsStorePacket(0x0801, 32, 3);
+    UT_DS_ToolsStorePacket(0x0802, 24, 1);
+    UT_DS_ToolsStorePacket(0x0801, 40, 4);
+    UT_DS_ToolsStorePacket(0x0801, 40, 5);
+    UT_DS_ToolsStorePacket(0x0802, 24, 1);
+
+    /* Every packet was written, some of them as XOR records */
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(DS_AppData.FileStatus[0].FileHandle));
+    UtAssert_UINT32_LT(DS_AppData.FileStatus[0].DeltaOutBytes,
+                       DS_AppData.FileStatus[0].DeltaInBytes + (9 * sizeof(DS_DeltaRecord_t)));
+
+    /* Execute the function being tested */
+    rewind(UT_DS_ToolsWritten);
+    UtAssert_INT32_EQ(DS_DeltaDecodeFile(UT_DS_ToolsWritten, UT_DS_ToolsDecoded, &Records), EXIT_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Records, 9);
+    UT_DS_ToolsCheckDecoded();
+}
+
+void DS_DeltaDecodeFile_Test_Truncated(void)
+{
+    unsigned long Records   = 0;
+    FILE *        Truncated = tmpfile();
+    size_t        Length;
+
+    DS_AppData.FileStatus[0].DeltaKeyframe = 3;
+
+    UT_DS_ToolsStorePacket(0x0801, 32, 0);
+
+    /* Lose the end of the keyframe */
+    Length = UT_DS_ToolsReadAll(UT_DS_ToolsWritten, UT_DS_ToolsDecodedData);
+    fwrite(UT_DS_ToolsDecodedData, 1, Length - 16, Truncated);
+
+    /* Execute the function being tested */
+    rewind(Truncated);
+    UtAssert_INT32_EQ(DS_DeltaDecodeFile(Truncated, UT_DS_ToolsDecoded, &Records), EXIT_FAILURE);
+    fclose(Truncated);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Records, 0);
+}
+
+void DS_CodecCrc16_Test(void)
+{
+    /* CRC-16/ARC check value */
+    UtAssert_UINT32_EQ(DS_CodecCrc16("123456789", 9), 0xBB3D);
+    UtAssert_UINT32_EQ(DS_CodecCrc16("", 0), 0);
+}
+
+#if (DS_FILE_COMPRESSION == true)
+void DS_CodecDecodeFile_Test_RoundTrip(void)
+{
+    unsigned long Blocks = 0;
+    unsigned long Errors = 0;
+
+    UT_DS_ToolsStoreBlocks();
+
+    /* Every byte was written and the packets were compressed */
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(DS_AppData.FileStatus[0].FileHandle));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[0].CodecInBytes, (14 * 48) + 600);
+    UtAssert_UINT32_LT(DS_AppData.FileStatus[0].CodecOutBytes, DS_AppData.FileStatus[0].CodecInBytes);
+
+    /* Execute the function being tested */
+    rewind(UT_DS_ToolsWritten);
+    UtAssert_INT32_EQ(DS_CodecDecodeFile(UT_DS_ToolsWritten, UT_DS_ToolsDecoded, &Blocks, &Errors), EXIT_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Blocks, 5);
+    UtAssert_UINT32_EQ(Errors, 0);
+    UT_DS_ToolsCheckDecoded();
+}
+
+void DS_CodecDecodeFile_Test_Corrupted(void)
+{
+    unsigned long   Blocks    = 0;
+    unsigned long   Errors    = 0;
+    FILE *          Corrupted = tmpfile();
+    DS_CodecFrame_t Frame;
+    size_t          Length;
+    size_t          ExpectedLength;
+    size_t          DecodedLength;
+
+    UT_DS_ToolsStoreBlocks();
+
+    /* Damage the first data byte of the second block */
+    Length = UT_DS_ToolsReadAll(UT_DS_ToolsWritten, UT_DS_ToolsWrittenData);
+    memcpy(&Frame, UT_DS_ToolsWrittenData, sizeof(Frame));
+    UT_DS_ToolsWrittenData[(2 * sizeof(Frame)) + Frame.Length] ^= 0xFF;
+    fwrite(UT_DS_ToolsWrittenData, 1, Length, Corrupted);
+
+    /* Execute the function being tested */
+    rewind(Corrupted);
+    UtAssert_INT32_EQ(DS_CodecDecodeFile(Corrupted, UT_DS_ToolsDecoded, &Blocks, &Errors), EXIT_FAILURE);
+    fclose(Corrupted);
+
+    /* Verify results - the blocks after the damaged one are still decoded */
+    UtAssert_UINT32_EQ(Blocks, 4);
+    UtAssert_UINT32_EQ(Errors, 1);
+
+    ExpectedLength = UT_DS_ToolsReadAll(UT_DS_ToolsExpected, UT_DS_ToolsExpectedData);
+    DecodedLength  = UT_DS_ToolsReadAll(UT_DS_ToolsDecoded, UT_DS_ToolsDecodedData);
+
+    UtAssert_UINT32_EQ(DecodedLength, ExpectedLength - (5 * 48));
+    UtAssert_MemCmp(UT_DS_ToolsDecodedData, UT_DS_ToolsExpectedData, 5 * 48, "First block");
+    UtAssert_MemCmp(&UT_DS_ToolsDecodedData[5 * 48], &UT_DS_ToolsExpectedData[10 * 48], ExpectedLength - (10 * 48),
+                    "Blocks after the damaged block");
+}
+#endif
+
+void UtTest_Setup(void)
+{
+    UT_DS_TOOLS_TEST_ADD(DS_DeltaDecodeFile_Test_RoundTrip);
+    UT_DS_TOOLS_TEST_ADD(DS_DeltaDecodeFile_Test_Truncated);
+    UT_DS_TOOLS_TEST_ADD(DS_CodecCrc16_Test);
+#if (DS_FILE_COMPRESSION == true)
+    UT_DS_TOOLS_TEST_ADD(DS_CodecDecodeFile_Test_RoundTrip);
+    UT_DS_TOOLS_TEST_ADD(DS_CodecDecodeFile_Test_Corrupted);
+#endif
+}
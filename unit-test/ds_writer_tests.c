@@ -0,0 +1,645 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,917-1, and identified as “CFS Data Storage
+ * (DS) application version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   This file contains unit test cases for the functions contained in the file ds_writer.c
+ */
+
+/*
+ * Includes
+ */
+
+#include "ds_app.h"
+#include "ds_appdefs.h"
+#include "ds_file.h"
+#include "ds_msg.h"
+#include "ds_events.h"
+#include "ds_test_utils.h"
+#include "ds_writer.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/*
+ * Helper Functions
+ */
+
+bool UT_DS_WriterEnqueueNoop(const uint16 *DestIndex, uint16 DestCount)
+{
+    size_t            forced_Size = sizeof(DS_NoopCmd_t);
+    DS_WriterRecord_t Record;
+
+    memset(&Record, 0, sizeof(Record));
+    Record.Type      = DS_WRITER_PACKET;
+    Record.DestCount = DestCount;
+    memcpy(Record.DestIndex, DestIndex, DestCount * sizeof(DestIndex[0]));
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+
+    return DS_WriterEnqueue(&Record, &UT_CmdBuf.Buf);
+}
+
+bool UT_DS_WriterEnqueueWork(uint32 Work)
+{
+    DS_WriterRecord_t Record;
+
+    memset(&Record, 0, sizeof(Record));
+    Record.Type = DS_WRITER_WORK;
+    Record.Work = Work;
+
+    return DS_WriterEnqueue(&Record, NULL);
+}
+
+/*
+ * Function Definitions
+ */
+
+void DS_WriterInit_Test_Nominal(void)
+{
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_WriterInit(), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(DS_AppData.WriterTaskActive);
+    UtAssert_STUB_COUNT(OS_CountSemCreate, 1);
+    UtAssert_STUB_COUNT(OS_MutSemCreate, 2);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_WriterInit_Test_SemCreateError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemCreate), 1, OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_WriterInit(), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(DS_AppData.WriterTaskActive);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_INIT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_WriterInit_Test_MutexCreateError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 1, OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_WriterInit(), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(DS_AppData.WriterTaskActive);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_INIT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_WriterInit_Test_HkMutexCreateError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 2, OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_WriterInit(), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(DS_AppData.WriterTaskActive);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_INIT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_WriterInit_Test_ChildTaskError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_WriterInit(), -1);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(DS_AppData.WriterTaskActive);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_INIT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_WriterTask_Test_SemTakeError(void)
+{
+    uint16 DestIndex = 0;
+
+    DS_AppData.FileStatus[0].FileState = DS_ENABLED;
+    UT_DS_WriterEnqueueNoop(&DestIndex, 1);
+
+    DS_AppData.WriterTaskActive = true;
+
+    /* Process one record, then fail the semaphore take */
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTake), 2, OS_ERROR);
+
+    /* Execute the function being tested */
+    DS_WriterTask();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.WriterRing.Tail, DS_AppData.WriterRing.Head);
+    UtAssert_STUB_COUNT(DS_FileSetupWrite, 1);
+    UtAssert_BOOL_FALSE(DS_AppData.WriterTaskActive);
+
+    /* Lock is held for the record and while the active flag is cleared */
+    UtAssert_STUB_COUNT(OS_MutSemTake, 2);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 2);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_WRITER_TASK_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_WriterEnqueue_Test_Nominal(void)
+{
+    uint16             DestIndex[2] = {0, 2};
+    DS_WriterRecord_t *Record       = (DS_WriterRecord_t *)&DS_AppData.WriterRing.Block[0];
+    uint32             NeedBlocks   = DS_WRITER_HDR_BLOCKS + DS_WRITER_BLOCKS(sizeof(DS_NoopCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(UT_DS_WriterEnqueueNoop(DestIndex, 2));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.WriterRing.Head, NeedBlocks);
+    UtAssert_UINT32_EQ(DS_AppData.WriterRing.Tail, 0);
+    UtAssert_UINT32_EQ(DS_AppData.WriterRing.PeakBlocks, NeedBlocks);
+    UtAssert_UINT32_EQ(DS_AppData.WriterRing.DropCounter, 0);
+    UtAssert_UINT32_EQ(Record->Type, DS_WRITER_PACKET);
+    UtAssert_UINT32_EQ(Record->Length, sizeof(DS_NoopCmd_t));
+    UtAssert_UINT32_EQ(Record->DestCount, 2);
+    UtAssert_UINT32_EQ(Record->DestIndex[0], 0);
+    UtAssert_UINT32_EQ(Record->DestIndex[1], 2);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_WriterEnqueue_Test_Work(void)
+{
+    DS_WriterRecord_t *Record = (DS_WriterRecord_t *)&DS_AppData.WriterRing.Block[0];
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(UT_DS_WriterEnqueueWork(DS_WRITER_WORK_FLUSH));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.WriterRing.Head, DS_WRITER_HDR_BLOCKS);
+    UtAssert_UINT32_EQ(Record->Type, DS_WRITER_WORK);
+    UtAssert_UINT32_EQ(Record->Length, 0);
+    UtAssert_UINT32_EQ(Record->Work, DS_WRITER_WORK_FLUSH);
+    UtAssert_STUB_COUNT(CFE_MSG_GetSize, 0);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 1);
+}
+
+void DS_WriterEnqueue_Test_RingFull(void)
+{
+    uint16 DestIndex = 0;
+
+    DS_AppData.WriterRing.Head = 5;
+    DS_AppData.WriterRing.Tail = 6;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(UT_DS_WriterEnqueueNoop(&DestIndex, 1));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.WriterRing.Head, 5);
+    UtAssert_UINT32_EQ(DS_AppData.WriterRing.DropCounter, 1);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_WriterEnqueue_Test_PacketTooLarge(void)
+{
+    size_t            forced_Size = DS_WRITER_RING_SIZE;
+    DS_WriterRecord_t Record;
+
+    memset(&Record, 0, sizeof(Record));
+    Record.Type      = DS_WRITER_PACKET;
+    Record.DestCount = 1;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_WriterEnqueue(&Record, &UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.WriterRing.Head, 0);
+    UtAssert_UINT32_EQ(DS_AppData.WriterRing.DropCounter, 1);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_WriterEnqueue_Test_Wrap(void)
+{
+    uint16             DestIndex  = 3;
+    DS_WriterRecord_t *Marker     = (DS_WriterRecord_t *)&DS_AppData.WriterRing.Block[DS_WRITER_RING_BLOCKS -
+                                                                                   DS_WRITER_HDR_BLOCKS];
+    DS_WriterRecord_t *Record     = (DS_WriterRecord_t *)&DS_AppData.WriterRing.Block[0];
+    uint32             NeedBlocks = DS_WRITER_HDR_BLOCKS + DS_WRITER_BLOCKS(sizeof(DS_NoopCmd_t));
+
+    /* Empty ring with only room for a header before the end */
+    DS_AppData.WriterRing.Head = DS_WRITER_RING_BLOCKS - DS_WRITER_HDR_BLOCKS;
+    DS_AppData.WriterRing.Tail = DS_WRITER_RING_BLOCKS - DS_WRITER_HDR_BLOCKS;
+    Marker->Type               = DS_WRITER_PACKET;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(UT_DS_WriterEnqueueNoop(&DestIndex, 1));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Marker->Type, DS_WRITER_WRAP);
+    UtAssert_UINT32_EQ(Record->Type, DS_WRITER_PACKET);
+    UtAssert_UINT32_EQ(Record->DestCount, 1);
+    UtAssert_UINT32_EQ(Record->DestIndex[0], 3);
+    UtAssert_UINT32_EQ(DS_AppData.WriterRing.Head, NeedBlocks);
+    UtAssert_UINT32_EQ(DS_AppData.WriterRing.PeakBlocks, NeedBlocks + DS_WRITER_HDR_BLOCKS);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 1);
+}
+
+void DS_WriterSubmit_Test_Active(void)
+{
+    DS_WriterRecord_t Record;
+
+    memset(&Record, 0, sizeof(Record));
+    Record.Type = DS_WRITER_WORK;
+    Record.Work = DS_WRITER_WORK_CDS;
+
+    DS_AppData.WriterTaskActive = true;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_WriterSubmit(&Record, NULL));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.WriterRing.Head, DS_WRITER_HDR_BLOCKS);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 1);
+    UtAssert_STUB_COUNT(DS_AppProcessWork, 0);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+}
+
+void DS_WriterSubmit_Test_ActiveRingFull(void)
+{
+    DS_WriterRecord_t Record;
+
+    memset(&Record, 0, sizeof(Record));
+    Record.Type = DS_WRITER_WORK;
+
+    DS_AppData.WriterTaskActive = true;
+    DS_AppData.WriterRing.Head  = 5;
+    DS_AppData.WriterRing.Tail  = 6;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_WriterSubmit(&Record, NULL));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.WriterRing.DropCounter, 1);
+    UtAssert_STUB_COUNT(DS_AppProcessWork, 0);
+}
+
+void DS_WriterSubmit_Test_Inactive(void)
+{
+    uint16            DestIndex = 0;
+    DS_WriterRecord_t Record;
+
+    memset(&Record, 0, sizeof(Record));
+    Record.Type = DS_WRITER_WORK;
+    Record.Work = DS_WRITER_WORK_CDS;
+
+    /* Packet left in the ring by a storage writer that has stopped */
+    DS_AppData.FileStatus[0].FileState = DS_ENABLED;
+    UT_DS_WriterEnqueueNoop(&DestIndex, 1);
+
+    DS_AppData.WriterTaskActive = false;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_WriterSubmit(&Record, NULL));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.WriterRing.Tail, DS_AppData.WriterRing.Head);
+    UtAssert_STUB_COUNT(DS_FileSetupWrite, 1);
+    UtAssert_STUB_COUNT(DS_AppProcessWork, 1);
+
+    /* Writer lock, then the HK snapshot published after the work record */
+    UtAssert_STUB_COUNT(OS_MutSemTake, 2);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 2);
+}
+
+void DS_WriterProcess_Test_Command(void)
+{
+    DS_WriterRecord_t Record;
+
+    memset(&Record, 0, sizeof(Record));
+    Record.Type = DS_WRITER_COMMAND;
+
+    DS_AppData.FileCmdAcceptedCounter = 1;
+
+    /* Execute the function being tested */
+    DS_WriterProcess(&Record, &UT_CmdBuf.Buf);
+
+    /* Verify results - command counters are published for HK */
+    UtAssert_UINT32_EQ(DS_AppData.WriterHk.FileCmdAcceptedCounter, 1);
+    UtAssert_STUB_COUNT(DS_AppProcessFileCmd, 1);
+    UtAssert_STUB_COUNT(DS_AppProcessWork, 0);
+    UtAssert_STUB_COUNT(DS_FileSetupWrite, 0);
+}
+
+void DS_WriterProcess_Test_Work(void)
+{
+    DS_WriterRecord_t Record;
+
+    memset(&Record, 0, sizeof(Record));
+    Record.Type = DS_WRITER_WORK;
+    Record.Work = DS_WRITER_WORK_AGE;
+
+    DS_AppData.FlushCounter = 2;
+
+    /* Execute the function being tested */
+    DS_WriterProcess(&Record, NULL);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.WriterHk.FlushCounter, 2);
+    UtAssert_STUB_COUNT(DS_AppProcessWork, 1);
+    UtAssert_STUB_COUNT(DS_AppProcessFileCmd, 0);
+    UtAssert_STUB_COUNT(DS_FileSetupWrite, 0);
+}
+
+void DS_WriterProcessNext_Test_Nominal(void)
+{
+    uint16 DestIndex[2] = {0, 1};
+
+    DS_AppData.FileStatus[0].FileState = DS_ENABLED;
+    DS_AppData.FileStatus[1].FileState = DS_ENABLED;
+    UT_DS_WriterEnqueueNoop(DestIndex, 2);
+
+    /* Execute the function being tested */
+    DS_WriterProcessNext();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.WriterRing.Tail, DS_AppData.WriterRing.Head);
+    UtAssert_STUB_COUNT(DS_FileSetupWrite, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_WriterProcessNext_Test_Work(void)
+{
+    UT_DS_WriterEnqueueWork(DS_WRITER_WORK_FLUSH);
+
+    /* Execute the function being tested */
+    DS_WriterProcessNext();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.WriterRing.Tail, DS_WRITER_HDR_BLOCKS);
+    UtAssert_STUB_COUNT(DS_AppProcessWork, 1);
+    UtAssert_STUB_COUNT(DS_FileSetupWrite, 0);
+}
+
+void DS_WriterProcessNext_Test_DestDisabled(void)
+{
+    uint16 DestIndex = 0;
+
+    DS_AppData.FileStatus[0].FileState = DS_DISABLED;
+    UT_DS_WriterEnqueueNoop(&DestIndex, 1);
+
+    /* Execute the function being tested */
+    DS_WriterProcessNext();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.WriterRing.Tail, DS_AppData.WriterRing.Head);
+    UtAssert_STUB_COUNT(DS_FileSetupWrite, 0);
+}
+
+void DS_WriterProcessNext_Test_NoDestTable(void)
+{
+    uint16 DestIndex = 0;
+
+    DS_AppData.FileStatus[0].FileState = DS_ENABLED;
+    UT_DS_WriterEnqueueNoop(&DestIndex, 1);
+
+    DS_AppData.DestFileTblPtr = NULL;
+
+    /* Execute the function being tested */
+    DS_WriterProcessNext();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.WriterRing.Tail, DS_AppData.WriterRing.Head);
+    UtAssert_STUB_COUNT(DS_FileSetupWrite, 0);
+}
+
+void DS_WriterProcessNext_Test_Wrap(void)
+{
+    uint16 DestIndex = 0;
+
+    DS_AppData.FileStatus[0].FileState = DS_ENABLED;
+    DS_AppData.WriterRing.Head         = DS_WRITER_RING_BLOCKS - DS_WRITER_HDR_BLOCKS;
+    DS_AppData.WriterRing.Tail         = DS_WRITER_RING_BLOCKS - DS_WRITER_HDR_BLOCKS;
+    UT_DS_WriterEnqueueNoop(&DestIndex, 1);
+
+    /* Execute the function being tested */
+    DS_WriterProcessNext();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.WriterRing.Tail, DS_AppData.WriterRing.Head);
+    UtAssert_STUB_COUNT(DS_FileSetupWrite, 1);
+}
+
+void DS_WriterProcessNext_Test_Empty(void)
+{
+    DS_AppData.WriterRing.Head = 7;
+    DS_AppData.WriterRing.Tail = 7;
+
+    /* Execute the function being tested */
+    DS_WriterProcessNext();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.WriterRing.Tail, 7);
+    UtAssert_STUB_COUNT(DS_FileSetupWrite, 0);
+}
+
+void DS_WriterDrain_Test_Empty(void)
+{
+    DS_AppData.WriterTaskActive = true;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_WriterDrain());
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+}
+
+void DS_WriterDrain_Test_Timeout(void)
+{
+    UT_DS_WriterEnqueueWork(DS_WRITER_WORK_FLUSH);
+
+    /* Storage writer never gets to the record */
+    DS_AppData.WriterTaskActive = true;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_WriterDrain());
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_TaskDelay, DS_WRITER_DRAIN_TIMEOUT / DS_WRITER_DRAIN_POLL);
+    UtAssert_STUB_COUNT(DS_AppProcessWork, 0);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+}
+
+void DS_WriterDrain_Test_Inactive(void)
+{
+    UT_DS_WriterEnqueueWork(DS_WRITER_WORK_FLUSH);
+    UT_DS_WriterEnqueueWork(DS_WRITER_WORK_CDS);
+
+    DS_AppData.WriterTaskActive = false;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_WriterDrain());
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.WriterRing.Tail, DS_AppData.WriterRing.Head);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+    UtAssert_STUB_COUNT(DS_AppProcessWork, 2);
+
+    /* Writer lock, then one HK snapshot for each work record */
+    UtAssert_STUB_COUNT(OS_MutSemTake, 3);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 3);
+}
+
+void DS_WriterRingBytesUsed_Test(void)
+{
+    DS_AppData.WriterRing.Head = 3;
+    DS_AppData.WriterRing.Tail = 1;
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(DS_WriterRingBytesUsed(), 2 * DS_WRITER_BLOCK_SIZE);
+
+    DS_AppData.WriterRing.Head = 1;
+    DS_AppData.WriterRing.Tail = 3;
+
+    UtAssert_UINT32_EQ(DS_WriterRingBytesUsed(), (DS_WRITER_RING_BLOCKS - 2) * DS_WRITER_BLOCK_SIZE);
+}
+
+void DS_WriterPublishHk_Test(void)
+{
+    DS_AppData.FileCmdAcceptedCounter = 1;
+    DS_AppData.FileCmdRejectedCounter = 2;
+    DS_AppData.DestTblLoadCounter     = 3;
+    DS_AppData.DestTblErrCounter      = 4;
+    DS_AppData.FileWriteCounter       = 5;
+    DS_AppData.FileWriteErrCounter    = 6;
+    DS_AppData.FlushCounter           = 7;
+    DS_AppData.FlushByteCounter       = 8;
+    DS_AppData.DirectFlushCounter     = 9;
+    DS_AppData.RotationCounter        = 10;
+    DS_AppData.PreopenHitCounter      = 11;
+    DS_AppData.LastRotationTime       = 12;
+    DS_AppData.MaxRotationTime        = 13;
+
+    /* Execute the function being tested */
+    DS_WriterPublishHk();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.WriterHk.FileCmdAcceptedCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.WriterHk.FileCmdRejectedCounter, 2);
+    UtAssert_UINT32_EQ(DS_AppData.WriterHk.DestTblLoadCounter, 3);
+    UtAssert_UINT32_EQ(DS_AppData.WriterHk.DestTblErrCounter, 4);
+    UtAssert_UINT32_EQ(DS_AppData.WriterHk.FileWriteCounter, 5);
+    UtAssert_UINT32_EQ(DS_AppData.WriterHk.FileWriteErrCounter, 6);
+    UtAssert_UINT32_EQ(DS_AppData.WriterHk.FlushCounter, 7);
+    UtAssert_UINT32_EQ(DS_AppData.WriterHk.FlushByteCounter, 8);
+    UtAssert_UINT32_EQ(DS_AppData.WriterHk.DirectFlushCounter, 9);
+    UtAssert_UINT32_EQ(DS_AppData.WriterHk.RotationCounter, 10);
+    UtAssert_UINT32_EQ(DS_AppData.WriterHk.PreopenHitCounter, 11);
+    UtAssert_UINT32_EQ(DS_AppData.WriterHk.LastRotationTime, 12);
+    UtAssert_UINT32_EQ(DS_AppData.WriterHk.MaxRotationTime, 13);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+}
+
+void DS_WriterLock_Test_Inactive(void)
+{
+    DS_AppData.WriterTaskActive = false;
+
+    /* Execute the functions being tested */
+    DS_WriterLock();
+    DS_WriterUnlock();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+}
+
+void DS_WriterLock_Test_Active(void)
+{
+    DS_AppData.WriterTaskActive = true;
+
+    /* Execute the functions being tested */
+    DS_WriterLock();
+    DS_WriterUnlock();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+}
+
+void UtTest_Setup(void)
+{
+    UT_DS_TEST_ADD(DS_WriterInit_Test_Nominal);
+    UT_DS_TEST_ADD(DS_WriterInit_Test_SemCreateError);
+    UT_DS_TEST_ADD(DS_WriterInit_Test_MutexCreateError);
+    UT_DS_TEST_ADD(DS_WriterInit_Test_HkMutexCreateError);
+    UT_DS_TEST_ADD(DS_WriterInit_Test_ChildTaskError);
+
+    UT_DS_TEST_ADD(DS_WriterTask_Test_SemTakeError);
+
+    UT_DS_TEST_ADD(DS_WriterEnqueue_Test_Nominal);
+    UT_DS_TEST_ADD(DS_WriterEnqueue_Test_Work);
+    UT_DS_TEST_ADD(DS_WriterEnqueue_Test_RingFull);
+    UT_DS_TEST_ADD(DS_WriterEnqueue_Test_PacketTooLarge);
+    UT_DS_TEST_ADD(DS_WriterEnqueue_Test_Wrap);
+
+    UT_DS_TEST_ADD(DS_WriterSubmit_Test_Active);
+    UT_DS_TEST_ADD(DS_WriterSubmit_Test_ActiveRingFull);
+    UT_DS_TEST_ADD(DS_WriterSubmit_Test_Inactive);
+
+    UT_DS_TEST_ADD(DS_WriterProcess_Test_Command);
+    UT_DS_TEST_ADD(DS_WriterProcess_Test_Work);
+
+    UT_DS_TEST_ADD(DS_WriterProcessNext_Test_Nominal);
+    UT_DS_TEST_ADD(DS_WriterProcessNext_Test_Work);
+    UT_DS_TEST_ADD(DS_WriterProcessNext_Test_DestDisabled);
+    UT_DS_TEST_ADD(DS_WriterProcessNext_Test_NoDestTable);
+    UT_DS_TEST_ADD(DS_WriterProcessNext_Test_Wrap);
+    UT_DS_TEST_ADD(DS_WriterProcessNext_Test_Empty);
+
+    UT_DS_TEST_ADD(DS_WriterDrain_Test_Empty);
+    UT_DS_TEST_ADD(DS_WriterDrain_Test_Timeout);
+    UT_DS_TEST_ADD(DS_WriterDrain_Test_Inactive);
+
+    UT_DS_TEST_ADD(DS_WriterRingBytesUsed_Test);
+
+    UT_DS_TEST_ADD(DS_WriterPublishHk_Test);
+
+    UT_DS_TEST_ADD(DS_WriterLock_Test_Inactive);
+    UT_DS_TEST_ADD(DS_WriterLock_Test_Active);
+}
@@ -78,6 +78,18 @@ int32 DS_AppInitialize(void)
     return UT_DEFAULT_IMPL(DS_AppInitialize);
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Process a batch of Software Bus messages                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_AppProcessBatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_AppProcessBatch), BufPtr);
+    UT_DEFAULT_IMPL(DS_AppProcessBatch);
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Process Software Bus messages                                   */
@@ -102,6 +114,18 @@ void DS_AppProcessCmd(const CFE_SB_Buffer_t *BufPtr)
     UT_DEFAULT_IMPL(DS_AppProcessCmd);
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Process destination file commands (storage writer)              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_AppProcessFileCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_AppProcessFileCmd), BufPtr);
+    UT_DEFAULT_IMPL(DS_AppProcessFileCmd);
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Process hk request command                                      */
@@ -113,6 +137,62 @@ void DS_AppProcessHK(void)
     UT_DEFAULT_IMPL(DS_AppProcessHK);
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Maintenance scheduler clock                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_AppSchedClock(void)
+{
+    return UT_DEFAULT_IMPL(DS_AppSchedClock);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Initialize maintenance deadlines                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_AppSchedInit(void)
+{
+    UT_DEFAULT_IMPL(DS_AppSchedInit);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Time until the next maintenance deadline                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_AppSchedTimeout(void)
+{
+    return UT_DEFAULT_IMPL(DS_AppSchedTimeout);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Run maintenance that is due                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_AppSchedRun(void)
+{
+    UT_DEFAULT_IMPL(DS_AppSchedRun);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Run storage writer maintenance                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_AppProcessWork(const DS_WriterRecord_t *Record)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_AppProcessWork), Record);
+    UT_DEFAULT_IMPL(DS_AppProcessWork);
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Packet storage pre-processor                                    */
@@ -69,6 +69,17 @@ void DS_CmdReset(const CFE_SB_Buffer_t *BufPtr)
     UT_DEFAULT_IMPL(DS_CmdReset);
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Reset storage writer counters                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_CmdResetFileCounters(void)
+{
+    UT_DEFAULT_IMPL(DS_CmdResetFileCounters);
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Set application ena/dis state                                   */
@@ -225,6 +236,18 @@ void DS_CmdCloseFile(const CFE_SB_Buffer_t *BufPtr)
     UT_DEFAULT_IMPL(DS_CmdCloseFile);
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Flush destination file write buffer                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_CmdFlushFile(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CmdFlushFile), BufPtr);
+    UT_DEFAULT_IMPL(DS_CmdFlushFile);
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Close all open destination files                                */
@@ -249,6 +272,18 @@ void DS_CmdGetFileInfo(const CFE_SB_Buffer_t *BufPtr)
     UT_DEFAULT_IMPL(DS_CmdGetFileInfo);
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get duplicate packet info packet                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_CmdGetDedupInfo(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CmdGetDedupInfo), BufPtr);
+    UT_DEFAULT_IMPL(DS_CmdGetDedupInfo);
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Add message ID to packet filter table                           */
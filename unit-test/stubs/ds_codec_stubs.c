@@ -0,0 +1,185 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,917-1, and identified as “CFS Data Storage
+ * (DS) application version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  Unit testing stubs for the ds_codec.c file.
+ */
+
+#include "cfe.h"
+
+#include "ds_platform_cfg.h"
+#include "ds_verify.h"
+
+#include "ds_appdefs.h"
+
+#include "ds_app.h"
+#include "ds_codec.h"
+#include "ds_events.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compress a block                                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_CodecCompress(uint16 Codec, const uint8 *Data, uint32 Length, uint8 *Output, uint32 MaxSize,
+                        DS_CodecWork_t *Work)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecCompress), Codec);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecCompress), Data);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecCompress), Length);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecCompress), Output);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecCompress), MaxSize);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecCompress), Work);
+    return UT_DEFAULT_IMPL(DS_CodecCompress);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Decompress a block                                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_CodecDecompress(uint16 Codec, const uint8 *Data, uint32 Length, uint8 *Output, uint32 MaxSize)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecDecompress), Codec);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecDecompress), Data);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecDecompress), Length);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecDecompress), Output);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecDecompress), MaxSize);
+    return UT_DEFAULT_IMPL(DS_CodecDecompress);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Fast LZ block compressor                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_CodecCompressFast(const uint8 *Data, uint32 Length, uint8 *Output, uint32 MaxSize, DS_CodecWork_t *Work)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecCompressFast), Data);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecCompressFast), Length);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecCompressFast), Output);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecCompressFast), MaxSize);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecCompressFast), Work);
+    return UT_DEFAULT_IMPL(DS_CodecCompressFast);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* High ratio LZ block compressor                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_CodecCompressHigh(const uint8 *Data, uint32 Length, uint8 *Output, uint32 MaxSize, DS_CodecWork_t *Work)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecCompressHigh), Data);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecCompressHigh), Length);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecCompressHigh), Output);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecCompressHigh), MaxSize);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecCompressHigh), Work);
+    return UT_DEFAULT_IMPL(DS_CodecCompressHigh);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LZ block compressor                                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_CodecCompressLZ(const uint8 *Data, uint32 Length, uint8 *Output, uint32 MaxSize, DS_CodecWork_t *Work,
+                          uint32 Depth)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecCompressLZ), Data);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecCompressLZ), Length);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecCompressLZ), Output);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecCompressLZ), MaxSize);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecCompressLZ), Work);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecCompressLZ), Depth);
+    return UT_DEFAULT_IMPL(DS_CodecCompressLZ);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write LZ sequence                                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_CodecPutSequence(uint8 *Output, uint32 Position, uint32 MaxSize, const uint8 *Literals,
+                           uint32 LiteralLength, uint32 MatchOffset, uint32 MatchLength)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecPutSequence), Output);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecPutSequence), Position);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecPutSequence), MaxSize);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecPutSequence), Literals);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecPutSequence), LiteralLength);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecPutSequence), MatchOffset);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecPutSequence), MatchLength);
+    return UT_DEFAULT_IMPL(DS_CodecPutSequence);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LZ match finder hash                                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_CodecHash(const uint8 *Data)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecHash), Data);
+    return UT_DEFAULT_IMPL(DS_CodecHash);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Read LZ sequence length                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_CodecGetLength(const uint8 *Data, uint32 Length, uint32 *Position, uint32 Nibble, uint32 *Count)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecGetLength), Data);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecGetLength), Length);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecGetLength), Position);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecGetLength), Nibble);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecGetLength), Count);
+    return UT_DEFAULT_IMPL(DS_CodecGetLength);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LZ block decompressor                                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_CodecDecompressLZ(const uint8 *Data, uint32 Length, uint8 *Output, uint32 MaxSize)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecDecompressLZ), Data);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecDecompressLZ), Length);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecDecompressLZ), Output);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_CodecDecompressLZ), MaxSize);
+    return UT_DEFAULT_IMPL(DS_CodecDecompressLZ);
+}
@@ -83,6 +83,20 @@ void DS_FileWriteData(int32 FileIndex, const void *FileData, uint32 DataLength)
     UT_DEFAULT_IMPL(DS_FileWriteData);
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write data to direct I/O destination file                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileWriteDirect(int32 FileIndex, const void *FileData, uint32 DataLength)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileWriteDirect), FileIndex);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileWriteDirect), FileData);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileWriteDirect), DataLength);
+    UT_DEFAULT_IMPL(DS_FileWriteDirect);
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Write header to destination file                                */
@@ -95,6 +109,21 @@ void DS_FileWriteHeader(int32 FileIndex)
     UT_DEFAULT_IMPL(DS_FileWriteHeader);
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write header to an open file                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FileWriteHeaderData(int32 FileIndex, osal_id_t FileHandle, const char *FileName, uint32 *DataLength)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileWriteHeaderData), FileIndex);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileWriteHeaderData), FileHandle);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileWriteHeaderData), FileName);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileWriteHeaderData), DataLength);
+    return UT_DEFAULT_IMPL(DS_FileWriteHeaderData);
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* File write error handler                                        */
@@ -119,14 +148,103 @@ void DS_FileCreateDest(uint32 FileIndex)
     UT_DEFAULT_IMPL(DS_FileCreateDest);
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Open direct I/O access to a new destination file                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void DS_FileOpenDirect(uint32 FileIndex)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileOpenDirect), FileIndex);
+    UT_DEFAULT_IMPL(DS_FileOpenDirect);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Reserve storage for a new destination file                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool DS_FilePreallocate(uint32 FileIndex, const char *FileName)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FilePreallocate), FileIndex);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FilePreallocate), FileName);
+    return UT_DEFAULT_IMPL(DS_FilePreallocate);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Open the next destination file ahead of time                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void DS_FileOpenSpare(uint32 FileIndex)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileOpenSpare), FileIndex);
+    UT_DEFAULT_IMPL(DS_FileOpenSpare);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Discard the pre-opened next destination file                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void DS_FileCloseSpare(uint32 FileIndex)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileCloseSpare), FileIndex);
+    UT_DEFAULT_IMPL(DS_FileCloseSpare);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Pre-open processor                                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void DS_FileTestPreopen(void)
+{
+    UT_DEFAULT_IMPL(DS_FileTestPreopen);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Pre-open test for one destination                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void DS_FileTestPreopenDest(uint32 FileIndex)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileTestPreopenDest), FileIndex);
+    UT_DEFAULT_IMPL(DS_FileTestPreopenDest);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Record new file start latency                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void DS_FileRotationDone(CFE_TIME_SysTime_t StartTime)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileRotationDone), StartTime);
+    UT_DEFAULT_IMPL(DS_FileRotationDone);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Measure elapsed time in microseconds                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 DS_FileElapsedTime(CFE_TIME_SysTime_t StartTime)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileElapsedTime), StartTime);
+    return UT_DEFAULT_IMPL(DS_FileElapsedTime);
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Create destination filename                                     */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void DS_FileCreateName(uint32 FileIndex)
+void DS_FileCreateName(uint32 FileIndex, char *FileName)
 {
     UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileCreateName), FileIndex);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileCreateName), FileName);
     UT_DEFAULT_IMPL(DS_FileCreateName);
 }
 
@@ -149,12 +267,240 @@ void DS_FileCreateSequence(char *Buffer, uint32 Type, uint32 Count)
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void DS_FileUpdateHeader(int32 FileIndex)
+void DS_FileUpdateHeader(const DS_FinalizeEntry_t *Entry)
 {
-    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileUpdateHeader), FileIndex);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileUpdateHeader), Entry);
     UT_DEFAULT_IMPL(DS_FileUpdateHeader);
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Add packet to destination file content summary                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileSummaryUpdate(int32 FileIndex, const CFE_SB_Buffer_t *BufPtr, uint32 PacketLength)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileSummaryUpdate), FileIndex);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileSummaryUpdate), BufPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileSummaryUpdate), PacketLength);
+    UT_DEFAULT_IMPL(DS_FileSummaryUpdate);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Message ID Bloom filter bit                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_FileBloomBit(uint32 MessageValue, uint32 HashIndex)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileBloomBit), MessageValue);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileBloomBit), HashIndex);
+    return UT_DEFAULT_IMPL(DS_FileBloomBit);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Add packet to destination file index                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileIndexUpdate(int32 FileIndex, CFE_TIME_SysTime_t PacketTime, uint32 Offset)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileIndexUpdate), FileIndex);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileIndexUpdate), PacketTime);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileIndexUpdate), Offset);
+    UT_DEFAULT_IMPL(DS_FileIndexUpdate);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write destination file index                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileWriteIndex(int32 FileIndex)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileWriteIndex), FileIndex);
+    UT_DEFAULT_IMPL(DS_FileWriteIndex);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Flush destination file write buffer                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FileFlushBuffer(int32 FileIndex)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileFlushBuffer), FileIndex);
+    return UT_DEFAULT_IMPL(DS_FileFlushBuffer);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write compressed block                                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FileWriteBlock(int32 FileIndex, const void *Data, uint32 Length)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileWriteBlock), FileIndex);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileWriteBlock), Data);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileWriteBlock), Length);
+    return UT_DEFAULT_IMPL(DS_FileWriteBlock);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write packet to destination file                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileWritePacket(int32 FileIndex, const CFE_SB_Buffer_t *BufPtr, uint32 PacketLength)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileWritePacket), FileIndex);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileWritePacket), BufPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileWritePacket), PacketLength);
+    UT_DEFAULT_IMPL(DS_FileWritePacket);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get delta record message ID slot                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+DS_DeltaSlot_t *DS_FileDeltaSlot(int32 FileIndex, uint32 MessageID)
+{
+    int32                 Status;
+    DS_DeltaSlot_t *      retval;
+    static DS_DeltaSlot_t DELTA_SLOT = {0};
+
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileDeltaSlot), FileIndex);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileDeltaSlot), MessageID);
+    Status = UT_DEFAULT_IMPL(DS_FileDeltaSlot);
+
+    if (Status == 0)
+    {
+        retval = &DELTA_SLOT;
+    }
+    else
+    {
+        retval = NULL;
+    }
+
+    return retval;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Encode XOR delta                                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_FileDeltaEncode(const uint8 *Previous, const uint8 *Packet, uint32 Length, uint8 *Output, uint32 MaxSize)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileDeltaEncode), Previous);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileDeltaEncode), Packet);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileDeltaEncode), Length);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileDeltaEncode), Output);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileDeltaEncode), MaxSize);
+    return UT_DEFAULT_IMPL(DS_FileDeltaEncode);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Decode XOR delta                                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_FileDeltaDecode(const uint8 *Previous, uint32 Length, const uint8 *Data, uint32 DataLength, uint8 *Packet)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileDeltaDecode), Previous);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileDeltaDecode), Length);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileDeltaDecode), Data);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileDeltaDecode), DataLength);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileDeltaDecode), Packet);
+    return UT_DEFAULT_IMPL(DS_FileDeltaDecode);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Add packet to superframe                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileSuperframeAdd(int32 FileIndex, const CFE_SB_Buffer_t *BufPtr, uint32 PacketLength)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileSuperframeAdd), FileIndex);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileSuperframeAdd), BufPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileSuperframeAdd), PacketLength);
+    UT_DEFAULT_IMPL(DS_FileSuperframeAdd);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write partial superframe                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileSuperframeFlush(int32 FileIndex)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileSuperframeFlush), FileIndex);
+    UT_DEFAULT_IMPL(DS_FileSuperframeFlush);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get file growth for superframe packet                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_FileSuperframeGrowth(int32 FileIndex, uint32 PacketLength)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileSuperframeGrowth), FileIndex);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileSuperframeGrowth), PacketLength);
+    return UT_DEFAULT_IMPL(DS_FileSuperframeGrowth);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Flush write buffer with direct I/O                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FileFlushDirect(int32 FileIndex)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileFlushDirect), FileIndex);
+    return UT_DEFAULT_IMPL(DS_FileFlushDirect);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Apply destination file sync policy                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileTestSync(int32 FileIndex)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileTestSync), FileIndex);
+    UT_DEFAULT_IMPL(DS_FileTestSync);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Commit destination file data to storage                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FileSync(const char *FileName)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileSync), FileName);
+    return UT_DEFAULT_IMPL(DS_FileSync);
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Close destination file                                          */
@@ -166,6 +512,29 @@ void DS_FileCloseDest(int32 FileIndex)
     UT_DEFAULT_IMPL(DS_FileCloseDest);
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Hand a waiting closed file to the finalizer                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void DS_FileRetryFinalize(int32 FileIndex, bool Wait)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileRetryFinalize), FileIndex);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileRetryFinalize), Wait);
+    UT_DEFAULT_IMPL(DS_FileRetryFinalize);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Finalize closed destination file                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void DS_FileFinalize(DS_FinalizeEntry_t *Entry)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FileFinalize), Entry);
+    UT_DEFAULT_IMPL(DS_FileFinalize);
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* File age processor                                              */
@@ -0,0 +1,144 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,917-1, and identified as “CFS Data Storage
+ * (DS) application version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  Unit testing stubs for the ds_finalize.c file.
+ */
+
+#include "cfe.h"
+
+#include "ds_platform_cfg.h"
+#include "ds_verify.h"
+
+#include "ds_appdefs.h"
+
+#include "ds_app.h"
+#include "ds_file.h"
+#include "ds_finalize.h"
+#include "ds_events.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* File finalizer initialization                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FinalizeInit(void)
+{
+    return UT_DEFAULT_IMPL(DS_FinalizeInit);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* File finalizer child task entry point                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FinalizeTask(void)
+{
+    UT_DEFAULT_IMPL(DS_FinalizeTask);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Queue a closed destination file                                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_FinalizeEnqueue(const DS_FinalizeEntry_t *Entry)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FinalizeEnqueue), Entry);
+    return UT_DEFAULT_IMPL_RC(DS_FinalizeEnqueue, true);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Finalize the oldest queued file                                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FinalizeProcessNext(void)
+{
+    UT_DEFAULT_IMPL(DS_FinalizeProcessNext);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Create or restore the file finalizer queue CDS area             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FinalizeCreateCDS(void)
+{
+    UT_DEFAULT_IMPL(DS_FinalizeCreateCDS);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Create or restore the pre-opened filename CDS areas             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FinalizeCreateSpareCDS(void)
+{
+    UT_DEFAULT_IMPL(DS_FinalizeCreateSpareCDS);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Save a pre-opened filename to the CDS                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FinalizeUpdateSpareCDS(uint32 FileIndex, const char *SpareName)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FinalizeUpdateSpareCDS), FileIndex);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FinalizeUpdateSpareCDS), SpareName);
+    UT_DEFAULT_IMPL(DS_FinalizeUpdateSpareCDS);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Save the file finalizer queue to the CDS                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FinalizeUpdateCDS(int32 EntryIndex)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FinalizeUpdateCDS), EntryIndex);
+    UT_DEFAULT_IMPL(DS_FinalizeUpdateCDS);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Record file finalize latency                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FinalizeDone(uint32 QueueTime)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FinalizeDone), QueueTime);
+    UT_DEFAULT_IMPL(DS_FinalizeDone);
+}
@@ -0,0 +1,161 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,917-1, and identified as “CFS Data Storage
+ * (DS) application version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  Unit testing stubs for the ds_fsext.c file.
+ */
+
+#include "cfe.h"
+
+#include "ds_platform_cfg.h"
+#include "ds_verify.h"
+
+#include "ds_appdefs.h"
+
+#include "ds_app.h"
+#include "ds_file.h"
+#include "ds_fsext.h"
+#include "ds_events.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Reserve file storage                                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FsExtAllocate(const char *FileName, uint32 Size)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FsExtAllocate), FileName);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FsExtAllocate), Size);
+    return UT_DEFAULT_IMPL(DS_FsExtAllocate);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Set file length                                                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FsExtTruncate(const char *FileName, uint32 Size)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FsExtTruncate), FileName);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FsExtTruncate), Size);
+    return UT_DEFAULT_IMPL(DS_FsExtTruncate);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Commit file data to storage                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FsExtSync(const char *FileName)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FsExtSync), FileName);
+    return UT_DEFAULT_IMPL(DS_FsExtSync);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Open file for direct I/O                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FsExtOpenDirect(const char *FileName, int32 *FileDesc)
+{
+    int32 Status;
+
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FsExtOpenDirect), FileName);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FsExtOpenDirect), FileDesc);
+    Status = UT_DEFAULT_IMPL(DS_FsExtOpenDirect);
+
+    *FileDesc = (Status == OS_SUCCESS) ? 3 : -1;
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write aligned blocks with direct I/O                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FsExtWriteDirect(int32 FileDesc, const void *Buffer, uint32 Length, uint32 Offset)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FsExtWriteDirect), FileDesc);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FsExtWriteDirect), Buffer);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FsExtWriteDirect), Length);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FsExtWriteDirect), Offset);
+    return UT_DEFAULT_IMPL_RC(DS_FsExtWriteDirect, Length);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Close direct I/O file                                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FsExtCloseDirect(int32 FileDesc)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FsExtCloseDirect), FileDesc);
+    UT_DEFAULT_IMPL(DS_FsExtCloseDirect);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Report direct I/O support                                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_FsExtDirectAvailable(void)
+{
+    return UT_DEFAULT_IMPL_RC(DS_FsExtDirectAvailable, true);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Report preallocation support                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_FsExtAllocateAvailable(void)
+{
+    return UT_DEFAULT_IMPL_RC(DS_FsExtAllocateAvailable, true);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write data at a file offset                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FsExtWriteAt(const char *FileName, uint32 Offset, const void *Data, uint32 Length)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FsExtWriteAt), FileName);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FsExtWriteAt), Offset);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FsExtWriteAt), Data);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_FsExtWriteAt), Length);
+    return UT_DEFAULT_IMPL(DS_FsExtWriteAt);
+}
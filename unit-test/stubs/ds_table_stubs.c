@@ -159,14 +159,30 @@ bool DS_TableVerifyFileIndex(uint16 FileTableIndex)
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-bool DS_TableVerifyParms(uint16 Algorithm_N, uint16 Algorithm_X, uint16 Algorithm_O)
+bool DS_TableVerifyParms(uint16 FilterType, uint16 Algorithm_N, uint16 Algorithm_X, uint16 Algorithm_O)
 {
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifyParms), FilterType);
     UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifyParms), Algorithm_N);
     UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifyParms), Algorithm_X);
     UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifyParms), Algorithm_O);
     return UT_DEFAULT_IMPL(DS_TableVerifyParms);
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify byte rate filter burst                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyBurst(uint16 FilterType, uint16 Algorithm_X, uint16 Algorithm_O, uint16 MinLength)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifyBurst), FilterType);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifyBurst), Algorithm_X);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifyBurst), Algorithm_O);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifyBurst), MinLength);
+    return UT_DEFAULT_IMPL_RC(DS_TableVerifyBurst, true);
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Verify filter or filename type                                  */
@@ -179,6 +195,31 @@ bool DS_TableVerifyType(uint16 TimeVsCount)
     return UT_DEFAULT_IMPL(DS_TableVerifyType);
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify filter type                                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyFilterType(uint16 FilterType)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifyFilterType), FilterType);
+    return UT_DEFAULT_IMPL(DS_TableVerifyFilterType);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify filter predicate                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyPredicate(const DS_FilterPredicate_t *Predicate, uint16 MinLength)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifyPredicate), Predicate);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifyPredicate), MinLength);
+    return UT_DEFAULT_IMPL(DS_TableVerifyPredicate);
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Verify file ena/dis state                                       */
@@ -227,6 +268,111 @@ bool DS_TableVerifyCount(uint32 SequenceCount)
     return UT_DEFAULT_IMPL(DS_TableVerifyCount);
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify write buffer size                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyBufferSize(uint32 BufferSize)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifyBufferSize), BufferSize);
+    return UT_DEFAULT_IMPL(DS_TableVerifyBufferSize);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify preallocation selection                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyPreallocate(uint16 Preallocate)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifyPreallocate), Preallocate);
+    return UT_DEFAULT_IMPL(DS_TableVerifyPreallocate);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify sync policy                                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifySync(uint16 SyncPolicy, uint32 SyncInterval)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifySync), SyncPolicy);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifySync), SyncInterval);
+    return UT_DEFAULT_IMPL(DS_TableVerifySync);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify direct I/O selection                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyDirectIO(uint16 DirectIO, uint32 BufferSize)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifyDirectIO), DirectIO);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifyDirectIO), BufferSize);
+    return UT_DEFAULT_IMPL(DS_TableVerifyDirectIO);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify file index spacing                                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyIndex(uint32 IndexBytes, uint16 IndexSeconds)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifyIndex), IndexBytes);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifyIndex), IndexSeconds);
+    return UT_DEFAULT_IMPL(DS_TableVerifyIndex);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify file compression selection                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyCodec(uint16 Codec, uint32 BufferSize, uint16 DirectIO, bool Indexed)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifyCodec), Codec);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifyCodec), BufferSize);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifyCodec), DirectIO);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifyCodec), Indexed);
+    return UT_DEFAULT_IMPL(DS_TableVerifyCodec);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify delta record selection                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyDelta(uint16 DeltaKeyframe, bool Indexed)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifyDelta), DeltaKeyframe);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifyDelta), Indexed);
+    return UT_DEFAULT_IMPL(DS_TableVerifyDelta);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify superframe selection                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifySuperframe(uint16 SuperframeSize, uint16 DeltaKeyframe, bool Indexed)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifySuperframe), SuperframeSize);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifySuperframe), DeltaKeyframe);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableVerifySuperframe), Indexed);
+    return UT_DEFAULT_IMPL(DS_TableVerifySuperframe);
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Process new filter table                                        */
@@ -249,6 +395,17 @@ void DS_TableUnsubscribe(void)
     UT_DEFAULT_IMPL(DS_TableUnsubscribe);
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Process filter table differences                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_TableResubscribe(void)
+{
+    UT_DEFAULT_IMPL(DS_TableResubscribe);
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Create DS storage area in CDS                                   */
@@ -271,6 +428,41 @@ void DS_TableUpdateCDS(void)
     UT_DEFAULT_IMPL(DS_TableUpdateCDS);
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Mark a CDS entry as changed                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_TableMarkCDS(int32 Index)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableMarkCDS), Index);
+    UT_DEFAULT_IMPL(DS_TableMarkCDS);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Commit changed CDS entries                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_TableCommitCDS(void)
+{
+    UT_DEFAULT_IMPL(DS_TableCommitCDS);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Keep the CDS ahead of a destination sequence count              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_TableReserveCDS(int32 FileIndex)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableReserveCDS), FileIndex);
+    UT_DEFAULT_IMPL(DS_TableReserveCDS);
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Convert messageID to hash table index                           */
@@ -318,3 +510,62 @@ int32 DS_TableFindMsgID(CFE_SB_MsgId_t MessageID)
     UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableFindMsgID), MessageID);
     return UT_DEFAULT_IMPL(DS_TableFindMsgID);
 }
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* DS_TableFindSlot() - get hash table slot index for MID          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_TableFindSlot(CFE_SB_MsgId_t MessageID)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableFindSlot), MessageID);
+    return UT_DEFAULT_IMPL(DS_TableFindSlot);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Remove MID from hash table                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_TableRemoveMsgID(CFE_SB_MsgId_t MessageID)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableRemoveMsgID), MessageID);
+    return UT_DEFAULT_IMPL(DS_TableRemoveMsgID);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Allocate unused packet filter table entry                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_TableAllocEntry(void)
+{
+    return UT_DEFAULT_IMPL(DS_TableAllocEntry);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Return packet filter table entry to free list                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_TableFreeEntry(int32 FilterIndex)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableFreeEntry), FilterIndex);
+    UT_DEFAULT_IMPL(DS_TableFreeEntry);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compile packet routing plan for one filter table entry          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_TableCompileRoute(int32 FilterIndex)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_TableCompileRoute), FilterIndex);
+    UT_DEFAULT_IMPL(DS_TableCompileRoute);
+}
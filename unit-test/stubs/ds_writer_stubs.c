@@ -0,0 +1,161 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,917-1, and identified as “CFS Data Storage
+ * (DS) application version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  Unit testing stubs for the ds_writer.c file.
+ */
+
+#include "cfe.h"
+
+#include "ds_platform_cfg.h"
+#include "ds_verify.h"
+
+#include "ds_appdefs.h"
+
+#include "ds_app.h"
+#include "ds_file.h"
+#include "ds_writer.h"
+#include "ds_events.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Storage writer initialization                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_WriterInit(void)
+{
+    return UT_DEFAULT_IMPL(DS_WriterInit);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Storage writer child task entry point                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_WriterTask(void)
+{
+    UT_DEFAULT_IMPL(DS_WriterTask);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Add a record to the storage writer ring (DS main task only)     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_WriterEnqueue(const DS_WriterRecord_t *Record, const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_WriterEnqueue), Record);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_WriterEnqueue), BufPtr);
+    return UT_DEFAULT_IMPL_RC(DS_WriterEnqueue, true);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Hand a record to the storage writer (DS main task only)         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_WriterSubmit(const DS_WriterRecord_t *Record, const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_WriterSubmit), Record);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_WriterSubmit), BufPtr);
+    return UT_DEFAULT_IMPL_RC(DS_WriterSubmit, true);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Process one storage writer record (writer lock held)            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_WriterProcess(const DS_WriterRecord_t *Record, const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_WriterProcess), Record);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(DS_WriterProcess), BufPtr);
+    UT_DEFAULT_IMPL(DS_WriterProcess);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Process the oldest record in the ring (writer lock held)        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_WriterProcessNext(void)
+{
+    UT_DEFAULT_IMPL(DS_WriterProcessNext);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Wait for the storage writer to empty the ring                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_WriterDrain(void)
+{
+    return UT_DEFAULT_IMPL_RC(DS_WriterDrain, true);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get current ring occupancy                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_WriterRingBytesUsed(void)
+{
+    return UT_DEFAULT_IMPL(DS_WriterRingBytesUsed);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Publish storage writer housekeeping snapshot                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_WriterPublishHk(void)
+{
+    UT_DEFAULT_IMPL(DS_WriterPublishHk);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Lock/unlock destination file state                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_WriterLock(void)
+{
+    UT_DEFAULT_IMPL(DS_WriterLock);
+}
+
+void DS_WriterUnlock(void)
+{
+    UT_DEFAULT_IMPL(DS_WriterUnlock);
+}
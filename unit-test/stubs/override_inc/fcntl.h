@@ -0,0 +1,40 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,917-1, and identified as “CFS Data Storage
+ * (DS) application version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   Coverage stub replacement for fcntl.h
+ */
+
+#ifndef OVERRIDE_FCNTL_H
+#define OVERRIDE_FCNTL_H
+
+#include "stub_fcntl.h"
+
+/* ----------------------------------------- */
+/* mappings for declarations in fcntl.h */
+/* ----------------------------------------- */
+
+#define O_WRONLY            stub_O_WRONLY
+#define O_DIRECT            stub_O_DIRECT
+#define FALLOC_FL_KEEP_SIZE stub_FALLOC_FL_KEEP_SIZE
+#define open                stub_open
+#define fallocate           stub_fallocate
+
+#endif
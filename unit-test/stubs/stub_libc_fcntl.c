@@ -0,0 +1,44 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,917-1, and identified as “CFS Data Storage
+ * (DS) application version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Coverage stub replacement for fcntl.h
+ */
+#include "utstubs.h"
+
+#include "stub_fcntl.h"
+
+int stub_open(const char *file, int oflag, ...)
+{
+    int32 Status;
+
+    Status = UT_DEFAULT_IMPL_RC(stub_open, 3);
+
+    return Status;
+}
+
+int stub_fallocate(int fd, int mode, long offset, long len)
+{
+    int32 Status;
+
+    Status = UT_DEFAULT_IMPL(stub_fallocate);
+
+    return Status;
+}
@@ -0,0 +1,62 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,917-1, and identified as “CFS Data Storage
+ * (DS) application version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Coverage stub replacement for unistd.h
+ */
+#include "utstubs.h"
+
+#include "stub_unistd.h"
+
+int stub_close(int fd)
+{
+    int32 Status;
+
+    Status = UT_DEFAULT_IMPL(stub_close);
+
+    return Status;
+}
+
+int stub_truncate(const char *file, long length)
+{
+    int32 Status;
+
+    Status = UT_DEFAULT_IMPL(stub_truncate);
+
+    return Status;
+}
+
+int stub_fsync(int fd)
+{
+    int32 Status;
+
+    Status = UT_DEFAULT_IMPL(stub_fsync);
+
+    return Status;
+}
+
+long stub_pwrite(int fd, const void *buf, unsigned long n, long offset)
+{
+    int32 Status;
+
+    Status = UT_DEFAULT_IMPL_RC(stub_pwrite, n);
+
+    return Status;
+}
@@ -0,0 +1,39 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,917-1, and identified as “CFS Data Storage
+ * (DS) application version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   Coverage stub replacement for unistd.h
+ */
+
+#ifndef STUB_UNISTD_H
+#define STUB_UNISTD_H
+
+#include "stub_basetypes.h"
+
+/* ----------------------------------------- */
+/* prototypes normally declared in unistd.h */
+/* ----------------------------------------- */
+
+extern int stub_close(int fd);
+extern int stub_fsync(int fd);
+extern long stub_pwrite(int fd, const void *buf, unsigned long n, long offset);
+extern int stub_truncate(const char *file, long length);
+
+#endif